@@ -0,0 +1,56 @@
+#ifndef CHAOS_BENCH_H
+#define CHAOS_BENCH_H
+
+#include <stdio.h>
+#include <time.h>
+
+/* -------------------------------------------------------------------------- */
+/* Bench helpers                                                               */
+/* -------------------------------------------------------------------------- */
+
+/* Monotonic wall clock in nanoseconds */
+static inline double bench_now_ns(void)
+{
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((double)ts.tv_sec * 1e9) + (double)ts.tv_nsec;
+}
+
+/* Keeps the optimiser from discarding a benchmarked result */
+static inline void bench_sink(const volatile void *p)
+{
+    (void)p;
+}
+
+/*
+ * Times `body` repeated `iters` times and prints the per-call cost and the
+ * throughput over `bytes` bytes per call (pass 0 to omit throughput).
+ */
+#define BENCH_RUN(label, iters, bytes, body)                                        \
+    do                                                                              \
+    {                                                                               \
+        unsigned long bench_i_;                                                     \
+        double bench_t0_;                                                           \
+        double bench_ns_;                                                           \
+        for (bench_i_ = 0UL; bench_i_ < ((iters) / 16UL) + 1UL; bench_i_++)         \
+        {                                                                           \
+            body;                                                                   \
+        }                                                                           \
+        bench_t0_ = bench_now_ns();                                                 \
+        for (bench_i_ = 0UL; bench_i_ < (iters); bench_i_++)                        \
+        {                                                                           \
+            body;                                                                   \
+        }                                                                           \
+        bench_ns_ = (bench_now_ns() - bench_t0_) / (double)(iters);                 \
+        if ((bytes) != 0UL)                                                         \
+        {                                                                           \
+            printf("  %-36s %10.1f ns/call %10.1f MB/s\n", (label), bench_ns_,      \
+                   ((double)(bytes) * 1e3) / bench_ns_);                            \
+        }                                                                           \
+        else                                                                        \
+        {                                                                           \
+            printf("  %-36s %10.1f ns/call\n", (label), bench_ns_);                 \
+        }                                                                           \
+    } while (0)
+
+#endif /* CHAOS_BENCH_H */
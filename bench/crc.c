@@ -0,0 +1,47 @@
+#include "chaos_checksum.h"
+#include "chaos_memory.h"
+
+#include "chaos_bench.h"
+
+/* -------------------------------------------------------------------------- */
+/* CRC: separate memcpy + CRC versus fused chaos_memcpy_crc                    */
+/* -------------------------------------------------------------------------- */
+
+#define BENCH_MAX (64U * 1024U)
+
+static chaos_u8_t g_src[BENCH_MAX];
+static chaos_u8_t g_dst[BENCH_MAX];
+
+static void bench_size(chaos_size_t size, unsigned long iters)
+{
+    chaos_u32_t crc = 0U;
+
+    printf("size %lu bytes\n", (unsigned long)size);
+    BENCH_RUN("crc32", iters, size, (void)chaos_crc32(g_src, size, &crc));
+    BENCH_RUN("crc32c", iters, size, (void)chaos_crc32c(g_src, size, &crc));
+    BENCH_RUN("memcpy + crc32 (separate)", iters, size,
+              ((void)chaos_memcpy(g_dst, g_src, size), (void)chaos_crc32(g_dst, size, &crc)));
+    BENCH_RUN("memcpy_crc CRC_32 (fused)", iters, size,
+              (void)chaos_memcpy_crc(g_dst, g_src, size, CHAOS_CRC_32, &crc));
+    BENCH_RUN("memcpy + crc32c (separate)", iters, size,
+              ((void)chaos_memcpy(g_dst, g_src, size), (void)chaos_crc32c(g_dst, size, &crc)));
+    BENCH_RUN("memcpy_crc CRC_32C (fused)", iters, size,
+              (void)chaos_memcpy_crc(g_dst, g_src, size, CHAOS_CRC_32C, &crc));
+    bench_sink(&crc);
+}
+
+int main(void)
+{
+    chaos_size_t i;
+
+    for (i = 0U; i < BENCH_MAX; i++)
+    {
+        g_src[i] = (chaos_u8_t)((i * 131U) ^ (i >> 7U));
+    }
+
+    bench_size(64U, 2000000UL);
+    bench_size(1024U, 400000UL);
+    bench_size(BENCH_MAX, 8000UL);
+
+    return 0;
+}
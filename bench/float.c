@@ -0,0 +1,120 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "chaos_std.h"
+
+#include "chaos_bench.h"
+
+/* -------------------------------------------------------------------------- */
+/* Floating-point text: snprintf/strtod vs chaos_f64_to_str/chaos_strtof64      */
+/* -------------------------------------------------------------------------- */
+
+#define VALUES 4096U
+
+static chaos_f64_t g_values[VALUES];
+static chaos_f64_t g_parsed[VALUES];
+static chaos_size_t g_offset[VALUES + 1U];
+static char g_text[VALUES * 32U];
+static char g_out[VALUES * 32U];
+
+/* Half telemetry-like readings (a few decimals), half arbitrary bit patterns */
+static chaos_f64_t random_value(chaos_size_t i)
+{
+    chaos_u64_t u = ((chaos_u64_t)rand() << 42U) ^ ((chaos_u64_t)rand() << 21U) ^ (chaos_u64_t)rand();
+    chaos_f64_t d;
+
+    if ((i & 1U) == 0U)
+    {
+        d = (chaos_f64_t)(rand() % 1000000) / 1000.0;
+    }
+    else
+    {
+        u = (u & 0x800FFFFFFFFFFFFFULL) | ((chaos_u64_t)(0x300U + ((unsigned)rand() % 0x200U)) << 52U);
+        memcpy(&d, &u, sizeof(d));
+    }
+    return d;
+}
+
+static chaos_size_t fmt_snprintf(void)
+{
+    chaos_size_t used = 0U;
+    chaos_size_t i;
+
+    for (i = 0U; i < VALUES; i++)
+    {
+        used += (chaos_size_t)snprintf(&g_out[used], 32U, "%.17g", g_values[i]) + 1U;
+    }
+    return used;
+}
+
+static chaos_size_t fmt_chaos(void)
+{
+    chaos_size_t used = 0U;
+    chaos_size_t len = 0U;
+    chaos_size_t i;
+
+    for (i = 0U; i < VALUES; i++)
+    {
+        (void)chaos_f64_to_str(g_values[i], (chaos_char_t *)&g_out[used], 32U, &len);
+        used += len + 1U;
+    }
+    return used;
+}
+
+static chaos_size_t parse_strtod(void)
+{
+    chaos_size_t i;
+
+    for (i = 0U; i < VALUES; i++)
+    {
+        g_parsed[i] = strtod(&g_text[g_offset[i]], NULL);
+    }
+    return (chaos_size_t)(g_parsed[VALUES - 1U] != 0.0);
+}
+
+static chaos_size_t parse_chaos(void)
+{
+    chaos_size_t i;
+
+    for (i = 0U; i < VALUES; i++)
+    {
+        (void)chaos_strtof64((const chaos_char_t *)&g_text[g_offset[i]], g_offset[i + 1U] - g_offset[i] - 1U, &g_parsed[i], CHAOS_NULL);
+    }
+    return (chaos_size_t)(g_parsed[VALUES - 1U] != 0.0);
+}
+
+int main(void)
+{
+    volatile chaos_size_t sink = 0U;
+    chaos_size_t used = 0U;
+    chaos_size_t len = 0U;
+    chaos_size_t i;
+    chaos_size_t same = 0U;
+
+    srand(1);
+    for (i = 0U; i < VALUES; i++)
+    {
+        g_values[i] = random_value(i);
+        g_offset[i] = used;
+        (void)chaos_f64_to_str(g_values[i], (chaos_char_t *)&g_text[used], 32U, &len);
+        used += len + 1U;
+    }
+    g_offset[VALUES] = used;
+
+    (void)parse_chaos();
+    for (i = 0U; i < VALUES; i++)
+    {
+        same += (memcmp(&g_parsed[i], &g_values[i], sizeof(chaos_f64_t)) == 0) ? 1U : 0U;
+    }
+    printf("%u values per run, %u read back exactly; %u bytes shortest vs %u bytes %%.17g\n",
+           VALUES, (unsigned)same, (unsigned)fmt_chaos(), (unsigned)fmt_snprintf());
+
+    BENCH_RUN("snprintf %.17g", 300UL, 0UL, sink = fmt_snprintf());
+    BENCH_RUN("chaos_f64_to_str", 300UL, 0UL, sink = fmt_chaos());
+    BENCH_RUN("strtod", 300UL, 0UL, sink = parse_strtod());
+    BENCH_RUN("chaos_strtof64", 300UL, 0UL, sink = parse_chaos());
+    bench_sink(&sink);
+
+    return 0;
+}
@@ -0,0 +1,158 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "chaos_std.h"
+
+#include "chaos_bench.h"
+
+/* -------------------------------------------------------------------------- */
+/* Integer formatting: snprintf vs chaos_*_to_str                               */
+/* -------------------------------------------------------------------------- */
+
+#define VALUES 4096U
+
+static chaos_u32_t g_u32[VALUES];
+static chaos_u64_t g_u64[VALUES];
+static chaos_i64_t g_i64[VALUES];
+static char g_out[VALUES * 24U];
+
+/* Random value with a uniformly chosen bit length, as counters and sizes are */
+static chaos_u64_t random_value(unsigned max_bits)
+{
+    chaos_u64_t v = ((chaos_u64_t)rand() << 33U) ^ ((chaos_u64_t)rand() << 12U) ^ (chaos_u64_t)rand();
+    unsigned bits = 1U + ((unsigned)rand() % max_bits);
+
+    return (bits == 64U) ? v : (v & ((1ULL << bits) - 1ULL));
+}
+
+static chaos_size_t fmt_snprintf_u32(void)
+{
+    chaos_size_t used = 0U;
+    chaos_size_t i;
+
+    for (i = 0U; i < VALUES; i++)
+    {
+        used += (chaos_size_t)snprintf(&g_out[used], 24U, "%u", (unsigned)g_u32[i]) + 1U;
+    }
+    return used;
+}
+
+static chaos_size_t fmt_chaos_u32(void)
+{
+    chaos_size_t used = 0U;
+    chaos_size_t len = 0U;
+    chaos_size_t i;
+
+    for (i = 0U; i < VALUES; i++)
+    {
+        (void)chaos_u32_to_str(g_u32[i], (chaos_char_t *)&g_out[used], 24U, &len);
+        used += len + 1U;
+    }
+    return used;
+}
+
+static chaos_size_t fmt_snprintf_u64(void)
+{
+    chaos_size_t used = 0U;
+    chaos_size_t i;
+
+    for (i = 0U; i < VALUES; i++)
+    {
+        used += (chaos_size_t)snprintf(&g_out[used], 24U, "%llu", (unsigned long long)g_u64[i]) + 1U;
+    }
+    return used;
+}
+
+static chaos_size_t fmt_chaos_u64(void)
+{
+    chaos_size_t used = 0U;
+    chaos_size_t len = 0U;
+    chaos_size_t i;
+
+    for (i = 0U; i < VALUES; i++)
+    {
+        (void)chaos_u64_to_str(g_u64[i], (chaos_char_t *)&g_out[used], 24U, &len);
+        used += len + 1U;
+    }
+    return used;
+}
+
+static chaos_size_t fmt_snprintf_i64(void)
+{
+    chaos_size_t used = 0U;
+    chaos_size_t i;
+
+    for (i = 0U; i < VALUES; i++)
+    {
+        used += (chaos_size_t)snprintf(&g_out[used], 24U, "%lld", (long long)g_i64[i]) + 1U;
+    }
+    return used;
+}
+
+static chaos_size_t fmt_chaos_i64(void)
+{
+    chaos_size_t used = 0U;
+    chaos_size_t len = 0U;
+    chaos_size_t i;
+
+    for (i = 0U; i < VALUES; i++)
+    {
+        (void)chaos_i64_to_str(g_i64[i], (chaos_char_t *)&g_out[used], 24U, &len);
+        used += len + 1U;
+    }
+    return used;
+}
+
+static chaos_size_t fmt_snprintf_hex(void)
+{
+    chaos_size_t used = 0U;
+    chaos_size_t i;
+
+    for (i = 0U; i < VALUES; i++)
+    {
+        used += (chaos_size_t)snprintf(&g_out[used], 24U, "%llx", (unsigned long long)g_u64[i]) + 1U;
+    }
+    return used;
+}
+
+static chaos_size_t fmt_chaos_hex(void)
+{
+    chaos_size_t used = 0U;
+    chaos_size_t len = 0U;
+    chaos_size_t i;
+
+    for (i = 0U; i < VALUES; i++)
+    {
+        (void)chaos_u64_to_hex(g_u64[i], (chaos_char_t *)&g_out[used], 24U, &len);
+        used += len + 1U;
+    }
+    return used;
+}
+
+int main(void)
+{
+    volatile chaos_size_t sink = 0U;
+    chaos_size_t i;
+
+    srand(1);
+    for (i = 0U; i < VALUES; i++)
+    {
+        g_u32[i] = (chaos_u32_t)random_value(32U);
+        g_u64[i] = random_value(64U);
+        g_i64[i] = (chaos_i64_t)random_value(63U) * (((rand() % 4) == 0) ? -1 : 1);
+    }
+
+    printf("%u values per run, %s output\n", VALUES, (fmt_snprintf_i64() == fmt_chaos_i64()) ? "same size" : "DIFFERENT");
+
+    BENCH_RUN("snprintf %u", 1000UL, 0UL, sink = fmt_snprintf_u32());
+    BENCH_RUN("chaos_u32_to_str", 1000UL, 0UL, sink = fmt_chaos_u32());
+    BENCH_RUN("snprintf %llu", 1000UL, 0UL, sink = fmt_snprintf_u64());
+    BENCH_RUN("chaos_u64_to_str", 1000UL, 0UL, sink = fmt_chaos_u64());
+    BENCH_RUN("snprintf %lld", 1000UL, 0UL, sink = fmt_snprintf_i64());
+    BENCH_RUN("chaos_i64_to_str", 1000UL, 0UL, sink = fmt_chaos_i64());
+    BENCH_RUN("snprintf %llx", 1000UL, 0UL, sink = fmt_snprintf_hex());
+    BENCH_RUN("chaos_u64_to_hex", 1000UL, 0UL, sink = fmt_chaos_hex());
+    bench_sink(&sink);
+
+    return 0;
+}
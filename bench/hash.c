@@ -0,0 +1,89 @@
+#include "chaos_hash.h"
+
+#include "chaos_bench.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAS_TSC 1
+#else
+#define BENCH_HAS_TSC 0
+#endif
+
+/* -------------------------------------------------------------------------- */
+/* Hash throughput: chaos_hash64 vs the byte-loop FNV-1a it replaces            */
+/* -------------------------------------------------------------------------- */
+
+#define MAX_SIZE (64U * 1024U)
+
+static chaos_u8_t g_buf[MAX_SIZE];
+
+static chaos_u64_t fnv1a64(const chaos_u8_t *p, chaos_size_t size)
+{
+    chaos_u64_t h = 0xCBF29CE484222325ULL;
+    chaos_size_t i;
+
+    for (i = 0U; i < size; i++)
+    {
+        h ^= p[i];
+        h *= 0x00000100000001B3ULL;
+    }
+    return h;
+}
+
+/* Bytes per TSC tick (TSC runs at the nominal clock on current x86) */
+static double bytes_per_tick(chaos_size_t size, unsigned long iters)
+{
+#if (BENCH_HAS_TSC == 1)
+    volatile chaos_u64_t h = 0U;
+    chaos_u64_t out = 0U;
+    unsigned long long t0;
+    unsigned long i;
+
+    t0 = __rdtsc();
+    for (i = 0UL; i < iters; i++)
+    {
+        (void)chaos_hash64(g_buf, size, (chaos_u64_t)i, &out);
+        h = out;
+    }
+    (void)h;
+    return ((double)size * (double)iters) / (double)(__rdtsc() - t0);
+#else
+    (void)size;
+    (void)iters;
+    return 0.0;
+#endif
+}
+
+static void bench_size(chaos_size_t size, unsigned long iters)
+{
+    volatile chaos_u64_t h = 0U;
+    chaos_u64_t out = 0U;
+    char label[48];
+
+    (void)snprintf(label, sizeof(label), "fnv1a   %6lu B", (unsigned long)size);
+    BENCH_RUN(label, iters, size, h = fnv1a64(g_buf, size));
+    (void)snprintf(label, sizeof(label), "hash64  %6lu B", (unsigned long)size);
+    BENCH_RUN(label, iters, size, { (void)chaos_hash64(g_buf, size, 0U, &out); h = out; });
+    printf("  %-36s %10.2f B/cycle\n", "", bytes_per_tick(size, iters));
+    bench_sink(&h);
+}
+
+int main(void)
+{
+    chaos_size_t i;
+
+    for (i = 0U; i < MAX_SIZE; i++)
+    {
+        g_buf[i] = (chaos_u8_t)(i * 131U);
+    }
+
+    bench_size(8U, 20000000UL);
+    bench_size(16U, 20000000UL);
+    bench_size(32U, 10000000UL);
+    bench_size(64U, 10000000UL);
+    bench_size(256U, 2000000UL);
+    bench_size(4096U, 200000UL);
+    bench_size(MAX_SIZE, 10000UL);
+
+    return 0;
+}
@@ -0,0 +1,109 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "chaos_hashmap.h"
+
+#include "chaos_bench.h"
+
+/* -------------------------------------------------------------------------- */
+/* Hash map: insert, lookup hit, lookup miss and erase, by table size          */
+/* -------------------------------------------------------------------------- */
+
+#define MAX_N  (512U * 1024U)
+#define BATCH  1024U
+#define QUERIES (64U * 1024U)
+
+static chaos_u64_t g_keys[MAX_N];
+static chaos_u64_t g_misses[QUERIES];
+static chaos_u32_t g_order[QUERIES];
+static chaos_u8_t g_region[(1024U * 1024U * 21U) + 64U];
+
+static chaos_u64_t next_key(void)
+{
+    return ((chaos_u64_t)rand() << 40U) ^ ((chaos_u64_t)rand() << 20U) ^ (chaos_u64_t)rand();
+}
+
+static void bench_size(chaos_size_t n)
+{
+    volatile chaos_u64_t h = 0U;
+    unsigned long iters = (unsigned long)((4U * MAX_N) / n);
+    unsigned long batches = (unsigned long)((64U * MAX_N) / BATCH);
+    chaos_hashmap_t map;
+    chaos_size_t slots = 16U;
+    chaos_size_t size = 0U;
+    chaos_size_t q = 0U;
+    chaos_size_t i;
+    chaos_u64_t v;
+    void *value = CHAOS_NULL;
+    chaos_bool_t found = CHAOS_FALSE;
+
+    /* Smallest power of two that keeps the load at or under 7/8 */
+    while ((slots - (slots / 8U)) < n)
+    {
+        slots *= 2U;
+    }
+    (void)chaos_hashmap_region_size(8U, 8U, slots, &size);
+    (void)chaos_hashmap_init(&map, 8U, 8U, slots, g_region, size);
+
+    for (i = 0U; i < n; i++)
+    {
+        g_keys[i] = next_key() | 1U;
+    }
+    for (i = 0U; i < QUERIES; i++)
+    {
+        /* Stored keys are odd, so even ones always miss */
+        g_misses[i] = next_key() & ~(chaos_u64_t)1U;
+        g_order[i] = (chaos_u32_t)((chaos_size_t)rand() % n);
+    }
+
+    printf("%lu keys, %lu slots (u64 -> u64)\n", (unsigned long)n, (unsigned long)slots);
+    BENCH_RUN("insert all (clear + put)", iters, 0UL, {
+        (void)chaos_hashmap_clear(&map);
+        for (i = 0U; i < n; i++)
+        {
+            (void)chaos_hashmap_put(&map, &g_keys[i], &g_keys[i]);
+        }
+        h = map.count;
+    });
+    BENCH_RUN("lookup hit x1024", batches, 0UL, {
+        for (i = 0U; i < BATCH; i++)
+        {
+            (void)chaos_hashmap_find(&map, &g_keys[g_order[(q + i) % QUERIES]], &value, &found);
+            h += *(chaos_u64_t *)value;
+        }
+        q = (q + BATCH) % QUERIES;
+    });
+    BENCH_RUN("lookup miss x1024", batches, 0UL, {
+        for (i = 0U; i < BATCH; i++)
+        {
+            (void)chaos_hashmap_find(&map, &g_misses[(q + i) % QUERIES], &value, &found);
+            h += (chaos_u64_t)found;
+        }
+        q = (q + BATCH) % QUERIES;
+    });
+    BENCH_RUN("erase + put back x1024", batches, 0UL, {
+        for (i = 0U; i < BATCH; i++)
+        {
+            v = g_keys[g_order[(q + i) % QUERIES]];
+            (void)chaos_hashmap_erase(&map, &v, &found);
+            (void)chaos_hashmap_put(&map, &v, &v);
+        }
+        q = (q + BATCH) % QUERIES;
+        h += map.count;
+    });
+    bench_sink(&h);
+}
+
+int main(void)
+{
+    static const chaos_size_t sizes[] = { 1024U, 65536U, MAX_N };
+    chaos_size_t i;
+
+    srand(1U);
+    for (i = 0U; i < (sizeof(sizes) / sizeof(sizes[0])); i++)
+    {
+        bench_size(sizes[i]);
+    }
+
+    return 0;
+}
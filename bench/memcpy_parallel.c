@@ -0,0 +1,62 @@
+#include <stdlib.h>
+
+#include "chaos_memory.h"
+
+#include "chaos_bench.h"
+
+/* -------------------------------------------------------------------------- */
+/* Parallel copy/fill bandwidth scaling by thread count                        */
+/* -------------------------------------------------------------------------- */
+
+/*
+ * Build the library and this bench with CHAOS_ENABLE_THREADS=1, otherwise
+ * every row runs on the calling thread:
+ *   make all CHAOS_ENABLE_THREADS=1 && make -C bench memcpy_parallel CHAOS_ENABLE_THREADS=1
+ * The 2 MiB rows, just over the threshold, show the cost of waking the pool.
+ */
+
+#define BENCH_SIZE (64U * 1024U * 1024U)
+
+int main(void)
+{
+    const chaos_size_t threads[] = {1U, 2U, 4U, 8U, 16U};
+    const chaos_size_t sizes[] = {2U * 1024U * 1024U, BENCH_SIZE};
+    chaos_u8_t *src = (chaos_u8_t *)malloc(BENCH_SIZE);
+    chaos_u8_t *dst = (chaos_u8_t *)malloc(BENCH_SIZE);
+    char label[48];
+    unsigned long iters;
+    chaos_size_t s;
+    chaos_size_t t;
+
+    if ((src == NULL) || (dst == NULL))
+    {
+        printf("out of memory\n");
+        free(src);
+        free(dst);
+        return 1;
+    }
+
+    (void)chaos_memset(src, 0x3CU, BENCH_SIZE);
+    (void)chaos_memset(dst, 0x00U, BENCH_SIZE);
+
+    for (s = 0U; s < (sizeof(sizes) / sizeof(sizes[0])); s++)
+    {
+        iters = (unsigned long)((8U * BENCH_SIZE) / sizes[s]);
+        printf("size %lu MiB\n", (unsigned long)(sizes[s] >> 20U));
+        for (t = 0U; t < (sizeof(threads) / sizeof(threads[0])); t++)
+        {
+            (void)snprintf(label, sizeof(label), "memcpy_parallel %2lu thread(s)", (unsigned long)threads[t]);
+            BENCH_RUN(label, iters, sizes[s], (void)chaos_memcpy_parallel(dst, src, sizes[s], threads[t]));
+        }
+        for (t = 0U; t < (sizeof(threads) / sizeof(threads[0])); t++)
+        {
+            (void)snprintf(label, sizeof(label), "memset_parallel %2lu thread(s)", (unsigned long)threads[t]);
+            BENCH_RUN(label, iters, sizes[s], (void)chaos_memset_parallel(dst, 0xA5U, sizes[s], threads[t]));
+        }
+    }
+    bench_sink(dst);
+
+    free(src);
+    free(dst);
+    return 0;
+}
@@ -0,0 +1,140 @@
+#include <stdlib.h>
+
+#include "chaos_std.h"
+
+#include "chaos_bench.h"
+
+/* -------------------------------------------------------------------------- */
+/* CSV integer fields: glibc strtol/strtoll vs chaos_strtoi32/chaos_strtoi64    */
+/* -------------------------------------------------------------------------- */
+
+#define FIELDS   4096U
+#define CSV_SIZE (FIELDS * 22U)
+
+typedef struct
+{
+    char text[CSV_SIZE];
+    chaos_size_t size;
+} csv_t;
+
+static csv_t g_short;
+static csv_t g_mixed;
+static csv_t g_wide;
+
+/* Fields of min_digits..max_digits digits, a quarter negative, comma separated */
+static void fill(csv_t *csv, unsigned min_digits, unsigned max_digits)
+{
+    chaos_size_t len = 0U;
+    unsigned f;
+    unsigned d;
+    unsigned digits;
+
+    for (f = 0U; f < FIELDS; f++)
+    {
+        digits = min_digits + ((unsigned)rand() % (max_digits - min_digits + 1U));
+        if ((rand() % 4) == 0)
+        {
+            csv->text[len++] = '-';
+        }
+        csv->text[len++] = (char)('1' + (rand() % 9));
+        for (d = 1U; d < digits; d++)
+        {
+            csv->text[len++] = (char)('0' + (rand() % 10));
+        }
+        csv->text[len++] = ',';
+    }
+    csv->text[len - 1U] = '\n';
+    csv->size = len;
+}
+
+static long long sum_strtol(const csv_t *csv)
+{
+    const char *p = csv->text;
+    const char *end = csv->text + csv->size;
+    char *next;
+    long long sum = 0;
+
+    while (p < end)
+    {
+        sum += strtol(p, &next, 10);
+        p = next + 1;
+    }
+    return sum;
+}
+
+static long long sum_strtoll(const csv_t *csv)
+{
+    const char *p = csv->text;
+    const char *end = csv->text + csv->size;
+    char *next;
+    long long sum = 0;
+
+    while (p < end)
+    {
+        sum += strtoll(p, &next, 10);
+        p = next + 1;
+    }
+    return sum;
+}
+
+static long long sum_chaos_i32(const csv_t *csv)
+{
+    const chaos_char_t *p = (const chaos_char_t *)csv->text;
+    chaos_size_t left = csv->size;
+    chaos_size_t used = 0U;
+    chaos_i32_t v = 0;
+    long long sum = 0;
+
+    while (left != 0U)
+    {
+        (void)chaos_strtoi32(p, left, &v, &used);
+        sum += v;
+        p += used + 1U;
+        left -= used + 1U;
+    }
+    return sum;
+}
+
+static long long sum_chaos_i64(const csv_t *csv)
+{
+    const chaos_char_t *p = (const chaos_char_t *)csv->text;
+    chaos_size_t left = csv->size;
+    chaos_size_t used = 0U;
+    chaos_i64_t v = 0;
+    long long sum = 0;
+
+    while (left != 0U)
+    {
+        (void)chaos_strtoi64(p, left, &v, &used);
+        sum += v;
+        p += used + 1U;
+        left -= used + 1U;
+    }
+    return sum;
+}
+
+int main(void)
+{
+    volatile long long sink = 0;
+    long long a;
+    long long b;
+
+    srand(1);
+    fill(&g_short, 1U, 4U);
+    fill(&g_mixed, 1U, 9U);
+    fill(&g_wide, 12U, 18U);
+
+    a = sum_strtol(&g_mixed);
+    b = sum_chaos_i32(&g_mixed);
+    printf("%u fields per run, sums %s\n", FIELDS, (a == b) ? "match" : "DIFFER");
+
+    BENCH_RUN("strtol         1-4 digits", 2000UL, g_short.size, sink = sum_strtol(&g_short));
+    BENCH_RUN("chaos_strtoi32 1-4 digits", 2000UL, g_short.size, sink = sum_chaos_i32(&g_short));
+    BENCH_RUN("strtol         1-9 digits", 2000UL, g_mixed.size, sink = sum_strtol(&g_mixed));
+    BENCH_RUN("chaos_strtoi32 1-9 digits", 2000UL, g_mixed.size, sink = sum_chaos_i32(&g_mixed));
+    BENCH_RUN("strtoll        12-18 digits", 2000UL, g_wide.size, sink = sum_strtoll(&g_wide));
+    BENCH_RUN("chaos_strtoi64 12-18 digits", 2000UL, g_wide.size, sink = sum_chaos_i64(&g_wide));
+    bench_sink(&sink);
+
+    return 0;
+}
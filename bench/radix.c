@@ -0,0 +1,66 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "chaos_sort.h"
+
+#include "chaos_bench.h"
+
+/* -------------------------------------------------------------------------- */
+/* Radix sort vs the comparison sorts, by array size                            */
+/* -------------------------------------------------------------------------- */
+
+#define MAX_N (1024U * 1024U)
+
+static chaos_u32_t g_src32[MAX_N];
+static chaos_u32_t g_work32[MAX_N];
+static chaos_u64_t g_src64[MAX_N];
+static chaos_u64_t g_work64[MAX_N];
+static chaos_u32_t g_index[MAX_N];
+static chaos_sort_kv64_t g_pairs[MAX_N];
+static chaos_u8_t g_scratch[(MAX_N * 12U) + 65536U];
+
+static void bench_size(chaos_size_t n)
+{
+    volatile chaos_u64_t h = 0U;
+    unsigned long iters = (unsigned long)((4U * MAX_N) / n);
+    chaos_size_t i;
+
+    for (i = 0U; i < n; i++)
+    {
+        g_src32[i] = ((chaos_u32_t)rand() << 16U) ^ (chaos_u32_t)rand();
+        /* Microsecond timestamps over about ten minutes */
+        g_src64[i] = 1700000000000000ULL + (((chaos_u64_t)rand() << 15U) ^ (chaos_u64_t)rand()) % 600000000ULL;
+    }
+
+    printf("%lu keys (copy included)\n", (unsigned long)n);
+    BENCH_RUN("u32 chaos_sort_u32", iters, 0UL, { memcpy(g_work32, g_src32, n * 4U); (void)chaos_sort_u32(g_work32, n); h = g_work32[n / 2U]; });
+    BENCH_RUN("u32 chaos_radix_sort_u32", iters, 0UL, { memcpy(g_work32, g_src32, n * 4U); (void)chaos_radix_sort_u32(g_work32, NULL, n, g_scratch, sizeof(g_scratch)); h = g_work32[n / 2U]; });
+    BENCH_RUN("u64 chaos_sort_u64", iters, 0UL, { memcpy(g_work64, g_src64, n * 8U); (void)chaos_sort_u64(g_work64, n); h = g_work64[n / 2U]; });
+    BENCH_RUN("u64 chaos_radix_sort_u64", iters, 0UL, { memcpy(g_work64, g_src64, n * 8U); (void)chaos_radix_sort_u64(g_work64, NULL, n, g_scratch, sizeof(g_scratch)); h = g_work64[n / 2U]; });
+    BENCH_RUN("u64+index chaos_sort_kv64", iters, 0UL, {
+        for (i = 0U; i < n; i++) { g_pairs[i].key = g_src64[i]; g_pairs[i].value = i; }
+        (void)chaos_sort_kv64(g_pairs, n);
+        h = g_pairs[n / 2U].value;
+    });
+    BENCH_RUN("u64+index chaos_radix_sort_u64", iters, 0UL, {
+        for (i = 0U; i < n; i++) { g_work64[i] = g_src64[i]; g_index[i] = i; }
+        (void)chaos_radix_sort_u64(g_work64, g_index, n, g_scratch, sizeof(g_scratch));
+        h = g_index[n / 2U];
+    });
+    bench_sink(&h);
+}
+
+int main(void)
+{
+    static const chaos_size_t sizes[] = { 64U, 256U, 4096U, 65536U, MAX_N };
+    chaos_size_t i;
+
+    srand(1U);
+    for (i = 0U; i < (sizeof(sizes) / sizeof(sizes[0])); i++)
+    {
+        bench_size(sizes[i]);
+    }
+
+    return 0;
+}
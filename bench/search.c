@@ -0,0 +1,79 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "chaos_search.h"
+
+#include "chaos_bench.h"
+
+/* -------------------------------------------------------------------------- */
+/* Sorted-table search: classic binary search vs branchless vs Eytzinger        */
+/* -------------------------------------------------------------------------- */
+
+#define MAX_N   (4U * 1024U * 1024U)
+#define QUERIES (1024U * 1024U)
+
+static chaos_u32_t g_sorted[MAX_N];
+/* Aligned so that the 16 nodes four levels below any node share a cache line */
+static chaos_u32_t g_tree[MAX_N + 1U] __attribute__((aligned(64)));
+static chaos_u32_t g_query[QUERIES];
+
+/* The branchy search the calibration code used */
+static chaos_size_t classic_lower_bound(const chaos_u32_t *a, chaos_size_t n, chaos_u32_t key)
+{
+    chaos_size_t lo = 0U;
+    chaos_size_t hi = n;
+    chaos_size_t mid;
+
+    while (lo < hi)
+    {
+        mid = lo + ((hi - lo) / 2U);
+        if (a[mid] < key)
+        {
+            lo = mid + 1U;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+static void bench_size(chaos_size_t n)
+{
+    volatile chaos_size_t h = 0U;
+    chaos_size_t out = 0U;
+    chaos_size_t q = 0U;
+    chaos_size_t i;
+
+    for (i = 0U; i < n; i++)
+    {
+        g_sorted[i] = 3U * i;
+    }
+    (void)chaos_eytzinger_build(g_sorted, n, sizeof(g_sorted[0]), g_tree);
+    for (i = 0U; i < QUERIES; i++)
+    {
+        g_query[i] = ((chaos_u32_t)rand() ^ ((chaos_u32_t)rand() << 16U)) % (3U * n);
+    }
+
+    printf("%lu elements (%lu KiB)\n", (unsigned long)n, (unsigned long)((n * 4U) / 1024U));
+    BENCH_RUN("classic binary search", QUERIES, 0UL, { h = classic_lower_bound(g_sorted, n, g_query[q]); q = (q + 1U) % QUERIES; });
+    BENCH_RUN("chaos_lower_bound_u32", QUERIES, 0UL, { (void)chaos_lower_bound_u32(g_sorted, n, g_query[q], &out); h = out; q = (q + 1U) % QUERIES; });
+    BENCH_RUN("chaos_eytzinger_lower_bound_u32", QUERIES, 0UL, { (void)chaos_eytzinger_lower_bound_u32(g_tree, n, g_query[q], &out); h = out; q = (q + 1U) % QUERIES; });
+    bench_sink(&h);
+}
+
+int main(void)
+{
+    static const chaos_size_t sizes[] = { 1024U, 65536U, 1024U * 1024U, MAX_N };
+    chaos_size_t i;
+
+    srand(1U);
+    for (i = 0U; i < (sizeof(sizes) / sizeof(sizes[0])); i++)
+    {
+        bench_size(sizes[i]);
+    }
+
+    return 0;
+}
@@ -0,0 +1,92 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "chaos_sort.h"
+
+#include "chaos_bench.h"
+
+/* -------------------------------------------------------------------------- */
+/* Sorting: qsort vs chaos_sort (callback) vs chaos_sort_u32 / chaos_sort_u64   */
+/* -------------------------------------------------------------------------- */
+
+#define MAX_N (1024U * 1024U)
+
+static chaos_u32_t g_src32[MAX_N];
+static chaos_u32_t g_work32[MAX_N];
+static chaos_u64_t g_src64[MAX_N];
+static chaos_u64_t g_work64[MAX_N];
+
+static int cmp_qsort(const void *a, const void *b)
+{
+    chaos_u32_t x = *(const chaos_u32_t *)a;
+    chaos_u32_t y = *(const chaos_u32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static chaos_i32_t cmp_chaos(void *ctx, const void *a, const void *b)
+{
+    chaos_u32_t x = *(const chaos_u32_t *)a;
+    chaos_u32_t y = *(const chaos_u32_t *)b;
+    (void)ctx;
+    return (x > y) - (x < y);
+}
+
+static void fill(chaos_size_t n, int pattern)
+{
+    chaos_size_t i;
+    chaos_u64_t r;
+
+    for (i = 0U; i < n; i++)
+    {
+        r = ((chaos_u64_t)rand() << 42U) ^ ((chaos_u64_t)rand() << 21U) ^ (chaos_u64_t)rand();
+        if (pattern == 1)
+        {
+            r = (i + 16U < n) ? i : r;
+        }
+        else if (pattern == 2)
+        {
+            r %= 16U;
+        }
+        else if (pattern == 3)
+        {
+            r = n - i;
+        }
+        g_src32[i] = (chaos_u32_t)r;
+        g_src64[i] = r;
+    }
+}
+
+static void bench_size(chaos_size_t n, int pattern, const char *name)
+{
+    volatile chaos_u32_t h = 0U;
+    unsigned long iters = (unsigned long)((4U * MAX_N) / n);
+
+    fill(n, pattern);
+    printf("%s, %lu keys (copy included)\n", name, (unsigned long)n);
+    BENCH_RUN("copy only", iters, 0UL, { memcpy(g_work32, g_src32, n * 4U); h = g_work32[n / 2U]; });
+    BENCH_RUN("qsort", iters, 0UL, { memcpy(g_work32, g_src32, n * 4U); qsort(g_work32, n, 4U, cmp_qsort); h = g_work32[n / 2U]; });
+    BENCH_RUN("chaos_sort (callback)", iters, 0UL, { memcpy(g_work32, g_src32, n * 4U); (void)chaos_sort(g_work32, n, 4U, cmp_chaos, NULL); h = g_work32[n / 2U]; });
+    BENCH_RUN("chaos_sort_u32", iters, 0UL, { memcpy(g_work32, g_src32, n * 4U); (void)chaos_sort_u32(g_work32, n); h = g_work32[n / 2U]; });
+#if (CHAOS_ENABLE_INT64 == 1)
+    BENCH_RUN("chaos_sort_u64", iters, 0UL, { memcpy(g_work64, g_src64, n * 8U); (void)chaos_sort_u64(g_work64, n); h = (chaos_u32_t)g_work64[n / 2U]; });
+#endif
+    bench_sink(&h);
+}
+
+int main(void)
+{
+    static const chaos_size_t sizes[] = { 16U, 256U, 4096U, 65536U, MAX_N };
+    chaos_size_t i;
+
+    srand(1U);
+    for (i = 0U; i < (sizeof(sizes) / sizeof(sizes[0])); i++)
+    {
+        bench_size(sizes[i], 0, "random");
+    }
+    bench_size(MAX_N, 1, "sorted with a random tail");
+    bench_size(MAX_N, 2, "16 distinct values");
+    bench_size(MAX_N, 3, "descending");
+
+    return 0;
+}
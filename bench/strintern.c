@@ -0,0 +1,128 @@
+#include <stdlib.h>
+
+#include "chaos_string.h"
+#include "chaos_strintern.h"
+
+#include "chaos_bench.h"
+
+/* -------------------------------------------------------------------------- */
+/* Parameter database: name lookup and name equality                           */
+/* -------------------------------------------------------------------------- */
+
+#define NAMES     2000U
+#define LOOKUPS   1024U
+#define NAME_SIZE 32U
+
+static chaos_char_t g_names[NAMES][NAME_SIZE];
+static chaos_strview_t g_views[NAMES];
+static chaos_strid_t g_ids[NAMES];
+static chaos_u32_t g_queries[LOOKUPS];
+static chaos_u8_t g_region[256U * 1024U];
+
+/* Read on every call so the compiler cannot fold repeated runs together */
+static volatile chaos_u32_t g_step = 1U;
+
+/* Baseline: walk the table comparing names */
+static chaos_size_t lookup_strcmp(void)
+{
+    chaos_size_t sum = 0U;
+    chaos_size_t q;
+    chaos_size_t i;
+    chaos_bool_t equal;
+
+    for (q = 0U; q < LOOKUPS; q++)
+    {
+        equal = CHAOS_FALSE;
+        for (i = 0U; (i < NAMES) && (equal == CHAOS_FALSE); i++)
+        {
+            (void)chaos_strcmp(g_names[i], g_names[g_queries[q]], &equal);
+        }
+        sum += i;
+    }
+    return sum;
+}
+
+static chaos_size_t lookup_intern(const chaos_strintern_t *t)
+{
+    chaos_size_t sum = 0U;
+    chaos_size_t q;
+    chaos_strid_t id = CHAOS_STRID_NONE;
+
+    for (q = 0U; q < LOOKUPS; q++)
+    {
+        (void)chaos_strintern_find(t, &g_views[g_queries[q]], &id);
+        sum += id;
+    }
+    return sum;
+}
+
+static chaos_size_t equal_strcmp(void)
+{
+    chaos_size_t sum = 0U;
+    chaos_size_t q;
+    chaos_u32_t step = g_step;
+    chaos_bool_t equal = CHAOS_FALSE;
+
+    for (q = 0U; q < LOOKUPS; q++)
+    {
+        (void)chaos_strcmp(g_names[g_queries[q]], g_names[g_queries[(q + step) % LOOKUPS]], &equal);
+        sum += (equal == CHAOS_TRUE) ? 1U : 0U;
+    }
+    return sum;
+}
+
+static chaos_size_t equal_id(void)
+{
+    chaos_size_t sum = 0U;
+    chaos_size_t q;
+    chaos_u32_t step = g_step;
+
+    for (q = 0U; q < LOOKUPS; q++)
+    {
+        sum += (g_ids[g_queries[q]] == g_ids[g_queries[(q + step) % LOOKUPS]]) ? 1U : 0U;
+    }
+    return sum;
+}
+
+int main(void)
+{
+    chaos_strintern_t t;
+    chaos_strintern_stats_t st;
+    volatile chaos_size_t sum = 0U;
+    chaos_size_t i;
+
+    /* Long shared prefixes, as in hierarchical parameter names */
+    for (i = 0U; i < NAMES; i++)
+    {
+        (void)snprintf((char *)g_names[i], NAME_SIZE, "sys.payload.group%02u.param%04u", (unsigned)(i % 50U), (unsigned)i);
+        g_views[i].data = g_names[i];
+        (void)chaos_strlen(g_names[i], &g_views[i].len);
+    }
+    srand(3);
+    for (i = 0U; i < LOOKUPS; i++)
+    {
+        g_queries[i] = (chaos_u32_t)((chaos_u32_t)rand() % NAMES);
+    }
+
+    (void)chaos_strintern_init(&t, g_region, sizeof(g_region), 4096U);
+    for (i = 0U; i < NAMES; i++)
+    {
+        (void)chaos_strintern_add(&t, &g_views[i], &g_ids[i]);
+    }
+    (void)chaos_strintern_stats(&t, &st);
+    printf("%u names: load %u.%u%%, mean probe %u.%02u, max probe %u, pool %u/%u bytes\n",
+           (unsigned)st.count, (unsigned)(st.load_permille / 10U), (unsigned)(st.load_permille % 10U),
+           (unsigned)(st.probe_avg_x100 / 100U), (unsigned)(st.probe_avg_x100 % 100U),
+           (unsigned)st.probe_max, (unsigned)st.pool_used, (unsigned)st.pool_size);
+
+    BENCH_RUN("lookup   strcmp scan  x1024", 5UL, 0UL, sum = lookup_strcmp());
+    bench_sink(&sum);
+    BENCH_RUN("lookup   intern find  x1024", 2000UL, 0UL, sum = lookup_intern(&t));
+    bench_sink(&sum);
+    BENCH_RUN("equality strcmp       x1024", 20000UL, 0UL, sum = equal_strcmp());
+    bench_sink(&sum);
+    BENCH_RUN("equality handle       x1024", 20000UL, 0UL, sum = equal_id());
+    bench_sink(&sum);
+
+    return 0;
+}
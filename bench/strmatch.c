@@ -0,0 +1,107 @@
+#include <stdlib.h>
+
+#include "chaos_string.h"
+#include "chaos_memory.h"
+#include "chaos_strmatch.h"
+
+#include "chaos_bench.h"
+
+/* -------------------------------------------------------------------------- */
+/* Log filtering: does a line contain any of 200 keywords?                      */
+/* -------------------------------------------------------------------------- */
+
+#define KEYWORDS  200U
+#define LINES     256U
+#define LINE_SIZE 96U
+
+static chaos_char_t g_keys[KEYWORDS][12];
+static chaos_char_t g_lines[LINES][LINE_SIZE + 1U];
+static chaos_strview_t g_views[KEYWORDS];
+
+static void random_word(chaos_char_t *out, chaos_size_t len)
+{
+    chaos_size_t i;
+
+    for (i = 0U; i < len; i++)
+    {
+        out[i] = (chaos_char_t)('a' + (rand() % 26));
+    }
+    out[len] = 0U;
+}
+
+static chaos_size_t filter_strstr(void)
+{
+    chaos_size_t hits = 0U;
+    chaos_size_t l;
+    chaos_size_t k;
+    chaos_bool_t found;
+
+    for (l = 0U; l < LINES; l++)
+    {
+        found = CHAOS_FALSE;
+        for (k = 0U; (k < KEYWORDS) && (found == CHAOS_FALSE); k++)
+        {
+            (void)chaos_strstr(g_lines[l], g_keys[k], &found);
+        }
+        hits += (found == CHAOS_TRUE) ? 1U : 0U;
+    }
+    return hits;
+}
+
+static chaos_size_t filter_strmatch(const chaos_strmatch_t *m)
+{
+    chaos_size_t hits = 0U;
+    chaos_size_t l;
+    chaos_strview_t line;
+    chaos_bool_t found;
+
+    for (l = 0U; l < LINES; l++)
+    {
+        line.data = g_lines[l];
+        line.len = LINE_SIZE;
+        (void)chaos_strmatch_any(m, &line, &found);
+        hits += (found == CHAOS_TRUE) ? 1U : 0U;
+    }
+    return hits;
+}
+
+int main(void)
+{
+    chaos_strmatch_t m;
+    chaos_size_t size = 0U;
+    chaos_size_t hits = 0U;
+    chaos_size_t k;
+    chaos_size_t l;
+    void *arena;
+
+    srand(1);
+    for (k = 0U; k < KEYWORDS; k++)
+    {
+        random_word(g_keys[k], 5U + ((chaos_size_t)rand() % 6U));
+        g_views[k].data = g_keys[k];
+        (void)chaos_strlen(g_keys[k], &g_views[k].len);
+    }
+    /* One line in eight carries a keyword */
+    for (l = 0U; l < LINES; l++)
+    {
+        random_word(g_lines[l], LINE_SIZE);
+        if ((l % 8U) == 0U)
+        {
+            k = (chaos_size_t)rand() % KEYWORDS;
+            (void)chaos_memcpy(&g_lines[l][40], g_keys[k], g_views[k].len);
+        }
+    }
+
+    (void)chaos_strmatch_arena_size(g_views, KEYWORDS, &size);
+    arena = malloc(size);
+    (void)chaos_strmatch_build(&m, g_views, KEYWORDS, arena, size);
+    printf("%u keywords, %u states, arena %u bytes\n", KEYWORDS, (unsigned)m.node_count, (unsigned)size);
+
+    BENCH_RUN("strstr x200  per 256 lines", 20UL, LINES * LINE_SIZE, hits = filter_strstr());
+    bench_sink(&hits);
+    BENCH_RUN("strmatch     per 256 lines", 2000UL, LINES * LINE_SIZE, hits = filter_strmatch(&m));
+    bench_sink(&hits);
+
+    free(arena);
+    return 0;
+}
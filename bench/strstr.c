@@ -0,0 +1,74 @@
+#include "chaos_string.h"
+
+#include "chaos_bench.h"
+
+/* -------------------------------------------------------------------------- */
+/* Substring search on adversarial input: "aaaa...a" searched for "aa...ab"     */
+/* -------------------------------------------------------------------------- */
+
+#define HAY_SIZE (64U * 1024U)
+
+static chaos_char_t g_hay[HAY_SIZE + 1U];
+static chaos_char_t g_needle[256];
+
+/* The previous O(n * m) engine, kept here as the baseline */
+static chaos_bool_t naive_strstr(const chaos_char_t *str, const chaos_char_t *substr)
+{
+    chaos_bool_t found = CHAOS_FALSE;
+    chaos_size_t i = 0U;
+    chaos_size_t j;
+
+    while ((str[i] != 0U) && (found == CHAOS_FALSE))
+    {
+        j = 0U;
+        while ((substr[j] != 0U) && (str[i + j] != 0U) && (str[i + j] == substr[j]))
+        {
+            j++;
+        }
+        if (substr[j] == 0U)
+        {
+            found = CHAOS_TRUE;
+        }
+        i++;
+    }
+    return found;
+}
+
+static void bench_needle(chaos_size_t m, unsigned long iters)
+{
+    chaos_size_t i;
+    chaos_size_t pos = 0U;
+    chaos_bool_t found = CHAOS_FALSE;
+    char label[48];
+
+    for (i = 0U; i < (m - 1U); i++)
+    {
+        g_needle[i] = (chaos_char_t)'a';
+    }
+    g_needle[m - 1U] = (chaos_char_t)'b';
+    g_needle[m] = 0U;
+
+    (void)snprintf(label, sizeof(label), "naive     needle a^%lu b", (unsigned long)(m - 1U));
+    BENCH_RUN(label, iters, HAY_SIZE, found = naive_strstr(g_hay, g_needle));
+    (void)snprintf(label, sizeof(label), "two-way   needle a^%lu b", (unsigned long)(m - 1U));
+    BENCH_RUN(label, iters, HAY_SIZE, (void)chaos_strstr_pos(g_hay, g_needle, &pos, &found));
+    bench_sink(&found);
+}
+
+int main(void)
+{
+    chaos_size_t i;
+
+    for (i = 0U; i < HAY_SIZE; i++)
+    {
+        g_hay[i] = (chaos_char_t)'a';
+    }
+    g_hay[HAY_SIZE] = 0U;
+
+    printf("haystack a^%lu\n", (unsigned long)HAY_SIZE);
+    bench_needle(2U, 2000UL);
+    bench_needle(16U, 200UL);
+    bench_needle(128U, 40UL);
+
+    return 0;
+}
@@ -0,0 +1,136 @@
+#include <stdlib.h>
+
+#include "chaos_string.h"
+#include "chaos_utf8.h"
+
+#include "chaos_bench.h"
+
+/* -------------------------------------------------------------------------- */
+/* UTF-8 validation: byte-at-a-time decoder vs chaos_utf8_validate             */
+/* -------------------------------------------------------------------------- */
+
+#define TEXT_SIZE 65536U
+
+static chaos_char_t g_ascii[TEXT_SIZE];
+static chaos_char_t g_mixed[TEXT_SIZE];
+
+/* Classic per-byte state machine over the lead byte ranges */
+static chaos_bool_t validate_bytewise(const chaos_char_t *s, chaos_size_t size)
+{
+    chaos_size_t i = 0U;
+    chaos_size_t n;
+    chaos_size_t k;
+    chaos_u8_t lo;
+    chaos_u8_t hi;
+    chaos_u8_t c;
+
+    while (i < size)
+    {
+        c = s[i];
+        lo = 0x80U;
+        hi = 0xBFU;
+        if (c < 0x80U)
+        {
+            n = 1U;
+        }
+        else if ((c >= 0xC2U) && (c <= 0xDFU))
+        {
+            n = 2U;
+        }
+        else if ((c >= 0xE0U) && (c <= 0xEFU))
+        {
+            n = 3U;
+            lo = (c == 0xE0U) ? 0xA0U : 0x80U;
+            hi = (c == 0xEDU) ? 0x9FU : 0xBFU;
+        }
+        else if ((c >= 0xF0U) && (c <= 0xF4U))
+        {
+            n = 4U;
+            lo = (c == 0xF0U) ? 0x90U : 0x80U;
+            hi = (c == 0xF4U) ? 0x8FU : 0xBFU;
+        }
+        else
+        {
+            return CHAOS_FALSE;
+        }
+        if ((size - i) < n)
+        {
+            return CHAOS_FALSE;
+        }
+        if ((n > 1U) && ((s[i + 1U] < lo) || (s[i + 1U] > hi)))
+        {
+            return CHAOS_FALSE;
+        }
+        for (k = 2U; k < n; k++)
+        {
+            if ((s[i + k] & 0xC0U) != 0x80U)
+            {
+                return CHAOS_FALSE;
+            }
+        }
+        i += n;
+    }
+    return CHAOS_TRUE;
+}
+
+static void fill_mixed(void)
+{
+    static const chaos_char_t pieces[][4] = {
+        { 'a' }, { 0xC3U, 0xA9U }, { 0xE6U, 0x97U, 0xA5U }, { 0xF0U, 0x9FU, 0x98U, 0x80U },
+    };
+    chaos_size_t len = 0U;
+    chaos_size_t p;
+    chaos_size_t k;
+
+    /* Mostly 2 and 3 byte characters with some ASCII, as in CJK or Cyrillic text */
+    while (len < TEXT_SIZE)
+    {
+        p = (chaos_size_t)rand() % 4U;
+        for (k = 0U; (k <= p) && (len < TEXT_SIZE); k++)
+        {
+            g_mixed[len] = pieces[p][k];
+            len++;
+        }
+    }
+    /* Cut a trailing partial character */
+    while ((g_mixed[TEXT_SIZE - 1U] & 0x80U) != 0U)
+    {
+        g_mixed[TEXT_SIZE - 1U] = 'a';
+        k = TEXT_SIZE - 2U;
+        while ((g_mixed[k] & 0xC0U) == 0x80U)
+        {
+            g_mixed[k] = 'a';
+            k--;
+        }
+        g_mixed[k] = 'a';
+    }
+}
+
+int main(void)
+{
+    volatile chaos_bool_t ok = CHAOS_FALSE;
+    chaos_bool_t valid = CHAOS_FALSE;
+    chaos_size_t count = 0U;
+    chaos_size_t i;
+
+    srand(1);
+    for (i = 0U; i < TEXT_SIZE; i++)
+    {
+        g_ascii[i] = (chaos_char_t)(' ' + (rand() % 95));
+    }
+    fill_mixed();
+
+    (void)chaos_utf8_validate(g_mixed, TEXT_SIZE, &valid, CHAOS_NULL);
+    (void)chaos_utf8_count(g_mixed, TEXT_SIZE, &count);
+    printf("mixed text: %u bytes, %u code points, valid %u\n", TEXT_SIZE, (unsigned)count, (unsigned)valid);
+
+    BENCH_RUN("bytewise       64K ascii", 2000UL, TEXT_SIZE, ok = validate_bytewise(g_ascii, TEXT_SIZE));
+    BENCH_RUN("utf8_validate  64K ascii", 20000UL, TEXT_SIZE, (void)chaos_utf8_validate(g_ascii, TEXT_SIZE, &valid, CHAOS_NULL); ok = valid);
+    BENCH_RUN("bytewise       64K mixed", 2000UL, TEXT_SIZE, ok = validate_bytewise(g_mixed, TEXT_SIZE));
+    BENCH_RUN("utf8_validate  64K mixed", 20000UL, TEXT_SIZE, (void)chaos_utf8_validate(g_mixed, TEXT_SIZE, &valid, CHAOS_NULL); ok = valid);
+    BENCH_RUN("utf8_count     64K mixed", 20000UL, TEXT_SIZE, (void)chaos_utf8_count(g_mixed, TEXT_SIZE, &count));
+    bench_sink(&ok);
+    bench_sink(&count);
+
+    return 0;
+}
@@ -0,0 +1,67 @@
+/**
+ * @file chaos_checksum.h
+ * @brief Checksums and CRCs for CHAOSLIB.
+ *
+ * Provides CRC-32 (IEEE 802.3, as used by zlib/Ethernet) and CRC-32C
+ * (Castagnoli, as used by iSCSI/ext4) plus a fused copy-and-checksum.
+ * CRC values follow the zlib convention: pass 0 to start a new CRC and
+ * the previous result to continue it across buffers.
+ */
+
+#ifndef CHAOS_CHECKSUM_H
+#define CHAOS_CHECKSUM_H
+
+#include "chaos_types.h"
+#include "chaos_status.h"
+
+/* ============================================================= */
+/* CRC ALGORITHMS                                                */
+/* ============================================================= */
+
+/**
+ * @brief CRC algorithm selector for the generic entry points.
+ */
+typedef enum
+{
+    CHAOS_CRC_32  = 0U, /**< CRC-32, reflected polynomial 0xEDB88320 */
+    CHAOS_CRC_32C = 1U  /**< CRC-32C, reflected polynomial 0x82F63B78 */
+} chaos_crc_type_t;
+
+/* ============================================================= */
+/* CHECKSUM FUNCTIONS                                            */
+/* ============================================================= */
+
+/**
+ * @brief Update a CRC-32 (IEEE 802.3) with a buffer.
+ * @param[in] buf Input buffer
+ * @param[in] size Number of bytes to process
+ * @param[inout] crc Running CRC (0 to start); updated on success
+ * @return CHAOS_STATUS_OK on success or a CHAOS status code on error
+ */
+extern chaos_status_t chaos_crc32(const void *buf, chaos_size_t size, chaos_u32_t *crc);
+
+/**
+ * @brief Update a CRC-32C (Castagnoli) with a buffer.
+ * @param[in] buf Input buffer
+ * @param[in] size Number of bytes to process
+ * @param[inout] crc Running CRC (0 to start); updated on success
+ * @return CHAOS_STATUS_OK on success or a CHAOS status code on error
+ */
+extern chaos_status_t chaos_crc32c(const void *buf, chaos_size_t size, chaos_u32_t *crc);
+
+/**
+ * @brief Copy a buffer and update its CRC in a single pass.
+ *
+ * Equivalent to chaos_memcpy() followed by chaos_crc32()/chaos_crc32c()
+ * on the source, but every byte is loaded only once.
+ *
+ * @param[out] dst Destination buffer (must not overlap src)
+ * @param[in] src Source buffer
+ * @param[in] size Number of bytes to copy
+ * @param[in] type CRC algorithm
+ * @param[inout] crc Running CRC (0 to start); updated on success
+ * @return CHAOS_STATUS_OK on success or a CHAOS status code on error
+ */
+extern chaos_status_t chaos_memcpy_crc(void *dst, const void *src, chaos_size_t size, chaos_crc_type_t type, chaos_u32_t *crc);
+
+#endif /* CHAOS_CHECKSUM_H */
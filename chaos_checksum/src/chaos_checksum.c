@@ -0,0 +1,365 @@
+#include "chaos_checksum.h"
+#include "chaos_assert.h"
+#include "chaos_bits.h"
+#include "chaos_crc_tables.h"
+
+#if (CHAOS_HAS_SSE42 == 1) || (CHAOS_HAS_PCLMUL == 1)
+#include <immintrin.h>
+#endif
+
+/* ============================================================= */
+/* CRC ENGINE CONFIGURATION                                      */
+/* ============================================================= */
+
+/* Smallest input worth the carry-less multiply folding setup */
+#define CHAOS_CRC_FOLD_MIN (64U)
+
+/* Hardware crc32 instruction only implements the Castagnoli polynomial */
+#if (CHAOS_HAS_SSE42 == 1)
+#define CHAOS_CRC_HW_32C 1
+#else
+#define CHAOS_CRC_HW_32C 0
+#endif
+
+/* ============================================================= */
+/* FUNCTION PROTOTYPES                                          */
+/* ============================================================= */
+static chaos_u32_t chaos_crc_run(chaos_crc_type_t type, chaos_u32_t crc, const chaos_u8_t *s, chaos_u8_t *d, chaos_size_t size);
+static chaos_u32_t chaos_crc_slice8(const chaos_u32_t (*table)[256], chaos_u32_t crc, const chaos_u8_t *s, chaos_u8_t *d, chaos_size_t size);
+#if (CHAOS_CRC_HW_32C == 1)
+static chaos_u32_t chaos_crc_hw32c(chaos_u32_t crc, const chaos_u8_t *s, chaos_u8_t *d, chaos_size_t size);
+#endif
+#if (CHAOS_HAS_PCLMUL == 1)
+static chaos_u32_t chaos_crc_fold(chaos_crc_type_t type, chaos_u32_t crc, const chaos_u8_t *s, chaos_u8_t *d, chaos_size_t size);
+#endif
+
+/* ============================================================= */
+/* CRC32                                                         */
+/* ============================================================= */
+chaos_status_t chaos_crc32(const void *buf, chaos_size_t size, chaos_u32_t *crc)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    /* Validate parameters */
+    chaos_assert_not_null(buf, &status, CHAOS_MODULE_CHECKSUM);
+    chaos_assert_not_null(crc, &status, CHAOS_MODULE_CHECKSUM);
+    chaos_assert_param((size != 0U), &status, CHAOS_SEVERITY_WARNING, CHAOS_MODULE_CHECKSUM, CHAOS_CHECKSUM_SIZE_ZERO);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        *crc = chaos_crc_run(CHAOS_CRC_32, *crc, (const chaos_u8_t *)buf, CHAOS_NULL, size);
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* CRC32C                                                        */
+/* ============================================================= */
+chaos_status_t chaos_crc32c(const void *buf, chaos_size_t size, chaos_u32_t *crc)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    /* Validate parameters */
+    chaos_assert_not_null(buf, &status, CHAOS_MODULE_CHECKSUM);
+    chaos_assert_not_null(crc, &status, CHAOS_MODULE_CHECKSUM);
+    chaos_assert_param((size != 0U), &status, CHAOS_SEVERITY_WARNING, CHAOS_MODULE_CHECKSUM, CHAOS_CHECKSUM_SIZE_ZERO);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        *crc = chaos_crc_run(CHAOS_CRC_32C, *crc, (const chaos_u8_t *)buf, CHAOS_NULL, size);
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* MEMCPY + CRC                                                  */
+/* ============================================================= */
+chaos_status_t chaos_memcpy_crc(void *dst, const void *src, chaos_size_t size, chaos_crc_type_t type, chaos_u32_t *crc)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    /* Validate parameters */
+    chaos_assert_not_null(dst, &status, CHAOS_MODULE_CHECKSUM);
+    chaos_assert_not_null(src, &status, CHAOS_MODULE_CHECKSUM);
+    chaos_assert_not_null(crc, &status, CHAOS_MODULE_CHECKSUM);
+    chaos_assert_param(((type == CHAOS_CRC_32) || (type == CHAOS_CRC_32C)), &status, CHAOS_SEVERITY_ERROR, CHAOS_MODULE_CHECKSUM, CHAOS_CHECKSUM_BAD_TYPE);
+    chaos_assert_param((size != 0U), &status, CHAOS_SEVERITY_WARNING, CHAOS_MODULE_CHECKSUM, CHAOS_CHECKSUM_SIZE_ZERO);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        *crc = chaos_crc_run(type, *crc, (const chaos_u8_t *)src, (chaos_u8_t *)dst, size);
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* CRC DISPATCH                                                  */
+/* ============================================================= */
+
+/*
+ * Runs the fastest available kernels over s (copying to d when d is not
+ * CHAOS_NULL): carry-less multiply folding for the bulk of large inputs, then the
+ * crc32 instruction (CRC-32C only) or slicing-by-8 for the remainder.
+ */
+static chaos_u32_t chaos_crc_run(chaos_crc_type_t type, chaos_u32_t crc, const chaos_u8_t *s, chaos_u8_t *d, chaos_size_t size)
+{
+    chaos_u32_t state = ~crc;
+
+#if (CHAOS_HAS_PCLMUL == 1)
+    if (size >= CHAOS_CRC_FOLD_MIN)
+    {
+        chaos_size_t bulk = size & ~(chaos_size_t)15U;
+
+        state = chaos_crc_fold(type, state, s, d, bulk);
+        s += bulk;
+        if (d != CHAOS_NULL)
+        {
+            d += bulk;
+        }
+        size -= bulk;
+    }
+#endif
+
+    if (size != 0U)
+    {
+        if (type == CHAOS_CRC_32C)
+        {
+#if (CHAOS_CRC_HW_32C == 1)
+            state = chaos_crc_hw32c(state, s, d, size);
+#else
+            state = chaos_crc_slice8(chaos_crc32c_table, state, s, d, size);
+#endif
+        }
+        else
+        {
+            state = chaos_crc_slice8(chaos_crc32_table, state, s, d, size);
+        }
+    }
+
+    return ~state;
+}
+
+/* ============================================================= */
+/* SLICING-BY-8                                                  */
+/* ============================================================= */
+
+/* Little-endian 32-bit load from any address, independent of host order */
+static CHAOS_ALWAYS_INLINE chaos_u32_t chaos_crc_le32(const chaos_u8_t *p)
+{
+    return (chaos_u32_t)p[0] | ((chaos_u32_t)p[1] << 8U) | ((chaos_u32_t)p[2] << 16U) | ((chaos_u32_t)p[3] << 24U);
+}
+
+static chaos_u32_t chaos_crc_slice8(const chaos_u32_t (*table)[256], chaos_u32_t crc, const chaos_u8_t *s, chaos_u8_t *d, chaos_size_t size)
+{
+    chaos_u32_t lo;
+    chaos_u32_t hi;
+
+    while (size >= 8U)
+    {
+        lo = chaos_crc_le32(s) ^ crc;
+        hi = chaos_crc_le32(s + 4U);
+        if (d != CHAOS_NULL)
+        {
+            chaos_u32_storeu(d, chaos_u32_loadu(s));
+            chaos_u32_storeu(d + 4U, chaos_u32_loadu(s + 4U));
+            d += 8U;
+        }
+
+        crc = table[7][lo & 0xFFU] ^ table[6][(lo >> 8U) & 0xFFU] ^
+              table[5][(lo >> 16U) & 0xFFU] ^ table[4][lo >> 24U] ^
+              table[3][hi & 0xFFU] ^ table[2][(hi >> 8U) & 0xFFU] ^
+              table[1][(hi >> 16U) & 0xFFU] ^ table[0][hi >> 24U];
+
+        s += 8U;
+        size -= 8U;
+    }
+
+    while (size != 0U)
+    {
+        if (d != CHAOS_NULL)
+        {
+            *d = *s;
+            d++;
+        }
+        crc = table[0][(crc ^ (chaos_u32_t)*s) & 0xFFU] ^ (crc >> 8U);
+        s++;
+        size--;
+    }
+
+    return crc;
+}
+
+/* ============================================================= */
+/* SSE4.2 CRC32 INSTRUCTION (CRC-32C)                            */
+/* ============================================================= */
+#if (CHAOS_CRC_HW_32C == 1)
+static chaos_u32_t chaos_crc_hw32c(chaos_u32_t crc, const chaos_u8_t *s, chaos_u8_t *d, chaos_size_t size)
+{
+    chaos_word_t w;
+
+    while (size >= CHAOS_WORD_SIZE)
+    {
+        w = chaos_word_loadu(s);
+        if (d != CHAOS_NULL)
+        {
+            chaos_word_storeu(d, w);
+            d += CHAOS_WORD_SIZE;
+        }
+#if (CHAOS_PTR_WIDTH == 64)
+        crc = (chaos_u32_t)_mm_crc32_u64((unsigned long long)crc, (unsigned long long)w);
+#else
+        crc = (chaos_u32_t)_mm_crc32_u32((unsigned int)crc, (unsigned int)w);
+#endif
+        s += CHAOS_WORD_SIZE;
+        size -= CHAOS_WORD_SIZE;
+    }
+
+    while (size != 0U)
+    {
+        if (d != CHAOS_NULL)
+        {
+            *d = *s;
+            d++;
+        }
+        crc = (chaos_u32_t)_mm_crc32_u8((unsigned int)crc, (unsigned char)*s);
+        s++;
+        size--;
+    }
+
+    return crc;
+}
+#endif
+
+/* ============================================================= */
+/* PCLMUL FOLDING                                                */
+/* ============================================================= */
+#if (CHAOS_HAS_PCLMUL == 1)
+
+/* Pack two fold constants into one register */
+static CHAOS_ALWAYS_INLINE __m128i chaos_crc_k(long long hi, long long lo)
+{
+    return _mm_set_epi64x(hi, lo);
+}
+
+/* Fold acc forward by the distance encoded in k and add data */
+static CHAOS_ALWAYS_INLINE __m128i chaos_crc_fold16(__m128i acc, __m128i k, __m128i data)
+{
+    __m128i t = _mm_clmulepi64_si128(acc, k, 0x00);
+    acc = _mm_clmulepi64_si128(acc, k, 0x11);
+    return _mm_xor_si128(_mm_xor_si128(acc, t), data);
+}
+
+/* Load 16 bytes and forward them to the copy destination when fusing */
+static CHAOS_ALWAYS_INLINE __m128i chaos_crc_load16(const chaos_u8_t *s, chaos_u8_t *d)
+{
+    __m128i v = _mm_loadu_si128((const __m128i *)s);
+    if (d != CHAOS_NULL)
+    {
+        _mm_storeu_si128((__m128i *)d, v);
+    }
+    return v;
+}
+
+/* Requires size >= 64 and a multiple of 16 */
+static chaos_u32_t chaos_crc_fold(chaos_crc_type_t type, chaos_u32_t crc, const chaos_u8_t *s, chaos_u8_t *d, chaos_size_t size)
+{
+    __m128i k1k2;
+    __m128i k3k4;
+    __m128i k5;
+    __m128i poly;
+    __m128i x1;
+    __m128i x2;
+    __m128i x3;
+    __m128i x4;
+    __m128i t;
+    const __m128i mask32 = _mm_setr_epi32(-1, 0, -1, 0);
+
+    /*
+     * Fold constants for the reflected polynomials (x^n mod P, bit-reflected):
+     * k1/k2 fold by 512 bits, k3/k4 by 128 bits, k5 folds 96 bits to 64 and
+     * P'/mu drive the final Barrett reduction.
+     */
+    if (type == CHAOS_CRC_32C)
+    {
+        k1k2 = chaos_crc_k(0x09E4ADDF8LL, 0x0740EEF02LL);
+        k3k4 = chaos_crc_k(0x14CD00BD6LL, 0x0F20C0DFELL);
+        k5   = chaos_crc_k(0LL, 0x0DD45AAB8LL);
+        poly = chaos_crc_k(0x0DEA713F1LL, 0x105EC76F1LL);
+    }
+    else
+    {
+        k1k2 = chaos_crc_k(0x1C6E41596LL, 0x154442BD4LL);
+        k3k4 = chaos_crc_k(0x0CCAA009ELL, 0x1751997D0LL);
+        k5   = chaos_crc_k(0LL, 0x163CD6124LL);
+        poly = chaos_crc_k(0x1F7011641LL, 0x1DB710641LL);
+    }
+
+    /* Four independent 128-bit accumulators hide the multiply latency */
+    x1 = chaos_crc_load16(s, d);
+    x2 = chaos_crc_load16(s + 16U, (d != CHAOS_NULL) ? (d + 16U) : CHAOS_NULL);
+    x3 = chaos_crc_load16(s + 32U, (d != CHAOS_NULL) ? (d + 32U) : CHAOS_NULL);
+    x4 = chaos_crc_load16(s + 48U, (d != CHAOS_NULL) ? (d + 48U) : CHAOS_NULL);
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)crc));
+    s += 64U;
+    if (d != CHAOS_NULL)
+    {
+        d += 64U;
+    }
+    size -= 64U;
+
+    while (size >= 64U)
+    {
+        CHAOS_PREFETCH(s + 256U);
+        if (d != CHAOS_NULL)
+        {
+            x1 = chaos_crc_fold16(x1, k1k2, chaos_crc_load16(s, d));
+            x2 = chaos_crc_fold16(x2, k1k2, chaos_crc_load16(s + 16U, d + 16U));
+            x3 = chaos_crc_fold16(x3, k1k2, chaos_crc_load16(s + 32U, d + 32U));
+            x4 = chaos_crc_fold16(x4, k1k2, chaos_crc_load16(s + 48U, d + 48U));
+            d += 64U;
+        }
+        else
+        {
+            x1 = chaos_crc_fold16(x1, k1k2, _mm_loadu_si128((const __m128i *)s));
+            x2 = chaos_crc_fold16(x2, k1k2, _mm_loadu_si128((const __m128i *)(s + 16U)));
+            x3 = chaos_crc_fold16(x3, k1k2, _mm_loadu_si128((const __m128i *)(s + 32U)));
+            x4 = chaos_crc_fold16(x4, k1k2, _mm_loadu_si128((const __m128i *)(s + 48U)));
+        }
+        s += 64U;
+        size -= 64U;
+    }
+
+    /* Collapse the accumulators into one 128-bit remainder */
+    x1 = chaos_crc_fold16(x1, k3k4, x2);
+    x1 = chaos_crc_fold16(x1, k3k4, x3);
+    x1 = chaos_crc_fold16(x1, k3k4, x4);
+
+    while (size >= 16U)
+    {
+        x1 = chaos_crc_fold16(x1, k3k4, chaos_crc_load16(s, d));
+        s += 16U;
+        if (d != CHAOS_NULL)
+        {
+            d += 16U;
+        }
+        size -= 16U;
+    }
+
+    /* 128 -> 64 bits */
+    t = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), t);
+    t = _mm_srli_si128(x1, 4);
+    x1 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), k5, 0x00);
+    x1 = _mm_xor_si128(x1, t);
+
+    /* Barrett reduction 64 -> 32 bits */
+    t = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), poly, 0x10);
+    t = _mm_clmulepi64_si128(_mm_and_si128(t, mask32), poly, 0x00);
+    x1 = _mm_xor_si128(x1, t);
+
+    return (chaos_u32_t)_mm_extract_epi32(x1, 1);
+}
+#endif
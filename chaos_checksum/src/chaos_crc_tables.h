@@ -0,0 +1,17 @@
+/**
+ * @file chaos_crc_tables.h
+ * @brief Internal CRC lookup tables (not part of the public API).
+ */
+
+#ifndef CHAOS_CRC_TABLES_H
+#define CHAOS_CRC_TABLES_H
+
+#include "chaos_types.h"
+
+/** @brief Slicing-by-8 tables for CRC-32 (IEEE 802.3). */
+extern const chaos_u32_t chaos_crc32_table[8][256];
+
+/** @brief Slicing-by-8 tables for CRC-32C (Castagnoli). */
+extern const chaos_u32_t chaos_crc32c_table[8][256];
+
+#endif /* CHAOS_CRC_TABLES_H */
@@ -0,0 +1,313 @@
+/**
+ * @file chaos_bits.h
+ * @brief Machine-word access helpers for CHAOSLIB.
+ *
+ * Provides the native word type, alias-safe aligned/unaligned loads
+ * and stores, bit scans and the byte-lane tricks used by the
+ * word-at-a-time (SWAR) kernels.
+ */
+
+#ifndef CHAOS_BITS_H
+#define CHAOS_BITS_H
+
+#include "chaos_types.h"
+#include "chaos_compiler.h"
+
+/* ============================================================= */
+/* WORD TYPES                                                    */
+/* ============================================================= */
+
+/** @brief Native machine word (same width as a pointer). */
+typedef chaos_uintptr_t chaos_word_t;
+
+/** @brief Word that may alias any object (aligned access). */
+typedef chaos_word_t CHAOS_MAY_ALIAS chaos_word_alias_t;
+
+/** @brief Word that may alias any object and may sit at any address. */
+typedef chaos_word_t CHAOS_MAY_ALIAS CHAOS_PACKED_ALIGN(1) chaos_word_unaligned_t;
+
+/** @brief Size of a machine word in bytes. */
+#define CHAOS_WORD_SIZE ((chaos_size_t)sizeof(chaos_word_t))
+
+/** @brief Word with 0x01 in every byte. */
+#define CHAOS_WORD_ONES ((chaos_word_t)(~(chaos_word_t)0U) / (chaos_word_t)0xFFU)
+
+/** @brief Word with 0x7F in every byte. */
+#define CHAOS_WORD_LOW7 (CHAOS_WORD_ONES * (chaos_word_t)0x7FU)
+
+/** @brief Mask selecting the misaligned part of an address. */
+#define CHAOS_WORD_MASK ((chaos_uintptr_t)(sizeof(chaos_word_t) - 1U))
+
+/**
+ * @brief Smallest memory protection granule that an over-read must not cross.
+ * @note Unaligned wide loads past a terminator are only issued when they stay
+ *       inside one granule of this size.
+ */
+#ifndef CHAOS_PAGE_SIZE
+#define CHAOS_PAGE_SIZE 4096U
+#endif
+
+/* ============================================================= */
+/* WORD ACCESS                                                   */
+/* ============================================================= */
+
+/**
+ * @brief Load a word from a word-aligned address.
+ */
+static CHAOS_ALWAYS_INLINE chaos_word_t chaos_word_load(const void *ptr)
+{
+    return *(const chaos_word_alias_t *)ptr;
+}
+
+/**
+ * @brief Load a word from any address.
+ */
+static CHAOS_ALWAYS_INLINE chaos_word_t chaos_word_loadu(const void *ptr)
+{
+    return *(const chaos_word_unaligned_t *)ptr;
+}
+
+/**
+ * @brief Store a word to a word-aligned address.
+ */
+static CHAOS_ALWAYS_INLINE void chaos_word_store(void *ptr, chaos_word_t value)
+{
+    *(chaos_word_alias_t *)ptr = value;
+}
+
+/**
+ * @brief Store a word to any address.
+ */
+static CHAOS_ALWAYS_INLINE void chaos_word_storeu(void *ptr, chaos_word_t value)
+{
+    *(chaos_word_unaligned_t *)ptr = value;
+}
+
+/**
+ * @name Fixed-width unaligned access
+ * @brief Alias-safe loads/stores of 16/32-bit values at any address.
+ * @{
+ */
+typedef chaos_u16_t CHAOS_MAY_ALIAS CHAOS_PACKED_ALIGN(1) chaos_u16_unaligned_t;
+typedef chaos_u32_t CHAOS_MAY_ALIAS CHAOS_PACKED_ALIGN(1) chaos_u32_unaligned_t;
+
+static CHAOS_ALWAYS_INLINE chaos_u16_t chaos_u16_loadu(const void *ptr)
+{
+    return *(const chaos_u16_unaligned_t *)ptr;
+}
+
+static CHAOS_ALWAYS_INLINE void chaos_u16_storeu(void *ptr, chaos_u16_t value)
+{
+    *(chaos_u16_unaligned_t *)ptr = value;
+}
+
+static CHAOS_ALWAYS_INLINE chaos_u32_t chaos_u32_loadu(const void *ptr)
+{
+    return *(const chaos_u32_unaligned_t *)ptr;
+}
+
+static CHAOS_ALWAYS_INLINE void chaos_u32_storeu(void *ptr, chaos_u32_t value)
+{
+    *(chaos_u32_unaligned_t *)ptr = value;
+}
+
+#if defined(CHAOS_ENABLE_INT64) && (CHAOS_ENABLE_INT64 == 1)
+typedef chaos_u64_t CHAOS_MAY_ALIAS CHAOS_PACKED_ALIGN(1) chaos_u64_unaligned_t;
+
+static CHAOS_ALWAYS_INLINE chaos_u64_t chaos_u64_loadu(const void *ptr)
+{
+    return *(const chaos_u64_unaligned_t *)ptr;
+}
+
+static CHAOS_ALWAYS_INLINE void chaos_u64_storeu(void *ptr, chaos_u64_t value)
+{
+    *(chaos_u64_unaligned_t *)ptr = value;
+}
+#endif
+/** @} */
+
+/**
+ * @brief Number of bytes needed to bring an address up to word alignment.
+ */
+static CHAOS_ALWAYS_INLINE chaos_size_t chaos_word_misalign(const void *ptr)
+{
+    return (chaos_size_t)((CHAOS_WORD_SIZE - ((chaos_uintptr_t)ptr & CHAOS_WORD_MASK)) & CHAOS_WORD_MASK);
+}
+
+/**
+ * @brief Check that reading size bytes from ptr stays inside one page.
+ */
+static CHAOS_ALWAYS_INLINE chaos_bool_t chaos_page_fits(const void *ptr, chaos_size_t size)
+{
+    return ((((chaos_uintptr_t)ptr) & ((chaos_uintptr_t)CHAOS_PAGE_SIZE - 1U)) <= ((chaos_uintptr_t)CHAOS_PAGE_SIZE - size)) ? CHAOS_TRUE : CHAOS_FALSE;
+}
+
+/* ============================================================= */
+/* BIT SCANS                                                     */
+/* ============================================================= */
+
+/**
+ * @brief Count trailing zero bits of a non-zero 32-bit value.
+ */
+static CHAOS_ALWAYS_INLINE chaos_u32_t chaos_u32_ctz(chaos_u32_t value)
+{
+#if (CHAOS_GNUC == 1)
+    return (chaos_u32_t)__builtin_ctz(value);
+#else
+    chaos_u32_t n = 0U;
+    while ((value & 1U) == 0U)
+    {
+        value >>= 1U;
+        n++;
+    }
+    return n;
+#endif
+}
+
+/**
+ * @brief Count leading zero bits of a non-zero 32-bit value.
+ */
+static CHAOS_ALWAYS_INLINE chaos_u32_t chaos_u32_clz(chaos_u32_t value)
+{
+#if (CHAOS_GNUC == 1)
+    return (chaos_u32_t)__builtin_clz(value);
+#else
+    chaos_u32_t n = 0U;
+    while ((value & 0x80000000U) == 0U)
+    {
+        value <<= 1U;
+        n++;
+    }
+    return n;
+#endif
+}
+
+/**
+ * @brief Count the set bits of a 32-bit value.
+ */
+static CHAOS_ALWAYS_INLINE chaos_u32_t chaos_u32_popcount(chaos_u32_t value)
+{
+#if (CHAOS_GNUC == 1)
+    return (chaos_u32_t)__builtin_popcount(value);
+#else
+    value = value - ((value >> 1U) & 0x55555555U);
+    value = (value & 0x33333333U) + ((value >> 2U) & 0x33333333U);
+    value = (value + (value >> 4U)) & 0x0F0F0F0FU;
+    return (value * 0x01010101U) >> 24U;
+#endif
+}
+
+/**
+ * @brief Count trailing zero bits of a non-zero word.
+ */
+static CHAOS_ALWAYS_INLINE chaos_u32_t chaos_word_ctz(chaos_word_t value)
+{
+#if (CHAOS_PTR_WIDTH == 64) && (CHAOS_GNUC == 1)
+    return (chaos_u32_t)__builtin_ctzll(value);
+#elif (CHAOS_PTR_WIDTH == 64)
+    return (((chaos_u32_t)value) != 0U) ? chaos_u32_ctz((chaos_u32_t)value) : (32U + chaos_u32_ctz((chaos_u32_t)(value >> 32U)));
+#else
+    return chaos_u32_ctz(value);
+#endif
+}
+
+/**
+ * @brief Count leading zero bits of a non-zero word.
+ */
+static CHAOS_ALWAYS_INLINE chaos_u32_t chaos_word_clz(chaos_word_t value)
+{
+#if (CHAOS_PTR_WIDTH == 64) && (CHAOS_GNUC == 1)
+    return (chaos_u32_t)__builtin_clzll(value);
+#elif (CHAOS_PTR_WIDTH == 64)
+    return ((value >> 32U) != 0U) ? chaos_u32_clz((chaos_u32_t)(value >> 32U)) : (32U + chaos_u32_clz((chaos_u32_t)value));
+#else
+    return chaos_u32_clz(value);
+#endif
+}
+
+/* ============================================================= */
+/* WIDE MULTIPLY                                                 */
+/* ============================================================= */
+
+#if defined(CHAOS_ENABLE_INT64) && (CHAOS_ENABLE_INT64 == 1)
+/**
+ * @brief Full 64 x 64 -> 128-bit product.
+ * @param[in] a First factor
+ * @param[in] b Second factor
+ * @param[out] lo Low 64 bits of the product
+ * @param[out] hi High 64 bits of the product
+ */
+static CHAOS_ALWAYS_INLINE void chaos_u64_mul128(chaos_u64_t a, chaos_u64_t b, chaos_u64_t *lo, chaos_u64_t *hi)
+{
+#if (CHAOS_GNUC == 1) && defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 chaos_u128_t;
+    chaos_u128_t r = (chaos_u128_t)a * (chaos_u128_t)b;
+
+    *lo = (chaos_u64_t)r;
+    *hi = (chaos_u64_t)(r >> 64U);
+#else
+    /* Schoolbook on 32-bit halves */
+    chaos_u64_t a_lo = a & 0xFFFFFFFFULL;
+    chaos_u64_t a_hi = a >> 32U;
+    chaos_u64_t b_lo = b & 0xFFFFFFFFULL;
+    chaos_u64_t b_hi = b >> 32U;
+    chaos_u64_t ll = a_lo * b_lo;
+    chaos_u64_t lh = a_lo * b_hi;
+    chaos_u64_t hl = a_hi * b_lo;
+    chaos_u64_t hh = a_hi * b_hi;
+    chaos_u64_t mid = (ll >> 32U) + (lh & 0xFFFFFFFFULL) + (hl & 0xFFFFFFFFULL);
+
+    *lo = (mid << 32U) | (ll & 0xFFFFFFFFULL);
+    *hi = hh + (lh >> 32U) + (hl >> 32U) + (mid >> 32U);
+#endif
+}
+#endif
+
+/* ============================================================= */
+/* BYTE-LANE (SWAR) HELPERS                                      */
+/* ============================================================= */
+
+/**
+ * @brief Replicate a byte into every lane of a word.
+ */
+static CHAOS_ALWAYS_INLINE chaos_word_t chaos_word_splat(chaos_u8_t value)
+{
+    return CHAOS_WORD_ONES * (chaos_word_t)value;
+}
+
+/**
+ * @brief Flag the zero bytes of a word.
+ * @return 0x80 in every lane that is zero, 0x00 elsewhere. Exact: no lane is
+ *         flagged because of a borrow from its neighbour, so the result can
+ *         be scanned from either end.
+ */
+static CHAOS_ALWAYS_INLINE chaos_word_t chaos_word_zero_lanes(chaos_word_t value)
+{
+    return ~(((value & CHAOS_WORD_LOW7) + CHAOS_WORD_LOW7) | value | CHAOS_WORD_LOW7);
+}
+
+/**
+ * @brief Memory index of the first flagged lane of a non-zero lane mask.
+ */
+static CHAOS_ALWAYS_INLINE chaos_size_t chaos_word_first_lane(chaos_word_t mask)
+{
+#if (CHAOS_LITTLE_ENDIAN == 1)
+    return (chaos_size_t)(chaos_word_ctz(mask) >> 3U);
+#else
+    return (chaos_size_t)(chaos_word_clz(mask) >> 3U);
+#endif
+}
+
+/**
+ * @brief Memory index of the last flagged lane of a non-zero lane mask.
+ */
+static CHAOS_ALWAYS_INLINE chaos_size_t chaos_word_last_lane(chaos_word_t mask)
+{
+#if (CHAOS_LITTLE_ENDIAN == 1)
+    return (chaos_size_t)(CHAOS_WORD_SIZE - 1U - (chaos_word_clz(mask) >> 3U));
+#else
+    return (chaos_size_t)(CHAOS_WORD_SIZE - 1U - (chaos_word_ctz(mask) >> 3U));
+#endif
+}
+
+#endif /* CHAOS_BITS_H */
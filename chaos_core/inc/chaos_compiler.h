@@ -0,0 +1,109 @@
+/**
+ * @file chaos_compiler.h
+ * @brief Compiler abstraction and target feature detection for CHAOSLIB.
+ *
+ * Centralises every compiler extension used by the library so that the
+ * rest of the code base never spells a raw attribute or builtin.
+ */
+
+#ifndef CHAOS_COMPILER_H
+#define CHAOS_COMPILER_H
+
+/* ============================================================= */
+/* CONFIGURATION                                                 */
+/* ============================================================= */
+
+/**
+ * @brief Allow the use of SIMD intrinsics when the target supports them.
+ * @note Set to 0 to force the portable scalar/SWAR implementations.
+ */
+#ifndef CHAOS_ENABLE_SIMD
+#define CHAOS_ENABLE_SIMD 1
+#endif
+
+/* ============================================================= */
+/* ATTRIBUTES                                                    */
+/* ============================================================= */
+
+#if defined(__GNUC__) || defined(__clang__)
+#define CHAOS_GNUC 1
+#else
+#define CHAOS_GNUC 0
+#endif
+
+#if (CHAOS_GNUC == 1)
+#define CHAOS_WEAK            __attribute__((weak))
+#define CHAOS_MAY_ALIAS       __attribute__((__may_alias__))
+#define CHAOS_PACKED_ALIGN(n) __attribute__((__aligned__(n)))
+#define CHAOS_ALWAYS_INLINE   inline __attribute__((__always_inline__))
+#define CHAOS_LIKELY(x)       __builtin_expect(!!(x), 1)
+#define CHAOS_UNLIKELY(x)     __builtin_expect(!!(x), 0)
+#define CHAOS_PREFETCH(p)     __builtin_prefetch((p))
+#define CHAOS_IS_CONSTANT(x)  __builtin_constant_p(x)
+#define CHAOS_ATOMIC_LOAD_ACQUIRE(p)     __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define CHAOS_ATOMIC_STORE_RELEASE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#else
+#define CHAOS_WEAK
+#define CHAOS_MAY_ALIAS
+#define CHAOS_PACKED_ALIGN(n)
+#define CHAOS_ALWAYS_INLINE   inline
+#define CHAOS_LIKELY(x)       (x)
+#define CHAOS_UNLIKELY(x)     (x)
+#define CHAOS_PREFETCH(p)     ((void)(p))
+#define CHAOS_IS_CONSTANT(x)  0
+#define CHAOS_ATOMIC_LOAD_ACQUIRE(p)     (*(p))
+#define CHAOS_ATOMIC_STORE_RELEASE(p, v) (*(p) = (v))
+#endif
+
+/* ============================================================= */
+/* ENDIANNESS                                                    */
+/* ============================================================= */
+
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#define CHAOS_LITTLE_ENDIAN 0
+#else
+#define CHAOS_LITTLE_ENDIAN 1
+#endif
+
+/* ============================================================= */
+/* INSTRUCTION SET DETECTION                                     */
+/* ============================================================= */
+
+/**
+ * @name Instruction set availability
+ * @brief Each flag is 1 only when SIMD is enabled and the compiler targets the ISA
+ *        (e.g. via -msse4.2 / -mavx2 / -march=native in ARCH_FLAGS).
+ * @{
+ */
+#if (CHAOS_ENABLE_SIMD == 1) && defined(__SSE2__)
+#define CHAOS_HAS_SSE2 1
+#else
+#define CHAOS_HAS_SSE2 0
+#endif
+
+#if (CHAOS_ENABLE_SIMD == 1) && defined(__SSE4_1__)
+#define CHAOS_HAS_SSE41 1
+#else
+#define CHAOS_HAS_SSE41 0
+#endif
+
+#if (CHAOS_ENABLE_SIMD == 1) && defined(__SSE4_2__)
+#define CHAOS_HAS_SSE42 1
+#else
+#define CHAOS_HAS_SSE42 0
+#endif
+
+#if (CHAOS_ENABLE_SIMD == 1) && defined(__AVX2__)
+#define CHAOS_HAS_AVX2 1
+#else
+#define CHAOS_HAS_AVX2 0
+#endif
+
+#if (CHAOS_ENABLE_SIMD == 1) && defined(__PCLMUL__) && defined(__SSE4_1__)
+#define CHAOS_HAS_PCLMUL 1
+#else
+#define CHAOS_HAS_PCLMUL 0
+#endif
+/** @} */
+
+#endif /* CHAOS_COMPILER_H */
@@ -47,7 +47,8 @@ typedef enum
     CHAOS_MODULE_ALLOC    = 0x05U, /**< Dynamic memory allocators. */
     CHAOS_MODULE_MATH     = 0x06U, /**< Mathematical functions. */
     CHAOS_MODULE_STDLIB   = 0x07U, /**< Standard library wrappers. */
-    CHAOS_MODULE_PLATFORM = 0x08U  /**< Platform-specific abstractions. */
+    CHAOS_MODULE_PLATFORM = 0x08U, /**< Platform-specific abstractions. */
+    CHAOS_MODULE_CHECKSUM = 0x09U  /**< Checksums and CRCs. */
 } chaos_module_t;
 
 /* ============================================================= */
@@ -85,6 +86,7 @@ typedef enum
     CHAOS_MEM_SRC_EQ_DST  = 0x02U, /**< Source and destination addresses are identical; no copy required. */
     CHAOS_MEM_OVERFLOW    = 0x03U, /**< Memory operation would result in a buffer overflow. */
     CHAOS_MEM_ALIGNMENT   = 0x04U, /**< Memory address does not meet the required alignment criteria. */
+    CHAOS_MEM_BUSY        = 0x05U, /**< Asynchronous copy still in flight; wait again later. */
     CHAOS_MEM_UNKNOWN     = 0xFFU  /**< Generic or unidentified memory error */
 } chaos_memory_code_t;
 
@@ -100,6 +102,7 @@ typedef enum
     CHAOS_STRING_SIZE_ZERO    = 0x02U, /**< Size is zero */
     CHAOS_STRING_TRUNCATED    = 0x03U, /**< String was truncated */
     CHAOS_STRING_NOT_FOUND    = 0x04U, /**< Substring not found */
+    CHAOS_STRING_OUT_OF_RANGE = 0x05U, /**< Offset lies outside the string */
     CHAOS_STRING_UNKNOWN      = 0xFFU  /**< Generic unknown error */
 } chaos_string_code_t;
 
@@ -117,6 +120,37 @@ typedef enum
     CHAOS_ALLOC_DISABLED          = 0xFEU,  /**< Allocation feature is disabled. */
     CHAOS_ALLOC_UNKNOWN           = 0xFFU  /**< Generic or unidentified allocation error. */
 } chaos_alloc_code_t;
+
+/**
+ * @brief Specific error codes for the CHAOS_MODULE_STDLIB.
+ * These codes are intended to be used in the 'code' field of a #chaos_status_t
+ * when the module is set to #CHAOS_MODULE_STDLIB.
+ */
+typedef enum
+{
+    CHAOS_STD_OK           = 0x00U, /**< Operation successful. */
+    CHAOS_STD_NO_DIGITS    = 0x01U, /**< Input does not start with a number. */
+    CHAOS_STD_OVERFLOW     = 0x02U, /**< Number does not fit the result type; result saturated. */
+    CHAOS_STD_TRUNCATED    = 0x03U, /**< Output buffer too small; an empty string was written. */
+    CHAOS_STD_SIZE_ZERO    = 0x04U, /**< Element size is zero. */
+    CHAOS_STD_SCRATCH_SMALL = 0x05U, /**< Scratch buffer smaller than required. */
+    CHAOS_STD_FULL         = 0x06U, /**< Container has no free slot. */
+    CHAOS_STD_UNKNOWN      = 0xFFU  /**< Generic or unidentified stdlib error. */
+} chaos_std_code_t;
+
+/**
+ * @brief Specific error codes for the CHAOS_MODULE_CHECKSUM.
+ * These codes are intended to be used in the 'code' field of a #chaos_status_t
+ * when the module is set to #CHAOS_MODULE_CHECKSUM.
+ */
+typedef enum
+{
+    CHAOS_CHECKSUM_OK           = 0x00U, /**< Operation successful. */
+    CHAOS_CHECKSUM_SIZE_ZERO    = 0x01U, /**< Size parameter is zero; checksum left unchanged. */
+    CHAOS_CHECKSUM_BAD_TYPE     = 0x02U, /**< Unknown checksum algorithm requested. */
+    CHAOS_CHECKSUM_UNKNOWN      = 0xFFU  /**< Generic or unidentified checksum error. */
+} chaos_checksum_code_t;
+
 /* ============================================================= */
 /* STATUS ENCODING                                               */
 /* ============================================================= */
@@ -0,0 +1,84 @@
+/**
+ * @file chaos_hash.h
+ * @brief Fast non-cryptographic hashing for CHAOSLIB.
+ *
+ * chaos_hash64() is a wide-multiply hash: each step folds 16 bytes through
+ * one 64 x 64 -> 128-bit product, and inputs above 48 bytes run three such
+ * lanes side by side. Values are defined on the little-endian reading of
+ * the input, so they are identical on every target and may be stored.
+ * This is not a cryptographic hash: it offers no protection against keys
+ * chosen to collide.
+ *
+ * The streaming form (init/update/final) produces exactly the one-shot
+ * value however the input is split.
+ */
+
+#ifndef CHAOS_HASH_H
+#define CHAOS_HASH_H
+
+#include "chaos_types.h"
+#include "chaos_status.h"
+
+#if defined(CHAOS_ENABLE_INT64) && (CHAOS_ENABLE_INT64 == 1)
+
+/* ============================================================= */
+/* HASH TYPES                                                    */
+/* ============================================================= */
+
+/**
+ * @brief Streaming hash state.
+ */
+typedef struct
+{
+    chaos_u64_t seed;         /**< Running state of the first lane */
+    chaos_u64_t lane1;        /**< Second lane (inputs above 48 bytes) */
+    chaos_u64_t lane2;        /**< Third lane (inputs above 48 bytes) */
+    chaos_u64_t total;        /**< Bytes hashed so far */
+    chaos_u8_t buf[64];       /**< Last 16 bytes consumed, then up to 48 pending bytes */
+    chaos_size_t pending;     /**< Bytes waiting in buf[16..] */
+    chaos_bool_t wide;        /**< At least one 48-byte block was consumed */
+} chaos_hash64_state_t;
+
+/* ============================================================= */
+/* HASH FUNCTIONS                                                */
+/* ============================================================= */
+
+/**
+ * @brief Hash a buffer.
+ * @param[in] buf Data to hash (may be NULL when size is 0)
+ * @param[in] size Number of bytes
+ * @param[in] seed Seed selecting one function of the family
+ * @param[out] hash 64-bit hash value
+ * @return CHAOS_STATUS_OK on success or a CHAOS status code on error
+ */
+extern chaos_status_t chaos_hash64(const void *buf, chaos_size_t size, chaos_u64_t seed, chaos_u64_t *hash);
+
+/**
+ * @brief Start a streaming hash.
+ * @param[out] state State to initialise
+ * @param[in] seed Seed (as for chaos_hash64())
+ * @return CHAOS_STATUS_OK on success or a CHAOS status code on error
+ */
+extern chaos_status_t chaos_hash64_init(chaos_hash64_state_t *state, chaos_u64_t seed);
+
+/**
+ * @brief Feed more data to a streaming hash.
+ * @param[inout] state State from chaos_hash64_init()
+ * @param[in] buf Data (may be NULL when size is 0)
+ * @param[in] size Number of bytes
+ * @return CHAOS_STATUS_OK on success or a CHAOS status code on error
+ */
+extern chaos_status_t chaos_hash64_update(chaos_hash64_state_t *state, const void *buf, chaos_size_t size);
+
+/**
+ * @brief Get the hash of everything fed so far.
+ * @details The state is left unchanged, so more data may still be added.
+ * @param[in] state State from chaos_hash64_init()
+ * @param[out] hash 64-bit hash value
+ * @return CHAOS_STATUS_OK on success or a CHAOS status code on error
+ */
+extern chaos_status_t chaos_hash64_final(const chaos_hash64_state_t *state, chaos_u64_t *hash);
+
+#endif /* CHAOS_ENABLE_INT64 */
+
+#endif /* CHAOS_HASH_H */
@@ -12,6 +12,18 @@
 #include "chaos_types.h"
 #include "chaos_status.h"
 
+/* ============================================================= */
+/* SCATTER / GATHER DESCRIPTOR                                   */
+/* ============================================================= */
+
+/**
+ * @brief One contiguous fragment of a scatter/gather list.
+ */
+typedef struct
+{
+    void        *base; /**< Start of the fragment (may be NULL when len is 0) */
+    chaos_size_t len;  /**< Fragment length in bytes */
+} chaos_iovec_t;
 
 /* ============================================================= */
 /* MEMORY FUNCTIONS                                               */
@@ -44,6 +56,35 @@ extern chaos_status_t chaos_memmove(void *dst, const void *src, chaos_size_t siz
  */
 extern chaos_status_t chaos_memset(void *dst, chaos_u8_t value, chaos_size_t size);
 
+/**
+ * @brief Fill a buffer with a repeated 16-bit pattern.
+ * @param[inout] dst Destination buffer (any alignment)
+ * @param[in] value Pattern stored in native byte order
+ * @param[in] count Number of 16-bit elements to write
+ * @return CHAOS_STATUS_OK on success or a CHAOS status code on error
+ */
+extern chaos_status_t chaos_memset16(void *dst, chaos_u16_t value, chaos_size_t count);
+
+/**
+ * @brief Fill a buffer with a repeated 32-bit pattern.
+ * @param[inout] dst Destination buffer (any alignment)
+ * @param[in] value Pattern stored in native byte order
+ * @param[in] count Number of 32-bit elements to write
+ * @return CHAOS_STATUS_OK on success or a CHAOS status code on error
+ */
+extern chaos_status_t chaos_memset32(void *dst, chaos_u32_t value, chaos_size_t count);
+
+#if defined(CHAOS_ENABLE_INT64) && (CHAOS_ENABLE_INT64 == 1)
+/**
+ * @brief Fill a buffer with a repeated 64-bit pattern.
+ * @param[inout] dst Destination buffer (any alignment)
+ * @param[in] value Pattern stored in native byte order
+ * @param[in] count Number of 64-bit elements to write
+ * @return CHAOS_STATUS_OK on success or a CHAOS status code on error
+ */
+extern chaos_status_t chaos_memset64(void *dst, chaos_u64_t value, chaos_size_t count);
+#endif
+
 /**
  * @brief Memory comparison
  * @param[in] buf1 First buffer
@@ -59,4 +100,112 @@ extern chaos_status_t chaos_memcmp(
     chaos_bool_t *equal
 );
 
+/**
+ * @brief Find the first occurrence of a byte in a buffer.
+ * @param[in] buf Buffer to scan
+ * @param[in] size Number of bytes to scan
+ * @param[in] value Byte value to look for
+ * @param[out] offset Offset of the first match (set to @p size when not found)
+ * @param[out] found Output parameter set to CHAOS_TRUE if a match exists
+ * @return CHAOS_STATUS_OK on success or a CHAOS status code on error
+ */
+extern chaos_status_t chaos_memchr(
+    const void *buf,
+    chaos_size_t size,
+    chaos_u8_t value,
+    chaos_size_t *offset,
+    chaos_bool_t *found
+);
+
+/**
+ * @brief Find the last occurrence of a byte in a buffer.
+ * @param[in] buf Buffer to scan
+ * @param[in] size Number of bytes to scan
+ * @param[in] value Byte value to look for
+ * @param[out] offset Offset of the last match (set to @p size when not found)
+ * @param[out] found Output parameter set to CHAOS_TRUE if a match exists
+ * @return CHAOS_STATUS_OK on success or a CHAOS status code on error
+ */
+extern chaos_status_t chaos_memrchr(
+    const void *buf,
+    chaos_size_t size,
+    chaos_u8_t value,
+    chaos_size_t *offset,
+    chaos_bool_t *found
+);
+
+/**
+ * @brief Gather several fragments into one contiguous buffer.
+ * @details All descriptors are validated and the total length is checked
+ *          against @p dst_cap before the first byte is written, so the
+ *          destination is left untouched on error.
+ * @param[out] dst Destination buffer
+ * @param[in] dst_cap Capacity of the destination buffer in bytes
+ * @param[in] src Array of source fragments (copied in order)
+ * @param[in] count Number of entries in @p src
+ * @param[out] total Number of bytes written to @p dst
+ * @return CHAOS_STATUS_OK on success or a CHAOS status code on error
+ */
+extern chaos_status_t chaos_memcpy_gather(
+    void *dst,
+    chaos_size_t dst_cap,
+    const chaos_iovec_t *src,
+    chaos_size_t count,
+    chaos_size_t *total
+);
+
+/**
+ * @brief Scatter one contiguous buffer across several fragments.
+ * @details Fragments are filled in order until @p size bytes are consumed.
+ *          The combined fragment capacity is checked before any copy.
+ * @param[in] dst Array of destination fragments
+ * @param[in] count Number of entries in @p dst
+ * @param[in] src Source buffer
+ * @param[in] size Number of bytes to distribute
+ * @return CHAOS_STATUS_OK on success or a CHAOS status code on error
+ */
+extern chaos_status_t chaos_memcpy_scatter(
+    const chaos_iovec_t *dst,
+    chaos_size_t count,
+    const void *src,
+    chaos_size_t size
+);
+
+/* ============================================================= */
+/* PARALLEL COPY / FILL                                          */
+/* ============================================================= */
+
+/**
+ * @brief Minimum size in bytes before the parallel routines split the work.
+ * @note Smaller requests run serially; override with -DCHAOS_MEM_PARALLEL_THRESHOLD=n.
+ */
+#ifndef CHAOS_MEM_PARALLEL_THRESHOLD
+#define CHAOS_MEM_PARALLEL_THRESHOLD (1024U * 1024U)
+#endif
+
+/**
+ * @brief Memory copy split across worker threads.
+ * @details The destination is cut into @p threads cache-line aligned chunks which
+ *          are copied through the chaos_parallel_run() platform hook.
+ *          Requests below CHAOS_MEM_PARALLEL_THRESHOLD, or with @p threads <= 1,
+ *          behave exactly like chaos_memcpy().
+ * @param[inout] dst Destination buffer (must not overlap src)
+ * @param[in] src Source buffer
+ * @param[in] size Number of bytes to copy
+ * @param[in] threads Number of chunks (worker threads) to use
+ * @return CHAOS_STATUS_OK on success or a CHAOS status code on error
+ */
+extern chaos_status_t chaos_memcpy_parallel(void *dst, const void *src, chaos_size_t size, chaos_size_t threads);
+
+/**
+ * @brief Memory set split across worker threads.
+ * @details Same chunking and threshold rules as chaos_memcpy_parallel().
+ * @param[inout] dst Destination buffer
+ * @param[in] value Byte value to set
+ * @param[in] size Number of bytes to set
+ * @param[in] threads Number of chunks (worker threads) to use
+ * @return CHAOS_STATUS_OK on success or a CHAOS status code on error
+ */
+extern chaos_status_t chaos_memset_parallel(void *dst, chaos_u8_t value, chaos_size_t size, chaos_size_t threads);
+
 #endif /* CHAOS_MEMORY_H */
@@ -0,0 +1,58 @@
+/**
+ * @file chaos_memory_async.h
+ * @brief Asynchronous memory copy for CHAOSLIB.
+ *
+ * chaos_memcpy_async() hands a copy to the chaos_dma_submit() platform hook
+ * and returns at once; the caller overlaps other work with the transfer and
+ * collects the result with chaos_memcpy_poll() or chaos_memcpy_wait().
+ */
+
+#ifndef CHAOS_MEMORY_ASYNC_H
+#define CHAOS_MEMORY_ASYNC_H
+
+#include "chaos_types.h"
+#include "chaos_status.h"
+#include "chaos_dma.h"
+
+/* ============================================================= */
+/* ASYNCHRONOUS COPY                                             */
+/* ============================================================= */
+
+/**
+ * @brief Handle of one asynchronous copy; owned by the caller until waited on.
+ */
+typedef chaos_dma_request_t chaos_mem_async_t;
+
+/**
+ * @brief Start a memory copy and return without waiting for it.
+ * @details The copy is handed to the chaos_dma_submit() platform hook. Neither
+ *          buffer may be touched until chaos_memcpy_poll() reports completion or
+ *          chaos_memcpy_wait() returns. Every started copy must be waited on once.
+ * @param[inout] dst Destination buffer (must not overlap src)
+ * @param[in] src Source buffer
+ * @param[in] size Number of bytes to copy
+ * @param[out] handle Handle tracking the copy
+ * @return CHAOS_STATUS_OK if the copy was started or a CHAOS status code on error
+ */
+extern chaos_status_t chaos_memcpy_async(void *dst, const void *src, chaos_size_t size, chaos_mem_async_t *handle);
+
+/**
+ * @brief Check whether an asynchronous copy has finished, without blocking.
+ * @param[inout] handle Handle from chaos_memcpy_async()
+ * @param[out] done CHAOS_TRUE once the copy is complete
+ * @return CHAOS_STATUS_OK on success or a CHAOS status code on error
+ */
+extern chaos_status_t chaos_memcpy_poll(chaos_mem_async_t *handle, chaos_bool_t *done);
+
+/**
+ * @brief Wait for an asynchronous copy to finish.
+ * @details The wait is bounded by the chaos_dma_wait() hook. If the copy is
+ *          still in flight when it gives up, a CHAOS_MEM_BUSY warning is
+ *          returned and the handle stays valid: call again later.
+ * @param[inout] handle Handle from chaos_memcpy_async()
+ * @return Status of the copy itself, a CHAOS_MEM_BUSY warning, or a CHAOS
+ *         status code on error
+ */
+extern chaos_status_t chaos_memcpy_wait(chaos_mem_async_t *handle);
+
+#endif /* CHAOS_MEMORY_ASYNC_H */
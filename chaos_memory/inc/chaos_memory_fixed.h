@@ -0,0 +1,314 @@
+/**
+ * @file chaos_memory_fixed.h
+ * @brief Header-inline memory primitives specialised for compile-time sizes.
+ *
+ * chaos_memcpy_fixed() and chaos_memset_fixed() are meant for the small
+ * copies of fixed-size objects (typically 1 to 64 bytes). When the size is
+ * a compile-time constant they collapse to a handful of register moves;
+ * otherwise, or above CHAOS_MEM_FIXED_MAX, they forward to the out-of-line
+ * chaos_memcpy()/chaos_memset().
+ */
+
+#ifndef CHAOS_MEMORY_FIXED_H
+#define CHAOS_MEMORY_FIXED_H
+
+#include "chaos_types.h"
+#include "chaos_status.h"
+#include "chaos_assert.h"
+#include "chaos_bits.h"
+#include "chaos_memory.h"
+
+#if (CHAOS_HAS_SSE2 == 1)
+#include <emmintrin.h>
+#endif
+
+/* ============================================================= */
+/* CONFIGURATION                                                 */
+/* ============================================================= */
+
+/**
+ * @brief Enable parameter validation in the fixed-size primitives.
+ * @details Defaults to CHAOS_ENABLE_ASSERT. Define it to 0 before including
+ *          this header to strip the checks from hot paths while keeping
+ *          assertions elsewhere, or to 1 to keep them with assertions off.
+ */
+#ifndef CHAOS_MEM_FIXED_VALIDATE
+#define CHAOS_MEM_FIXED_VALIDATE CHAOS_ENABLE_ASSERT
+#endif
+
+/**
+ * @brief Largest constant size expanded inline; bigger sizes call the library.
+ */
+#ifndef CHAOS_MEM_FIXED_MAX
+#define CHAOS_MEM_FIXED_MAX 64U
+#endif
+
+#if (CHAOS_MEM_FIXED_MAX > 64U)
+#error "CHAOS_MEM_FIXED_MAX cannot exceed 64 bytes"
+#endif
+
+/* ============================================================= */
+/* INTERNAL HELPERS                                              */
+/* ============================================================= */
+
+/**
+ * @brief Validate fill parameters (same codes as chaos_memset).
+ */
+static CHAOS_ALWAYS_INLINE chaos_status_t chaos_mem_fixed_check_fill(const void *dst, chaos_size_t size)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+#if (CHAOS_MEM_FIXED_VALIDATE == 1)
+    if (dst == CHAOS_NULL)
+    {
+        status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_MEMORY, CHAOS_ERRCLASS_NULL_PTR, 0U);
+    }
+    else if (size == 0U)
+    {
+        status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_WARNING, CHAOS_MODULE_MEMORY, CHAOS_ERRCLASS_INVALID_PARAM, CHAOS_MEM_SIZE_ZERO);
+    }
+    else
+    {
+        /* Parameters valid */
+    }
+#else
+    (void)dst;
+    (void)size;
+#endif
+
+    return status;
+}
+
+/**
+ * @brief Validate copy parameters (same codes as chaos_memcpy).
+ */
+static CHAOS_ALWAYS_INLINE chaos_status_t chaos_mem_fixed_check_copy(const void *dst, const void *src, chaos_size_t size)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+#if (CHAOS_MEM_FIXED_VALIDATE == 1)
+    if (src == CHAOS_NULL)
+    {
+        status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_MEMORY, CHAOS_ERRCLASS_NULL_PTR, 0U);
+    }
+    else
+    {
+        status = chaos_mem_fixed_check_fill(dst, size);
+    }
+
+    if ((status == CHAOS_STATUS_OK) && (dst == src))
+    {
+        status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_WARNING, CHAOS_MODULE_MEMORY, CHAOS_ERRCLASS_INVALID_PARAM, CHAOS_MEM_SRC_EQ_DST);
+    }
+#else
+    (void)dst;
+    (void)src;
+    (void)size;
+#endif
+
+    return status;
+}
+
+/**
+ * @brief Copy 16 bytes between arbitrary addresses.
+ */
+static CHAOS_ALWAYS_INLINE void chaos_mem_fixed_copy16(chaos_u8_t *d, const chaos_u8_t *s)
+{
+#if (CHAOS_HAS_SSE2 == 1)
+    _mm_storeu_si128((__m128i *)(void *)d, _mm_loadu_si128((const __m128i *)(const void *)s));
+#else
+    chaos_u32_t w0 = chaos_u32_loadu(&s[0U]);
+    chaos_u32_t w1 = chaos_u32_loadu(&s[4U]);
+    chaos_u32_t w2 = chaos_u32_loadu(&s[8U]);
+    chaos_u32_t w3 = chaos_u32_loadu(&s[12U]);
+    chaos_u32_storeu(&d[0U], w0);
+    chaos_u32_storeu(&d[4U], w1);
+    chaos_u32_storeu(&d[8U], w2);
+    chaos_u32_storeu(&d[12U], w3);
+#endif
+}
+
+/**
+ * @brief Inline copy kernel for size <= 64.
+ * @details Written as a ladder of size tests rather than loops so that a
+ *          constant size folds to straight-line moves at any optimisation level.
+ */
+static CHAOS_ALWAYS_INLINE void chaos_mem_fixed_copy(chaos_u8_t *d, const chaos_u8_t *s, chaos_size_t size)
+{
+    chaos_size_t off = size & ~(chaos_size_t)15U;
+
+    if (size >= 16U)
+    {
+        chaos_mem_fixed_copy16(&d[0U], &s[0U]);
+    }
+    if (size >= 32U)
+    {
+        chaos_mem_fixed_copy16(&d[16U], &s[16U]);
+    }
+    if (size >= 48U)
+    {
+        chaos_mem_fixed_copy16(&d[32U], &s[32U]);
+    }
+    if (size >= 64U)
+    {
+        chaos_mem_fixed_copy16(&d[48U], &s[48U]);
+    }
+    if ((size & 8U) != 0U)
+    {
+        chaos_u32_t lo = chaos_u32_loadu(&s[off]);
+        chaos_u32_t hi = chaos_u32_loadu(&s[off + 4U]);
+        chaos_u32_storeu(&d[off], lo);
+        chaos_u32_storeu(&d[off + 4U], hi);
+        off += 8U;
+    }
+    if ((size & 4U) != 0U)
+    {
+        chaos_u32_storeu(&d[off], chaos_u32_loadu(&s[off]));
+        off += 4U;
+    }
+    if ((size & 2U) != 0U)
+    {
+        chaos_u16_storeu(&d[off], chaos_u16_loadu(&s[off]));
+        off += 2U;
+    }
+    if ((size & 1U) != 0U)
+    {
+        d[off] = s[off];
+    }
+}
+
+/**
+ * @brief Store 16 copies of a byte at an arbitrary address.
+ */
+static CHAOS_ALWAYS_INLINE void chaos_mem_fixed_fill16(chaos_u8_t *d, chaos_u8_t value)
+{
+#if (CHAOS_HAS_SSE2 == 1)
+    _mm_storeu_si128((__m128i *)(void *)d, _mm_set1_epi8((char)value));
+#else
+    chaos_u32_t p32 = 0x01010101U * (chaos_u32_t)value;
+    chaos_u32_storeu(&d[0U], p32);
+    chaos_u32_storeu(&d[4U], p32);
+    chaos_u32_storeu(&d[8U], p32);
+    chaos_u32_storeu(&d[12U], p32);
+#endif
+}
+
+/**
+ * @brief Inline fill kernel for size <= 64 (same ladder as the copy kernel).
+ */
+static CHAOS_ALWAYS_INLINE void chaos_mem_fixed_fill(chaos_u8_t *d, chaos_u8_t value, chaos_size_t size)
+{
+    chaos_u32_t p32 = 0x01010101U * (chaos_u32_t)value;
+    chaos_size_t off = size & ~(chaos_size_t)15U;
+
+    if (size >= 16U)
+    {
+        chaos_mem_fixed_fill16(&d[0U], value);
+    }
+    if (size >= 32U)
+    {
+        chaos_mem_fixed_fill16(&d[16U], value);
+    }
+    if (size >= 48U)
+    {
+        chaos_mem_fixed_fill16(&d[32U], value);
+    }
+    if (size >= 64U)
+    {
+        chaos_mem_fixed_fill16(&d[48U], value);
+    }
+    if ((size & 8U) != 0U)
+    {
+        chaos_u32_storeu(&d[off], p32);
+        chaos_u32_storeu(&d[off + 4U], p32);
+        off += 8U;
+    }
+    if ((size & 4U) != 0U)
+    {
+        chaos_u32_storeu(&d[off], p32);
+        off += 4U;
+    }
+    if ((size & 2U) != 0U)
+    {
+        chaos_u16_storeu(&d[off], (chaos_u16_t)p32);
+        off += 2U;
+    }
+    if ((size & 1U) != 0U)
+    {
+        d[off] = value;
+    }
+}
+
+/* ============================================================= */
+/* FIXED-SIZE MEMORY FUNCTIONS                                   */
+/* ============================================================= */
+
+/**
+ * @brief Copy a small object whose size is known at compile time.
+ * @param[inout] dst Destination buffer
+ * @param[in] src Source buffer (must not overlap dst)
+ * @param[in] size Number of bytes to copy (ideally a constant expression)
+ * @return CHAOS_STATUS_OK on success or a CHAOS status code on error
+ * @note Macro so that the constness of @p size is sampled at the call site,
+ *       which keeps the inline path even at -O0. @p size is evaluated once.
+ */
+#define chaos_memcpy_fixed(dst, src, size) \
+    chaos_memcpy_fixed_impl((dst), (src), (size), (chaos_bool_t)(CHAOS_IS_CONSTANT(size) != 0))
+
+/**
+ * @brief Fill a small object whose size is known at compile time.
+ * @param[inout] dst Destination buffer
+ * @param[in] value Byte value to set
+ * @param[in] size Number of bytes to set (ideally a constant expression)
+ * @return CHAOS_STATUS_OK on success or a CHAOS status code on error
+ */
+#define chaos_memset_fixed(dst, value, size) \
+    chaos_memset_fixed_impl((dst), (value), (size), (chaos_bool_t)(CHAOS_IS_CONSTANT(size) != 0))
+
+/**
+ * @brief Back end of chaos_memcpy_fixed(); do not call directly.
+ */
+static CHAOS_ALWAYS_INLINE chaos_status_t chaos_memcpy_fixed_impl(void *dst, const void *src, chaos_size_t size, chaos_bool_t is_const)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    if ((is_const == CHAOS_TRUE) && (size <= CHAOS_MEM_FIXED_MAX))
+    {
+        status = chaos_mem_fixed_check_copy(dst, src, size);
+        if (status == CHAOS_STATUS_OK)
+        {
+            chaos_mem_fixed_copy((chaos_u8_t *)dst, (const chaos_u8_t *)src, size);
+        }
+    }
+    else
+    {
+        status = chaos_memcpy(dst, src, size);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Back end of chaos_memset_fixed(); do not call directly.
+ */
+static CHAOS_ALWAYS_INLINE chaos_status_t chaos_memset_fixed_impl(void *dst, chaos_u8_t value, chaos_size_t size, chaos_bool_t is_const)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    if ((is_const == CHAOS_TRUE) && (size <= CHAOS_MEM_FIXED_MAX))
+    {
+        status = chaos_mem_fixed_check_fill(dst, size);
+        if (status == CHAOS_STATUS_OK)
+        {
+            chaos_mem_fixed_fill((chaos_u8_t *)dst, value, size);
+        }
+    }
+    else
+    {
+        status = chaos_memset(dst, value, size);
+    }
+
+    return status;
+}
+
+#endif /* CHAOS_MEMORY_FIXED_H */
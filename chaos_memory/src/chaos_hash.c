@@ -0,0 +1,276 @@
+/**
+ * @file chaos_hash.c
+ * @brief Implementation of the wide-multiply hash.
+ *
+ * The construction follows wyhash: every step xors 16 input bytes with a
+ * secret and the running state, multiplies the two halves to 128 bits and
+ * folds the product back to 64 bits.
+ */
+
+#include "chaos_hash.h"
+
+#if defined(CHAOS_ENABLE_INT64) && (CHAOS_ENABLE_INT64 == 1)
+
+#include "chaos_assert.h"
+#include "chaos_bits.h"
+
+/* ============================================================= */
+/* CONSTANTS                                                     */
+/* ============================================================= */
+
+/* Secrets of the wyhash family (odd, balanced bit counts) */
+#define CHAOS_HASH_S0 0xA0761D6478BD642FULL
+#define CHAOS_HASH_S1 0xE7037ED1A0B428DBULL
+#define CHAOS_HASH_S2 0x8EBC6AF09C88C6E3ULL
+#define CHAOS_HASH_S3 0x589965CC75374CC3ULL
+
+/* Bytes per three-lane block */
+#define CHAOS_HASH_BLOCK 48U
+
+/* Bytes of history kept ahead of the pending data in the streaming buffer */
+#define CHAOS_HASH_HISTORY 16U
+
+/* ============================================================= */
+/* FUNCTION PROTOTYPES                                          */
+/* ============================================================= */
+static chaos_u64_t chaos_hash_mix(chaos_u64_t a, chaos_u64_t b);
+static chaos_u64_t chaos_hash_r8(const chaos_u8_t *p);
+static chaos_u64_t chaos_hash_r4(const chaos_u8_t *p);
+static void chaos_hash_block(const chaos_u8_t *p, chaos_u64_t *seed, chaos_u64_t *lane1, chaos_u64_t *lane2);
+static chaos_u64_t chaos_hash_tail(const chaos_u8_t *p, chaos_size_t size, chaos_u64_t seed, chaos_u64_t total);
+
+/* ============================================================= */
+/* HASH64                                                        */
+/* ============================================================= */
+chaos_status_t chaos_hash64(const void *buf, chaos_size_t size, chaos_u64_t seed, chaos_u64_t *hash)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    const chaos_u8_t *p = (const chaos_u8_t *)buf;
+    chaos_size_t i = size;
+    chaos_u64_t lane1;
+    chaos_u64_t lane2;
+
+    chaos_assert_not_null(hash, &status, CHAOS_MODULE_MEMORY);
+    if (size != 0U)
+    {
+        chaos_assert_not_null(buf, &status, CHAOS_MODULE_MEMORY);
+    }
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        seed ^= chaos_hash_mix(seed ^ CHAOS_HASH_S0, CHAOS_HASH_S1);
+
+        if (i > CHAOS_HASH_BLOCK)
+        {
+            lane1 = seed;
+            lane2 = seed;
+            do
+            {
+                chaos_hash_block(p, &seed, &lane1, &lane2);
+                p += CHAOS_HASH_BLOCK;
+                i -= CHAOS_HASH_BLOCK;
+            } while (i > CHAOS_HASH_BLOCK);
+            seed ^= lane1 ^ lane2;
+        }
+
+        *hash = chaos_hash_tail(p, i, seed, (chaos_u64_t)size);
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* STREAMING                                                     */
+/* ============================================================= */
+chaos_status_t chaos_hash64_init(chaos_hash64_state_t *state, chaos_u64_t seed)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    chaos_assert_not_null(state, &status, CHAOS_MODULE_MEMORY);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        state->seed = seed ^ chaos_hash_mix(seed ^ CHAOS_HASH_S0, CHAOS_HASH_S1);
+        state->lane1 = state->seed;
+        state->lane2 = state->seed;
+        state->total = 0U;
+        state->pending = 0U;
+        state->wide = CHAOS_FALSE;
+    }
+
+    return status;
+}
+
+chaos_status_t chaos_hash64_update(chaos_hash64_state_t *state, const void *buf, chaos_size_t size)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    const chaos_u8_t *p = (const chaos_u8_t *)buf;
+    chaos_u8_t *pend;
+    chaos_size_t take;
+    chaos_size_t i;
+
+    chaos_assert_not_null(state, &status, CHAOS_MODULE_MEMORY);
+    if (size != 0U)
+    {
+        chaos_assert_not_null(buf, &status, CHAOS_MODULE_MEMORY);
+    }
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        state->total += (chaos_u64_t)size;
+        pend = &state->buf[CHAOS_HASH_HISTORY];
+
+        while (size != 0U)
+        {
+            /* A full block is only consumed once more input is known to follow it */
+            if (state->pending == CHAOS_HASH_BLOCK)
+            {
+                chaos_hash_block(pend, &state->seed, &state->lane1, &state->lane2);
+                state->wide = CHAOS_TRUE;
+                for (i = 0U; i < CHAOS_HASH_HISTORY; i++)
+                {
+                    state->buf[i] = pend[(CHAOS_HASH_BLOCK - CHAOS_HASH_HISTORY) + i];
+                }
+                state->pending = 0U;
+            }
+
+            /* Straight from the caller buffer while whole blocks remain beyond it */
+            while ((state->pending == 0U) && (size > CHAOS_HASH_BLOCK))
+            {
+                chaos_hash_block(p, &state->seed, &state->lane1, &state->lane2);
+                state->wide = CHAOS_TRUE;
+                for (i = 0U; i < CHAOS_HASH_HISTORY; i++)
+                {
+                    state->buf[i] = p[(CHAOS_HASH_BLOCK - CHAOS_HASH_HISTORY) + i];
+                }
+                p += CHAOS_HASH_BLOCK;
+                size -= CHAOS_HASH_BLOCK;
+            }
+
+            take = CHAOS_HASH_BLOCK - state->pending;
+            take = (size < take) ? size : take;
+            for (i = 0U; i < take; i++)
+            {
+                pend[state->pending + i] = p[i];
+            }
+            state->pending += take;
+            p += take;
+            size -= take;
+        }
+    }
+
+    return status;
+}
+
+chaos_status_t chaos_hash64_final(const chaos_hash64_state_t *state, chaos_u64_t *hash)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_u64_t seed;
+
+    chaos_assert_not_null(state, &status, CHAOS_MODULE_MEMORY);
+    chaos_assert_not_null(hash, &status, CHAOS_MODULE_MEMORY);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        seed = state->seed;
+        if (state->wide == CHAOS_TRUE)
+        {
+            seed ^= state->lane1 ^ state->lane2;
+        }
+
+        /* The tail may read back into the 16 bytes of history */
+        *hash = chaos_hash_tail(&state->buf[CHAOS_HASH_HISTORY], state->pending, seed, state->total);
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* INTERNAL HELPERS                                              */
+/* ============================================================= */
+
+/* Multiply to 128 bits and fold the halves */
+static chaos_u64_t chaos_hash_mix(chaos_u64_t a, chaos_u64_t b)
+{
+    chaos_u64_t lo;
+    chaos_u64_t hi;
+
+    chaos_u64_mul128(a, b, &lo, &hi);
+
+    return lo ^ hi;
+}
+
+/* Little-endian loads, so hash values do not depend on the target */
+static chaos_u64_t chaos_hash_r8(const chaos_u8_t *p)
+{
+#if (CHAOS_LITTLE_ENDIAN == 1)
+    return chaos_u64_loadu(p);
+#else
+    return (chaos_hash_r4(p + 4) << 32U) | chaos_hash_r4(p);
+#endif
+}
+
+static chaos_u64_t chaos_hash_r4(const chaos_u8_t *p)
+{
+#if (CHAOS_LITTLE_ENDIAN == 1)
+    return (chaos_u64_t)chaos_u32_loadu(p);
+#else
+    return (chaos_u64_t)p[0] | ((chaos_u64_t)p[1] << 8U) | ((chaos_u64_t)p[2] << 16U) | ((chaos_u64_t)p[3] << 24U);
+#endif
+}
+
+/* One 48-byte step: three independent 16-byte multiplies */
+static void chaos_hash_block(const chaos_u8_t *p, chaos_u64_t *seed, chaos_u64_t *lane1, chaos_u64_t *lane2)
+{
+    *seed = chaos_hash_mix(chaos_hash_r8(p) ^ CHAOS_HASH_S1, chaos_hash_r8(p + 8) ^ *seed);
+    *lane1 = chaos_hash_mix(chaos_hash_r8(p + 16) ^ CHAOS_HASH_S2, chaos_hash_r8(p + 24) ^ *lane1);
+    *lane2 = chaos_hash_mix(chaos_hash_r8(p + 32) ^ CHAOS_HASH_S3, chaos_hash_r8(p + 40) ^ *lane2);
+}
+
+/*
+ * Last at most 48 bytes. Above 16 bytes in total, the final 16 bytes are
+ * read as two overlapping words ending at the last byte, which may reach
+ * back before p (into data already consumed).
+ */
+static chaos_u64_t chaos_hash_tail(const chaos_u8_t *p, chaos_size_t size, chaos_u64_t seed, chaos_u64_t total)
+{
+    chaos_u64_t a = 0U;
+    chaos_u64_t b = 0U;
+    chaos_size_t i = size;
+    chaos_size_t q;
+
+    if (total <= 16U)
+    {
+        if (i >= 4U)
+        {
+            q = (i >> 3U) << 2U;
+            a = (chaos_hash_r4(p) << 32U) | chaos_hash_r4(p + q);
+            b = (chaos_hash_r4(p + i - 4U) << 32U) | chaos_hash_r4(p + i - 4U - q);
+        }
+        else if (i > 0U)
+        {
+            a = ((chaos_u64_t)p[0] << 16U) | ((chaos_u64_t)p[i >> 1U] << 8U) | (chaos_u64_t)p[i - 1U];
+        }
+        else
+        {
+            /* Empty input */
+        }
+    }
+    else
+    {
+        while (i > 16U)
+        {
+            seed = chaos_hash_mix(chaos_hash_r8(p) ^ CHAOS_HASH_S1, chaos_hash_r8(p + 8) ^ seed);
+            p += 16;
+            i -= 16U;
+        }
+        a = chaos_hash_r8(p + i - 16);
+        b = chaos_hash_r8(p + i - 8);
+    }
+
+    chaos_u64_mul128(a ^ CHAOS_HASH_S1, b ^ seed, &a, &b);
+
+    return chaos_hash_mix(a ^ CHAOS_HASH_S0 ^ total, b ^ CHAOS_HASH_S1);
+}
+
+#endif /* CHAOS_ENABLE_INT64 */
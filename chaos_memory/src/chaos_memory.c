@@ -1,5 +1,40 @@
 #include "chaos_memory.h"
 #include "chaos_assert.h"
+#include "chaos_bits.h"
+
+#if (CHAOS_HAS_SSE2 == 1)
+#include <emmintrin.h>
+#endif
+#if (CHAOS_HAS_AVX2 == 1)
+#include <immintrin.h>
+#endif
+
+/* ============================================================= */
+/* COPY ENGINE CONFIGURATION                                     */
+/* ============================================================= */
+
+/* Below this size the byte loop beats the alignment prologue */
+#define CHAOS_MEM_WIDE_MIN (4U * CHAOS_WORD_SIZE)
+
+/* Alignment targeted for destination stores */
+#if (CHAOS_HAS_AVX2 == 1)
+#define CHAOS_MEM_VEC_ALIGN ((chaos_uintptr_t)32U)
+#elif (CHAOS_HAS_SSE2 == 1)
+#define CHAOS_MEM_VEC_ALIGN ((chaos_uintptr_t)16U)
+#else
+#define CHAOS_MEM_VEC_ALIGN ((chaos_uintptr_t)CHAOS_WORD_SIZE)
+#endif
+
+/* ============================================================= */
+/* FUNCTION PROTOTYPES                                          */
+/* ============================================================= */
+static void chaos_mem_copy_fwd(chaos_u8_t *d, const chaos_u8_t *s, chaos_size_t size);
+static void chaos_mem_copy_bwd(chaos_u8_t *d, const chaos_u8_t *s, chaos_size_t size);
+static void chaos_mem_fill(chaos_u8_t *d, const chaos_u8_t *pattern, chaos_size_t esize, chaos_size_t size);
+static chaos_status_t chaos_mem_fill_n(void *dst, const chaos_u8_t *pattern, chaos_size_t esize, chaos_size_t count);
+static chaos_bool_t chaos_mem_find_fwd(const chaos_u8_t *p, chaos_size_t size, chaos_u8_t value, chaos_size_t *pos);
+static chaos_bool_t chaos_mem_find_bwd(const chaos_u8_t *p, chaos_size_t size, chaos_u8_t value, chaos_size_t *pos);
+static chaos_status_t chaos_mem_iov_total(const chaos_iovec_t *iov, chaos_size_t count, chaos_size_t *total);
 
 /* ============================================================= */
 /* MEMCPY                                                        */
@@ -9,7 +44,6 @@ chaos_status_t chaos_memcpy(void *dst, const void *src, chaos_size_t size)
     chaos_status_t status = CHAOS_STATUS_OK;
     const chaos_u8_t *s = (const chaos_u8_t *)src;
     chaos_u8_t *d = (chaos_u8_t *)dst;
-    chaos_size_t i = 0U;
 
     /* Validate parameters */
     chaos_assert_not_null(dst, &status, CHAOS_MODULE_MEMORY);
@@ -20,10 +54,7 @@ chaos_status_t chaos_memcpy(void *dst, const void *src, chaos_size_t size)
     /* Perform copy if no errors */
     if (status == CHAOS_STATUS_OK)
     {
-        for (i = 0U; i < size; i++)
-        {
-            d[i] = s[i];
-        }
+        chaos_mem_copy_fwd(d, s, size);
     }
 
     return status;
@@ -37,7 +68,6 @@ chaos_status_t chaos_memmove(void *dst, const void *src, chaos_size_t size)
     chaos_status_t status = CHAOS_STATUS_OK;
     chaos_u8_t *d = (chaos_u8_t *)dst;
     const chaos_u8_t *s = (const chaos_u8_t *)src;
-    chaos_size_t i = 0U;
 
     /* Validate parameters */
     chaos_assert_not_null(dst, &status, CHAOS_MODULE_MEMORY);
@@ -48,21 +78,19 @@ chaos_status_t chaos_memmove(void *dst, const void *src, chaos_size_t size)
     /* Perform move if no errors */
     if (status == CHAOS_STATUS_OK)
     {
-        /* Determine copy direction based on overlap */
-        if (d < s)
+        /*
+         * Forward copy is safe when dst is below src or when the regions
+         * do not overlap at all: (dst - src) wraps to a huge value in the
+         * first case and is >= size in the second.
+         */
+        if (((chaos_uintptr_t)d - (chaos_uintptr_t)s) >= (chaos_uintptr_t)size)
         {
-            for (i = 0U; i < size; i++)
-            {
-                d[i] = s[i];
-            }
+            chaos_mem_copy_fwd(d, s, size);
         }
-        /* Copy backward if dst > src to handle overlap */
+        /* dst lies inside [src, src + size): copy backward */
         else
         {
-            for (i = size; i > 0U; i--)
-            {
-                d[i-1U] = s[i-1U];
-            }
+            chaos_mem_copy_bwd(d, s, size);
         }
     }
 
@@ -76,8 +104,6 @@ chaos_status_t chaos_memmove(void *dst, const void *src, chaos_size_t size)
 chaos_status_t chaos_memset(void *dst, chaos_u8_t value, chaos_size_t size)
 {
     chaos_status_t status = CHAOS_STATUS_OK;
-    chaos_u8_t *d = (chaos_u8_t *)dst;
-    chaos_size_t i = 0U;
 
     /* Validate parameters */
     chaos_assert_not_null(dst, &status, CHAOS_MODULE_MEMORY);
@@ -86,14 +112,79 @@ chaos_status_t chaos_memset(void *dst, chaos_u8_t value, chaos_size_t size)
     /* Perform set if no errors */
     if (status == CHAOS_STATUS_OK)
     {
-        for (i = 0U; i < size; i++)
-        {
-            d[i] = value;
-        }
+        chaos_mem_fill((chaos_u8_t *)dst, &value, 1U, size);
     }
     return status;
 }
 
+/* ============================================================= */
+/* MEMSET16 / MEMSET32 / MEMSET64                                */
+/* ============================================================= */
+chaos_status_t chaos_memset16(void *dst, chaos_u16_t value, chaos_size_t count)
+{
+    chaos_u8_t pattern[2];
+
+    chaos_u16_storeu(pattern, value);
+
+    return chaos_mem_fill_n(dst, pattern, 2U, count);
+}
+
+chaos_status_t chaos_memset32(void *dst, chaos_u32_t value, chaos_size_t count)
+{
+    chaos_u8_t pattern[4];
+
+    chaos_u32_storeu(pattern, value);
+
+    return chaos_mem_fill_n(dst, pattern, 4U, count);
+}
+
+#if defined(CHAOS_ENABLE_INT64) && (CHAOS_ENABLE_INT64 == 1)
+chaos_status_t chaos_memset64(void *dst, chaos_u64_t value, chaos_size_t count)
+{
+    chaos_u8_t pattern[8];
+
+    /* Memory order of a native u64 is the memory order of its two halves */
+#if (CHAOS_LITTLE_ENDIAN == 1)
+    chaos_u32_storeu(&pattern[0], (chaos_u32_t)value);
+    chaos_u32_storeu(&pattern[4], (chaos_u32_t)(value >> 32U));
+#else
+    chaos_u32_storeu(&pattern[0], (chaos_u32_t)(value >> 32U));
+    chaos_u32_storeu(&pattern[4], (chaos_u32_t)value);
+#endif
+
+    return chaos_mem_fill_n(dst, pattern, 8U, count);
+}
+#endif
+
+/* ============================================================= */
+/* PATTERN FILL FRONT-END                                        */
+/* ============================================================= */
+/*
+ * Shared validation of the multi-byte fills: 'count' is in elements and
+ * the byte size must fit in chaos_size_t.
+ */
+static chaos_status_t chaos_mem_fill_n(void *dst, const chaos_u8_t *pattern, chaos_size_t esize, chaos_size_t count)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    /* Validate parameters */
+    chaos_assert_not_null(dst, &status, CHAOS_MODULE_MEMORY);
+    chaos_assert_param((count != 0U), &status, CHAOS_SEVERITY_WARNING, CHAOS_MODULE_MEMORY, CHAOS_MEM_SIZE_ZERO);
+
+    if ((status == CHAOS_STATUS_OK) && (count > (chaos_u32_t_MAX / esize)))
+    {
+        status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_MEMORY, CHAOS_ERRCLASS_OVERFLOW, CHAOS_MEM_OVERFLOW);
+    }
+
+    /* Perform fill if no errors */
+    if (status == CHAOS_STATUS_OK)
+    {
+        chaos_mem_fill((chaos_u8_t *)dst, pattern, esize, count * esize);
+    }
+
+    return status;
+}
+
 /* ============================================================= */
 /* MEMCMP                                                           */
 /* ============================================================= */
@@ -131,3 +222,731 @@ chaos_status_t chaos_memcmp(
 
     return status;
 }
+
+/* ============================================================= */
+/* MEMCHR                                                        */
+/* ============================================================= */
+chaos_status_t chaos_memchr(
+    const void *buf,
+    chaos_size_t size,
+    chaos_u8_t value,
+    chaos_size_t *offset,
+    chaos_bool_t *found)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    /* Validate parameters */
+    chaos_assert_not_null(buf, &status, CHAOS_MODULE_MEMORY);
+    chaos_assert_not_null(offset, &status, CHAOS_MODULE_MEMORY);
+    chaos_assert_not_null(found, &status, CHAOS_MODULE_MEMORY);
+    chaos_assert_param((size != 0U), &status, CHAOS_SEVERITY_WARNING, CHAOS_MODULE_MEMORY, CHAOS_MEM_SIZE_ZERO);
+
+    /* Perform search if no errors */
+    if (status == CHAOS_STATUS_OK)
+    {
+        *offset = size;
+        *found = chaos_mem_find_fwd((const chaos_u8_t *)buf, size, value, offset);
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* MEMRCHR                                                       */
+/* ============================================================= */
+chaos_status_t chaos_memrchr(
+    const void *buf,
+    chaos_size_t size,
+    chaos_u8_t value,
+    chaos_size_t *offset,
+    chaos_bool_t *found)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    /* Validate parameters */
+    chaos_assert_not_null(buf, &status, CHAOS_MODULE_MEMORY);
+    chaos_assert_not_null(offset, &status, CHAOS_MODULE_MEMORY);
+    chaos_assert_not_null(found, &status, CHAOS_MODULE_MEMORY);
+    chaos_assert_param((size != 0U), &status, CHAOS_SEVERITY_WARNING, CHAOS_MODULE_MEMORY, CHAOS_MEM_SIZE_ZERO);
+
+    /* Perform search if no errors */
+    if (status == CHAOS_STATUS_OK)
+    {
+        *offset = size;
+        *found = chaos_mem_find_bwd((const chaos_u8_t *)buf, size, value, offset);
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* GATHER                                                        */
+/* ============================================================= */
+chaos_status_t chaos_memcpy_gather(
+    void *dst,
+    chaos_size_t dst_cap,
+    const chaos_iovec_t *src,
+    chaos_size_t count,
+    chaos_size_t *total)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_u8_t *d = (chaos_u8_t *)dst;
+    chaos_size_t needed = 0U;
+    chaos_size_t i = 0U;
+
+    /* Validate parameters */
+    chaos_assert_not_null(dst, &status, CHAOS_MODULE_MEMORY);
+    chaos_assert_not_null(src, &status, CHAOS_MODULE_MEMORY);
+    chaos_assert_not_null(total, &status, CHAOS_MODULE_MEMORY);
+    chaos_assert_param((count != 0U), &status, CHAOS_SEVERITY_WARNING, CHAOS_MODULE_MEMORY, CHAOS_MEM_SIZE_ZERO);
+
+    /* Validate every fragment and the total length once, up front */
+    if (status == CHAOS_STATUS_OK)
+    {
+        status = chaos_mem_iov_total(src, count, &needed);
+    }
+
+    if ((status == CHAOS_STATUS_OK) && (needed > dst_cap))
+    {
+        status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_MEMORY, CHAOS_ERRCLASS_OVERFLOW, CHAOS_MEM_OVERFLOW);
+    }
+
+    /* Perform gather if no errors */
+    if (status == CHAOS_STATUS_OK)
+    {
+        for (i = 0U; i < count; i++)
+        {
+            chaos_mem_copy_fwd(d, (const chaos_u8_t *)src[i].base, src[i].len);
+            d += src[i].len;
+        }
+
+        *total = needed;
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* SCATTER                                                       */
+/* ============================================================= */
+chaos_status_t chaos_memcpy_scatter(
+    const chaos_iovec_t *dst,
+    chaos_size_t count,
+    const void *src,
+    chaos_size_t size)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    const chaos_u8_t *s = (const chaos_u8_t *)src;
+    chaos_size_t capacity = 0U;
+    chaos_size_t remaining = size;
+    chaos_size_t chunk = 0U;
+    chaos_size_t i = 0U;
+
+    /* Validate parameters */
+    chaos_assert_not_null(dst, &status, CHAOS_MODULE_MEMORY);
+    chaos_assert_not_null(src, &status, CHAOS_MODULE_MEMORY);
+    chaos_assert_param((count != 0U), &status, CHAOS_SEVERITY_WARNING, CHAOS_MODULE_MEMORY, CHAOS_MEM_SIZE_ZERO);
+    chaos_assert_param((size != 0U), &status, CHAOS_SEVERITY_WARNING, CHAOS_MODULE_MEMORY, CHAOS_MEM_SIZE_ZERO);
+
+    /* Validate every fragment and the total capacity once, up front */
+    if (status == CHAOS_STATUS_OK)
+    {
+        status = chaos_mem_iov_total(dst, count, &capacity);
+    }
+
+    if ((status == CHAOS_STATUS_OK) && (size > capacity))
+    {
+        status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_MEMORY, CHAOS_ERRCLASS_OVERFLOW, CHAOS_MEM_OVERFLOW);
+    }
+
+    /* Perform scatter if no errors */
+    if (status == CHAOS_STATUS_OK)
+    {
+        for (i = 0U; (i < count) && (remaining > 0U); i++)
+        {
+            chunk = (dst[i].len < remaining) ? dst[i].len : remaining;
+            chaos_mem_copy_fwd((chaos_u8_t *)dst[i].base, s, chunk);
+            s += chunk;
+            remaining -= chunk;
+        }
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* IOVEC VALIDATION HELPER                                       */
+/* ============================================================= */
+/*
+ * Checks that every non-empty fragment has a base pointer and that the
+ * summed length fits in chaos_size_t.
+ */
+static chaos_status_t chaos_mem_iov_total(const chaos_iovec_t *iov, chaos_size_t count, chaos_size_t *total)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_size_t sum = 0U;
+    chaos_size_t i = 0U;
+
+    for (i = 0U; (i < count) && (status == CHAOS_STATUS_OK); i++)
+    {
+        if ((iov[i].base == CHAOS_NULL) && (iov[i].len != 0U))
+        {
+            status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_MEMORY, CHAOS_ERRCLASS_NULL_PTR, 0U);
+        }
+        else if (iov[i].len > (chaos_u32_t_MAX - sum))
+        {
+            status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_MEMORY, CHAOS_ERRCLASS_OVERFLOW, CHAOS_MEM_OVERFLOW);
+        }
+        else
+        {
+            sum += iov[i].len;
+        }
+    }
+
+    *total = sum;
+
+    return status;
+}
+
+/* ============================================================= */
+/* FORWARD COPY ENGINE                                           */
+/* ============================================================= */
+/*
+ * Copies low to high addresses. Every block is fully loaded before it is
+ * stored, so the engine is also correct for overlapping regions as long as
+ * dst is below src.
+ */
+static void chaos_mem_copy_fwd(chaos_u8_t *d, const chaos_u8_t *s, chaos_size_t size)
+{
+    chaos_size_t n = size;
+    chaos_size_t head = 0U;
+
+    if (n >= CHAOS_MEM_WIDE_MIN)
+    {
+        /* Align destination so the wide stores never split a line */
+        head = (chaos_size_t)((CHAOS_MEM_VEC_ALIGN - ((chaos_uintptr_t)d & (CHAOS_MEM_VEC_ALIGN - 1U))) & (CHAOS_MEM_VEC_ALIGN - 1U));
+        if (head > n)
+        {
+            head = n;
+        }
+        n -= head;
+        while (head > 0U)
+        {
+            *d = *s;
+            d++;
+            s++;
+            head--;
+        }
+
+#if (CHAOS_HAS_AVX2 == 1)
+        while (n >= 128U)
+        {
+            __m256i v0 = _mm256_loadu_si256((const __m256i *)(const void *)(s));
+            __m256i v1 = _mm256_loadu_si256((const __m256i *)(const void *)(s + 32U));
+            __m256i v2 = _mm256_loadu_si256((const __m256i *)(const void *)(s + 64U));
+            __m256i v3 = _mm256_loadu_si256((const __m256i *)(const void *)(s + 96U));
+            _mm256_store_si256((__m256i *)(void *)(d), v0);
+            _mm256_store_si256((__m256i *)(void *)(d + 32U), v1);
+            _mm256_store_si256((__m256i *)(void *)(d + 64U), v2);
+            _mm256_store_si256((__m256i *)(void *)(d + 96U), v3);
+            d += 128U;
+            s += 128U;
+            n -= 128U;
+        }
+#endif
+#if (CHAOS_HAS_SSE2 == 1)
+        while (n >= 64U)
+        {
+            __m128i v0 = _mm_loadu_si128((const __m128i *)(const void *)(s));
+            __m128i v1 = _mm_loadu_si128((const __m128i *)(const void *)(s + 16U));
+            __m128i v2 = _mm_loadu_si128((const __m128i *)(const void *)(s + 32U));
+            __m128i v3 = _mm_loadu_si128((const __m128i *)(const void *)(s + 48U));
+            _mm_store_si128((__m128i *)(void *)(d), v0);
+            _mm_store_si128((__m128i *)(void *)(d + 16U), v1);
+            _mm_store_si128((__m128i *)(void *)(d + 32U), v2);
+            _mm_store_si128((__m128i *)(void *)(d + 48U), v3);
+            d += 64U;
+            s += 64U;
+            n -= 64U;
+        }
+        while (n >= 16U)
+        {
+            _mm_store_si128((__m128i *)(void *)d, _mm_loadu_si128((const __m128i *)(const void *)s));
+            d += 16U;
+            s += 16U;
+            n -= 16U;
+        }
+#endif
+        while (n >= CHAOS_WORD_SIZE)
+        {
+            chaos_word_store(d, chaos_word_loadu(s));
+            d += CHAOS_WORD_SIZE;
+            s += CHAOS_WORD_SIZE;
+            n -= CHAOS_WORD_SIZE;
+        }
+    }
+
+    /* Tail (or whole copy when too small for the wide path) */
+    while (n > 0U)
+    {
+        *d = *s;
+        d++;
+        s++;
+        n--;
+    }
+}
+
+/* ============================================================= */
+/* BACKWARD COPY ENGINE                                          */
+/* ============================================================= */
+/*
+ * Mirror of the forward engine, walking from the end of both buffers.
+ * Each block is loaded into registers before any byte of it is stored,
+ * which makes it correct for overlapping regions where dst is above src.
+ */
+static void chaos_mem_copy_bwd(chaos_u8_t *d, const chaos_u8_t *s, chaos_size_t size)
+{
+    chaos_u8_t *de = d + size;
+    const chaos_u8_t *se = s + size;
+    chaos_size_t n = size;
+    chaos_size_t tail = 0U;
+
+    if (n >= CHAOS_MEM_WIDE_MIN)
+    {
+        /* Align destination end so the wide stores are aligned */
+        tail = (chaos_size_t)((chaos_uintptr_t)de & (CHAOS_MEM_VEC_ALIGN - 1U));
+        if (tail > n)
+        {
+            tail = n;
+        }
+        n -= tail;
+        while (tail > 0U)
+        {
+            de--;
+            se--;
+            *de = *se;
+            tail--;
+        }
+
+#if (CHAOS_HAS_AVX2 == 1)
+        while (n >= 128U)
+        {
+            __m256i v3 = _mm256_loadu_si256((const __m256i *)(const void *)(se - 32U));
+            __m256i v2 = _mm256_loadu_si256((const __m256i *)(const void *)(se - 64U));
+            __m256i v1 = _mm256_loadu_si256((const __m256i *)(const void *)(se - 96U));
+            __m256i v0 = _mm256_loadu_si256((const __m256i *)(const void *)(se - 128U));
+            _mm256_store_si256((__m256i *)(void *)(de - 32U), v3);
+            _mm256_store_si256((__m256i *)(void *)(de - 64U), v2);
+            _mm256_store_si256((__m256i *)(void *)(de - 96U), v1);
+            _mm256_store_si256((__m256i *)(void *)(de - 128U), v0);
+            de -= 128U;
+            se -= 128U;
+            n -= 128U;
+        }
+#endif
+#if (CHAOS_HAS_SSE2 == 1)
+        while (n >= 64U)
+        {
+            __m128i v3 = _mm_loadu_si128((const __m128i *)(const void *)(se - 16U));
+            __m128i v2 = _mm_loadu_si128((const __m128i *)(const void *)(se - 32U));
+            __m128i v1 = _mm_loadu_si128((const __m128i *)(const void *)(se - 48U));
+            __m128i v0 = _mm_loadu_si128((const __m128i *)(const void *)(se - 64U));
+            _mm_store_si128((__m128i *)(void *)(de - 16U), v3);
+            _mm_store_si128((__m128i *)(void *)(de - 32U), v2);
+            _mm_store_si128((__m128i *)(void *)(de - 48U), v1);
+            _mm_store_si128((__m128i *)(void *)(de - 64U), v0);
+            de -= 64U;
+            se -= 64U;
+            n -= 64U;
+        }
+        while (n >= 16U)
+        {
+            se -= 16U;
+            de -= 16U;
+            _mm_store_si128((__m128i *)(void *)de, _mm_loadu_si128((const __m128i *)(const void *)se));
+            n -= 16U;
+        }
+#endif
+        while (n >= CHAOS_WORD_SIZE)
+        {
+            se -= CHAOS_WORD_SIZE;
+            de -= CHAOS_WORD_SIZE;
+            chaos_word_store(de, chaos_word_loadu(se));
+            n -= CHAOS_WORD_SIZE;
+        }
+    }
+
+    /* Head (or whole copy when too small for the wide path) */
+    while (n > 0U)
+    {
+        de--;
+        se--;
+        *de = *se;
+        n--;
+    }
+}
+
+/* ============================================================= */
+/* FORWARD BYTE SEARCH                                           */
+/* ============================================================= */
+/*
+ * The vector stage compares 64 bytes per iteration and only locates the
+ * exact lane once the OR of all compare masks is non-zero. What remains
+ * (or the whole buffer without SIMD) goes through the SWAR stage: aligned
+ * words are XORed with the splatted needle so matching bytes become zero
+ * lanes. All loads stay inside [p, p + size).
+ */
+static chaos_bool_t chaos_mem_find_fwd(const chaos_u8_t *p, chaos_size_t size, chaos_u8_t value, chaos_size_t *pos)
+{
+    chaos_bool_t hit = CHAOS_FALSE;
+    chaos_size_t i = 0U;
+    chaos_size_t head = 0U;
+    chaos_word_t needle = chaos_word_splat(value);
+    chaos_word_t lanes = 0U;
+
+#if (CHAOS_HAS_AVX2 == 1)
+    const __m256i vneedle = _mm256_set1_epi8((char)value);
+    chaos_u32_t mask = 0U;
+
+    while (((size - i) >= 64U) && (hit == CHAOS_FALSE))
+    {
+        __m256i c0 = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(const void *)&p[i]), vneedle);
+        __m256i c1 = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(const void *)&p[i + 32U]), vneedle);
+
+        if (_mm256_movemask_epi8(_mm256_or_si256(c0, c1)) != 0)
+        {
+            mask = (chaos_u32_t)_mm256_movemask_epi8(c0);
+            if (mask != 0U)
+            {
+                *pos = i + chaos_u32_ctz(mask);
+            }
+            else
+            {
+                *pos = i + 32U + chaos_u32_ctz((chaos_u32_t)_mm256_movemask_epi8(c1));
+            }
+            hit = CHAOS_TRUE;
+        }
+        else
+        {
+            i += 64U;
+        }
+    }
+#elif (CHAOS_HAS_SSE2 == 1)
+    const __m128i vneedle = _mm_set1_epi8((char)value);
+    chaos_u32_t lo = 0U;
+    chaos_u32_t hi = 0U;
+
+    while (((size - i) >= 64U) && (hit == CHAOS_FALSE))
+    {
+        __m128i c0 = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(const void *)&p[i]), vneedle);
+        __m128i c1 = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(const void *)&p[i + 16U]), vneedle);
+        __m128i c2 = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(const void *)&p[i + 32U]), vneedle);
+        __m128i c3 = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(const void *)&p[i + 48U]), vneedle);
+
+        if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(c0, c1), _mm_or_si128(c2, c3))) != 0)
+        {
+            /* Merge the four 16-lane masks into two 32-lane maps */
+            lo = (chaos_u32_t)_mm_movemask_epi8(c0) | ((chaos_u32_t)_mm_movemask_epi8(c1) << 16U);
+            hi = (chaos_u32_t)_mm_movemask_epi8(c2) | ((chaos_u32_t)_mm_movemask_epi8(c3) << 16U);
+
+            if (lo != 0U)
+            {
+                *pos = i + chaos_u32_ctz(lo);
+            }
+            else
+            {
+                *pos = i + 32U + chaos_u32_ctz(hi);
+            }
+            hit = CHAOS_TRUE;
+        }
+        else
+        {
+            i += 64U;
+        }
+    }
+#endif
+
+    /* Bytes up to the first word boundary */
+    head = chaos_word_misalign(&p[i]);
+    while ((head > 0U) && (i < size) && (hit == CHAOS_FALSE))
+    {
+        if (p[i] == value)
+        {
+            *pos = i;
+            hit = CHAOS_TRUE;
+        }
+        else
+        {
+            i++;
+            head--;
+        }
+    }
+
+    /* Aligned words */
+    while (((size - i) >= CHAOS_WORD_SIZE) && (hit == CHAOS_FALSE))
+    {
+        lanes = chaos_word_zero_lanes(chaos_word_load(&p[i]) ^ needle);
+        if (lanes != 0U)
+        {
+            *pos = i + chaos_word_first_lane(lanes);
+            hit = CHAOS_TRUE;
+        }
+        else
+        {
+            i += CHAOS_WORD_SIZE;
+        }
+    }
+
+    /* Tail bytes */
+    while ((i < size) && (hit == CHAOS_FALSE))
+    {
+        if (p[i] == value)
+        {
+            *pos = i;
+            hit = CHAOS_TRUE;
+        }
+        else
+        {
+            i++;
+        }
+    }
+
+    return hit;
+}
+
+/* ============================================================= */
+/* BACKWARD BYTE SEARCH                                          */
+/* ============================================================= */
+/*
+ * Mirror of the forward search; 'end' is the number of bytes still to
+ * examine, i.e. the window [p, p + end) shrinks from the top.
+ */
+static chaos_bool_t chaos_mem_find_bwd(const chaos_u8_t *p, chaos_size_t size, chaos_u8_t value, chaos_size_t *pos)
+{
+    chaos_bool_t hit = CHAOS_FALSE;
+    chaos_size_t end = size;
+    chaos_size_t tail = 0U;
+    chaos_word_t needle = chaos_word_splat(value);
+    chaos_word_t lanes = 0U;
+
+#if (CHAOS_HAS_AVX2 == 1)
+    const __m256i vneedle = _mm256_set1_epi8((char)value);
+    chaos_u32_t mask = 0U;
+
+    while ((end >= 64U) && (hit == CHAOS_FALSE))
+    {
+        __m256i c0 = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(const void *)&p[end - 64U]), vneedle);
+        __m256i c1 = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(const void *)&p[end - 32U]), vneedle);
+
+        if (_mm256_movemask_epi8(_mm256_or_si256(c0, c1)) != 0)
+        {
+            mask = (chaos_u32_t)_mm256_movemask_epi8(c1);
+            if (mask != 0U)
+            {
+                *pos = end - 32U + (31U - chaos_u32_clz(mask));
+            }
+            else
+            {
+                *pos = end - 64U + (31U - chaos_u32_clz((chaos_u32_t)_mm256_movemask_epi8(c0)));
+            }
+            hit = CHAOS_TRUE;
+        }
+        else
+        {
+            end -= 64U;
+        }
+    }
+#elif (CHAOS_HAS_SSE2 == 1)
+    const __m128i vneedle = _mm_set1_epi8((char)value);
+    chaos_u32_t lo = 0U;
+    chaos_u32_t hi = 0U;
+
+    while ((end >= 64U) && (hit == CHAOS_FALSE))
+    {
+        __m128i c0 = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(const void *)&p[end - 64U]), vneedle);
+        __m128i c1 = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(const void *)&p[end - 48U]), vneedle);
+        __m128i c2 = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(const void *)&p[end - 32U]), vneedle);
+        __m128i c3 = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(const void *)&p[end - 16U]), vneedle);
+
+        if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(c0, c1), _mm_or_si128(c2, c3))) != 0)
+        {
+            lo = (chaos_u32_t)_mm_movemask_epi8(c0) | ((chaos_u32_t)_mm_movemask_epi8(c1) << 16U);
+            hi = (chaos_u32_t)_mm_movemask_epi8(c2) | ((chaos_u32_t)_mm_movemask_epi8(c3) << 16U);
+
+            if (hi != 0U)
+            {
+                *pos = end - 32U + (31U - chaos_u32_clz(hi));
+            }
+            else
+            {
+                *pos = end - 64U + (31U - chaos_u32_clz(lo));
+            }
+            hit = CHAOS_TRUE;
+        }
+        else
+        {
+            end -= 64U;
+        }
+    }
+#endif
+
+    /* Bytes down to the last word boundary */
+    tail = (chaos_size_t)((chaos_uintptr_t)&p[end] & CHAOS_WORD_MASK);
+    while ((tail > 0U) && (end > 0U) && (hit == CHAOS_FALSE))
+    {
+        if (p[end - 1U] == value)
+        {
+            *pos = end - 1U;
+            hit = CHAOS_TRUE;
+        }
+        else
+        {
+            end--;
+            tail--;
+        }
+    }
+
+    /* Aligned words */
+    while ((end >= CHAOS_WORD_SIZE) && (hit == CHAOS_FALSE))
+    {
+        lanes = chaos_word_zero_lanes(chaos_word_load(&p[end - CHAOS_WORD_SIZE]) ^ needle);
+        if (lanes != 0U)
+        {
+            *pos = end - CHAOS_WORD_SIZE + chaos_word_last_lane(lanes);
+            hit = CHAOS_TRUE;
+        }
+        else
+        {
+            end -= CHAOS_WORD_SIZE;
+        }
+    }
+
+    /* Head bytes */
+    while ((end > 0U) && (hit == CHAOS_FALSE))
+    {
+        if (p[end - 1U] == value)
+        {
+            *pos = end - 1U;
+            hit = CHAOS_TRUE;
+        }
+        else
+        {
+            end--;
+        }
+    }
+
+    return hit;
+}
+
+/* ============================================================= */
+/* PATTERN FILL ENGINE                                           */
+/* ============================================================= */
+/*
+ * Fills 'size' bytes with a pattern of 'esize' bytes (1, 2, 4 or 8) that
+ * starts at d. A 64-byte block holding the pattern replicated from phase 0
+ * is built once; any window into it at offset (pos & (esize - 1)) is the
+ * correctly rotated pattern for a store at d + pos. This lets the head be
+ * written bytewise up to vector alignment, the body with aligned vector
+ * stores, and the tail with words and bytes, whatever the alignment of d.
+ */
+static void chaos_mem_fill(chaos_u8_t *d, const chaos_u8_t *pattern, chaos_size_t esize, chaos_size_t size)
+{
+    chaos_word_t block_words[64U / sizeof(chaos_word_t)];
+    chaos_u8_t *block = (chaos_u8_t *)block_words;
+    chaos_size_t emask = esize - 1U;
+    chaos_size_t off = 0U;
+    chaos_size_t head = 0U;
+    chaos_u32_t lo = 0U;
+    chaos_u32_t hi = 0U;
+    chaos_word_t w0 = 0U;
+    chaos_word_t w1 = 0U;
+    chaos_size_t i = 0U;
+
+    if (size >= CHAOS_MEM_WIDE_MIN)
+    {
+        /* Replicate the pattern into two 32-bit halves, then into the block */
+        if (esize == 1U)
+        {
+            lo = 0x01010101U * (chaos_u32_t)pattern[0];
+        }
+        else if (esize == 2U)
+        {
+            lo = 0x00010001U * (chaos_u32_t)chaos_u16_loadu(pattern);
+        }
+        else
+        {
+            lo = chaos_u32_loadu(pattern);
+        }
+        hi = (esize == 8U) ? chaos_u32_loadu(&pattern[4]) : lo;
+
+        for (i = 0U; i < 64U; i += 8U)
+        {
+            chaos_u32_storeu(&block[i], lo);
+            chaos_u32_storeu(&block[i + 4U], hi);
+        }
+
+        /* Head: bytes up to vector alignment */
+        head = (chaos_size_t)((CHAOS_MEM_VEC_ALIGN - ((chaos_uintptr_t)d & (CHAOS_MEM_VEC_ALIGN - 1U))) & (CHAOS_MEM_VEC_ALIGN - 1U));
+        while ((off < head) && (off < size))
+        {
+            d[off] = block[off];
+            off++;
+        }
+
+#if (CHAOS_HAS_AVX2 == 1)
+        {
+            __m256i v = _mm256_loadu_si256((const __m256i *)(const void *)&block[off & emask]);
+
+            while ((size - off) >= 128U)
+            {
+                _mm256_store_si256((__m256i *)(void *)&d[off], v);
+                _mm256_store_si256((__m256i *)(void *)&d[off + 32U], v);
+                _mm256_store_si256((__m256i *)(void *)&d[off + 64U], v);
+                _mm256_store_si256((__m256i *)(void *)&d[off + 96U], v);
+                off += 128U;
+            }
+        }
+#endif
+#if (CHAOS_HAS_SSE2 == 1)
+        {
+            __m128i v = _mm_loadu_si128((const __m128i *)(const void *)&block[off & emask]);
+
+            while ((size - off) >= 64U)
+            {
+                _mm_store_si128((__m128i *)(void *)&d[off], v);
+                _mm_store_si128((__m128i *)(void *)&d[off + 16U], v);
+                _mm_store_si128((__m128i *)(void *)&d[off + 32U], v);
+                _mm_store_si128((__m128i *)(void *)&d[off + 48U], v);
+                off += 64U;
+            }
+            while ((size - off) >= 16U)
+            {
+                _mm_store_si128((__m128i *)(void *)&d[off], v);
+                off += 16U;
+            }
+        }
+#endif
+
+        /* Word pairs: two words always span a whole number of elements */
+        w0 = chaos_word_loadu(&block[off & emask]);
+        w1 = chaos_word_loadu(&block[(off & emask) + CHAOS_WORD_SIZE]);
+        while ((size - off) >= (2U * CHAOS_WORD_SIZE))
+        {
+            chaos_word_store(&d[off], w0);
+            chaos_word_store(&d[off + CHAOS_WORD_SIZE], w1);
+            off += 2U * CHAOS_WORD_SIZE;
+        }
+        if ((size - off) >= CHAOS_WORD_SIZE)
+        {
+            chaos_word_store(&d[off], w0);
+            off += CHAOS_WORD_SIZE;
+        }
+    }
+
+    /* Tail (or whole fill when too small for the wide path) */
+    while (off < size)
+    {
+        d[off] = pattern[off & emask];
+        off++;
+    }
+}
@@ -0,0 +1,100 @@
+#include "chaos_memory_async.h"
+#include "chaos_assert.h"
+#include "chaos_compiler.h"
+
+/* ============================================================= */
+/* MEMCPY ASYNC                                                  */
+/* ============================================================= */
+chaos_status_t chaos_memcpy_async(void *dst, const void *src, chaos_size_t size, chaos_mem_async_t *handle)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_size_t i;
+
+    /* Validate parameters */
+    chaos_assert_not_null(dst, &status, CHAOS_MODULE_MEMORY);
+    chaos_assert_not_null(src, &status, CHAOS_MODULE_MEMORY);
+    chaos_assert_not_null(handle, &status, CHAOS_MODULE_MEMORY);
+    chaos_assert_param((size != 0U), &status, CHAOS_SEVERITY_WARNING, CHAOS_MODULE_MEMORY, CHAOS_MEM_SIZE_ZERO);
+    chaos_assert_param((dst != src), &status, CHAOS_SEVERITY_WARNING, CHAOS_MODULE_MEMORY, CHAOS_MEM_SRC_EQ_DST);
+
+    if (handle != CHAOS_NULL)
+    {
+        handle->dst = dst;
+        handle->src = src;
+        handle->size = size;
+        handle->result = status;
+        handle->state = (chaos_u32_t)CHAOS_DMA_IDLE;
+        for (i = 0U; i < CHAOS_DMA_PRIVATE_WORDS; i++)
+        {
+            handle->priv[i] = 0U;
+        }
+    }
+
+    /* Hand the copy to the engine; a rejected request stays IDLE */
+    if (status == CHAOS_STATUS_OK)
+    {
+        handle->state = (chaos_u32_t)CHAOS_DMA_BUSY;
+        status = chaos_dma_submit(handle);
+        if (status != CHAOS_STATUS_OK)
+        {
+            handle->result = status;
+            handle->state = (chaos_u32_t)CHAOS_DMA_IDLE;
+        }
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* MEMCPY POLL                                                   */
+/* ============================================================= */
+chaos_status_t chaos_memcpy_poll(chaos_mem_async_t *handle, chaos_bool_t *done)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    /* Validate parameters */
+    chaos_assert_not_null(handle, &status, CHAOS_MODULE_MEMORY);
+    chaos_assert_not_null(done, &status, CHAOS_MODULE_MEMORY);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        if (CHAOS_ATOMIC_LOAD_ACQUIRE(&handle->state) == (chaos_u32_t)CHAOS_DMA_BUSY)
+        {
+            *done = chaos_dma_poll(handle);
+        }
+        else
+        {
+            *done = CHAOS_TRUE;
+        }
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* MEMCPY WAIT                                                   */
+/* ============================================================= */
+chaos_status_t chaos_memcpy_wait(chaos_mem_async_t *handle)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    /* Validate parameters */
+    chaos_assert_not_null(handle, &status, CHAOS_MODULE_MEMORY);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        /* DONE still needs the wait hook to release backend resources */
+        if ((CHAOS_ATOMIC_LOAD_ACQUIRE(&handle->state) != (chaos_u32_t)CHAOS_DMA_IDLE) &&
+            (chaos_dma_wait(handle) == CHAOS_FALSE))
+        {
+            /* Engine still busy: the handle stays valid for another wait */
+            status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_WARNING, CHAOS_MODULE_MEMORY, CHAOS_ERRCLASS_NONE, CHAOS_MEM_BUSY);
+        }
+        else
+        {
+            status = handle->result;
+        }
+    }
+
+    return status;
+}
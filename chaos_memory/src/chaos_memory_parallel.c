@@ -0,0 +1,146 @@
+#include "chaos_memory.h"
+#include "chaos_assert.h"
+#include "chaos_parallel.h"
+
+/* ============================================================= */
+/* PARALLEL CONFIGURATION                                        */
+/* ============================================================= */
+
+/* Chunk boundaries land on destination cache lines to avoid false sharing */
+#define CHAOS_MEM_PARALLEL_LINE ((chaos_uintptr_t)64U)
+
+/* Shared description of one parallel copy or fill */
+typedef struct
+{
+    chaos_u8_t *dst;
+    const chaos_u8_t *src; /* CHAOS_NULL for a fill */
+    chaos_u8_t value;
+    chaos_size_t size;
+    chaos_size_t chunks;
+} chaos_mem_par_job_t;
+
+/* ============================================================= */
+/* FUNCTION PROTOTYPES                                          */
+/* ============================================================= */
+static chaos_size_t chaos_mem_par_split(const chaos_mem_par_job_t *job, chaos_size_t index);
+static void chaos_mem_par_task(void *ctx, chaos_size_t index);
+
+/* ============================================================= */
+/* MEMCPY PARALLEL                                               */
+/* ============================================================= */
+chaos_status_t chaos_memcpy_parallel(void *dst, const void *src, chaos_size_t size, chaos_size_t threads)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_mem_par_job_t job;
+
+    /* Validate parameters */
+    chaos_assert_not_null(dst, &status, CHAOS_MODULE_MEMORY);
+    chaos_assert_not_null(src, &status, CHAOS_MODULE_MEMORY);
+    chaos_assert_param((size != 0U), &status, CHAOS_SEVERITY_WARNING, CHAOS_MODULE_MEMORY, CHAOS_MEM_SIZE_ZERO);
+    chaos_assert_param((dst != src), &status, CHAOS_SEVERITY_WARNING, CHAOS_MODULE_MEMORY, CHAOS_MEM_SRC_EQ_DST);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        if ((threads <= 1U) || (size < CHAOS_MEM_PARALLEL_THRESHOLD))
+        {
+            status = chaos_memcpy(dst, src, size);
+        }
+        else
+        {
+            job.dst = (chaos_u8_t *)dst;
+            job.src = (const chaos_u8_t *)src;
+            job.value = 0U;
+            job.size = size;
+            job.chunks = threads;
+            status = chaos_parallel_run(chaos_mem_par_task, &job, threads);
+        }
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* MEMSET PARALLEL                                               */
+/* ============================================================= */
+chaos_status_t chaos_memset_parallel(void *dst, chaos_u8_t value, chaos_size_t size, chaos_size_t threads)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_mem_par_job_t job;
+
+    /* Validate parameters */
+    chaos_assert_not_null(dst, &status, CHAOS_MODULE_MEMORY);
+    chaos_assert_param((size != 0U), &status, CHAOS_SEVERITY_WARNING, CHAOS_MODULE_MEMORY, CHAOS_MEM_SIZE_ZERO);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        if ((threads <= 1U) || (size < CHAOS_MEM_PARALLEL_THRESHOLD))
+        {
+            status = chaos_memset(dst, value, size);
+        }
+        else
+        {
+            job.dst = (chaos_u8_t *)dst;
+            job.src = CHAOS_NULL;
+            job.value = value;
+            job.size = size;
+            job.chunks = threads;
+            status = chaos_parallel_run(chaos_mem_par_task, &job, threads);
+        }
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* CHUNKING                                                      */
+/* ============================================================= */
+
+/*
+ * Offset where chunk `index` starts: an equal share of the buffer, pushed
+ * forward to the next destination cache line and clamped to the size.
+ */
+static chaos_size_t chaos_mem_par_split(const chaos_mem_par_job_t *job, chaos_size_t index)
+{
+    chaos_size_t pos = job->size;
+    chaos_size_t off;
+    chaos_size_t pad;
+
+    if (index == 0U)
+    {
+        pos = 0U;
+    }
+    else if (index < job->chunks)
+    {
+        off = (job->size / job->chunks) * index;
+        pad = (chaos_size_t)((CHAOS_MEM_PARALLEL_LINE - (((chaos_uintptr_t)job->dst + off) & (CHAOS_MEM_PARALLEL_LINE - 1U))) & (CHAOS_MEM_PARALLEL_LINE - 1U));
+        if (pad < (job->size - off))
+        {
+            pos = off + pad;
+        }
+    }
+    else
+    {
+        /* Last boundary is the end of the buffer */
+    }
+
+    return pos;
+}
+
+static void chaos_mem_par_task(void *ctx, chaos_size_t index)
+{
+    const chaos_mem_par_job_t *job = (const chaos_mem_par_job_t *)ctx;
+    chaos_size_t begin = chaos_mem_par_split(job, index);
+    chaos_size_t end = chaos_mem_par_split(job, index + 1U);
+
+    if (end > begin)
+    {
+        if (job->src != CHAOS_NULL)
+        {
+            (void)chaos_memcpy(job->dst + begin, job->src + begin, end - begin);
+        }
+        else
+        {
+            (void)chaos_memset(job->dst + begin, job->value, end - begin);
+        }
+    }
+}
@@ -0,0 +1,82 @@
+/**
+ * @file chaos_dma.h
+ * @brief Asynchronous copy engine (DMA) hooks for CHAOSLIB.
+ */
+
+#ifndef CHAOS_DMA_H
+#define CHAOS_DMA_H
+
+#include "chaos_types.h"
+#include "chaos_status.h"
+
+/**
+ * @brief Words of backend-private storage carried by each request.
+ */
+#define CHAOS_DMA_PRIVATE_WORDS 4U
+
+/**
+ * @brief Polls the default chaos_dma_wait() makes before reporting the
+ *        request as still busy (no thread backend).
+ */
+#ifndef CHAOS_DMA_WAIT_POLLS
+#define CHAOS_DMA_WAIT_POLLS 100000U
+#endif
+
+/**
+ * @brief Life cycle of a DMA request.
+ */
+typedef enum
+{
+    CHAOS_DMA_IDLE = 0x00U, /**< Not submitted yet. */
+    CHAOS_DMA_BUSY = 0x01U, /**< Transfer in flight. */
+    CHAOS_DMA_DONE = 0x02U  /**< Transfer finished; result is valid. */
+} chaos_dma_state_t;
+
+/**
+ * @brief One asynchronous copy request.
+ * @note The backend sets result before publishing CHAOS_DMA_DONE in state.
+ */
+typedef struct
+{
+    void *dst;                                        /**< Destination buffer */
+    const void *src;                                  /**< Source buffer */
+    chaos_size_t size;                                /**< Number of bytes */
+    volatile chaos_u32_t state;                       /**< chaos_dma_state_t, updated by the backend */
+    chaos_status_t result;                            /**< Transfer status once state is DONE */
+    chaos_uintptr_t priv[CHAOS_DMA_PRIVATE_WORDS];    /**< Backend-private (channel, thread, ...) */
+} chaos_dma_request_t;
+
+/**
+ * @brief Start a copy without waiting for it to finish.
+ * @details This weak function should be overridden to program a DMA engine
+ *          (including any cache clean/invalidate the target needs). The default
+ *          copies on a background POSIX thread when CHAOS_ENABLE_THREADS is 1,
+ *          and synchronously otherwise.
+ * @note Called with state set to CHAOS_DMA_BUSY and the buffers already validated.
+ * @param[inout] req Request to start
+ * @return CHAOS_STATUS_OK if the request was accepted
+ */
+extern chaos_status_t chaos_dma_submit(chaos_dma_request_t *req);
+
+/**
+ * @brief Check whether a submitted request has finished, without blocking.
+ * @details This weak function may be overridden to query the DMA engine.
+ * @param[inout] req Submitted request
+ * @return CHAOS_TRUE once the transfer is complete
+ */
+extern chaos_bool_t chaos_dma_poll(chaos_dma_request_t *req);
+
+/**
+ * @brief Wait, for a bounded time, for a submitted request to finish and
+ *        release its backend resources.
+ * @details This weak function should be overridden together with chaos_dma_submit().
+ *          It must not block forever: when the engine has not finished in
+ *          reasonable time it returns CHAOS_FALSE and may be called again.
+ *          The default joins the copy thread when CHAOS_ENABLE_THREADS is 1,
+ *          and polls at most CHAOS_DMA_WAIT_POLLS times otherwise.
+ * @param[inout] req Submitted request
+ * @return CHAOS_TRUE once the transfer is complete and its resources released
+ */
+extern chaos_bool_t chaos_dma_wait(chaos_dma_request_t *req);
+
+#endif /* CHAOS_DMA_H */
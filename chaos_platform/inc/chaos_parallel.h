@@ -0,0 +1,51 @@
+/**
+ * @file chaos_parallel.h
+ * @brief Parallel task execution hook for CHAOSLIB.
+ */
+
+#ifndef CHAOS_PARALLEL_H
+#define CHAOS_PARALLEL_H
+
+#include "chaos_types.h"
+#include "chaos_status.h"
+
+/**
+ * @brief Build the default hook on POSIX threads.
+ * @note When 0 the default hook runs every task on the calling thread.
+ */
+#ifndef CHAOS_ENABLE_THREADS
+#define CHAOS_ENABLE_THREADS 0
+#endif
+
+/**
+ * @brief Upper bound on the worker threads used by the default hook.
+ */
+#ifndef CHAOS_PARALLEL_MAX_WORKERS
+#define CHAOS_PARALLEL_MAX_WORKERS 16U
+#endif
+
+/**
+ * @brief One unit of parallel work.
+ * @param[in] ctx Caller context shared by every task
+ * @param[in] index Task index in [0, count)
+ */
+typedef void (*chaos_parallel_task_t)(void *ctx, chaos_size_t index);
+
+/**
+ * @brief Run count independent tasks, possibly concurrently, and wait for all of them.
+ * @details This weak function may be overridden to hand the tasks to a platform
+ *          scheduler. When CHAOS_ENABLE_THREADS is 1 the default keeps a pool of
+ *          up to CHAOS_PARALLEL_MAX_WORKERS - 1 POSIX threads, started on first
+ *          use and woken for each call (the caller works too); otherwise it runs
+ *          the tasks in order on the calling thread.
+ * @note Tasks must not depend on each other or on their execution order. Only
+ *       one call uses the pool at a time: a concurrent call, or one made from
+ *       inside a task, runs its tasks on the calling thread.
+ * @param[in] task Task function
+ * @param[in] ctx Context passed to every task (may be NULL)
+ * @param[in] count Number of tasks
+ * @return CHAOS_STATUS_OK once every task has completed, or a CHAOS status code on error
+ */
+extern chaos_status_t chaos_parallel_run(chaos_parallel_task_t task, void *ctx, chaos_size_t count);
+
+#endif /* CHAOS_PARALLEL_H */
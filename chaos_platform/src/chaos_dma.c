@@ -0,0 +1,94 @@
+#include "chaos_dma.h"
+#include "chaos_compiler.h"
+#include "chaos_memory.h"
+
+#if (CHAOS_ENABLE_THREADS == 1)
+#include <pthread.h>
+
+/* ============================================================= */
+/* SOFTWARE BACKEND (POSIX THREAD)                               */
+/* ============================================================= */
+
+/* priv[0..2] hold the thread handle, priv[3] flags a thread still to join */
+#define CHAOS_DMA_JOIN_SLOT (CHAOS_DMA_PRIVATE_WORDS - 1U)
+
+CHAOS_STATIC_ASSERT(sizeof(pthread_t) <= (CHAOS_DMA_JOIN_SLOT * sizeof(chaos_uintptr_t)), dma_priv_fits_pthread);
+
+static void *chaos_dma_thread(void *arg);
+
+static void *chaos_dma_thread(void *arg)
+{
+    chaos_dma_request_t *req = (chaos_dma_request_t *)arg;
+
+    req->result = chaos_memcpy(req->dst, req->src, req->size);
+    CHAOS_ATOMIC_STORE_RELEASE(&req->state, (chaos_u32_t)CHAOS_DMA_DONE);
+
+    return CHAOS_NULL;
+}
+#endif
+
+/**
+ * DMA Submission Hook
+ */
+CHAOS_WEAK chaos_status_t chaos_dma_submit(chaos_dma_request_t *req)
+{
+#if (CHAOS_ENABLE_THREADS == 1)
+    pthread_t thread;
+
+    req->priv[CHAOS_DMA_JOIN_SLOT] = 0U;
+    if (pthread_create(&thread, CHAOS_NULL, chaos_dma_thread, req) == 0)
+    {
+        (void)chaos_memcpy(req->priv, &thread, (chaos_size_t)sizeof(thread));
+        req->priv[CHAOS_DMA_JOIN_SLOT] = 1U;
+    }
+    else
+    {
+        /* No thread available: complete the copy before returning */
+        (void)chaos_dma_thread(req);
+    }
+#else
+    req->result = chaos_memcpy(req->dst, req->src, req->size);
+    CHAOS_ATOMIC_STORE_RELEASE(&req->state, (chaos_u32_t)CHAOS_DMA_DONE);
+#endif
+
+    return CHAOS_STATUS_OK;
+}
+
+/**
+ * DMA Poll Hook
+ */
+CHAOS_WEAK chaos_bool_t chaos_dma_poll(chaos_dma_request_t *req)
+{
+    return (CHAOS_ATOMIC_LOAD_ACQUIRE(&req->state) == (chaos_u32_t)CHAOS_DMA_DONE) ? CHAOS_TRUE : CHAOS_FALSE;
+}
+
+/**
+ * DMA Wait Hook
+ */
+CHAOS_WEAK chaos_bool_t chaos_dma_wait(chaos_dma_request_t *req)
+{
+    chaos_bool_t done;
+#if (CHAOS_ENABLE_THREADS == 1)
+    pthread_t thread;
+
+    /* The thread only copies, so joining it is bounded by the copy itself */
+    if (req->priv[CHAOS_DMA_JOIN_SLOT] != 0U)
+    {
+        (void)chaos_memcpy(&thread, req->priv, (chaos_size_t)sizeof(thread));
+        (void)pthread_join(thread, CHAOS_NULL);
+        req->priv[CHAOS_DMA_JOIN_SLOT] = 0U;
+    }
+    done = chaos_dma_poll(req);
+#else
+    chaos_u32_t polls = 0U;
+
+    done = chaos_dma_poll(req);
+    while ((done == CHAOS_FALSE) && (polls < CHAOS_DMA_WAIT_POLLS))
+    {
+        polls++;
+        done = chaos_dma_poll(req);
+    }
+#endif
+
+    return done;
+}
@@ -0,0 +1,193 @@
+#include "chaos_parallel.h"
+#include "chaos_assert.h"
+#include "chaos_compiler.h"
+
+#if (CHAOS_ENABLE_THREADS == 1)
+#include <pthread.h>
+
+/* ============================================================= */
+/* POSIX WORKER POOL                                             */
+/* ============================================================= */
+
+/*
+ * Workers are started on first use and kept: each call only posts a job
+ * and wakes them. Worker k runs tasks k, k + stride, k + 2 * stride, ...;
+ * the caller is worker 0. One call owns the pool at a time.
+ */
+typedef struct
+{
+    pthread_mutex_t owner;       /* Held by the call using the pool */
+    pthread_mutex_t lock;        /* Guards every field below */
+    pthread_cond_t wake;         /* A job was posted */
+    pthread_cond_t idle;         /* The last busy worker finished */
+    chaos_parallel_task_t task;
+    void *ctx;
+    chaos_size_t count;
+    chaos_size_t stride;
+    chaos_size_t active;         /* Workers 1..active take part in the job */
+    chaos_size_t busy;           /* Of those, the ones still running */
+    chaos_size_t started;        /* Workers created so far */
+    chaos_u32_t generation;      /* Bumped for every job */
+} chaos_parallel_pool_t;
+
+static chaos_parallel_pool_t g_pool = {
+    PTHREAD_MUTEX_INITIALIZER, PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, PTHREAD_COND_INITIALIZER,
+    CHAOS_NULL, CHAOS_NULL, 0U, 0U, 0U, 0U, 0U, 0U
+};
+
+/* Worker ids, and the generation each worker saw when it was created */
+static chaos_size_t g_pool_id[CHAOS_PARALLEL_MAX_WORKERS];
+static chaos_u32_t g_pool_seen[CHAOS_PARALLEL_MAX_WORKERS];
+
+static void chaos_parallel_slice(chaos_parallel_task_t task, void *ctx, chaos_size_t count, chaos_size_t first, chaos_size_t stride);
+static void *chaos_parallel_thread(void *arg);
+static void chaos_parallel_pool_run(chaos_parallel_task_t task, void *ctx, chaos_size_t count);
+
+static void chaos_parallel_slice(chaos_parallel_task_t task, void *ctx, chaos_size_t count, chaos_size_t first, chaos_size_t stride)
+{
+    chaos_size_t i;
+
+    for (i = first; i < count; i += stride)
+    {
+        task(ctx, i);
+    }
+}
+
+static void *chaos_parallel_thread(void *arg)
+{
+    chaos_size_t id = *(const chaos_size_t *)arg;
+    chaos_parallel_task_t task;
+    void *ctx;
+    chaos_size_t count;
+    chaos_size_t stride;
+    chaos_bool_t member;
+    chaos_u32_t seen;
+
+    (void)pthread_mutex_lock(&g_pool.lock);
+    seen = g_pool_seen[id];
+
+    /* Workers live as long as the process */
+    for (;;)
+    {
+        while (g_pool.generation == seen)
+        {
+            (void)pthread_cond_wait(&g_pool.wake, &g_pool.lock);
+        }
+        seen = g_pool.generation;
+        member = (id <= g_pool.active) ? CHAOS_TRUE : CHAOS_FALSE;
+        task = g_pool.task;
+        ctx = g_pool.ctx;
+        count = g_pool.count;
+        stride = g_pool.stride;
+        (void)pthread_mutex_unlock(&g_pool.lock);
+
+        if (member == CHAOS_TRUE)
+        {
+            chaos_parallel_slice(task, ctx, count, id, stride);
+        }
+
+        (void)pthread_mutex_lock(&g_pool.lock);
+        if (member == CHAOS_TRUE)
+        {
+            g_pool.busy--;
+            if (g_pool.busy == 0U)
+            {
+                (void)pthread_cond_signal(&g_pool.idle);
+            }
+        }
+    }
+
+    return CHAOS_NULL;
+}
+
+/* Caller owns the pool; count is at least 2 */
+static void chaos_parallel_pool_run(chaos_parallel_task_t task, void *ctx, chaos_size_t count)
+{
+    chaos_size_t nworkers = (count < CHAOS_PARALLEL_MAX_WORKERS) ? count : CHAOS_PARALLEL_MAX_WORKERS;
+    chaos_bool_t spawn = CHAOS_TRUE;
+    pthread_t thread;
+    chaos_size_t active;
+    chaos_size_t id;
+
+    (void)pthread_mutex_lock(&g_pool.lock);
+
+    /* Grow the pool to this job's size; a worker that cannot start stops the growth */
+    while ((spawn == CHAOS_TRUE) && (g_pool.started < (nworkers - 1U)))
+    {
+        id = g_pool.started + 1U;
+        g_pool_id[id] = id;
+        g_pool_seen[id] = g_pool.generation;
+        if (pthread_create(&thread, CHAOS_NULL, chaos_parallel_thread, &g_pool_id[id]) == 0)
+        {
+            (void)pthread_detach(thread);
+            g_pool.started = id;
+        }
+        else
+        {
+            spawn = CHAOS_FALSE;
+        }
+    }
+
+    g_pool.task = task;
+    g_pool.ctx = ctx;
+    g_pool.count = count;
+    g_pool.stride = nworkers;
+    active = (g_pool.started < (nworkers - 1U)) ? g_pool.started : (nworkers - 1U);
+    g_pool.active = active;
+    g_pool.busy = active;
+    g_pool.generation++;
+    (void)pthread_cond_broadcast(&g_pool.wake);
+    (void)pthread_mutex_unlock(&g_pool.lock);
+
+    /* The caller is worker 0 and stands in for the workers that could not be started */
+    chaos_parallel_slice(task, ctx, count, 0U, nworkers);
+    for (id = active + 1U; id < nworkers; id++)
+    {
+        chaos_parallel_slice(task, ctx, count, id, nworkers);
+    }
+
+    (void)pthread_mutex_lock(&g_pool.lock);
+    while (g_pool.busy != 0U)
+    {
+        (void)pthread_cond_wait(&g_pool.idle, &g_pool.lock);
+    }
+    (void)pthread_mutex_unlock(&g_pool.lock);
+}
+#endif
+
+/**
+ * Parallel Task Hook
+ */
+CHAOS_WEAK chaos_status_t chaos_parallel_run(chaos_parallel_task_t task, void *ctx, chaos_size_t count)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_bool_t pooled = CHAOS_FALSE;
+    chaos_size_t i;
+
+    if (task == CHAOS_NULL)
+    {
+        status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_PLATFORM, CHAOS_ERRCLASS_NULL_PTR, 0U);
+    }
+
+    if (status == CHAOS_STATUS_OK)
+    {
+#if (CHAOS_ENABLE_THREADS == 1)
+        /* A second caller, or a task calling back in, finds the pool owned and runs inline */
+        if ((count > 1U) && (pthread_mutex_trylock(&g_pool.owner) == 0))
+        {
+            chaos_parallel_pool_run(task, ctx, count);
+            (void)pthread_mutex_unlock(&g_pool.owner);
+            pooled = CHAOS_TRUE;
+        }
+#endif
+        if (pooled == CHAOS_FALSE)
+        {
+            for (i = 0U; i < count; i++)
+            {
+                task(ctx, i);
+            }
+        }
+    }
+
+    return status;
+}
@@ -0,0 +1,150 @@
+/**
+ * @file chaos_hashmap.h
+ * @brief Open-addressing hash map for CHAOSLIB.
+ *
+ * Keys and values are fixed-size byte blocks copied into the table; keys
+ * are equal when their bytes are. Slots are probed linearly and kept in
+ * Robin Hood order (each run of occupied slots sorted by home slot), so
+ * erasing shifts the following entries back instead of leaving tombstones.
+ *
+ * Every slot has a control byte: 0 when empty, otherwise 0x80 plus seven
+ * bits of the key hash. A lookup compares a whole group of control bytes
+ * against that fingerprint at once (16 with SSE2, one word otherwise) and
+ * only reads the keys whose fingerprint matches, stopping at the first
+ * empty slot.
+ *
+ * The slot count is a power of two and at most 7/8 of the slots are used.
+ * The table lives in one region, supplied by the caller (fixed size) or
+ * taken from chaos_alloc() (doubled when full). Hashing uses chaos_hash64()
+ * and is not protected against keys chosen to collide.
+ */
+
+#ifndef CHAOS_HASHMAP_H
+#define CHAOS_HASHMAP_H
+
+#include "chaos_types.h"
+#include "chaos_status.h"
+
+#if defined(CHAOS_ENABLE_INT64) && (CHAOS_ENABLE_INT64 == 1)
+
+/* ============================================================= */
+/* HASH MAP TYPES                                                */
+/* ============================================================= */
+
+/** @brief Smallest supported number of slots. */
+#define CHAOS_HASHMAP_SLOTS_MIN ((chaos_size_t)16U)
+
+/** @brief Largest supported number of slots. */
+#define CHAOS_HASHMAP_SLOTS_MAX ((chaos_size_t)1U << 24U)
+
+/**
+ * @brief Hash map.
+ */
+typedef struct
+{
+    chaos_u8_t *entries;      /**< Key then value of each slot, stride bytes apart */
+    chaos_u32_t *hashes;      /**< Hash of the key in each occupied slot */
+    chaos_u8_t *ctrl;         /**< Control bytes, the first group repeated past the end */
+    chaos_size_t key_size;    /**< Key size in bytes */
+    chaos_size_t value_size;  /**< Value size in bytes (0 for a set) */
+    chaos_size_t stride;      /**< Bytes per entry */
+    chaos_size_t slot_count;  /**< Number of slots (power of two) */
+    chaos_size_t capacity;    /**< Maximum number of entries (7/8 of the slots) */
+    chaos_size_t count;       /**< Number of entries */
+    void *region;             /**< chaos_alloc() block to release, or NULL */
+} chaos_hashmap_t;
+
+/* ============================================================= */
+/* HASH MAP FUNCTIONS                                            */
+/* ============================================================= */
+
+/**
+ * @brief Compute the region size a table needs.
+ * @param[in] key_size Key size in bytes (non-zero)
+ * @param[in] value_size Value size in bytes
+ * @param[in] slot_count Number of slots (power of two, CHAOS_HASHMAP_SLOTS_MIN to CHAOS_HASHMAP_SLOTS_MAX)
+ * @param[out] size Bytes to pass to chaos_hashmap_init() (alignment slack included)
+ */
+extern chaos_status_t chaos_hashmap_region_size(chaos_size_t key_size, chaos_size_t value_size, chaos_size_t slot_count, chaos_size_t *size);
+
+/**
+ * @brief Initialise a map over a caller-supplied region.
+ * @details The map never grows: chaos_hashmap_put() of a new key fails
+ *          with CHAOS_STD_FULL once it holds 7/8 of @p slot_count entries.
+ *          Values are aligned to the largest power of two, up to 8, that
+ *          divides both sizes.
+ * @param[out] map Map to initialise
+ * @param[in] key_size Key size in bytes (non-zero)
+ * @param[in] value_size Value size in bytes
+ * @param[in] slot_count Number of slots (see chaos_hashmap_region_size())
+ * @param[in] region Caller storage (any alignment)
+ * @param[in] region_size Size of @p region in bytes
+ */
+extern chaos_status_t chaos_hashmap_init(chaos_hashmap_t *map, chaos_size_t key_size, chaos_size_t value_size, chaos_size_t slot_count, void *region, chaos_size_t region_size);
+
+/**
+ * @brief Initialise a map in chaos_alloc() memory.
+ * @details The slot count doubles whenever a new key finds the map full,
+ *          up to CHAOS_HASHMAP_SLOTS_MAX.
+ * @param[out] map Map to initialise
+ * @param[in] key_size Key size in bytes (non-zero)
+ * @param[in] value_size Value size in bytes
+ * @param[in] slot_count Initial number of slots (as for chaos_hashmap_init())
+ * @note Requires CHAOS_ENABLE_ALLOC; release with chaos_hashmap_free().
+ */
+extern chaos_status_t chaos_hashmap_init_dynamic(chaos_hashmap_t *map, chaos_size_t key_size, chaos_size_t value_size, chaos_size_t slot_count);
+
+/**
+ * @brief Release the region of a dynamic map (no-op for caller storage).
+ * @param[inout] map Map to release
+ */
+extern chaos_status_t chaos_hashmap_free(chaos_hashmap_t *map);
+
+/**
+ * @brief Remove every entry, keeping the storage.
+ * @param[inout] map Map
+ */
+extern chaos_status_t chaos_hashmap_clear(chaos_hashmap_t *map);
+
+/**
+ * @brief Insert a key or replace its value.
+ * @param[inout] map Map
+ * @param[in] key Key (key_size bytes)
+ * @param[in] value Value (value_size bytes; may be NULL when value_size is 0)
+ * @return CHAOS_STATUS_OK, a CHAOS_STD_FULL error when a fixed map (or a
+ *         dynamic one at CHAOS_HASHMAP_SLOTS_MAX) is full, or the status of
+ *         chaos_alloc() when growing fails; the map is unchanged on error
+ */
+extern chaos_status_t chaos_hashmap_put(chaos_hashmap_t *map, const void *key, const void *value);
+
+/**
+ * @brief Look a key up.
+ * @param[in] map Map
+ * @param[in] key Key (key_size bytes)
+ * @param[out] value Stored value, valid until the next put or erase (may be NULL)
+ * @param[out] found CHAOS_TRUE if the key is present
+ */
+extern chaos_status_t chaos_hashmap_find(const chaos_hashmap_t *map, const void *key, void **value, chaos_bool_t *found);
+
+/**
+ * @brief Remove a key.
+ * @param[inout] map Map
+ * @param[in] key Key (key_size bytes)
+ * @param[out] found CHAOS_TRUE if the key was present (may be NULL)
+ */
+extern chaos_status_t chaos_hashmap_erase(chaos_hashmap_t *map, const void *key, chaos_bool_t *found);
+
+/**
+ * @brief Step through the entries in slot order.
+ * @details Start with *cursor = 0; the map must not change during the walk.
+ * @param[in] map Map
+ * @param[inout] cursor Slot to resume from, advanced past the entry returned
+ * @param[out] key Key of the next entry
+ * @param[out] value Value of the next entry (may be NULL)
+ * @param[out] found CHAOS_FALSE once every entry has been returned
+ */
+extern chaos_status_t chaos_hashmap_next(const chaos_hashmap_t *map, chaos_size_t *cursor, const void **key, void **value, chaos_bool_t *found);
+
+#endif /* CHAOS_ENABLE_INT64 */
+
+#endif /* CHAOS_HASHMAP_H */
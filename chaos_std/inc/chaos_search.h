@@ -0,0 +1,172 @@
+/**
+ * @file chaos_search.h
+ * @brief Searching sorted arrays for CHAOSLIB.
+ *
+ * chaos_lower_bound() and chaos_bsearch() halve the range without
+ * branching on the comparison: its result becomes a mask that moves the
+ * range start, so the loop runs exactly ceil(log2(count)) times and never
+ * mispredicts. The typed forms inline the comparison.
+ *
+ * For large tables that are searched often, chaos_eytzinger_build()
+ * rearranges a sorted array in breadth-first (Eytzinger) order: node k
+ * has its children at 2k and 2k + 1, so the first levels share a few
+ * cache lines and the 16 descendants four levels down of a 4-byte node
+ * are adjacent. The Eytzinger searches prefetch those descendants while
+ * the current level is compared. Slot 0 of the tree is unused; align the
+ * tree to 64 bytes to keep each group of descendants in one line.
+ *
+ * Tables must be sorted ascending by the same order the search uses;
+ * float tables must not contain NaN.
+ */
+
+#ifndef CHAOS_SEARCH_H
+#define CHAOS_SEARCH_H
+
+#include "chaos_types.h"
+#include "chaos_status.h"
+#include "chaos_sort.h"
+
+/* ============================================================= */
+/* SEARCH CONSTANTS                                              */
+/* ============================================================= */
+
+/** Largest element count an Eytzinger tree may hold */
+#define CHAOS_EYTZINGER_MAX ((chaos_size_t)0x3FFFFFFFU)
+
+/* ============================================================= */
+/* BINARY SEARCH                                                 */
+/* ============================================================= */
+
+/**
+ * @brief Find the first element not less than a key.
+ * @param[in] base Sorted elements (may be NULL when count is 0)
+ * @param[in] count Number of elements
+ * @param[in] size Size of one element in bytes (non-zero)
+ * @param[in] key Key passed as the second argument of @p cmp
+ * @param[in] cmp Comparator, called as cmp(ctx, element, key)
+ * @param[in] ctx Passed to every @p cmp call (may be NULL)
+ * @param[out] index Index of that element, or @p count when there is none
+ */
+extern chaos_status_t chaos_lower_bound(const void *base, chaos_size_t count, chaos_size_t size, const void *key, chaos_sort_cmp_t cmp, void *ctx, chaos_size_t *index);
+
+/**
+ * @brief Find an element equal to a key.
+ * @details As chaos_lower_bound(); when several elements match, the first
+ *          is reported.
+ * @param[out] index Index of the match, or where the key would be inserted
+ * @param[out] found CHAOS_TRUE if an element compares equal to @p key
+ */
+extern chaos_status_t chaos_bsearch(const void *base, chaos_size_t count, chaos_size_t size, const void *key, chaos_sort_cmp_t cmp, void *ctx, chaos_size_t *index, chaos_bool_t *found);
+
+/**
+ * @brief chaos_lower_bound() over unsigned 32-bit integers.
+ * @param[in] base Sorted elements (may be NULL when count is 0)
+ * @param[in] count Number of elements
+ * @param[in] key Value searched for
+ * @param[out] index First index whose element is >= @p key, or @p count
+ */
+extern chaos_status_t chaos_lower_bound_u32(const chaos_u32_t *base, chaos_size_t count, chaos_u32_t key, chaos_size_t *index);
+
+/**
+ * @brief chaos_lower_bound() over signed 32-bit integers.
+ * @details As chaos_lower_bound_u32().
+ */
+extern chaos_status_t chaos_lower_bound_i32(const chaos_i32_t *base, chaos_size_t count, chaos_i32_t key, chaos_size_t *index);
+
+#if defined(CHAOS_ENABLE_INT64) && (CHAOS_ENABLE_INT64 == 1)
+/**
+ * @brief chaos_lower_bound() over unsigned 64-bit integers.
+ * @details As chaos_lower_bound_u32().
+ */
+extern chaos_status_t chaos_lower_bound_u64(const chaos_u64_t *base, chaos_size_t count, chaos_u64_t key, chaos_size_t *index);
+
+/**
+ * @brief chaos_lower_bound() over signed 64-bit integers.
+ * @details As chaos_lower_bound_u32().
+ */
+extern chaos_status_t chaos_lower_bound_i64(const chaos_i64_t *base, chaos_size_t count, chaos_i64_t key, chaos_size_t *index);
+#endif
+
+#if defined(CHAOS_ENABLE_FLOAT) && (CHAOS_ENABLE_FLOAT == 1)
+/**
+ * @brief chaos_lower_bound() over floats.
+ * @details As chaos_lower_bound_u32().
+ */
+extern chaos_status_t chaos_lower_bound_f32(const chaos_f32_t *base, chaos_size_t count, chaos_f32_t key, chaos_size_t *index);
+
+/**
+ * @brief chaos_lower_bound() over doubles.
+ * @details As chaos_lower_bound_u32().
+ */
+extern chaos_status_t chaos_lower_bound_f64(const chaos_f64_t *base, chaos_size_t count, chaos_f64_t key, chaos_size_t *index);
+#endif
+
+/* ============================================================= */
+/* EYTZINGER LAYOUT                                              */
+/* ============================================================= */
+
+/**
+ * @brief Copy a sorted array into Eytzinger order.
+ * @details Payload arrays built with the same @p count line up with the
+ *          tree slot for slot.
+ * @param[in] sorted Sorted elements (may be NULL when count is 0)
+ * @param[in] count Number of elements
+ * @param[in] size Size of one element in bytes (non-zero)
+ * @param[out] tree Room for count + 1 elements; slot 0 is left untouched
+ * @return CHAOS_STATUS_OK, or an error when @p count exceeds
+ *         CHAOS_EYTZINGER_MAX (the searches check the same limit)
+ */
+extern chaos_status_t chaos_eytzinger_build(const void *sorted, chaos_size_t count, chaos_size_t size, void *tree);
+
+/**
+ * @brief Find the tree slot of the first element not less than a key.
+ * @details As chaos_lower_bound() on the array the tree was built from.
+ * @param[in] tree Tree from chaos_eytzinger_build()
+ * @param[out] slot Slot of that element (1 to count), or 0 when there is none
+ */
+extern chaos_status_t chaos_eytzinger_lower_bound(const void *tree, chaos_size_t count, chaos_size_t size, const void *key, chaos_sort_cmp_t cmp, void *ctx, chaos_size_t *slot);
+
+/**
+ * @brief chaos_eytzinger_lower_bound() over unsigned 32-bit integers.
+ * @param[in] tree Tree from chaos_eytzinger_build()
+ * @param[in] count Number of elements (tree slots 1 to count)
+ * @param[in] key Value searched for
+ * @param[out] slot Slot of the first element >= @p key, or 0
+ */
+extern chaos_status_t chaos_eytzinger_lower_bound_u32(const chaos_u32_t *tree, chaos_size_t count, chaos_u32_t key, chaos_size_t *slot);
+
+/**
+ * @brief chaos_eytzinger_lower_bound() over signed 32-bit integers.
+ * @details As chaos_eytzinger_lower_bound_u32().
+ */
+extern chaos_status_t chaos_eytzinger_lower_bound_i32(const chaos_i32_t *tree, chaos_size_t count, chaos_i32_t key, chaos_size_t *slot);
+
+#if defined(CHAOS_ENABLE_INT64) && (CHAOS_ENABLE_INT64 == 1)
+/**
+ * @brief chaos_eytzinger_lower_bound() over unsigned 64-bit integers.
+ * @details As chaos_eytzinger_lower_bound_u32().
+ */
+extern chaos_status_t chaos_eytzinger_lower_bound_u64(const chaos_u64_t *tree, chaos_size_t count, chaos_u64_t key, chaos_size_t *slot);
+
+/**
+ * @brief chaos_eytzinger_lower_bound() over signed 64-bit integers.
+ * @details As chaos_eytzinger_lower_bound_u32().
+ */
+extern chaos_status_t chaos_eytzinger_lower_bound_i64(const chaos_i64_t *tree, chaos_size_t count, chaos_i64_t key, chaos_size_t *slot);
+#endif
+
+#if defined(CHAOS_ENABLE_FLOAT) && (CHAOS_ENABLE_FLOAT == 1)
+/**
+ * @brief chaos_eytzinger_lower_bound() over floats.
+ * @details As chaos_eytzinger_lower_bound_u32().
+ */
+extern chaos_status_t chaos_eytzinger_lower_bound_f32(const chaos_f32_t *tree, chaos_size_t count, chaos_f32_t key, chaos_size_t *slot);
+
+/**
+ * @brief chaos_eytzinger_lower_bound() over doubles.
+ * @details As chaos_eytzinger_lower_bound_u32().
+ */
+extern chaos_status_t chaos_eytzinger_lower_bound_f64(const chaos_f64_t *tree, chaos_size_t count, chaos_f64_t key, chaos_size_t *slot);
+#endif
+
+#endif /* CHAOS_SEARCH_H */
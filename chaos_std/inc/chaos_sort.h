@@ -0,0 +1,204 @@
+/**
+ * @file chaos_sort.h
+ * @brief In-place sorting for CHAOSLIB.
+ *
+ * All sorts are pattern-defeating quicksort (Peters): median-of-three or
+ * ninther pivots, insertion sort below 24 elements, a linear pass that
+ * finishes already sorted runs, shuffles that break adversarial patterns,
+ * and a heapsort fallback once partitions keep coming out unbalanced, so
+ * the worst case is O(n log n). Nothing is allocated and the recursion
+ * depth is at most log2(count). The sorts are not stable.
+ *
+ * chaos_sort() takes a comparator callback like qsort(). The typed forms
+ * are instantiations of chaos_sort_impl.h with the comparison inlined,
+ * which lets them partition in blocks without branching on comparisons;
+ * include that header to get the same for other element types.
+ *
+ * The radix sorts order plain numeric keys, optionally with a 32-bit
+ * payload each, in O(n) passes over the data. They are stable, and are
+ * the better choice from a few thousand keys up.
+ */
+
+#ifndef CHAOS_SORT_H
+#define CHAOS_SORT_H
+
+#include "chaos_types.h"
+#include "chaos_status.h"
+
+/* ============================================================= */
+/* SORT TYPES                                                    */
+/* ============================================================= */
+
+/**
+ * @brief Comparator: negative, zero or positive as a sorts before, with or
+ *        after b. Must be a consistent total preorder.
+ */
+typedef chaos_i32_t (*chaos_sort_cmp_t)(void *ctx, const void *a, const void *b);
+
+/**
+ * @brief 32-bit key with a 32-bit payload, sorted by key.
+ */
+typedef struct
+{
+    chaos_u32_t key;          /**< Sort key */
+    chaos_u32_t value;        /**< Payload carried with the key */
+} chaos_sort_kv32_t;
+
+#if defined(CHAOS_ENABLE_INT64) && (CHAOS_ENABLE_INT64 == 1)
+/**
+ * @brief 64-bit key with a 64-bit payload, sorted by key.
+ */
+typedef struct
+{
+    chaos_u64_t key;          /**< Sort key */
+    chaos_u64_t value;        /**< Payload carried with the key */
+} chaos_sort_kv64_t;
+#endif
+
+/* ============================================================= */
+/* SORT FUNCTIONS                                                */
+/* ============================================================= */
+
+/**
+ * @brief Sort an array of elements of any size.
+ * @param[inout] base Elements (may be NULL when count is 0)
+ * @param[in] count Number of elements
+ * @param[in] size Size of one element in bytes (non-zero)
+ * @param[in] cmp Comparator
+ * @param[in] ctx Passed to every @p cmp call (may be NULL)
+ */
+extern chaos_status_t chaos_sort(void *base, chaos_size_t count, chaos_size_t size, chaos_sort_cmp_t cmp, void *ctx);
+
+/**
+ * @brief Sort unsigned 32-bit integers in ascending order.
+ * @param[inout] base Elements (may be NULL when count is 0)
+ * @param[in] count Number of elements
+ */
+extern chaos_status_t chaos_sort_u32(chaos_u32_t *base, chaos_size_t count);
+
+/**
+ * @brief Sort signed 32-bit integers in ascending order.
+ * @details As chaos_sort_u32().
+ */
+extern chaos_status_t chaos_sort_i32(chaos_i32_t *base, chaos_size_t count);
+
+/**
+ * @brief Sort key/value pairs by ascending key.
+ * @details As chaos_sort_u32(); pairs with equal keys end up in any order.
+ */
+extern chaos_status_t chaos_sort_kv32(chaos_sort_kv32_t *base, chaos_size_t count);
+
+#if defined(CHAOS_ENABLE_INT64) && (CHAOS_ENABLE_INT64 == 1)
+/**
+ * @brief Sort unsigned 64-bit integers in ascending order.
+ * @details As chaos_sort_u32().
+ */
+extern chaos_status_t chaos_sort_u64(chaos_u64_t *base, chaos_size_t count);
+
+/**
+ * @brief Sort signed 64-bit integers in ascending order.
+ * @details As chaos_sort_u32().
+ */
+extern chaos_status_t chaos_sort_i64(chaos_i64_t *base, chaos_size_t count);
+
+/**
+ * @brief Sort 64-bit key/value pairs by ascending key.
+ * @details As chaos_sort_kv32().
+ */
+extern chaos_status_t chaos_sort_kv64(chaos_sort_kv64_t *base, chaos_size_t count);
+#endif
+
+#if defined(CHAOS_ENABLE_FLOAT) && (CHAOS_ENABLE_FLOAT == 1)
+/**
+ * @brief Sort floats in ascending order.
+ * @details NaNs go last; -0 and +0 compare equal. As chaos_sort_u32().
+ */
+extern chaos_status_t chaos_sort_f32(chaos_f32_t *base, chaos_size_t count);
+
+/**
+ * @brief Sort doubles in ascending order.
+ * @details As chaos_sort_f32().
+ */
+extern chaos_status_t chaos_sort_f64(chaos_f64_t *base, chaos_size_t count);
+#endif
+
+/* ============================================================= */
+/* RADIX SORT FUNCTIONS                                          */
+/* ============================================================= */
+
+/*
+ * LSD radix sorts with 8-bit digits for 32-bit keys and 11-bit digits for
+ * 64-bit keys. One read pass builds every digit histogram; a digit that
+ * is the same in all keys (the high bytes of nearby timestamps, say)
+ * costs no pass. Each remaining pass moves the keys, and the payloads
+ * when given, between the array and the scratch buffer. The 64-bit sorts
+ * only run the digits above about log2(count) + 12 bits and finish with
+ * an insertion pass, falling back to every digit when that pass finds
+ * too much out of order.
+ *
+ * scratch may be NULL, in which case the buffer comes from chaos_alloc()
+ * and is released before returning; without CHAOS_ENABLE_ALLOC that fails
+ * with the allocator's CHAOS_ALLOC_DISABLED status.
+ * Otherwise it must hold at least chaos_radix_sort_scratch() bytes; no
+ * alignment is required.
+ */
+
+/**
+ * @brief Scratch bytes a radix sort needs.
+ * @param[in] count Number of keys
+ * @param[in] key_size Key size in bytes (4 or 8)
+ * @param[in] with_values CHAOS_TRUE when a payload array is sorted along
+ * @return Buffer size, or the largest chaos_size_t when it does not fit
+ */
+extern chaos_size_t chaos_radix_sort_scratch(chaos_size_t count, chaos_size_t key_size, chaos_bool_t with_values);
+
+/**
+ * @brief Radix sort unsigned 32-bit keys in ascending order.
+ * @param[inout] keys Keys (may be NULL when count is 0)
+ * @param[inout] values Payload moved with each key, or NULL
+ * @param[in] count Number of keys
+ * @param[in] scratch Scratch buffer, or NULL to allocate one
+ * @param[in] scratch_size Size of @p scratch in bytes
+ * @return CHAOS_STATUS_OK, a CHAOS_STD_SCRATCH_SMALL error, or the
+ *         chaos_alloc() error when no buffer could be allocated
+ */
+extern chaos_status_t chaos_radix_sort_u32(chaos_u32_t *keys, chaos_u32_t *values, chaos_size_t count, void *scratch, chaos_size_t scratch_size);
+
+/**
+ * @brief Radix sort signed 32-bit keys in ascending order.
+ * @details As chaos_radix_sort_u32().
+ */
+extern chaos_status_t chaos_radix_sort_i32(chaos_i32_t *keys, chaos_u32_t *values, chaos_size_t count, void *scratch, chaos_size_t scratch_size);
+
+#if defined(CHAOS_ENABLE_INT64) && (CHAOS_ENABLE_INT64 == 1)
+/**
+ * @brief Radix sort unsigned 64-bit keys in ascending order.
+ * @details As chaos_radix_sort_u32().
+ */
+extern chaos_status_t chaos_radix_sort_u64(chaos_u64_t *keys, chaos_u32_t *values, chaos_size_t count, void *scratch, chaos_size_t scratch_size);
+
+/**
+ * @brief Radix sort signed 64-bit keys in ascending order.
+ * @details As chaos_radix_sort_u32().
+ */
+extern chaos_status_t chaos_radix_sort_i64(chaos_i64_t *keys, chaos_u32_t *values, chaos_size_t count, void *scratch, chaos_size_t scratch_size);
+#endif
+
+#if defined(CHAOS_ENABLE_FLOAT) && (CHAOS_ENABLE_FLOAT == 1)
+/**
+ * @brief Radix sort floats in ascending order.
+ * @details Orders by IEEE total order: -0 before +0, and NaNs at either
+ *          end by sign. As chaos_radix_sort_u32().
+ */
+extern chaos_status_t chaos_radix_sort_f32(chaos_f32_t *keys, chaos_u32_t *values, chaos_size_t count, void *scratch, chaos_size_t scratch_size);
+
+#if defined(CHAOS_ENABLE_INT64) && (CHAOS_ENABLE_INT64 == 1)
+/**
+ * @brief Radix sort doubles in ascending order.
+ * @details As chaos_radix_sort_f32().
+ */
+extern chaos_status_t chaos_radix_sort_f64(chaos_f64_t *keys, chaos_u32_t *values, chaos_size_t count, void *scratch, chaos_size_t scratch_size);
+#endif
+#endif
+
+#endif /* CHAOS_SORT_H */
@@ -0,0 +1,730 @@
+/**
+ * @file chaos_sort_impl.h
+ * @brief Pattern-defeating quicksort for one element type, instantiated by macro.
+ *
+ * Define the three parameters and include this file:
+ *
+ *     #define CHAOS_SORT_NAME       event_sort
+ *     #define CHAOS_SORT_TYPE       event_t
+ *     #define CHAOS_SORT_LESS(a, b) ((a)->time < (b)->time)
+ *     #include "chaos_sort_impl.h"
+ *
+ * This defines static void event_sort(event_t *base, chaos_size_t count)
+ * and static helpers named event_sort_*, then undefines the parameters so
+ * the file can be included again for another type. CHAOS_SORT_LESS gets
+ * two element pointers and must be a strict weak ordering; its arguments
+ * never have side effects. Elements are moved by assignment.
+ *
+ * For elements whose size is only known at run time, also define
+ * CHAOS_SORT_CTX (a context type), CHAOS_SORT_WIDTH(ctx) (element size in
+ * bytes) and CHAOS_SORT_SWAP(a, b) (exchange two elements), with
+ * CHAOS_SORT_TYPE set to chaos_u8_t. Every function then takes the context
+ * first, as ctx, which CHAOS_SORT_LESS and CHAOS_SORT_SWAP may use.
+ * Elements are only ever exchanged, so the pivot is compared in place at
+ * the front of its range instead of from a copy. chaos_sort() is built
+ * this way.
+ *
+ * Partitioning follows BlockQuicksort (Edelkamp and Weiss): a block of
+ * comparison results is first recorded as offsets, with no branch on the
+ * outcome, and the misplaced elements are then exchanged in one pass.
+ *
+ * No include guard: this file is meant to be included more than once.
+ */
+
+#if !defined(CHAOS_SORT_NAME) || !defined(CHAOS_SORT_TYPE) || !defined(CHAOS_SORT_LESS)
+#error "Define CHAOS_SORT_NAME, CHAOS_SORT_TYPE and CHAOS_SORT_LESS before including chaos_sort_impl.h"
+#endif
+
+#if defined(CHAOS_SORT_WIDTH) && (!defined(CHAOS_SORT_CTX) || !defined(CHAOS_SORT_SWAP))
+#error "CHAOS_SORT_WIDTH also needs CHAOS_SORT_CTX and CHAOS_SORT_SWAP"
+#endif
+
+#include "chaos_types.h"
+
+#ifndef CHAOS_SORT_IMPL_COMMON
+#define CHAOS_SORT_IMPL_COMMON
+
+/* Ranges below this are insertion sorted */
+#define CHAOS_SORT_INSERTION 24U
+
+/* Ranges above this take the pivot as a median of three medians */
+#define CHAOS_SORT_NINTHER 128U
+
+/* Element moves the optimistic insertion sort may spend before giving up */
+#define CHAOS_SORT_PARTIAL_LIMIT 8U
+
+/* Comparisons recorded per side before exchanging (offsets fit a byte) */
+#define CHAOS_SORT_BLOCK 64U
+
+#define CHAOS_SORT_CAT2(a, b) a##_##b
+#define CHAOS_SORT_CAT(a, b)  CHAOS_SORT_CAT2(a, b)
+
+#endif /* CHAOS_SORT_IMPL_COMMON */
+
+#define CHAOS_SORT_FN(name) CHAOS_SORT_CAT(CHAOS_SORT_NAME, name)
+
+/* Element addressing: n elements after or before p, and elements from a to b */
+#if defined(CHAOS_SORT_WIDTH)
+#define CHAOS_SORT_PARAM      CHAOS_SORT_CTX ctx,
+#define CHAOS_SORT_ARG        ctx,
+#define CHAOS_SORT_AT(p, n)   ((p) + ((chaos_uintptr_t)(n) * CHAOS_SORT_WIDTH(ctx)))
+#define CHAOS_SORT_BACK(p, n) ((p) - ((chaos_uintptr_t)(n) * CHAOS_SORT_WIDTH(ctx)))
+#define CHAOS_SORT_DIST(a, b) ((chaos_size_t)((b) - (a)) / CHAOS_SORT_WIDTH(ctx))
+#else
+#define CHAOS_SORT_PARAM
+#define CHAOS_SORT_ARG
+#define CHAOS_SORT_AT(p, n)   ((p) + (n))
+#define CHAOS_SORT_BACK(p, n) ((p) - (n))
+#define CHAOS_SORT_DIST(a, b) ((chaos_size_t)((b) - (a)))
+#endif
+
+/* ============================================================= */
+/* FUNCTION PROTOTYPES                                          */
+/* ============================================================= */
+static void CHAOS_SORT_FN(insertion)(CHAOS_SORT_PARAM CHAOS_SORT_TYPE *begin, CHAOS_SORT_TYPE *end);
+static void CHAOS_SORT_FN(insertion_unguarded)(CHAOS_SORT_PARAM CHAOS_SORT_TYPE *begin, CHAOS_SORT_TYPE *end);
+static chaos_bool_t CHAOS_SORT_FN(insertion_partial)(CHAOS_SORT_PARAM CHAOS_SORT_TYPE *begin, CHAOS_SORT_TYPE *end);
+static void CHAOS_SORT_FN(swap)(CHAOS_SORT_PARAM CHAOS_SORT_TYPE *a, CHAOS_SORT_TYPE *b);
+static void CHAOS_SORT_FN(sort3)(CHAOS_SORT_PARAM CHAOS_SORT_TYPE *a, CHAOS_SORT_TYPE *b, CHAOS_SORT_TYPE *c);
+static CHAOS_SORT_TYPE *CHAOS_SORT_FN(partition_right)(CHAOS_SORT_PARAM CHAOS_SORT_TYPE *begin, CHAOS_SORT_TYPE *end, chaos_bool_t *already);
+static CHAOS_SORT_TYPE *CHAOS_SORT_FN(partition_left)(CHAOS_SORT_PARAM CHAOS_SORT_TYPE *begin, CHAOS_SORT_TYPE *end);
+static void CHAOS_SORT_FN(shuffle)(CHAOS_SORT_PARAM CHAOS_SORT_TYPE *begin, CHAOS_SORT_TYPE *pivot, CHAOS_SORT_TYPE *end);
+static void CHAOS_SORT_FN(sift)(CHAOS_SORT_PARAM CHAOS_SORT_TYPE *base, chaos_size_t root, chaos_size_t count);
+static void CHAOS_SORT_FN(heapsort)(CHAOS_SORT_PARAM CHAOS_SORT_TYPE *base, chaos_size_t count);
+static void CHAOS_SORT_FN(loop)(CHAOS_SORT_PARAM CHAOS_SORT_TYPE *begin, CHAOS_SORT_TYPE *end, chaos_u32_t bad, chaos_bool_t leftmost);
+static void CHAOS_SORT_NAME(CHAOS_SORT_PARAM CHAOS_SORT_TYPE *base, chaos_size_t count);
+
+/* ============================================================= */
+/* ENTRY POINT                                                   */
+/* ============================================================= */
+static void CHAOS_SORT_NAME(CHAOS_SORT_PARAM CHAOS_SORT_TYPE *base, chaos_size_t count)
+{
+    chaos_u32_t bad = 0U;
+    chaos_size_t n = count;
+
+    /* floor(log2(count)) unbalanced partitions are tolerated before heapsort */
+    while (n > 1U)
+    {
+        n >>= 1U;
+        bad++;
+    }
+    if (count > 1U)
+    {
+        CHAOS_SORT_FN(loop)(CHAOS_SORT_ARG base, CHAOS_SORT_AT(base, count), bad, CHAOS_TRUE);
+    }
+}
+
+/* ============================================================= */
+/* INTERNAL HELPERS                                              */
+/* ============================================================= */
+
+static void CHAOS_SORT_FN(insertion)(CHAOS_SORT_PARAM CHAOS_SORT_TYPE *begin, CHAOS_SORT_TYPE *end)
+{
+    CHAOS_SORT_TYPE *cur;
+    CHAOS_SORT_TYPE *sift;
+#if defined(CHAOS_SORT_WIDTH)
+
+    for (cur = CHAOS_SORT_AT(begin, 1U); cur < end; cur = CHAOS_SORT_AT(cur, 1U))
+    {
+        sift = cur;
+        while ((sift != begin) && CHAOS_SORT_LESS(sift, CHAOS_SORT_BACK(sift, 1U)))
+        {
+            CHAOS_SORT_SWAP(sift, CHAOS_SORT_BACK(sift, 1U));
+            sift = CHAOS_SORT_BACK(sift, 1U);
+        }
+    }
+#else
+    CHAOS_SORT_TYPE tmp;
+
+    for (cur = begin + 1; cur < end; cur++)
+    {
+        if (CHAOS_SORT_LESS(cur, cur - 1))
+        {
+            tmp = *cur;
+            sift = cur;
+            do
+            {
+                *sift = *(sift - 1);
+                sift--;
+            } while ((sift != begin) && CHAOS_SORT_LESS(&tmp, sift - 1));
+            *sift = tmp;
+        }
+    }
+#endif
+}
+
+/* Needs an element not greater than any in the range just before begin */
+static void CHAOS_SORT_FN(insertion_unguarded)(CHAOS_SORT_PARAM CHAOS_SORT_TYPE *begin, CHAOS_SORT_TYPE *end)
+{
+    CHAOS_SORT_TYPE *cur;
+    CHAOS_SORT_TYPE *sift;
+#if defined(CHAOS_SORT_WIDTH)
+
+    for (cur = CHAOS_SORT_AT(begin, 1U); cur < end; cur = CHAOS_SORT_AT(cur, 1U))
+    {
+        sift = cur;
+        while (CHAOS_SORT_LESS(sift, CHAOS_SORT_BACK(sift, 1U)))
+        {
+            CHAOS_SORT_SWAP(sift, CHAOS_SORT_BACK(sift, 1U));
+            sift = CHAOS_SORT_BACK(sift, 1U);
+        }
+    }
+#else
+    CHAOS_SORT_TYPE tmp;
+
+    for (cur = begin + 1; cur < end; cur++)
+    {
+        if (CHAOS_SORT_LESS(cur, cur - 1))
+        {
+            tmp = *cur;
+            sift = cur;
+            do
+            {
+                *sift = *(sift - 1);
+                sift--;
+            } while (CHAOS_SORT_LESS(&tmp, sift - 1));
+            *sift = tmp;
+        }
+    }
+#endif
+}
+
+/* Insertion sort that gives up (returning CHAOS_FALSE) after a few moves */
+static chaos_bool_t CHAOS_SORT_FN(insertion_partial)(CHAOS_SORT_PARAM CHAOS_SORT_TYPE *begin, CHAOS_SORT_TYPE *end)
+{
+    CHAOS_SORT_TYPE *cur;
+    CHAOS_SORT_TYPE *sift;
+    chaos_size_t moved = 0U;
+#if defined(CHAOS_SORT_WIDTH)
+
+    for (cur = CHAOS_SORT_AT(begin, 1U); (cur < end) && (moved <= CHAOS_SORT_PARTIAL_LIMIT); cur = CHAOS_SORT_AT(cur, 1U))
+    {
+        sift = cur;
+        while ((sift != begin) && CHAOS_SORT_LESS(sift, CHAOS_SORT_BACK(sift, 1U)))
+        {
+            CHAOS_SORT_SWAP(sift, CHAOS_SORT_BACK(sift, 1U));
+            sift = CHAOS_SORT_BACK(sift, 1U);
+            moved++;
+        }
+    }
+#else
+    CHAOS_SORT_TYPE tmp;
+
+    for (cur = begin + 1; (cur < end) && (moved <= CHAOS_SORT_PARTIAL_LIMIT); cur++)
+    {
+        if (CHAOS_SORT_LESS(cur, cur - 1))
+        {
+            tmp = *cur;
+            sift = cur;
+            do
+            {
+                *sift = *(sift - 1);
+                sift--;
+            } while ((sift != begin) && CHAOS_SORT_LESS(&tmp, sift - 1));
+            *sift = tmp;
+            moved += (chaos_size_t)(cur - sift);
+        }
+    }
+#endif
+
+    return (moved <= CHAOS_SORT_PARTIAL_LIMIT) ? CHAOS_TRUE : CHAOS_FALSE;
+}
+
+static void CHAOS_SORT_FN(swap)(CHAOS_SORT_PARAM CHAOS_SORT_TYPE *a, CHAOS_SORT_TYPE *b)
+{
+#if defined(CHAOS_SORT_WIDTH)
+    CHAOS_SORT_SWAP(a, b);
+#else
+    CHAOS_SORT_TYPE tmp = *a;
+
+    *a = *b;
+    *b = tmp;
+#endif
+}
+
+static void CHAOS_SORT_FN(sort3)(CHAOS_SORT_PARAM CHAOS_SORT_TYPE *a, CHAOS_SORT_TYPE *b, CHAOS_SORT_TYPE *c)
+{
+    if (CHAOS_SORT_LESS(b, a))
+    {
+        CHAOS_SORT_FN(swap)(CHAOS_SORT_ARG a, b);
+    }
+    if (CHAOS_SORT_LESS(c, b))
+    {
+        CHAOS_SORT_FN(swap)(CHAOS_SORT_ARG b, c);
+    }
+    if (CHAOS_SORT_LESS(b, a))
+    {
+        CHAOS_SORT_FN(swap)(CHAOS_SORT_ARG a, b);
+    }
+}
+
+/* The pivot: a copy of *begin, or *begin itself when elements are only exchanged */
+#if defined(CHAOS_SORT_WIDTH)
+#define CHAOS_SORT_PIVOT pivot
+#else
+#define CHAOS_SORT_PIVOT (&pivot)
+#endif
+
+/*
+ * Partition around *begin: smaller elements to its left, the others to its
+ * right; returns where the pivot ends up. The median selection left an
+ * element not less than the pivot at the end, which bounds the first scan.
+ * already is set when no element had to move.
+ */
+static CHAOS_SORT_TYPE *CHAOS_SORT_FN(partition_right)(CHAOS_SORT_PARAM CHAOS_SORT_TYPE *begin, CHAOS_SORT_TYPE *end, chaos_bool_t *already)
+{
+#if defined(CHAOS_SORT_WIDTH)
+    const CHAOS_SORT_TYPE *pivot = begin;
+#else
+    CHAOS_SORT_TYPE pivot = *begin;
+    CHAOS_SORT_TYPE tmp;
+#endif
+    CHAOS_SORT_TYPE *first = begin;
+    CHAOS_SORT_TYPE *last = end;
+    CHAOS_SORT_TYPE *base_l;
+    CHAOS_SORT_TYPE *base_r;
+    CHAOS_SORT_TYPE *l;
+    CHAOS_SORT_TYPE *r;
+    chaos_u8_t off_l[CHAOS_SORT_BLOCK];
+    chaos_u8_t off_r[CHAOS_SORT_BLOCK];
+    chaos_size_t num_l = 0U;
+    chaos_size_t num_r = 0U;
+    chaos_size_t start_l = 0U;
+    chaos_size_t start_r = 0U;
+    chaos_size_t split_l;
+    chaos_size_t split_r;
+    chaos_size_t num;
+    chaos_size_t i;
+    chaos_bool_t scan = CHAOS_TRUE;
+
+    do
+    {
+        first = CHAOS_SORT_AT(first, 1U);
+    } while (CHAOS_SORT_LESS(first, CHAOS_SORT_PIVOT));
+
+    if (CHAOS_SORT_BACK(first, 1U) == begin)
+    {
+        /* No sentinel on the left side of the scan: bound it by first */
+        while ((scan == CHAOS_TRUE) && (first < last))
+        {
+            last = CHAOS_SORT_BACK(last, 1U);
+            scan = CHAOS_SORT_LESS(last, CHAOS_SORT_PIVOT) ? CHAOS_FALSE : CHAOS_TRUE;
+        }
+    }
+    else
+    {
+        do
+        {
+            last = CHAOS_SORT_BACK(last, 1U);
+        } while (!CHAOS_SORT_LESS(last, CHAOS_SORT_PIVOT));
+    }
+
+    *already = (first >= last) ? CHAOS_TRUE : CHAOS_FALSE;
+
+    if (*already == CHAOS_FALSE)
+    {
+        CHAOS_SORT_FN(swap)(CHAOS_SORT_ARG first, last);
+        first = CHAOS_SORT_AT(first, 1U);
+        base_l = first;
+        base_r = last;
+
+        while (first < last)
+        {
+            /* Refill whichever offset block ran empty, splitting what is left between them */
+            split_l = CHAOS_SORT_DIST(first, last);
+            split_r = 0U;
+            if ((num_l == 0U) && (num_r == 0U))
+            {
+                split_r = split_l - (split_l / 2U);
+                split_l /= 2U;
+            }
+            else if (num_r == 0U)
+            {
+                split_r = split_l;
+                split_l = 0U;
+            }
+            else if (num_l != 0U)
+            {
+                split_l = 0U;
+            }
+            else
+            {
+                /* Only the left block needs refilling */
+            }
+            split_l = (split_l < CHAOS_SORT_BLOCK) ? split_l : CHAOS_SORT_BLOCK;
+            split_r = (split_r < CHAOS_SORT_BLOCK) ? split_r : CHAOS_SORT_BLOCK;
+
+            for (i = 0U; i < split_l; i++)
+            {
+                off_l[num_l] = (chaos_u8_t)i;
+                num_l += CHAOS_SORT_LESS(first, CHAOS_SORT_PIVOT) ? 0U : 1U;
+                first = CHAOS_SORT_AT(first, 1U);
+            }
+            for (i = 0U; i < split_r; i++)
+            {
+                last = CHAOS_SORT_BACK(last, 1U);
+                off_r[num_r] = (chaos_u8_t)(i + 1U);
+                num_r += CHAOS_SORT_LESS(last, CHAOS_SORT_PIVOT) ? 1U : 0U;
+            }
+
+            /*
+             * Exchange as many as both blocks have. Equal counts (descending or
+             * duplicate-heavy input) swap pairwise; otherwise the typed sorts move
+             * them as one cycle, which writes each element once.
+             */
+            num = (num_l < num_r) ? num_l : num_r;
+#if defined(CHAOS_SORT_WIDTH)
+            for (i = 0U; i < num; i++)
+            {
+                l = CHAOS_SORT_AT(base_l, off_l[start_l + i]);
+                r = CHAOS_SORT_BACK(base_r, off_r[start_r + i]);
+                CHAOS_SORT_SWAP(l, r);
+            }
+#else
+            if (num_l == num_r)
+            {
+                for (i = 0U; i < num; i++)
+                {
+                    CHAOS_SORT_FN(swap)(CHAOS_SORT_ARG base_l + off_l[start_l + i], base_r - off_r[start_r + i]);
+                }
+            }
+            else if (num != 0U)
+            {
+                l = base_l + off_l[start_l];
+                r = base_r - off_r[start_r];
+                tmp = *l;
+                *l = *r;
+                for (i = 1U; i < num; i++)
+                {
+                    l = base_l + off_l[start_l + i];
+                    *r = *l;
+                    r = base_r - off_r[start_r + i];
+                    *l = *r;
+                }
+                *r = tmp;
+            }
+            else
+            {
+                /* One block has nothing to exchange */
+            }
+#endif
+            num_l -= num;
+            num_r -= num;
+            start_l += num;
+            start_r += num;
+            if (num_l == 0U)
+            {
+                start_l = 0U;
+                base_l = first;
+            }
+            if (num_r == 0U)
+            {
+                start_r = 0U;
+                base_r = last;
+            }
+        }
+
+        /* Whatever one block still holds goes to the far end of the settled range */
+        if (num_l != 0U)
+        {
+            while (num_l != 0U)
+            {
+                num_l--;
+                last = CHAOS_SORT_BACK(last, 1U);
+                CHAOS_SORT_FN(swap)(CHAOS_SORT_ARG CHAOS_SORT_AT(base_l, off_l[start_l + num_l]), last);
+            }
+            first = last;
+        }
+        if (num_r != 0U)
+        {
+            while (num_r != 0U)
+            {
+                num_r--;
+                CHAOS_SORT_FN(swap)(CHAOS_SORT_ARG CHAOS_SORT_BACK(base_r, off_r[start_r + num_r]), first);
+                first = CHAOS_SORT_AT(first, 1U);
+            }
+        }
+    }
+
+    first = CHAOS_SORT_BACK(first, 1U);
+#if defined(CHAOS_SORT_WIDTH)
+    CHAOS_SORT_SWAP(begin, first);
+#else
+    *begin = *first;
+    *first = pivot;
+#endif
+
+    return first;
+}
+
+/*
+ * Partition around *begin with the elements equal to it on the left. Used
+ * when the pivot equals the element before the range (a pivot already
+ * used): the whole left side then holds that value and needs no sorting.
+ */
+static CHAOS_SORT_TYPE *CHAOS_SORT_FN(partition_left)(CHAOS_SORT_PARAM CHAOS_SORT_TYPE *begin, CHAOS_SORT_TYPE *end)
+{
+#if defined(CHAOS_SORT_WIDTH)
+    const CHAOS_SORT_TYPE *pivot = begin;
+#else
+    CHAOS_SORT_TYPE pivot = *begin;
+#endif
+    CHAOS_SORT_TYPE *first = begin;
+    CHAOS_SORT_TYPE *last = end;
+    chaos_bool_t scan = CHAOS_TRUE;
+
+    do
+    {
+        last = CHAOS_SORT_BACK(last, 1U);
+    } while (CHAOS_SORT_LESS(CHAOS_SORT_PIVOT, last));
+
+    if (CHAOS_SORT_AT(last, 1U) == end)
+    {
+        while ((scan == CHAOS_TRUE) && (first < last))
+        {
+            first = CHAOS_SORT_AT(first, 1U);
+            scan = CHAOS_SORT_LESS(CHAOS_SORT_PIVOT, first) ? CHAOS_FALSE : CHAOS_TRUE;
+        }
+    }
+    else
+    {
+        do
+        {
+            first = CHAOS_SORT_AT(first, 1U);
+        } while (!CHAOS_SORT_LESS(CHAOS_SORT_PIVOT, first));
+    }
+
+    while (first < last)
+    {
+        CHAOS_SORT_FN(swap)(CHAOS_SORT_ARG first, last);
+        do
+        {
+            last = CHAOS_SORT_BACK(last, 1U);
+        } while (CHAOS_SORT_LESS(CHAOS_SORT_PIVOT, last));
+        do
+        {
+            first = CHAOS_SORT_AT(first, 1U);
+        } while (!CHAOS_SORT_LESS(CHAOS_SORT_PIVOT, first));
+    }
+
+#if defined(CHAOS_SORT_WIDTH)
+    CHAOS_SORT_SWAP(begin, last);
+#else
+    *begin = *last;
+    *last = pivot;
+#endif
+
+    return last;
+}
+
+#undef CHAOS_SORT_PIVOT
+
+/* After an unbalanced split, move a few elements so the next pivots sample elsewhere */
+static void CHAOS_SORT_FN(shuffle)(CHAOS_SORT_PARAM CHAOS_SORT_TYPE *begin, CHAOS_SORT_TYPE *pivot, CHAOS_SORT_TYPE *end)
+{
+    chaos_size_t l_size = CHAOS_SORT_DIST(begin, pivot);
+    chaos_size_t r_size = CHAOS_SORT_DIST(pivot, end) - 1U;
+
+    if (l_size >= CHAOS_SORT_INSERTION)
+    {
+        CHAOS_SORT_FN(swap)(CHAOS_SORT_ARG begin, CHAOS_SORT_AT(begin, l_size / 4U));
+        CHAOS_SORT_FN(swap)(CHAOS_SORT_ARG CHAOS_SORT_BACK(pivot, 1U), CHAOS_SORT_BACK(pivot, l_size / 4U));
+        if (l_size > CHAOS_SORT_NINTHER)
+        {
+            CHAOS_SORT_FN(swap)(CHAOS_SORT_ARG CHAOS_SORT_AT(begin, 1U), CHAOS_SORT_AT(begin, (l_size / 4U) + 1U));
+            CHAOS_SORT_FN(swap)(CHAOS_SORT_ARG CHAOS_SORT_AT(begin, 2U), CHAOS_SORT_AT(begin, (l_size / 4U) + 2U));
+            CHAOS_SORT_FN(swap)(CHAOS_SORT_ARG CHAOS_SORT_BACK(pivot, 2U), CHAOS_SORT_BACK(pivot, (l_size / 4U) + 1U));
+            CHAOS_SORT_FN(swap)(CHAOS_SORT_ARG CHAOS_SORT_BACK(pivot, 3U), CHAOS_SORT_BACK(pivot, (l_size / 4U) + 2U));
+        }
+    }
+    if (r_size >= CHAOS_SORT_INSERTION)
+    {
+        CHAOS_SORT_FN(swap)(CHAOS_SORT_ARG CHAOS_SORT_AT(pivot, 1U), CHAOS_SORT_AT(pivot, 1U + (r_size / 4U)));
+        CHAOS_SORT_FN(swap)(CHAOS_SORT_ARG CHAOS_SORT_BACK(end, 1U), CHAOS_SORT_BACK(end, r_size / 4U));
+        if (r_size > CHAOS_SORT_NINTHER)
+        {
+            CHAOS_SORT_FN(swap)(CHAOS_SORT_ARG CHAOS_SORT_AT(pivot, 2U), CHAOS_SORT_AT(pivot, 2U + (r_size / 4U)));
+            CHAOS_SORT_FN(swap)(CHAOS_SORT_ARG CHAOS_SORT_AT(pivot, 3U), CHAOS_SORT_AT(pivot, 3U + (r_size / 4U)));
+            CHAOS_SORT_FN(swap)(CHAOS_SORT_ARG CHAOS_SORT_BACK(end, 2U), CHAOS_SORT_BACK(end, 1U + (r_size / 4U)));
+            CHAOS_SORT_FN(swap)(CHAOS_SORT_ARG CHAOS_SORT_BACK(end, 3U), CHAOS_SORT_BACK(end, 2U + (r_size / 4U)));
+        }
+    }
+}
+
+/* Restore the max-heap property below root */
+static void CHAOS_SORT_FN(sift)(CHAOS_SORT_PARAM CHAOS_SORT_TYPE *base, chaos_size_t root, chaos_size_t count)
+{
+    chaos_size_t child = (2U * root) + 1U;
+    chaos_bool_t more = CHAOS_TRUE;
+#if defined(CHAOS_SORT_WIDTH)
+
+    while ((more == CHAOS_TRUE) && (child < count))
+    {
+        if (((child + 1U) < count) && CHAOS_SORT_LESS(CHAOS_SORT_AT(base, child), CHAOS_SORT_AT(base, child + 1U)))
+        {
+            child++;
+        }
+        if (CHAOS_SORT_LESS(CHAOS_SORT_AT(base, root), CHAOS_SORT_AT(base, child)))
+        {
+            CHAOS_SORT_SWAP(CHAOS_SORT_AT(base, root), CHAOS_SORT_AT(base, child));
+            root = child;
+            child = (2U * root) + 1U;
+        }
+        else
+        {
+            more = CHAOS_FALSE;
+        }
+    }
+#else
+    CHAOS_SORT_TYPE tmp = base[root];
+
+    while ((more == CHAOS_TRUE) && (child < count))
+    {
+        if (((child + 1U) < count) && CHAOS_SORT_LESS(&base[child], &base[child + 1U]))
+        {
+            child++;
+        }
+        if (CHAOS_SORT_LESS(&tmp, &base[child]))
+        {
+            base[root] = base[child];
+            root = child;
+            child = (2U * root) + 1U;
+        }
+        else
+        {
+            more = CHAOS_FALSE;
+        }
+    }
+    base[root] = tmp;
+#endif
+}
+
+static void CHAOS_SORT_FN(heapsort)(CHAOS_SORT_PARAM CHAOS_SORT_TYPE *base, chaos_size_t count)
+{
+    chaos_size_t i;
+
+    for (i = count / 2U; i > 0U; i--)
+    {
+        CHAOS_SORT_FN(sift)(CHAOS_SORT_ARG base, i - 1U, count);
+    }
+    for (i = count - 1U; i > 0U; i--)
+    {
+        CHAOS_SORT_FN(swap)(CHAOS_SORT_ARG base, CHAOS_SORT_AT(base, i));
+        CHAOS_SORT_FN(sift)(CHAOS_SORT_ARG base, 0U, i);
+    }
+}
+
+/*
+ * Sorts [begin, end). leftmost is CHAOS_FALSE when the element before begin
+ * is a previous pivot, not greater than anything in the range. The smaller
+ * side of each partition is sorted by recursion and the larger one by the
+ * loop, which bounds the depth by log2 of the size.
+ */
+static void CHAOS_SORT_FN(loop)(CHAOS_SORT_PARAM CHAOS_SORT_TYPE *begin, CHAOS_SORT_TYPE *end, chaos_u32_t bad, chaos_bool_t leftmost)
+{
+    CHAOS_SORT_TYPE *pivot;
+    chaos_size_t size;
+    chaos_size_t half;
+    chaos_size_t l_size;
+    chaos_size_t r_size;
+    chaos_bool_t already = CHAOS_FALSE;
+    chaos_bool_t done = CHAOS_FALSE;
+
+    while (done == CHAOS_FALSE)
+    {
+        size = CHAOS_SORT_DIST(begin, end);
+        half = size / 2U;
+
+        if (size < CHAOS_SORT_INSERTION)
+        {
+            if (leftmost == CHAOS_TRUE)
+            {
+                CHAOS_SORT_FN(insertion)(CHAOS_SORT_ARG begin, end);
+            }
+            else
+            {
+                CHAOS_SORT_FN(insertion_unguarded)(CHAOS_SORT_ARG begin, end);
+            }
+            done = CHAOS_TRUE;
+        }
+        else
+        {
+            if (size > CHAOS_SORT_NINTHER)
+            {
+                CHAOS_SORT_FN(sort3)(CHAOS_SORT_ARG begin, CHAOS_SORT_AT(begin, half), CHAOS_SORT_BACK(end, 1U));
+                CHAOS_SORT_FN(sort3)(CHAOS_SORT_ARG CHAOS_SORT_AT(begin, 1U), CHAOS_SORT_AT(begin, half - 1U), CHAOS_SORT_BACK(end, 2U));
+                CHAOS_SORT_FN(sort3)(CHAOS_SORT_ARG CHAOS_SORT_AT(begin, 2U), CHAOS_SORT_AT(begin, half + 1U), CHAOS_SORT_BACK(end, 3U));
+                CHAOS_SORT_FN(sort3)(CHAOS_SORT_ARG CHAOS_SORT_AT(begin, half - 1U), CHAOS_SORT_AT(begin, half), CHAOS_SORT_AT(begin, half + 1U));
+                CHAOS_SORT_FN(swap)(CHAOS_SORT_ARG begin, CHAOS_SORT_AT(begin, half));
+            }
+            else
+            {
+                CHAOS_SORT_FN(sort3)(CHAOS_SORT_ARG CHAOS_SORT_AT(begin, half), begin, CHAOS_SORT_BACK(end, 1U));
+            }
+
+            if ((leftmost == CHAOS_FALSE) && !CHAOS_SORT_LESS(CHAOS_SORT_BACK(begin, 1U), begin))
+            {
+                /* Many equal elements: put them all left and go on with the rest */
+                begin = CHAOS_SORT_AT(CHAOS_SORT_FN(partition_left)(CHAOS_SORT_ARG begin, end), 1U);
+            }
+            else
+            {
+                pivot = CHAOS_SORT_FN(partition_right)(CHAOS_SORT_ARG begin, end, &already);
+                l_size = CHAOS_SORT_DIST(begin, pivot);
+                r_size = size - l_size - 1U;
+
+                if ((l_size < (size / 8U)) || (r_size < (size / 8U)))
+                {
+                    bad--;
+                    if (bad == 0U)
+                    {
+                        CHAOS_SORT_FN(heapsort)(CHAOS_SORT_ARG begin, size);
+                        done = CHAOS_TRUE;
+                    }
+                    else
+                    {
+                        CHAOS_SORT_FN(shuffle)(CHAOS_SORT_ARG begin, pivot, end);
+                    }
+                }
+                else if ((already == CHAOS_TRUE) && (CHAOS_SORT_FN(insertion_partial)(CHAOS_SORT_ARG begin, pivot) == CHAOS_TRUE) &&
+                         (CHAOS_SORT_FN(insertion_partial)(CHAOS_SORT_ARG CHAOS_SORT_AT(pivot, 1U), end) == CHAOS_TRUE))
+                {
+                    /* The input was (nearly) sorted already */
+                    done = CHAOS_TRUE;
+                }
+                else
+                {
+                    /* Both sides still to sort */
+                }
+
+                if (done == CHAOS_FALSE)
+                {
+                    if (l_size < r_size)
+                    {
+                        CHAOS_SORT_FN(loop)(CHAOS_SORT_ARG begin, pivot, bad, leftmost);
+                        begin = CHAOS_SORT_AT(pivot, 1U);
+                        leftmost = CHAOS_FALSE;
+                    }
+                    else
+                    {
+                        CHAOS_SORT_FN(loop)(CHAOS_SORT_ARG CHAOS_SORT_AT(pivot, 1U), end, bad, CHAOS_FALSE);
+                        end = pivot;
+                    }
+                }
+            }
+        }
+    }
+}
+
+#undef CHAOS_SORT_FN
+#undef CHAOS_SORT_PARAM
+#undef CHAOS_SORT_ARG
+#undef CHAOS_SORT_AT
+#undef CHAOS_SORT_BACK
+#undef CHAOS_SORT_DIST
+#undef CHAOS_SORT_NAME
+#undef CHAOS_SORT_TYPE
+#undef CHAOS_SORT_LESS
+#undef CHAOS_SORT_CTX
+#undef CHAOS_SORT_WIDTH
+#undef CHAOS_SORT_SWAP
@@ -0,0 +1,174 @@
+/**
+ * @file chaos_std.h
+ * @brief Standard library replacements for CHAOSLIB.
+ *
+ * Decimal integer parsing in the manner of strtol(): leading ASCII
+ * whitespace is skipped, an optional sign is accepted and digits are read
+ * up to the first non-digit. Unlike strtol() the input is length-bounded
+ * (fields need no terminator), overflow is reported as an error with the
+ * result saturated, and a '-' is rejected by the unsigned parsers. Digits
+ * are converted a word at a time (eight per step on 64-bit targets).
+ *
+ * Integer formatting writes a null-terminated decimal or hexadecimal string
+ * into a bounded buffer. The digit count is worked out first, so digits are
+ * stored directly in their final place, two per table lookup.
+ *
+ * Floating-point formatting (CHAOS_ENABLE_FLOAT with CHAOS_ENABLE_INT64)
+ * writes the shortest decimal that reads back to the same value, and
+ * parsing rounds correctly (to nearest, ties to even) for any number of
+ * digits, so the two round-trip exactly.
+ */
+
+#ifndef CHAOS_STD_H
+#define CHAOS_STD_H
+
+#include "chaos_types.h"
+#include "chaos_status.h"
+
+/* ============================================================= */
+/* INTEGER PARSING                                               */
+/* ============================================================= */
+
+/**
+ * @brief Parse a signed 32-bit decimal integer.
+ * @param[in] str Characters to parse (may be NULL when len is 0)
+ * @param[in] len Number of characters available
+ * @param[out] value Parsed value; saturated on overflow, 0 when no digits
+ * @param[out] consumed Characters used, whitespace and sign included; 0 when
+ *             there are no digits (may be NULL)
+ * @return CHAOS_STATUS_OK, or CHAOS_STD_NO_DIGITS / CHAOS_STD_OVERFLOW errors
+ */
+extern chaos_status_t chaos_strtoi32(const chaos_char_t *str, chaos_size_t len, chaos_i32_t *value, chaos_size_t *consumed);
+
+/**
+ * @brief Parse an unsigned 32-bit decimal integer.
+ * @details As chaos_strtoi32(); a leading '-' is not a number.
+ */
+extern chaos_status_t chaos_strtou32(const chaos_char_t *str, chaos_size_t len, chaos_u32_t *value, chaos_size_t *consumed);
+
+#if defined(CHAOS_ENABLE_INT64) && (CHAOS_ENABLE_INT64 == 1)
+/**
+ * @brief Parse a signed 64-bit decimal integer.
+ * @details As chaos_strtoi32().
+ */
+extern chaos_status_t chaos_strtoi64(const chaos_char_t *str, chaos_size_t len, chaos_i64_t *value, chaos_size_t *consumed);
+
+/**
+ * @brief Parse an unsigned 64-bit decimal integer.
+ * @details As chaos_strtoi32(); a leading '-' is not a number.
+ */
+extern chaos_status_t chaos_strtou64(const chaos_char_t *str, chaos_size_t len, chaos_u64_t *value, chaos_size_t *consumed);
+#endif
+
+/**
+ * @brief Parse the number at the start of a null-terminated string.
+ * @param[in] str Null-terminated string
+ * @param[out] value Parsed value (as chaos_strtoi32())
+ * @return CHAOS_STATUS_OK, or CHAOS_STD_NO_DIGITS / CHAOS_STD_OVERFLOW errors
+ */
+extern chaos_status_t chaos_atoi(const chaos_cstr_t str, chaos_i32_t *value);
+
+/* ============================================================= */
+/* INTEGER FORMATTING                                            */
+/* ============================================================= */
+
+/**
+ * @brief Format an unsigned 32-bit integer in decimal.
+ * @param[in] value Value to format
+ * @param[out] buf Output buffer, null-terminated on return
+ * @param[in] size Size of @p buf in bytes (11 always suffices)
+ * @param[out] len Characters written, terminator excluded; 0 when the
+ *             buffer is too small (may be NULL)
+ * @return CHAOS_STATUS_OK, or a CHAOS_STD_TRUNCATED error when the text and
+ *         its terminator do not fit (buf then holds an empty string)
+ */
+extern chaos_status_t chaos_u32_to_str(chaos_u32_t value, chaos_char_t *buf, chaos_size_t size, chaos_size_t *len);
+
+/**
+ * @brief Format a signed 32-bit integer in decimal ('-' for negatives).
+ * @details As chaos_u32_to_str() (12 bytes always suffice).
+ */
+extern chaos_status_t chaos_i32_to_str(chaos_i32_t value, chaos_char_t *buf, chaos_size_t size, chaos_size_t *len);
+
+/**
+ * @brief Format an unsigned 32-bit integer in lowercase hexadecimal.
+ * @details No prefix and no leading zeros; as chaos_u32_to_str() (9 bytes
+ *          always suffice).
+ */
+extern chaos_status_t chaos_u32_to_hex(chaos_u32_t value, chaos_char_t *buf, chaos_size_t size, chaos_size_t *len);
+
+#if defined(CHAOS_ENABLE_INT64) && (CHAOS_ENABLE_INT64 == 1)
+/**
+ * @brief Format an unsigned 64-bit integer in decimal.
+ * @details As chaos_u32_to_str() (21 bytes always suffice).
+ */
+extern chaos_status_t chaos_u64_to_str(chaos_u64_t value, chaos_char_t *buf, chaos_size_t size, chaos_size_t *len);
+
+/**
+ * @brief Format a signed 64-bit integer in decimal ('-' for negatives).
+ * @details As chaos_u32_to_str() (21 bytes always suffice).
+ */
+extern chaos_status_t chaos_i64_to_str(chaos_i64_t value, chaos_char_t *buf, chaos_size_t size, chaos_size_t *len);
+
+/**
+ * @brief Format an unsigned 64-bit integer in lowercase hexadecimal.
+ * @details As chaos_u32_to_hex() (17 bytes always suffice).
+ */
+extern chaos_status_t chaos_u64_to_hex(chaos_u64_t value, chaos_char_t *buf, chaos_size_t size, chaos_size_t *len);
+#endif
+
+#if defined(CHAOS_ENABLE_FLOAT) && (CHAOS_ENABLE_FLOAT == 1) && defined(CHAOS_ENABLE_INT64) && (CHAOS_ENABLE_INT64 == 1)
+/* ============================================================= */
+/* FLOATING-POINT FORMATTING                                     */
+/* ============================================================= */
+
+/**
+ * @brief Format a double with the fewest digits that read back exactly.
+ * @details Plain notation ("0.001", "123.5", "1e+21" excepted) for decimal
+ *          exponents -6 to 20, scientific notation ("1.5e-7", "2e+300")
+ *          outside them. Special values print as "inf", "-inf", "nan" and
+ *          "-0". Otherwise as chaos_u32_to_str() (26 bytes always suffice).
+ * @param[in] value Value to format
+ * @param[out] buf Output buffer, null-terminated on return
+ * @param[in] size Size of @p buf in bytes
+ * @param[out] len Characters written, terminator excluded; 0 when the
+ *             buffer is too small (may be NULL)
+ * @return CHAOS_STATUS_OK, or a CHAOS_STD_TRUNCATED error
+ */
+extern chaos_status_t chaos_f64_to_str(chaos_f64_t value, chaos_char_t *buf, chaos_size_t size, chaos_size_t *len);
+
+/**
+ * @brief Format a float with the fewest digits that read back exactly.
+ * @details As chaos_f64_to_str() (23 bytes always suffice).
+ */
+extern chaos_status_t chaos_f32_to_str(chaos_f32_t value, chaos_char_t *buf, chaos_size_t size, chaos_size_t *len);
+
+/* ============================================================= */
+/* FLOATING-POINT PARSING                                        */
+/* ============================================================= */
+
+/**
+ * @brief Parse a decimal double in the manner of strtod().
+ * @details Skips leading whitespace and accepts an optional sign, then
+ *          digits with an optional '.' and fraction (at least one digit in
+ *          all) and an optional exponent 'e'/'E' with sign; an 'e' not
+ *          followed by digits is left unread. "inf", "infinity" and "nan"
+ *          are accepted in any case; hexadecimal floats are not. Values too
+ *          small for a subnormal read as zero without error.
+ * @param[in] str Characters to parse (may be NULL when len is 0)
+ * @param[in] len Number of characters available
+ * @param[out] value Correctly rounded value; +-inf on overflow, 0 when no number
+ * @param[out] consumed Characters used, whitespace and sign included; 0 when
+ *             there is no number (may be NULL)
+ * @return CHAOS_STATUS_OK, or CHAOS_STD_NO_DIGITS / CHAOS_STD_OVERFLOW errors
+ */
+extern chaos_status_t chaos_strtof64(const chaos_char_t *str, chaos_size_t len, chaos_f64_t *value, chaos_size_t *consumed);
+
+/**
+ * @brief Parse a decimal float in the manner of strtof().
+ * @details As chaos_strtof64(), rounding once, straight to float.
+ */
+extern chaos_status_t chaos_strtof32(const chaos_char_t *str, chaos_size_t len, chaos_f32_t *value, chaos_size_t *consumed);
+#endif
+
+#endif /* CHAOS_STD_H */
@@ -0,0 +1,1093 @@
+/**
+ * @file chaos_float.c
+ * @brief Implementation of the floating-point conversions.
+ *
+ * Formatting uses the Schubfach algorithm (Giulietti): the value and the
+ * two ends of its rounding interval are scaled by one 128-bit power of ten
+ * with round-to-odd, and the shortest decimal inside the interval is read
+ * off the three results. It is exact for every input, so it needs no slow
+ * fallback.
+ *
+ * Parsing uses the Eisel-Lemire algorithm: up to 19 significant digits are
+ * multiplied by the same 128-bit power of five and the correctly rounded
+ * result is taken from the top of the product. Only when longer inputs were
+ * cut to 19 digits and the cut changes the rounding is the text converted
+ * again as an exact big decimal.
+ */
+
+#include "chaos_std.h"
+
+#if defined(CHAOS_ENABLE_FLOAT) && (CHAOS_ENABLE_FLOAT == 1) && defined(CHAOS_ENABLE_INT64) && (CHAOS_ENABLE_INT64 == 1)
+
+#include "chaos_assert.h"
+#include "chaos_bits.h"
+#include "chaos_std_internal.h"
+
+/* ============================================================= */
+/* CONSTANTS                                                     */
+/* ============================================================= */
+
+/* Significant digits that fit the 64-bit accumulator */
+#define CHAOS_FLOAT_SIG_DIGITS 19U
+
+/* Digits kept by the exact decimal; more only sets its sticky flag */
+#define CHAOS_FLOAT_DEC_DIGITS 800
+
+/* Room for the digits a left shift adds in front (2^60 has 19 digits) */
+#define CHAOS_FLOAT_DEC_SLACK 19
+
+/* Largest shift the decimal takes in one step (n * 10 + 9 stays in 64 bits) */
+#define CHAOS_FLOAT_DEC_MAX_SHIFT 60U
+
+/* Longest text of a formatted double, sign and terminator included */
+#define CHAOS_FLOAT_TEXT_MAX 32U
+
+/**
+ * @brief Parameters of one binary format.
+ */
+typedef struct
+{
+    chaos_u32_t mant_bits;    /* Stored significand bits */
+    chaos_u32_t exp_bits;     /* Exponent field bits */
+    chaos_i32_t min_exp;      /* Exponent bias, negated */
+    chaos_i32_t inf_exp;      /* Biased exponent of infinity */
+    chaos_i32_t min_pow10;    /* Below 10^this every 19-digit number rounds to zero */
+    chaos_i32_t max_pow10;    /* Above 10^this every number overflows */
+    chaos_i32_t even_min;     /* Powers of ten whose products can be exact halfway points */
+    chaos_i32_t even_max;
+} chaos_float_format_t;
+
+static const chaos_float_format_t chaos_float_binary64 = { 52U, 11U, -1023, 0x7FF, -342, 308, -4, 23 };
+static const chaos_float_format_t chaos_float_binary32 = { 23U, 8U, -127, 0xFF, -65, 38, -17, 10 };
+
+/**
+ * @brief Exact decimal for the slow path: 0.d[0]d[1]... * 10^dp.
+ */
+typedef struct
+{
+    chaos_u8_t d[CHAOS_FLOAT_DEC_DIGITS + CHAOS_FLOAT_DEC_SLACK]; /* Digit values */
+    chaos_i32_t nd;           /* Digits in use (no trailing zeros) */
+    chaos_i32_t dp;           /* Position of the decimal point */
+    chaos_bool_t trunc;       /* Non-zero digits were dropped past the end */
+} chaos_float_decimal_t;
+
+/* Binary shifts that bring a decimal point position of n (up to 8) towards 0 */
+static const chaos_u32_t chaos_float_powtab[9] = { 1U, 3U, 6U, 9U, 13U, 16U, 19U, 23U, 26U };
+
+/* ============================================================= */
+/* FUNCTION PROTOTYPES                                          */
+/* ============================================================= */
+static void chaos_float_format(chaos_bool_t neg, chaos_i32_t exp, chaos_u64_t mant, const chaos_float_format_t *fmt, chaos_char_t *buf, chaos_size_t size, chaos_size_t *len, chaos_status_t *status);
+static chaos_u64_t chaos_float_shortest(chaos_u64_t c, chaos_i32_t q, chaos_bool_t closer, chaos_i32_t *exp10);
+static chaos_u64_t chaos_float_round_to_odd(const chaos_u64_t *g, chaos_u64_t cp);
+static chaos_size_t chaos_float_print(chaos_bool_t neg, chaos_u64_t digits, chaos_i32_t exp10, chaos_char_t *out);
+static chaos_i32_t chaos_float_floor_shift(chaos_i32_t x, chaos_u32_t n);
+static chaos_size_t chaos_float_parse(const chaos_char_t *str, chaos_size_t len, const chaos_float_format_t *fmt, chaos_u64_t *bits, chaos_status_t *status);
+static chaos_size_t chaos_float_match(const chaos_char_t *str, chaos_size_t len, const char *word);
+static chaos_u64_t chaos_float_eisel_lemire(chaos_i64_t q, chaos_u64_t w, const chaos_float_format_t *fmt);
+static chaos_u64_t chaos_float_slow(const chaos_char_t *str, chaos_size_t len, chaos_i64_t exp10, const chaos_float_format_t *fmt);
+static void chaos_float_dec_shift(chaos_float_decimal_t *a, chaos_i32_t k);
+static void chaos_float_dec_lshift(chaos_float_decimal_t *a, chaos_u32_t k);
+static void chaos_float_dec_rshift(chaos_float_decimal_t *a, chaos_u32_t k);
+static void chaos_float_dec_trim(chaos_float_decimal_t *a);
+static chaos_u64_t chaos_float_dec_round(const chaos_float_decimal_t *a);
+
+/* ============================================================= */
+/* FLOATING-POINT FORMATTING                                     */
+/* ============================================================= */
+chaos_status_t chaos_f64_to_str(chaos_f64_t value, chaos_char_t *buf, chaos_size_t size, chaos_size_t *len)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_bool_t neg = CHAOS_FALSE;
+    union
+    {
+        chaos_f64_t f;
+        chaos_u64_t u;
+    } bits;
+
+    chaos_assert_not_null(buf, &status, CHAOS_MODULE_STDLIB);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        bits.f = value;
+        if ((bits.u >> 63U) != 0U)
+        {
+            neg = CHAOS_TRUE;
+        }
+        chaos_float_format(neg, (chaos_i32_t)((bits.u >> 52U) & 0x7FFU), bits.u & 0x000FFFFFFFFFFFFFULL, &chaos_float_binary64, buf, size, len, &status);
+    }
+
+    return status;
+}
+
+chaos_status_t chaos_f32_to_str(chaos_f32_t value, chaos_char_t *buf, chaos_size_t size, chaos_size_t *len)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_bool_t neg = CHAOS_FALSE;
+    union
+    {
+        chaos_f32_t f;
+        chaos_u32_t u;
+    } bits;
+
+    chaos_assert_not_null(buf, &status, CHAOS_MODULE_STDLIB);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        bits.f = value;
+        if ((bits.u >> 31U) != 0U)
+        {
+            neg = CHAOS_TRUE;
+        }
+        chaos_float_format(neg, (chaos_i32_t)((bits.u >> 23U) & 0xFFU), (chaos_u64_t)(bits.u & 0x007FFFFFU), &chaos_float_binary32, buf, size, len, &status);
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* FLOATING-POINT PARSING                                        */
+/* ============================================================= */
+chaos_status_t chaos_strtof64(const chaos_char_t *str, chaos_size_t len, chaos_f64_t *value, chaos_size_t *consumed)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_size_t used;
+    union
+    {
+        chaos_f64_t f;
+        chaos_u64_t u;
+    } bits;
+
+    chaos_assert_not_null(value, &status, CHAOS_MODULE_STDLIB);
+    if (len != 0U)
+    {
+        chaos_assert_not_null(str, &status, CHAOS_MODULE_STDLIB);
+    }
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        used = chaos_float_parse(str, len, &chaos_float_binary64, &bits.u, &status);
+        *value = bits.f;
+        if (consumed != CHAOS_NULL)
+        {
+            *consumed = used;
+        }
+    }
+
+    return status;
+}
+
+chaos_status_t chaos_strtof32(const chaos_char_t *str, chaos_size_t len, chaos_f32_t *value, chaos_size_t *consumed)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_size_t used;
+    chaos_u64_t wide = 0U;
+    union
+    {
+        chaos_f32_t f;
+        chaos_u32_t u;
+    } bits;
+
+    chaos_assert_not_null(value, &status, CHAOS_MODULE_STDLIB);
+    if (len != 0U)
+    {
+        chaos_assert_not_null(str, &status, CHAOS_MODULE_STDLIB);
+    }
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        used = chaos_float_parse(str, len, &chaos_float_binary32, &wide, &status);
+        bits.u = (chaos_u32_t)wide;
+        *value = bits.f;
+        if (consumed != CHAOS_NULL)
+        {
+            *consumed = used;
+        }
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* FORMATTING HELPERS                                            */
+/* ============================================================= */
+
+/* Text of the value with biased exponent exp and stored significand mant */
+static void chaos_float_format(chaos_bool_t neg, chaos_i32_t exp, chaos_u64_t mant, const chaos_float_format_t *fmt, chaos_char_t *buf, chaos_size_t size, chaos_size_t *len, chaos_status_t *status)
+{
+    chaos_char_t text[CHAOS_FLOAT_TEXT_MAX];
+    chaos_size_t n = 0U;
+    chaos_size_t i;
+    chaos_i32_t q;
+    chaos_i32_t exp10 = 0;
+    chaos_u64_t c;
+    chaos_u64_t digits;
+
+    if (neg == CHAOS_TRUE)
+    {
+        text[n] = (chaos_char_t)'-';
+        n++;
+    }
+
+    if (exp == fmt->inf_exp)
+    {
+        if (mant != 0U)
+        {
+            /* NaN has no meaningful sign */
+            n = 0U;
+            text[n] = (chaos_char_t)'n';
+            text[n + 1U] = (chaos_char_t)'a';
+            text[n + 2U] = (chaos_char_t)'n';
+        }
+        else
+        {
+            text[n] = (chaos_char_t)'i';
+            text[n + 1U] = (chaos_char_t)'n';
+            text[n + 2U] = (chaos_char_t)'f';
+        }
+        n += 3U;
+    }
+    else if ((exp == 0) && (mant == 0U))
+    {
+        text[n] = (chaos_char_t)'0';
+        n++;
+    }
+    else
+    {
+        /* value = c * 2^q */
+        if (exp != 0)
+        {
+            c = mant | ((chaos_u64_t)1U << fmt->mant_bits);
+            q = exp + fmt->min_exp - (chaos_i32_t)fmt->mant_bits;
+        }
+        else
+        {
+            c = mant;
+            q = 1 + fmt->min_exp - (chaos_i32_t)fmt->mant_bits;
+        }
+
+        if ((q <= 0) && (q > -(chaos_i32_t)(fmt->mant_bits + 1U)) && ((c & (((chaos_u64_t)1U << (chaos_u32_t)-q) - 1U)) == 0U))
+        {
+            /* Small integers are exact */
+            digits = c >> (chaos_u32_t)-q;
+        }
+        else
+        {
+            /* The interval below a power of two is half as wide as above it */
+            digits = chaos_float_shortest(c, q, ((mant == 0U) && (exp > 1)) ? CHAOS_TRUE : CHAOS_FALSE, &exp10);
+        }
+
+        while ((digits % 10U) == 0U)
+        {
+            digits /= 10U;
+            exp10++;
+        }
+        n = chaos_float_print(neg, digits, exp10, text);
+    }
+
+    if (n >= size)
+    {
+        if (size != 0U)
+        {
+            buf[0] = 0U;
+        }
+        n = 0U;
+        *status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STDLIB, CHAOS_ERRCLASS_OVERFLOW, CHAOS_STD_TRUNCATED);
+    }
+    else
+    {
+        for (i = 0U; i < n; i++)
+        {
+            buf[i] = text[i];
+        }
+        buf[n] = 0U;
+    }
+
+    if (len != CHAOS_NULL)
+    {
+        *len = n;
+    }
+}
+
+/*
+ * Schubfach, on the interval [cbl, cbr] * 2^(q-2) around 4c * 2^(q-2).
+ * k is chosen so that scaling by 10^-k leaves the interval between 1 and
+ * 10 decimal units wide: its bounds and centre are computed with
+ * round-to-odd, which keeps enough information to place them exactly
+ * relative to integers. The shorter candidate (one digit fewer) is tried
+ * first; otherwise the integer nearest the centre that lies inside wins.
+ * Bounds are included only for even c (round-half-even on reading back).
+ */
+static chaos_u64_t chaos_float_shortest(chaos_u64_t c, chaos_i32_t q, chaos_bool_t closer, chaos_i32_t *exp10)
+{
+    chaos_u64_t odd = c & 1U;
+    chaos_u64_t cbl = (4U * c) - 2U + ((closer == CHAOS_TRUE) ? 1U : 0U);
+    chaos_u64_t cb = 4U * c;
+    chaos_u64_t cbr = (4U * c) + 2U;
+    chaos_u64_t g[2];
+    chaos_u64_t vbl;
+    chaos_u64_t vb;
+    chaos_u64_t vbr;
+    chaos_u64_t lower;
+    chaos_u64_t upper;
+    chaos_u64_t s;
+    chaos_u64_t sp;
+    chaos_u64_t result;
+    chaos_bool_t u_in;
+    chaos_bool_t w_in;
+    chaos_bool_t done = CHAOS_FALSE;
+    chaos_i32_t k;
+    chaos_u32_t h;
+
+    /* k = floor(log10(2^q)), or floor(log10(3/4 * 2^q)) when the lower gap is halved */
+    k = chaos_float_floor_shift((q * 1262611) - ((closer == CHAOS_TRUE) ? 524031 : 0), 22U);
+    /* h = q + floor(log2(10^-k)) + 1, between 1 and 4 */
+    h = (chaos_u32_t)(q + chaos_float_floor_shift(-k * 1741647, 19U) + 1);
+
+    /* g = floor(10^-k * 2^(127 - floor(log2(10^-k)))) + 1, the same mantissa as 5^-k */
+    g[0] = chaos_std_pow5[-k - CHAOS_STD_POW5_MIN][0];
+    g[1] = chaos_std_pow5[-k - CHAOS_STD_POW5_MIN][1] + 1U;
+    if (g[1] == 0U)
+    {
+        g[0]++;
+    }
+
+    vbl = chaos_float_round_to_odd(g, cbl << h);
+    vb = chaos_float_round_to_odd(g, cb << h);
+    vbr = chaos_float_round_to_odd(g, cbr << h);
+    lower = vbl + odd;
+    upper = vbr - odd;
+
+    s = vb >> 2U;
+    result = s;
+    *exp10 = k;
+
+    if (s >= 10U)
+    {
+        /* One digit fewer: at most one of the two neighbours can be inside */
+        sp = s / 10U;
+        u_in = (lower <= (40U * sp)) ? CHAOS_TRUE : CHAOS_FALSE;
+        w_in = (((40U * sp) + 40U) <= upper) ? CHAOS_TRUE : CHAOS_FALSE;
+        if (u_in != w_in)
+        {
+            result = sp + ((w_in == CHAOS_TRUE) ? 1U : 0U);
+            *exp10 = k + 1;
+            done = CHAOS_TRUE;
+        }
+    }
+
+    if (done == CHAOS_FALSE)
+    {
+        u_in = (lower <= (4U * s)) ? CHAOS_TRUE : CHAOS_FALSE;
+        w_in = (((4U * s) + 4U) <= upper) ? CHAOS_TRUE : CHAOS_FALSE;
+        if (u_in != w_in)
+        {
+            result = s + ((w_in == CHAOS_TRUE) ? 1U : 0U);
+        }
+        else
+        {
+            /* Both inside: the nearer one, ties to even */
+            result = s + (((vb > ((4U * s) + 2U)) || ((vb == ((4U * s) + 2U)) && ((s & 1U) != 0U))) ? 1U : 0U);
+        }
+    }
+
+    return result;
+}
+
+/* Top 64 bits of g * cp / 2^64, with the lowest bit set when anything below was lost */
+static chaos_u64_t chaos_float_round_to_odd(const chaos_u64_t *g, chaos_u64_t cp)
+{
+    chaos_u64_t x_lo;
+    chaos_u64_t x_hi;
+    chaos_u64_t y_lo;
+    chaos_u64_t y_hi;
+    chaos_u64_t z;
+
+    chaos_u64_mul128(g[1], cp, &x_lo, &x_hi);
+    chaos_u64_mul128(g[0], cp, &y_lo, &y_hi);
+    z = y_lo + x_hi;
+    y_hi += (z < x_hi) ? 1U : 0U;
+
+    return y_hi | ((z > 1U) ? 1U : 0U);
+}
+
+/*
+ * digits * 10^exp10 as text, returning its length. Plain notation is used
+ * for decimal exponents -6 to 20 and scientific notation ("1.5e-7",
+ * "1e+21") outside them, as in JavaScript.
+ */
+static chaos_size_t chaos_float_print(chaos_bool_t neg, chaos_u64_t digits, chaos_i32_t exp10, chaos_char_t *out)
+{
+    chaos_size_t n = chaos_std_dec_len(digits);
+    chaos_i32_t e = exp10 + (chaos_i32_t)n - 1;
+    chaos_size_t p = (neg == CHAOS_TRUE) ? 1U : 0U;
+    chaos_size_t i;
+    chaos_size_t z;
+
+    if ((e >= 0) && (e <= 20))
+    {
+        if (exp10 >= 0)
+        {
+            /* Integer: digits then zeros */
+            chaos_std_put_dec(digits, &out[p + n]);
+            for (i = 0U; i < (chaos_size_t)exp10; i++)
+            {
+                out[p + n + i] = (chaos_char_t)'0';
+            }
+            p += n + (chaos_size_t)exp10;
+        }
+        else
+        {
+            /* Point inside the digits: store one place right, then pull the integer part back */
+            chaos_std_put_dec(digits, &out[p + n + 1U]);
+            for (i = 0U; i <= (chaos_size_t)e; i++)
+            {
+                out[p + i] = out[p + i + 1U];
+            }
+            out[p + (chaos_size_t)e + 1U] = (chaos_char_t)'.';
+            p += n + 1U;
+        }
+    }
+    else if ((e < 0) && (e >= -6))
+    {
+        /* "0.", the zeros after the point, the digits */
+        z = (chaos_size_t)(-e - 1);
+        out[p] = (chaos_char_t)'0';
+        out[p + 1U] = (chaos_char_t)'.';
+        for (i = 0U; i < z; i++)
+        {
+            out[p + 2U + i] = (chaos_char_t)'0';
+        }
+        chaos_std_put_dec(digits, &out[p + 2U + z + n]);
+        p += 2U + z + n;
+    }
+    else
+    {
+        chaos_std_put_dec(digits, &out[p + n + 1U]);
+        out[p] = out[p + 1U];
+        if (n > 1U)
+        {
+            out[p + 1U] = (chaos_char_t)'.';
+            p += n + 1U;
+        }
+        else
+        {
+            p += 1U;
+        }
+        out[p] = (chaos_char_t)'e';
+        out[p + 1U] = (chaos_char_t)((e < 0) ? '-' : '+');
+        z = (chaos_size_t)((e < 0) ? -e : e);
+        p += 2U + chaos_std_dec_len((chaos_u64_t)z);
+        chaos_std_put_dec((chaos_u64_t)z, &out[p]);
+    }
+
+    if (neg == CHAOS_TRUE)
+    {
+        out[0] = (chaos_char_t)'-';
+    }
+
+    return p;
+}
+
+/* floor(x / 2^n), also for negative x */
+static chaos_i32_t chaos_float_floor_shift(chaos_i32_t x, chaos_u32_t n)
+{
+    chaos_i32_t r;
+
+    if (x >= 0)
+    {
+        r = (chaos_i32_t)((chaos_u32_t)x >> n);
+    }
+    else
+    {
+        r = -(chaos_i32_t)((((chaos_u32_t)-x) + ((1U << n) - 1U)) >> n);
+    }
+
+    return r;
+}
+
+/* ============================================================= */
+/* PARSING HELPERS                                               */
+/* ============================================================= */
+
+/*
+ * Whitespace, sign, then "inf", "infinity", "nan" (any case) or
+ * digits[.digits][e[sign]digits]; an 'e' without digits after it is not
+ * part of the number. Stores the bit pattern and returns the characters
+ * consumed.
+ */
+static chaos_size_t chaos_float_parse(const chaos_char_t *str, chaos_size_t len, const chaos_float_format_t *fmt, chaos_u64_t *bits, chaos_status_t *status)
+{
+    chaos_size_t i = 0U;
+    chaos_size_t start;
+    chaos_size_t j;
+    chaos_size_t seen = 0U;
+    chaos_size_t sig = 0U;
+    chaos_size_t m;
+    chaos_u64_t w = 0U;
+    chaos_u64_t d;
+    chaos_u64_t r;
+    chaos_i64_t exp10 = 0;
+    chaos_i64_t e = 0;
+    chaos_bool_t neg = CHAOS_FALSE;
+    chaos_bool_t eneg = CHAOS_FALSE;
+    chaos_bool_t trunc = CHAOS_FALSE;
+    chaos_bool_t frac = CHAOS_FALSE;
+    chaos_bool_t more = CHAOS_TRUE;
+
+    while ((i < len) && ((str[i] == (chaos_char_t)' ') || ((str[i] >= (chaos_char_t)'\t') && (str[i] <= (chaos_char_t)'\r'))))
+    {
+        i++;
+    }
+    if ((i < len) && ((str[i] == (chaos_char_t)'+') || (str[i] == (chaos_char_t)'-')))
+    {
+        neg = (str[i] == (chaos_char_t)'-') ? CHAOS_TRUE : CHAOS_FALSE;
+        i++;
+    }
+    start = i;
+
+    /* Leading zeros are not significant; digits past the 19th only adjust the exponent */
+    while ((i < len) && (more == CHAOS_TRUE))
+    {
+        d = (chaos_u64_t)(chaos_u8_t)(str[i] - (chaos_char_t)'0');
+        if (d <= 9U)
+        {
+            seen++;
+            if ((w == 0U) && (d == 0U))
+            {
+                exp10 -= (frac == CHAOS_TRUE) ? 1 : 0;
+            }
+            else if (sig < CHAOS_FLOAT_SIG_DIGITS)
+            {
+                w = (w * 10U) + d;
+                sig++;
+                exp10 -= (frac == CHAOS_TRUE) ? 1 : 0;
+            }
+            else
+            {
+                exp10 += (frac == CHAOS_TRUE) ? 0 : 1;
+                trunc = (d != 0U) ? CHAOS_TRUE : trunc;
+            }
+            i++;
+        }
+        else if ((str[i] == (chaos_char_t)'.') && (frac == CHAOS_FALSE))
+        {
+            frac = CHAOS_TRUE;
+            i++;
+        }
+        else
+        {
+            more = CHAOS_FALSE;
+        }
+    }
+
+    if (seen == 0U)
+    {
+        m = chaos_float_match(&str[start], len - start, "infinity");
+        if (m >= 3U)
+        {
+            m = (m == 8U) ? 8U : 3U;
+            *bits = (chaos_u64_t)fmt->inf_exp << fmt->mant_bits;
+        }
+        else if (chaos_float_match(&str[start], len - start, "nan") == 3U)
+        {
+            m = 3U;
+            *bits = ((chaos_u64_t)fmt->inf_exp << fmt->mant_bits) | ((chaos_u64_t)1U << (fmt->mant_bits - 1U));
+        }
+        else
+        {
+            m = 0U;
+            *bits = 0U;
+        }
+
+        if (m != 0U)
+        {
+            i = start + m;
+        }
+        else
+        {
+            neg = CHAOS_FALSE;
+            i = 0U;
+            *status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STDLIB, CHAOS_ERRCLASS_INVALID_PARAM, CHAOS_STD_NO_DIGITS);
+        }
+    }
+    else
+    {
+        if ((i < len) && ((str[i] == (chaos_char_t)'e') || (str[i] == (chaos_char_t)'E')))
+        {
+            j = i + 1U;
+            if ((j < len) && ((str[j] == (chaos_char_t)'+') || (str[j] == (chaos_char_t)'-')))
+            {
+                eneg = (str[j] == (chaos_char_t)'-') ? CHAOS_TRUE : CHAOS_FALSE;
+                j++;
+            }
+            if ((j < len) && ((chaos_u8_t)(str[j] - (chaos_char_t)'0') <= 9U))
+            {
+                while ((j < len) && ((chaos_u8_t)(str[j] - (chaos_char_t)'0') <= 9U))
+                {
+                    /* Far past any representable magnitude; stop growing */
+                    if (e < 100000000)
+                    {
+                        e = (e * 10) + (chaos_i64_t)(chaos_u8_t)(str[j] - (chaos_char_t)'0');
+                    }
+                    j++;
+                }
+                exp10 += (eneg == CHAOS_TRUE) ? -e : e;
+                i = j;
+            }
+        }
+
+        if (w == 0U)
+        {
+            *bits = 0U;
+        }
+        else
+        {
+            *bits = chaos_float_eisel_lemire(exp10, w, fmt);
+            if (trunc == CHAOS_TRUE)
+            {
+                /* The true value lies between w and w + 1 units: settle it only if they disagree */
+                r = chaos_float_eisel_lemire(exp10, w + 1U, fmt);
+                if (r != *bits)
+                {
+                    *bits = chaos_float_slow(&str[start], i - start, (eneg == CHAOS_TRUE) ? -e : e, fmt);
+                }
+            }
+            if ((*bits >> fmt->mant_bits) == (chaos_u64_t)fmt->inf_exp)
+            {
+                *status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STDLIB, CHAOS_ERRCLASS_OVERFLOW, CHAOS_STD_OVERFLOW);
+            }
+        }
+    }
+
+    if (neg == CHAOS_TRUE)
+    {
+        *bits |= (chaos_u64_t)1U << (fmt->mant_bits + fmt->exp_bits);
+    }
+
+    return i;
+}
+
+/* Length of the common prefix of str and the lowercase word, ignoring case */
+static chaos_size_t chaos_float_match(const chaos_char_t *str, chaos_size_t len, const char *word)
+{
+    chaos_size_t i = 0U;
+
+    while ((i < len) && (word[i] != '\0') && ((str[i] | (chaos_char_t)0x20U) == (chaos_char_t)word[i]))
+    {
+        i++;
+    }
+
+    return i;
+}
+
+/*
+ * w * 10^q correctly rounded, as a bit pattern without sign (w != 0).
+ * The top bits of w * 5^q, with w normalised to bit 63, are computed from
+ * the high half of the table entry and refined with the low half only
+ * when the bits below the mantissa are all ones, i.e. when the missing
+ * part could carry into them. Exact halfway points can only occur for a
+ * narrow range of q and are recognised by the product being exact.
+ */
+static chaos_u64_t chaos_float_eisel_lemire(chaos_i64_t q, chaos_u64_t w, const chaos_float_format_t *fmt)
+{
+    chaos_u64_t mask = 0xFFFFFFFFFFFFFFFFULL >> (fmt->mant_bits + 3U);
+    chaos_u64_t hi;
+    chaos_u64_t lo;
+    chaos_u64_t hi2;
+    chaos_u64_t lo2;
+    chaos_u64_t mant;
+    chaos_u64_t bits;
+    chaos_u32_t lz;
+    chaos_u32_t upper;
+    chaos_u32_t shift;
+    chaos_i32_t p2;
+    chaos_i32_t idx;
+
+    if (q < (chaos_i64_t)fmt->min_pow10)
+    {
+        bits = 0U;
+    }
+    else if (q > (chaos_i64_t)fmt->max_pow10)
+    {
+        bits = (chaos_u64_t)fmt->inf_exp << fmt->mant_bits;
+    }
+    else
+    {
+        lz = ((w >> 32U) != 0U) ? chaos_u32_clz((chaos_u32_t)(w >> 32U)) : (32U + chaos_u32_clz((chaos_u32_t)w));
+        w <<= lz;
+        idx = (chaos_i32_t)q - CHAOS_STD_POW5_MIN;
+
+        /* For q = -27..-1 the multiplier is floor(5^q) + 1 (no carry into the high word) */
+        chaos_u64_mul128(w, chaos_std_pow5[idx][0], &lo, &hi);
+        if ((hi & mask) == mask)
+        {
+            lo2 = chaos_std_pow5[idx][1] + (((q < 0) && (q >= -27)) ? 1U : 0U);
+            chaos_u64_mul128(w, lo2, &lo2, &hi2);
+            lo += hi2;
+            hi += (lo < hi2) ? 1U : 0U;
+        }
+
+        upper = (chaos_u32_t)(hi >> 63U);
+        shift = upper + 64U - fmt->mant_bits - 3U;
+        mant = hi >> shift;
+        /* floor(q * log2(10)) + 63 locates the product's top bit */
+        p2 = chaos_float_floor_shift(217706 * (chaos_i32_t)q, 16U) + 63 + (chaos_i32_t)upper - (chaos_i32_t)lz - fmt->min_exp;
+
+        if (p2 <= 0)
+        {
+            /* Subnormal, or zero when shifted out altogether */
+            if ((-p2 + 1) >= 64)
+            {
+                bits = 0U;
+            }
+            else
+            {
+                mant >>= (chaos_u32_t)(-p2 + 1);
+                mant += mant & 1U;
+                mant >>= 1U;
+                /* Rounding may carry into the smallest normal */
+                bits = mant;
+            }
+        }
+        else
+        {
+            if ((lo <= 1U) && (q >= (chaos_i64_t)fmt->even_min) && (q <= (chaos_i64_t)fmt->even_max) && ((mant & 3U) == 1U) && ((mant << shift) == hi))
+            {
+                /* Exactly halfway with an even result below: do not round up */
+                mant &= ~(chaos_u64_t)1U;
+            }
+            mant += mant & 1U;
+            mant >>= 1U;
+            if (mant >= ((chaos_u64_t)2U << fmt->mant_bits))
+            {
+                mant = (chaos_u64_t)1U << fmt->mant_bits;
+                p2++;
+            }
+            mant &= ~((chaos_u64_t)1U << fmt->mant_bits);
+            if (p2 >= fmt->inf_exp)
+            {
+                bits = (chaos_u64_t)fmt->inf_exp << fmt->mant_bits;
+            }
+            else
+            {
+                bits = mant | ((chaos_u64_t)(chaos_u32_t)p2 << fmt->mant_bits);
+            }
+        }
+    }
+
+    return bits;
+}
+
+/*
+ * Exact conversion of digits[.digits] * 10^e from the text (the number
+ * without sign or exponent): the decimal is shifted by powers of two until
+ * it lies in [1/2, 1), then by the significand width, and rounded once.
+ */
+static chaos_u64_t chaos_float_slow(const chaos_char_t *str, chaos_size_t len, chaos_i64_t exp10, const chaos_float_format_t *fmt)
+{
+    chaos_float_decimal_t a;
+    chaos_size_t i;
+    chaos_u8_t d;
+    chaos_bool_t frac = CHAOS_FALSE;
+    chaos_i32_t exp = 0;
+    chaos_i32_t n;
+    chaos_u64_t mant = 0U;
+    chaos_u64_t bits;
+    chaos_bool_t overflow = CHAOS_FALSE;
+    chaos_bool_t more = CHAOS_TRUE;
+
+    a.nd = 0;
+    a.dp = 0;
+    a.trunc = CHAOS_FALSE;
+    for (i = 0U; (i < len) && (more == CHAOS_TRUE); i++)
+    {
+        d = (chaos_u8_t)(str[i] - (chaos_char_t)'0');
+        if (d <= 9U)
+        {
+            if ((d == 0U) && (a.nd == 0))
+            {
+                a.dp--;
+            }
+            else if (a.nd < CHAOS_FLOAT_DEC_DIGITS)
+            {
+                a.d[a.nd] = d;
+                a.nd++;
+            }
+            else
+            {
+                a.trunc = (d != 0U) ? CHAOS_TRUE : a.trunc;
+            }
+            a.dp += (frac == CHAOS_TRUE) ? 0 : 1;
+        }
+        else if (str[i] == (chaos_char_t)'.')
+        {
+            frac = CHAOS_TRUE;
+        }
+        else
+        {
+            /* Start of the exponent */
+            more = CHAOS_FALSE;
+        }
+    }
+    /* Leading zeros after the point moved dp down; those before it cancelled out */
+    exp10 += (chaos_i64_t)a.dp;
+    a.dp = (exp10 > 100000) ? 100000 : ((exp10 < -100000) ? -100000 : (chaos_i32_t)exp10);
+    chaos_float_dec_trim(&a);
+
+    if (a.nd == 0)
+    {
+        /* Zero */
+    }
+    else if (a.dp > 310)
+    {
+        overflow = CHAOS_TRUE;
+    }
+    else if (a.dp < -330)
+    {
+        a.nd = 0;
+    }
+    else
+    {
+        while (a.dp > 0)
+        {
+            n = (chaos_i32_t)((a.dp >= 9) ? 27U : chaos_float_powtab[a.dp]);
+            chaos_float_dec_shift(&a, -n);
+            exp += n;
+        }
+        while ((a.dp < 0) || ((a.dp == 0) && (a.d[0] < 5U)))
+        {
+            n = (chaos_i32_t)((-a.dp >= 9) ? 27U : chaos_float_powtab[-a.dp]);
+            chaos_float_dec_shift(&a, n);
+            exp -= n;
+        }
+
+        /* Now in [1/2, 1): the exponent of [1, 2) is one less */
+        exp--;
+        if (exp < (fmt->min_exp + 1))
+        {
+            n = fmt->min_exp + 1 - exp;
+            chaos_float_dec_shift(&a, -n);
+            exp += n;
+        }
+
+        if ((exp - fmt->min_exp) >= fmt->inf_exp)
+        {
+            overflow = CHAOS_TRUE;
+        }
+        else
+        {
+            chaos_float_dec_shift(&a, (chaos_i32_t)fmt->mant_bits + 1);
+            mant = chaos_float_dec_round(&a);
+            if (mant == ((chaos_u64_t)2U << fmt->mant_bits))
+            {
+                mant >>= 1U;
+                exp++;
+                overflow = ((exp - fmt->min_exp) >= fmt->inf_exp) ? CHAOS_TRUE : CHAOS_FALSE;
+            }
+            if ((mant & ((chaos_u64_t)1U << fmt->mant_bits)) == 0U)
+            {
+                /* Subnormal */
+                exp = fmt->min_exp;
+            }
+        }
+    }
+
+    if (overflow == CHAOS_TRUE)
+    {
+        bits = (chaos_u64_t)fmt->inf_exp << fmt->mant_bits;
+    }
+    else if (a.nd == 0)
+    {
+        bits = 0U;
+    }
+    else
+    {
+        bits = (mant & (((chaos_u64_t)1U << fmt->mant_bits) - 1U)) | ((chaos_u64_t)(chaos_u32_t)(exp - fmt->min_exp) << fmt->mant_bits);
+    }
+
+    return bits;
+}
+
+/* Multiply the decimal by 2^k (k > 0) or divide it by 2^-k */
+static void chaos_float_dec_shift(chaos_float_decimal_t *a, chaos_i32_t k)
+{
+    if (a->nd == 0)
+    {
+        /* Zero stays zero */
+    }
+    else if (k > 0)
+    {
+        while (k > (chaos_i32_t)CHAOS_FLOAT_DEC_MAX_SHIFT)
+        {
+            chaos_float_dec_lshift(a, CHAOS_FLOAT_DEC_MAX_SHIFT);
+            k -= (chaos_i32_t)CHAOS_FLOAT_DEC_MAX_SHIFT;
+        }
+        chaos_float_dec_lshift(a, (chaos_u32_t)k);
+    }
+    else if (k < 0)
+    {
+        while (k < -(chaos_i32_t)CHAOS_FLOAT_DEC_MAX_SHIFT)
+        {
+            chaos_float_dec_rshift(a, CHAOS_FLOAT_DEC_MAX_SHIFT);
+            k += (chaos_i32_t)CHAOS_FLOAT_DEC_MAX_SHIFT;
+        }
+        chaos_float_dec_rshift(a, (chaos_u32_t)-k);
+    }
+    else
+    {
+        /* No shift */
+    }
+}
+
+/*
+ * Times 2^k, from the last digit up. The new digits are written ending
+ * CHAOS_FLOAT_DEC_SLACK places further right, which is as many as the
+ * carry can add, and moved back down afterwards.
+ */
+static void chaos_float_dec_lshift(chaos_float_decimal_t *a, chaos_u32_t k)
+{
+    chaos_i32_t r = a->nd;
+    chaos_i32_t w = a->nd + CHAOS_FLOAT_DEC_SLACK;
+    chaos_i32_t end = w;
+    chaos_i32_t i;
+    chaos_u64_t n = 0U;
+    chaos_u64_t quo;
+
+    while ((r > 0) || (n > 0U))
+    {
+        if (r > 0)
+        {
+            r--;
+            n += (chaos_u64_t)a->d[r] << k;
+        }
+        quo = n / 10U;
+        w--;
+        a->d[w] = (chaos_u8_t)(n - (quo * 10U));
+        n = quo;
+    }
+
+    /* w is the first new digit; there are end - w of them */
+    a->dp += (end - w) - a->nd;
+    a->nd = end - w;
+    for (i = 0; i < a->nd; i++)
+    {
+        a->d[i] = a->d[w + i];
+    }
+    if (a->nd > CHAOS_FLOAT_DEC_DIGITS)
+    {
+        for (i = CHAOS_FLOAT_DEC_DIGITS; i < a->nd; i++)
+        {
+            a->trunc = (a->d[i] != 0U) ? CHAOS_TRUE : a->trunc;
+        }
+        a->nd = CHAOS_FLOAT_DEC_DIGITS;
+    }
+    chaos_float_dec_trim(a);
+}
+
+/* Divided by 2^k, from the first digit down, dropping digits past the end */
+static void chaos_float_dec_rshift(chaos_float_decimal_t *a, chaos_u32_t k)
+{
+    chaos_i32_t r = 0;
+    chaos_i32_t w = 0;
+    chaos_u64_t n = 0U;
+    chaos_u64_t mask = ((chaos_u64_t)1U << k) - 1U;
+    chaos_u64_t dig;
+    chaos_bool_t empty = CHAOS_FALSE;
+
+    /* Read until the running value reaches 2^k: that is the first quotient digit */
+    while (((n >> k) == 0U) && (empty == CHAOS_FALSE))
+    {
+        if (r < a->nd)
+        {
+            n = (n * 10U) + a->d[r];
+        }
+        else if (n == 0U)
+        {
+            a->nd = 0;
+            empty = CHAOS_TRUE;
+        }
+        else
+        {
+            n *= 10U;
+        }
+        r++;
+    }
+
+    if (empty == CHAOS_FALSE)
+    {
+        a->dp -= r - 1;
+        while (r < a->nd)
+        {
+            dig = n >> k;
+            n &= mask;
+            a->d[w] = (chaos_u8_t)dig;
+            w++;
+            n = (n * 10U) + a->d[r];
+            r++;
+        }
+        while (n > 0U)
+        {
+            dig = n >> k;
+            n &= mask;
+            if (w < CHAOS_FLOAT_DEC_DIGITS)
+            {
+                a->d[w] = (chaos_u8_t)dig;
+                w++;
+            }
+            else if (dig > 0U)
+            {
+                a->trunc = CHAOS_TRUE;
+            }
+            else
+            {
+                /* Dropped zero */
+            }
+            n *= 10U;
+        }
+        a->nd = w;
+        chaos_float_dec_trim(a);
+    }
+}
+
+/* Drop trailing zeros */
+static void chaos_float_dec_trim(chaos_float_decimal_t *a)
+{
+    while ((a->nd > 0) && (a->d[a->nd - 1] == 0U))
+    {
+        a->nd--;
+    }
+    if (a->nd == 0)
+    {
+        a->dp = 0;
+    }
+}
+
+/* The integer part, rounded half to even on the first dropped digit and the rest */
+static chaos_u64_t chaos_float_dec_round(const chaos_float_decimal_t *a)
+{
+    chaos_u64_t n = 0U;
+    chaos_i32_t i;
+    chaos_bool_t up = CHAOS_FALSE;
+
+    for (i = 0; i < a->dp; i++)
+    {
+        n = (n * 10U) + ((i < a->nd) ? a->d[i] : 0U);
+    }
+    if (a->dp < a->nd)
+    {
+        if ((a->d[a->dp] == 5U) && ((a->dp + 1) == a->nd))
+        {
+            /* Halfway unless digits were dropped */
+            up = ((a->trunc == CHAOS_TRUE) || ((a->dp > 0) && ((a->d[a->dp - 1] & 1U) != 0U))) ? CHAOS_TRUE : CHAOS_FALSE;
+        }
+        else
+        {
+            up = (a->d[a->dp] >= 5U) ? CHAOS_TRUE : CHAOS_FALSE;
+        }
+    }
+
+    return n + ((up == CHAOS_TRUE) ? 1U : 0U);
+}
+
+#endif /* CHAOS_ENABLE_FLOAT && CHAOS_ENABLE_INT64 */
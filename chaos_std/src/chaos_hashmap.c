@@ -0,0 +1,651 @@
+/**
+ * @file chaos_hashmap.c
+ * @brief Implementation of the open-addressing hash map.
+ *
+ * Region layout: the entries (8-byte aligned), then the slot hashes, then
+ * slot_count + CHAOS_HASHMAP_MIRROR control bytes. The stored hashes give
+ * each entry's distance from its home slot without rehashing the key,
+ * which insertion, erasure and growth need.
+ */
+
+#include "chaos_hashmap.h"
+
+#if defined(CHAOS_ENABLE_INT64) && (CHAOS_ENABLE_INT64 == 1)
+
+#include "chaos_hash.h"
+#include "chaos_memory.h"
+#include "chaos_assert.h"
+#include "chaos_bits.h"
+#include "chaos_compiler.h"
+
+#if (CHAOS_HAS_SSE2 == 1)
+#include <emmintrin.h>
+#endif
+
+#if (CHAOS_ENABLE_ALLOC == 1)
+#include "chaos_alloc.h"
+#endif
+
+/* ============================================================= */
+/* CONSTANTS                                                     */
+/* ============================================================= */
+
+/* Alignment of the entry array */
+#define CHAOS_HASHMAP_ALIGN ((chaos_uintptr_t)8U)
+
+/* Control bytes repeated past the last slot, enough for the widest group */
+#define CHAOS_HASHMAP_MIRROR 16U
+
+/* Control byte of an empty slot; occupied slots have the top bit set */
+#define CHAOS_HASHMAP_EMPTY ((chaos_u8_t)0x00U)
+#define CHAOS_HASHMAP_USED  0x80U
+
+/* Hash seed, and the multiplier that mixes 4- and 8-byte keys */
+#define CHAOS_HASHMAP_SEED 0x2D358DCCAA6C78A5ULL
+#define CHAOS_HASHMAP_MIX  0x8BB84B93962EACC9ULL
+
+/* Control bytes compared per step: one SSE2 register or one word */
+#if (CHAOS_HAS_SSE2 == 1)
+#define CHAOS_HASHMAP_GROUP 16U
+typedef chaos_u32_t chaos_hashmap_mask_t;
+#else
+#define CHAOS_HASHMAP_GROUP CHAOS_WORD_SIZE
+typedef chaos_word_t chaos_hashmap_mask_t;
+#endif
+
+/* ============================================================= */
+/* FUNCTION PROTOTYPES                                          */
+/* ============================================================= */
+static chaos_hashmap_mask_t chaos_hashmap_match(const chaos_u8_t *ctrl, chaos_u8_t value);
+static chaos_size_t chaos_hashmap_first(chaos_hashmap_mask_t mask);
+static chaos_hashmap_mask_t chaos_hashmap_drop(chaos_hashmap_mask_t mask);
+static chaos_u32_t chaos_hashmap_hash(const chaos_hashmap_t *map, const void *key);
+static chaos_u8_t chaos_hashmap_tag(chaos_u32_t hash);
+static chaos_bool_t chaos_hashmap_key_equal(const chaos_hashmap_t *map, const chaos_u8_t *stored, const void *key);
+static chaos_size_t chaos_hashmap_locate(const chaos_hashmap_t *map, const void *key, chaos_u32_t hash, chaos_bool_t *found);
+static chaos_size_t chaos_hashmap_dist(const chaos_hashmap_t *map, chaos_size_t slot);
+static void chaos_hashmap_set_ctrl(chaos_hashmap_t *map, chaos_size_t slot, chaos_u8_t value);
+static void chaos_hashmap_copy(chaos_u8_t *dst, const void *src, chaos_size_t size);
+static void chaos_hashmap_move(chaos_hashmap_t *map, chaos_size_t from, chaos_size_t to);
+static chaos_size_t chaos_hashmap_place(chaos_hashmap_t *map, chaos_u32_t hash);
+static chaos_status_t chaos_hashmap_grow(chaos_hashmap_t *map);
+static void chaos_hashmap_layout(chaos_hashmap_t *map, chaos_size_t key_size, chaos_size_t value_size, chaos_size_t slot_count, void *region, chaos_size_t region_size, chaos_status_t *status);
+static void chaos_hashmap_check(const chaos_hashmap_t *map, chaos_status_t *status);
+
+/* ============================================================= */
+/* REGION SIZE                                                   */
+/* ============================================================= */
+chaos_status_t chaos_hashmap_region_size(chaos_size_t key_size, chaos_size_t value_size, chaos_size_t slot_count, chaos_size_t *size)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_u64_t total;
+
+    chaos_assert_not_null(size, &status, CHAOS_MODULE_STDLIB);
+    if ((status == CHAOS_STATUS_OK) && (key_size == 0U))
+    {
+        status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STDLIB, CHAOS_ERRCLASS_INVALID_PARAM, CHAOS_STD_SIZE_ZERO);
+    }
+    /* Slot indices are masked, so a count that is not a power of two would lose entries */
+    if ((status == CHAOS_STATUS_OK)
+        && ((slot_count < CHAOS_HASHMAP_SLOTS_MIN) || (slot_count > CHAOS_HASHMAP_SLOTS_MAX) || ((slot_count & (slot_count - 1U)) != 0U)))
+    {
+        status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STDLIB, CHAOS_ERRCLASS_OUT_OF_RANGE, CHAOS_STD_OVERFLOW);
+    }
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        total = ((chaos_u64_t)key_size + (chaos_u64_t)value_size + (chaos_u64_t)sizeof(chaos_u32_t) + 1U) * (chaos_u64_t)slot_count;
+        total += (chaos_u64_t)CHAOS_HASHMAP_MIRROR + (chaos_u64_t)(CHAOS_HASHMAP_ALIGN - 1U);
+
+        if (total > (chaos_u64_t)chaos_u32_t_MAX)
+        {
+            status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STDLIB, CHAOS_ERRCLASS_OVERFLOW, CHAOS_STD_OVERFLOW);
+        }
+        else
+        {
+            *size = (chaos_size_t)total;
+        }
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* INIT                                                          */
+/* ============================================================= */
+chaos_status_t chaos_hashmap_init(chaos_hashmap_t *map, chaos_size_t key_size, chaos_size_t value_size, chaos_size_t slot_count, void *region, chaos_size_t region_size)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    chaos_assert_not_null(map, &status, CHAOS_MODULE_STDLIB);
+    chaos_assert_not_null(region, &status, CHAOS_MODULE_STDLIB);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        chaos_hashmap_layout(map, key_size, value_size, slot_count, region, region_size, &status);
+        map->region = CHAOS_NULL;
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* INIT DYNAMIC                                                  */
+/* ============================================================= */
+chaos_status_t chaos_hashmap_init_dynamic(chaos_hashmap_t *map, chaos_size_t key_size, chaos_size_t value_size, chaos_size_t slot_count)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    chaos_assert_not_null(map, &status, CHAOS_MODULE_STDLIB);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+#if (CHAOS_ENABLE_ALLOC == 1)
+        void *region = CHAOS_NULL;
+        chaos_size_t size = 0U;
+
+        status = chaos_hashmap_region_size(key_size, value_size, slot_count, &size);
+        if (status == CHAOS_STATUS_OK)
+        {
+            status = chaos_alloc(size, &region);
+        }
+        if (status == CHAOS_STATUS_OK)
+        {
+            chaos_hashmap_layout(map, key_size, value_size, slot_count, region, size, &status);
+            map->region = region;
+        }
+#else
+        (void)key_size;
+        (void)value_size;
+        (void)slot_count;
+        status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STDLIB, CHAOS_ERRCLASS_NOT_SUPPORTED, CHAOS_STD_UNKNOWN);
+#endif
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* FREE                                                          */
+/* ============================================================= */
+chaos_status_t chaos_hashmap_free(chaos_hashmap_t *map)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    chaos_assert_not_null(map, &status, CHAOS_MODULE_STDLIB);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+#if (CHAOS_ENABLE_ALLOC == 1)
+        if (map->region != CHAOS_NULL)
+        {
+            status = chaos_free(map->region);
+        }
+#endif
+        map->entries = CHAOS_NULL;
+        map->hashes = CHAOS_NULL;
+        map->ctrl = CHAOS_NULL;
+        map->slot_count = 0U;
+        map->capacity = 0U;
+        map->count = 0U;
+        map->region = CHAOS_NULL;
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* CLEAR                                                         */
+/* ============================================================= */
+chaos_status_t chaos_hashmap_clear(chaos_hashmap_t *map)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    chaos_hashmap_check(map, &status);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        (void)chaos_memset(map->ctrl, CHAOS_HASHMAP_EMPTY, map->slot_count + CHAOS_HASHMAP_MIRROR);
+        map->count = 0U;
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* PUT                                                           */
+/* ============================================================= */
+chaos_status_t chaos_hashmap_put(chaos_hashmap_t *map, const void *key, const void *value)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_u32_t hash = 0U;
+    chaos_size_t slot = 0U;
+    chaos_bool_t found = CHAOS_FALSE;
+
+    chaos_hashmap_check(map, &status);
+    chaos_assert_not_null(key, &status, CHAOS_MODULE_STDLIB);
+    if ((status == CHAOS_STATUS_OK) && (map->value_size != 0U))
+    {
+        chaos_assert_not_null(value, &status, CHAOS_MODULE_STDLIB);
+    }
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        hash = chaos_hashmap_hash(map, key);
+        slot = chaos_hashmap_locate(map, key, hash, &found);
+        if ((found == CHAOS_FALSE) && (map->count >= map->capacity))
+        {
+            status = chaos_hashmap_grow(map);
+        }
+    }
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        if (found == CHAOS_FALSE)
+        {
+            slot = chaos_hashmap_place(map, hash);
+            chaos_hashmap_copy(&map->entries[slot * map->stride], key, map->key_size);
+        }
+        if (map->value_size != 0U)
+        {
+            chaos_hashmap_copy(&map->entries[(slot * map->stride) + map->key_size], value, map->value_size);
+        }
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* FIND                                                          */
+/* ============================================================= */
+chaos_status_t chaos_hashmap_find(const chaos_hashmap_t *map, const void *key, void **value, chaos_bool_t *found)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_size_t slot;
+
+    chaos_hashmap_check(map, &status);
+    chaos_assert_not_null(key, &status, CHAOS_MODULE_STDLIB);
+    chaos_assert_not_null(found, &status, CHAOS_MODULE_STDLIB);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        slot = chaos_hashmap_locate(map, key, chaos_hashmap_hash(map, key), found);
+        if (value != CHAOS_NULL)
+        {
+            *value = (*found == CHAOS_TRUE) ? (void *)&map->entries[(slot * map->stride) + map->key_size] : CHAOS_NULL;
+        }
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* ERASE                                                         */
+/* ============================================================= */
+chaos_status_t chaos_hashmap_erase(chaos_hashmap_t *map, const void *key, chaos_bool_t *found)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_size_t mask;
+    chaos_size_t slot;
+    chaos_size_t next;
+    chaos_bool_t present = CHAOS_FALSE;
+
+    chaos_hashmap_check(map, &status);
+    chaos_assert_not_null(key, &status, CHAOS_MODULE_STDLIB);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        mask = map->slot_count - 1U;
+        slot = chaos_hashmap_locate(map, key, chaos_hashmap_hash(map, key), &present);
+
+        if (present == CHAOS_TRUE)
+        {
+            /* Backward shift: pull each displaced successor one slot closer to home */
+            next = (slot + 1U) & mask;
+            while ((map->ctrl[next] != CHAOS_HASHMAP_EMPTY) && (chaos_hashmap_dist(map, next) != 0U))
+            {
+                chaos_hashmap_move(map, next, slot);
+                slot = next;
+                next = (next + 1U) & mask;
+            }
+            chaos_hashmap_set_ctrl(map, slot, CHAOS_HASHMAP_EMPTY);
+            map->count--;
+        }
+
+        if (found != CHAOS_NULL)
+        {
+            *found = present;
+        }
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* NEXT                                                          */
+/* ============================================================= */
+chaos_status_t chaos_hashmap_next(const chaos_hashmap_t *map, chaos_size_t *cursor, const void **key, void **value, chaos_bool_t *found)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_size_t i;
+
+    chaos_hashmap_check(map, &status);
+    chaos_assert_not_null(cursor, &status, CHAOS_MODULE_STDLIB);
+    chaos_assert_not_null(key, &status, CHAOS_MODULE_STDLIB);
+    chaos_assert_not_null(found, &status, CHAOS_MODULE_STDLIB);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        *found = CHAOS_FALSE;
+        for (i = *cursor; (i < map->slot_count) && (*found == CHAOS_FALSE); i++)
+        {
+            if (map->ctrl[i] != CHAOS_HASHMAP_EMPTY)
+            {
+                *key = &map->entries[i * map->stride];
+                if (value != CHAOS_NULL)
+                {
+                    *value = &map->entries[(i * map->stride) + map->key_size];
+                }
+                *found = CHAOS_TRUE;
+            }
+        }
+        *cursor = i;
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* INTERNAL HELPERS                                              */
+/* ============================================================= */
+
+/* Lanes of the group starting at ctrl whose control byte equals value */
+static chaos_hashmap_mask_t chaos_hashmap_match(const chaos_u8_t *ctrl, chaos_u8_t value)
+{
+#if (CHAOS_HAS_SSE2 == 1)
+    __m128i group = _mm_loadu_si128((const __m128i *)(const void *)ctrl);
+
+    return (chaos_hashmap_mask_t)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8((char)value)));
+#else
+    return chaos_word_zero_lanes(chaos_word_loadu(ctrl) ^ chaos_word_splat(value));
+#endif
+}
+
+/* Index of the first lane of a non-zero lane mask */
+static chaos_size_t chaos_hashmap_first(chaos_hashmap_mask_t mask)
+{
+#if (CHAOS_HAS_SSE2 == 1)
+    return (chaos_size_t)chaos_u32_ctz(mask);
+#else
+    return chaos_word_first_lane(mask);
+#endif
+}
+
+/* Clear the first lane of a non-zero lane mask */
+static chaos_hashmap_mask_t chaos_hashmap_drop(chaos_hashmap_mask_t mask)
+{
+#if (CHAOS_HAS_SSE2 == 1) || (CHAOS_LITTLE_ENDIAN == 1)
+    return mask & (mask - 1U);
+#else
+    return mask & ~(((chaos_word_t)1U << ((CHAOS_WORD_SIZE * 8U) - 1U)) >> chaos_word_clz(mask));
+#endif
+}
+
+/* 4- and 8-byte keys take one wide multiply; other sizes go through chaos_hash64() */
+static chaos_u32_t chaos_hashmap_hash(const chaos_hashmap_t *map, const void *key)
+{
+    chaos_u64_t h = 0U;
+    chaos_u64_t lo;
+    chaos_u64_t hi;
+
+    if (map->key_size == 4U)
+    {
+        chaos_u64_mul128((chaos_u64_t)chaos_u32_loadu(key) ^ CHAOS_HASHMAP_SEED, CHAOS_HASHMAP_MIX, &lo, &hi);
+        h = lo ^ hi;
+    }
+    else if (map->key_size == 8U)
+    {
+        chaos_u64_mul128(chaos_u64_loadu(key) ^ CHAOS_HASHMAP_SEED, CHAOS_HASHMAP_MIX, &lo, &hi);
+        h = lo ^ hi;
+    }
+    else
+    {
+        (void)chaos_hash64(key, map->key_size, CHAOS_HASHMAP_SEED, &h);
+    }
+
+    return (chaos_u32_t)(h ^ (h >> 32U));
+}
+
+/* The slot index uses the low hash bits, the control byte the top seven */
+static chaos_u8_t chaos_hashmap_tag(chaos_u32_t hash)
+{
+    return (chaos_u8_t)((hash >> 25U) | CHAOS_HASHMAP_USED);
+}
+
+static chaos_bool_t chaos_hashmap_key_equal(const chaos_hashmap_t *map, const chaos_u8_t *stored, const void *key)
+{
+    chaos_bool_t equal = CHAOS_FALSE;
+
+    if (map->key_size == 4U)
+    {
+        equal = (chaos_u32_loadu(stored) == chaos_u32_loadu(key)) ? CHAOS_TRUE : CHAOS_FALSE;
+    }
+    else if (map->key_size == 8U)
+    {
+        equal = (chaos_u64_loadu(stored) == chaos_u64_loadu(key)) ? CHAOS_TRUE : CHAOS_FALSE;
+    }
+    else
+    {
+        (void)chaos_memcmp(stored, key, map->key_size, &equal);
+    }
+
+    return equal;
+}
+
+/* Slot holding key, found a group at a time from its home slot */
+static chaos_size_t chaos_hashmap_locate(const chaos_hashmap_t *map, const void *key, chaos_u32_t hash, chaos_bool_t *found)
+{
+    chaos_size_t mask = map->slot_count - 1U;
+    chaos_size_t pos = (chaos_size_t)hash & mask;
+    chaos_size_t slot = 0U;
+    chaos_size_t stop;
+    chaos_u8_t tag = chaos_hashmap_tag(hash);
+    chaos_hashmap_mask_t match;
+    chaos_hashmap_mask_t empty;
+    chaos_bool_t done = CHAOS_FALSE;
+
+    *found = CHAOS_FALSE;
+
+    /* Without tombstones a key never lies past an empty slot, and the
+     * load limit keeps one, so the walk always ends */
+    while (done == CHAOS_FALSE)
+    {
+        match = chaos_hashmap_match(&map->ctrl[pos], tag);
+        empty = chaos_hashmap_match(&map->ctrl[pos], CHAOS_HASHMAP_EMPTY);
+        stop = (empty != 0U) ? chaos_hashmap_first(empty) : (chaos_size_t)CHAOS_HASHMAP_GROUP;
+
+        while ((match != 0U) && (*found == CHAOS_FALSE) && (chaos_hashmap_first(match) < stop))
+        {
+            slot = (pos + chaos_hashmap_first(match)) & mask;
+            *found = chaos_hashmap_key_equal(map, &map->entries[slot * map->stride], key);
+            match = chaos_hashmap_drop(match);
+        }
+
+        done = ((*found == CHAOS_TRUE) || (empty != 0U)) ? CHAOS_TRUE : CHAOS_FALSE;
+        pos = (pos + CHAOS_HASHMAP_GROUP) & mask;
+    }
+
+    return slot;
+}
+
+/* Distance of an occupied slot from its home slot */
+static chaos_size_t chaos_hashmap_dist(const chaos_hashmap_t *map, chaos_size_t slot)
+{
+    return (slot - (chaos_size_t)map->hashes[slot]) & (map->slot_count - 1U);
+}
+
+static void chaos_hashmap_set_ctrl(chaos_hashmap_t *map, chaos_size_t slot, chaos_u8_t value)
+{
+    map->ctrl[slot] = value;
+    if (slot < CHAOS_HASHMAP_MIRROR)
+    {
+        map->ctrl[map->slot_count + slot] = value;
+    }
+}
+
+/* Keys and entries are short: copy whole words inline, other sizes through chaos_memcpy() */
+static void chaos_hashmap_copy(chaos_u8_t *dst, const void *src, chaos_size_t size)
+{
+    const chaos_u8_t *s = (const chaos_u8_t *)src;
+    chaos_size_t i;
+
+    if ((size & 7U) == 0U)
+    {
+        for (i = 0U; i < size; i += 8U)
+        {
+            chaos_u64_storeu(&dst[i], chaos_u64_loadu(&s[i]));
+        }
+    }
+    else if (size == 4U)
+    {
+        chaos_u32_storeu(dst, chaos_u32_loadu(s));
+    }
+    else
+    {
+        (void)chaos_memcpy(dst, s, size);
+    }
+}
+
+static void chaos_hashmap_move(chaos_hashmap_t *map, chaos_size_t from, chaos_size_t to)
+{
+    chaos_hashmap_set_ctrl(map, to, map->ctrl[from]);
+    map->hashes[to] = map->hashes[from];
+    chaos_hashmap_copy(&map->entries[to * map->stride], &map->entries[from * map->stride], map->stride);
+}
+
+/* Claim the Robin Hood position of a new hash; the caller fills the entry */
+static chaos_size_t chaos_hashmap_place(chaos_hashmap_t *map, chaos_u32_t hash)
+{
+    chaos_size_t mask = map->slot_count - 1U;
+    chaos_size_t slot = (chaos_size_t)hash & mask;
+    chaos_size_t dist = 0U;
+    chaos_size_t end;
+    chaos_size_t prev;
+
+    /* Pass the entries whose home slot is not after ours */
+    while ((map->ctrl[slot] != CHAOS_HASHMAP_EMPTY) && (chaos_hashmap_dist(map, slot) >= dist))
+    {
+        slot = (slot + 1U) & mask;
+        dist++;
+    }
+
+    /* Shift the rest of the run up by one slot */
+    end = slot;
+    while (map->ctrl[end] != CHAOS_HASHMAP_EMPTY)
+    {
+        end = (end + 1U) & mask;
+    }
+    while (end != slot)
+    {
+        prev = (end - 1U) & mask;
+        chaos_hashmap_move(map, prev, end);
+        end = prev;
+    }
+
+    map->hashes[slot] = hash;
+    chaos_hashmap_set_ctrl(map, slot, chaos_hashmap_tag(hash));
+    map->count++;
+
+    return slot;
+}
+
+/* Move a full dynamic map to a region with twice the slots */
+static chaos_status_t chaos_hashmap_grow(chaos_hashmap_t *map)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+#if (CHAOS_ENABLE_ALLOC == 1)
+    chaos_hashmap_t grown;
+    void *region = CHAOS_NULL;
+    chaos_size_t size = 0U;
+    chaos_size_t slot;
+    chaos_size_t i;
+
+    if ((map->region == CHAOS_NULL) || (map->slot_count >= CHAOS_HASHMAP_SLOTS_MAX))
+    {
+        status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STDLIB, CHAOS_ERRCLASS_OVERFLOW, CHAOS_STD_FULL);
+    }
+    if (status == CHAOS_STATUS_OK)
+    {
+        status = chaos_hashmap_region_size(map->key_size, map->value_size, map->slot_count * 2U, &size);
+    }
+    if (status == CHAOS_STATUS_OK)
+    {
+        status = chaos_alloc(size, &region);
+    }
+    if (status == CHAOS_STATUS_OK)
+    {
+        chaos_hashmap_layout(&grown, map->key_size, map->value_size, map->slot_count * 2U, region, size, &status);
+    }
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        for (i = 0U; i < map->slot_count; i++)
+        {
+            if (map->ctrl[i] != CHAOS_HASHMAP_EMPTY)
+            {
+                slot = chaos_hashmap_place(&grown, map->hashes[i]);
+                chaos_hashmap_copy(&grown.entries[slot * grown.stride], &map->entries[i * map->stride], map->stride);
+            }
+        }
+        (void)chaos_free(map->region);
+        grown.region = region;
+        *map = grown;
+    }
+#else
+    (void)map;
+    status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STDLIB, CHAOS_ERRCLASS_OVERFLOW, CHAOS_STD_FULL);
+#endif
+
+    return status;
+}
+
+static void chaos_hashmap_layout(chaos_hashmap_t *map, chaos_size_t key_size, chaos_size_t value_size, chaos_size_t slot_count, void *region, chaos_size_t region_size, chaos_status_t *status)
+{
+    chaos_u8_t *base = (chaos_u8_t *)region;
+    chaos_size_t pad = (chaos_size_t)((CHAOS_HASHMAP_ALIGN - ((chaos_uintptr_t)base & (CHAOS_HASHMAP_ALIGN - 1U))) & (CHAOS_HASHMAP_ALIGN - 1U));
+    chaos_size_t need = 0U;
+
+    *status = chaos_hashmap_region_size(key_size, value_size, slot_count, &need);
+    if ((*status == CHAOS_STATUS_OK) && (region_size < need))
+    {
+        *status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STDLIB, CHAOS_ERRCLASS_OVERFLOW, CHAOS_STD_SCRATCH_SMALL);
+    }
+
+    if (*status == CHAOS_STATUS_OK)
+    {
+        map->entries = base + pad;
+        map->key_size = key_size;
+        map->value_size = value_size;
+        map->stride = key_size + value_size;
+        /* slot_count is a multiple of 16, so the hashes stay 4-byte aligned */
+        map->hashes = (chaos_u32_t *)(void *)(map->entries + (slot_count * map->stride));
+        map->ctrl = (chaos_u8_t *)(void *)(map->hashes + slot_count);
+        map->slot_count = slot_count;
+        map->capacity = slot_count - (slot_count / 8U);
+        map->count = 0U;
+
+        (void)chaos_memset(map->ctrl, CHAOS_HASHMAP_EMPTY, slot_count + CHAOS_HASHMAP_MIRROR);
+    }
+}
+
+static void chaos_hashmap_check(const chaos_hashmap_t *map, chaos_status_t *status)
+{
+    chaos_assert_not_null(map, status, CHAOS_MODULE_STDLIB);
+    if ((*status == CHAOS_STATUS_OK) && (map->ctrl == CHAOS_NULL))
+    {
+        *status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STDLIB, CHAOS_ERRCLASS_NULL_PTR, 0U);
+    }
+}
+
+#endif /* CHAOS_ENABLE_INT64 */
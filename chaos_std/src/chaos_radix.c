@@ -0,0 +1,505 @@
+/**
+ * @file chaos_radix.c
+ * @brief Implementation of the LSD radix sorts.
+ *
+ * Keys are mapped to unsigned integers that order the same way before
+ * their digits are taken: signed keys flip the sign bit, floats flip the
+ * sign bit when positive and every bit when negative. The mapping is
+ * applied on the fly, so the keys themselves are moved unchanged.
+ */
+
+#include "chaos_sort.h"
+#include "chaos_memory.h"
+#include "chaos_assert.h"
+#include "chaos_bits.h"
+
+#if (CHAOS_ENABLE_ALLOC == 1)
+#include "chaos_alloc.h"
+#endif
+
+/* ============================================================= */
+/* CONSTANTS                                                     */
+/* ============================================================= */
+
+/** Digit width in bits */
+#define CHAOS_RADIX_BITS 8U
+
+/** Buckets per digit */
+#define CHAOS_RADIX_BUCKETS 256U
+
+/** Digit width of the 64-bit sorts: six digits cover a key instead of eight */
+#define CHAOS_RADIX64_BITS 11U
+
+/** Buckets per 64-bit digit */
+#define CHAOS_RADIX64_BUCKETS 2048U
+
+/** Digits of a 64-bit key */
+#define CHAOS_RADIX64_DIGITS 6U
+
+/** Key bits sorted by the 64-bit prefix passes beyond log2 of the count */
+#define CHAOS_RADIX64_SLACK 12U
+
+/** Slack that lets the histograms start on an aligned address */
+#define CHAOS_RADIX_ALIGN ((chaos_size_t)sizeof(chaos_size_t))
+
+/** Largest chaos_size_t */
+#define CHAOS_RADIX_SIZE_MAX ((chaos_size_t)~(chaos_size_t)0U)
+
+/* ============================================================= */
+/* FUNCTION PROTOTYPES                                          */
+/* ============================================================= */
+static chaos_size_t *chaos_radix_layout(void *scratch);
+static chaos_status_t chaos_radix_sort32(void *keys, chaos_u32_t *values, chaos_size_t count, void *scratch, chaos_size_t scratch_size, chaos_u32_t sign, chaos_u32_t neg);
+static void chaos_radix_core32(chaos_u8_t *keys, chaos_u32_t *values, chaos_size_t count, chaos_size_t *hist, chaos_u32_t sign, chaos_u32_t neg);
+#if defined(CHAOS_ENABLE_INT64) && (CHAOS_ENABLE_INT64 == 1)
+static chaos_status_t chaos_radix_sort64(void *keys, chaos_u32_t *values, chaos_size_t count, void *scratch, chaos_size_t scratch_size, chaos_u64_t sign, chaos_u64_t neg);
+static void chaos_radix_core64(chaos_u8_t *keys, chaos_u32_t *values, chaos_size_t count, chaos_size_t *hist, chaos_u64_t sign, chaos_u64_t neg);
+static void chaos_radix_passes64(chaos_u8_t *keys, chaos_u32_t *values, chaos_size_t count, chaos_size_t *hist, chaos_u32_t base, chaos_u32_t first, chaos_u32_t last, chaos_u64_t sign, chaos_u64_t neg);
+static chaos_bool_t chaos_radix_finish64(chaos_u8_t *keys, chaos_u32_t *values, chaos_size_t count, chaos_u64_t sign, chaos_u64_t neg);
+#endif
+
+/* ============================================================= */
+/* SCRATCH SIZE                                                  */
+/* ============================================================= */
+chaos_size_t chaos_radix_sort_scratch(chaos_size_t count, chaos_size_t key_size, chaos_bool_t with_values)
+{
+    /* Alignment slack and one histogram per digit, then the key and payload copies */
+    chaos_size_t buckets = (key_size == 8U) ? (CHAOS_RADIX64_DIGITS * CHAOS_RADIX64_BUCKETS) : (key_size * CHAOS_RADIX_BUCKETS);
+    chaos_size_t fixed = CHAOS_RADIX_ALIGN + (buckets * (chaos_size_t)sizeof(chaos_size_t));
+    chaos_size_t per = key_size + ((with_values == CHAOS_TRUE) ? (chaos_size_t)sizeof(chaos_u32_t) : 0U);
+    chaos_size_t size = CHAOS_RADIX_SIZE_MAX;
+
+    if ((per == 0U) || (count <= ((CHAOS_RADIX_SIZE_MAX - fixed) / per)))
+    {
+        size = fixed + (count * per);
+    }
+
+    return size;
+}
+
+/* ============================================================= */
+/* RADIX SORT                                                    */
+/* ============================================================= */
+chaos_status_t chaos_radix_sort_u32(chaos_u32_t *keys, chaos_u32_t *values, chaos_size_t count, void *scratch, chaos_size_t scratch_size)
+{
+    return chaos_radix_sort32(keys, values, count, scratch, scratch_size, 0U, 0U);
+}
+
+chaos_status_t chaos_radix_sort_i32(chaos_i32_t *keys, chaos_u32_t *values, chaos_size_t count, void *scratch, chaos_size_t scratch_size)
+{
+    return chaos_radix_sort32(keys, values, count, scratch, scratch_size, 0x80000000UL, 0U);
+}
+
+#if defined(CHAOS_ENABLE_INT64) && (CHAOS_ENABLE_INT64 == 1)
+chaos_status_t chaos_radix_sort_u64(chaos_u64_t *keys, chaos_u32_t *values, chaos_size_t count, void *scratch, chaos_size_t scratch_size)
+{
+    return chaos_radix_sort64(keys, values, count, scratch, scratch_size, 0U, 0U);
+}
+
+chaos_status_t chaos_radix_sort_i64(chaos_i64_t *keys, chaos_u32_t *values, chaos_size_t count, void *scratch, chaos_size_t scratch_size)
+{
+    return chaos_radix_sort64(keys, values, count, scratch, scratch_size, 0x8000000000000000ULL, 0U);
+}
+#endif
+
+#if defined(CHAOS_ENABLE_FLOAT) && (CHAOS_ENABLE_FLOAT == 1)
+chaos_status_t chaos_radix_sort_f32(chaos_f32_t *keys, chaos_u32_t *values, chaos_size_t count, void *scratch, chaos_size_t scratch_size)
+{
+    return chaos_radix_sort32(keys, values, count, scratch, scratch_size, 0x80000000UL, 0x7FFFFFFFUL);
+}
+
+#if defined(CHAOS_ENABLE_INT64) && (CHAOS_ENABLE_INT64 == 1)
+chaos_status_t chaos_radix_sort_f64(chaos_f64_t *keys, chaos_u32_t *values, chaos_size_t count, void *scratch, chaos_size_t scratch_size)
+{
+    return chaos_radix_sort64(keys, values, count, scratch, scratch_size, 0x8000000000000000ULL, 0x7FFFFFFFFFFFFFFFULL);
+}
+#endif
+#endif
+
+/* ============================================================= */
+/* INTERNAL HELPERS                                              */
+/* ============================================================= */
+
+/* Histograms first, aligned; the key copy follows them */
+static chaos_size_t *chaos_radix_layout(void *scratch)
+{
+    chaos_u8_t *p = (chaos_u8_t *)scratch;
+
+    p += (CHAOS_RADIX_ALIGN - ((chaos_size_t)(chaos_uintptr_t)p % CHAOS_RADIX_ALIGN)) % CHAOS_RADIX_ALIGN;
+
+    return (chaos_size_t *)(void *)p;
+}
+
+/*
+ * Shared front end of the 32-bit sorts: checks the arguments, finds or
+ * allocates the scratch buffer and runs the passes. A key k orders as
+ * k ^ sign ^ (neg when its top bit is set).
+ */
+static chaos_status_t chaos_radix_sort32(void *keys, chaos_u32_t *values, chaos_size_t count, void *scratch, chaos_size_t scratch_size, chaos_u32_t sign, chaos_u32_t neg)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_size_t need = chaos_radix_sort_scratch(count, 4U, (values != CHAOS_NULL) ? CHAOS_TRUE : CHAOS_FALSE);
+    void *buffer = scratch;
+
+    if (count != 0U)
+    {
+        chaos_assert_not_null(keys, &status, CHAOS_MODULE_STDLIB);
+    }
+
+    if ((status == CHAOS_STATUS_OK) && (count > 1U))
+    {
+        if (buffer == CHAOS_NULL)
+        {
+#if (CHAOS_ENABLE_ALLOC == 1)
+            status = chaos_alloc(need, &buffer);
+#else
+            /* Same status as the disabled allocator: the caller has to pass a scratch buffer */
+            status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_FATAL, CHAOS_MODULE_ALLOC, CHAOS_ERRCLASS_NOT_SUPPORTED, CHAOS_ALLOC_DISABLED);
+#endif
+        }
+        else if (scratch_size < need)
+        {
+            status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STDLIB, CHAOS_ERRCLASS_INVALID_PARAM, CHAOS_STD_SCRATCH_SMALL);
+        }
+        else
+        {
+            /* Caller buffer is large enough */
+        }
+
+        if (status == CHAOS_STATUS_OK)
+        {
+            chaos_radix_core32((chaos_u8_t *)keys, values, count, chaos_radix_layout(buffer), sign, neg);
+#if (CHAOS_ENABLE_ALLOC == 1)
+            if (scratch == CHAOS_NULL)
+            {
+                (void)chaos_free(buffer);
+            }
+#endif
+        }
+    }
+
+    return status;
+}
+
+static void chaos_radix_core32(chaos_u8_t *keys, chaos_u32_t *values, chaos_size_t count, chaos_size_t *hist, chaos_u32_t sign, chaos_u32_t neg)
+{
+    chaos_u8_t *src_k = keys;
+    chaos_u8_t *dst_k = (chaos_u8_t *)&hist[4U * CHAOS_RADIX_BUCKETS];
+    chaos_u32_t *src_v = values;
+    chaos_u32_t *dst_v = (values != CHAOS_NULL) ? (chaos_u32_t *)(void *)(dst_k + (count * 4U)) : CHAOS_NULL;
+    chaos_u8_t *swap_k;
+    chaos_u32_t *swap_v;
+    chaos_size_t *h;
+    chaos_size_t i;
+    chaos_size_t pos;
+    chaos_size_t sum;
+    chaos_size_t c;
+    chaos_u32_t pass;
+    chaos_u32_t shift;
+    chaos_u32_t k;
+    chaos_u32_t t;
+
+    (void)chaos_memset(hist, 0U, 4U * CHAOS_RADIX_BUCKETS * (chaos_size_t)sizeof(chaos_size_t));
+    for (i = 0U; i < count; i++)
+    {
+        k = chaos_u32_loadu(&keys[i * 4U]);
+        t = k ^ sign ^ (neg & (0U - (k >> 31U)));
+        hist[t & 0xFFU]++;
+        hist[CHAOS_RADIX_BUCKETS + ((t >> 8U) & 0xFFU)]++;
+        hist[(2U * CHAOS_RADIX_BUCKETS) + ((t >> 16U) & 0xFFU)]++;
+        hist[(3U * CHAOS_RADIX_BUCKETS) + (t >> 24U)]++;
+    }
+
+    for (pass = 0U; pass < 4U; pass++)
+    {
+        h = &hist[pass * CHAOS_RADIX_BUCKETS];
+        shift = pass * CHAOS_RADIX_BITS;
+        k = chaos_u32_loadu(src_k);
+        t = k ^ sign ^ (neg & (0U - (k >> 31U)));
+
+        /* Skip a digit every key shares: the pass would not move anything */
+        if (h[(t >> shift) & 0xFFU] != count)
+        {
+            sum = 0U;
+            for (i = 0U; i < CHAOS_RADIX_BUCKETS; i++)
+            {
+                c = h[i];
+                h[i] = sum;
+                sum += c;
+            }
+
+            for (i = 0U; i < count; i++)
+            {
+                k = chaos_u32_loadu(&src_k[i * 4U]);
+                t = k ^ sign ^ (neg & (0U - (k >> 31U)));
+                pos = h[(t >> shift) & 0xFFU]++;
+                chaos_u32_storeu(&dst_k[pos * 4U], k);
+                if (src_v != CHAOS_NULL)
+                {
+                    dst_v[pos] = src_v[i];
+                }
+            }
+
+            swap_k = src_k;
+            src_k = dst_k;
+            dst_k = swap_k;
+            swap_v = src_v;
+            src_v = dst_v;
+            dst_v = swap_v;
+        }
+    }
+
+    /* An odd number of passes leaves the result in the scratch copy */
+    if (src_k != keys)
+    {
+        (void)chaos_memcpy(keys, src_k, count * 4U);
+        if (values != CHAOS_NULL)
+        {
+            (void)chaos_memcpy(values, src_v, count * (chaos_size_t)sizeof(chaos_u32_t));
+        }
+    }
+}
+
+#if defined(CHAOS_ENABLE_INT64) && (CHAOS_ENABLE_INT64 == 1)
+/* As chaos_radix_sort32(), for 64-bit keys */
+static chaos_status_t chaos_radix_sort64(void *keys, chaos_u32_t *values, chaos_size_t count, void *scratch, chaos_size_t scratch_size, chaos_u64_t sign, chaos_u64_t neg)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_size_t need = chaos_radix_sort_scratch(count, 8U, (values != CHAOS_NULL) ? CHAOS_TRUE : CHAOS_FALSE);
+    void *buffer = scratch;
+
+    if (count != 0U)
+    {
+        chaos_assert_not_null(keys, &status, CHAOS_MODULE_STDLIB);
+    }
+
+    if ((status == CHAOS_STATUS_OK) && (count > 1U))
+    {
+        if (buffer == CHAOS_NULL)
+        {
+#if (CHAOS_ENABLE_ALLOC == 1)
+            status = chaos_alloc(need, &buffer);
+#else
+            /* Same status as the disabled allocator: the caller has to pass a scratch buffer */
+            status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_FATAL, CHAOS_MODULE_ALLOC, CHAOS_ERRCLASS_NOT_SUPPORTED, CHAOS_ALLOC_DISABLED);
+#endif
+        }
+        else if (scratch_size < need)
+        {
+            status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STDLIB, CHAOS_ERRCLASS_INVALID_PARAM, CHAOS_STD_SCRATCH_SMALL);
+        }
+        else
+        {
+            /* Caller buffer is large enough */
+        }
+
+        if (status == CHAOS_STATUS_OK)
+        {
+            chaos_radix_core64((chaos_u8_t *)keys, values, count, chaos_radix_layout(buffer), sign, neg);
+#if (CHAOS_ENABLE_ALLOC == 1)
+            if (scratch == CHAOS_NULL)
+            {
+                (void)chaos_free(buffer);
+            }
+#endif
+        }
+    }
+
+    return status;
+}
+
+/*
+ * 11-bit digits, aligned on the highest bit in which the keys differ, so
+ * the digits above it cost nothing. The top prefix digits (log2 of the
+ * count plus CHAOS_RADIX64_SLACK bits) leave only the rare keys that share
+ * that prefix out of order, and an insertion pass finishes them. Keys that
+ * cluster below a wide prefix make that pass exceed its budget; the sort
+ * then runs every digit. Both paths are stable, so equal keys keep their
+ * order either way.
+ */
+static void chaos_radix_core64(chaos_u8_t *keys, chaos_u32_t *values, chaos_size_t count, chaos_size_t *hist, chaos_u64_t sign, chaos_u64_t neg)
+{
+    chaos_u64_t diff = 0U;
+    chaos_u64_t first;
+    chaos_u64_t k;
+    chaos_u32_t top = 0U;
+    chaos_u32_t digits;
+    chaos_u32_t prefix;
+    chaos_size_t i;
+
+    k = chaos_u64_loadu(keys);
+    first = k ^ sign ^ (neg & (0U - (k >> 63U)));
+    for (i = 1U; i < count; i++)
+    {
+        k = chaos_u64_loadu(&keys[i * 8U]);
+        diff |= (k ^ sign ^ (neg & (0U - (k >> 63U)))) ^ first;
+    }
+
+    if ((diff >> 32U) != 0U)
+    {
+        top = 64U - chaos_u32_clz((chaos_u32_t)(diff >> 32U));
+    }
+    else if (diff != 0U)
+    {
+        top = 32U - chaos_u32_clz((chaos_u32_t)diff);
+    }
+    else
+    {
+        /* All keys are equal: nothing to do */
+    }
+
+    if (top != 0U)
+    {
+        digits = (top + CHAOS_RADIX64_BITS - 1U) / CHAOS_RADIX64_BITS;
+        prefix = ((32U - chaos_u32_clz((chaos_u32_t)count - 1U)) + CHAOS_RADIX64_SLACK + CHAOS_RADIX64_BITS - 1U) / CHAOS_RADIX64_BITS;
+        prefix = (prefix < digits) ? prefix : digits;
+
+        chaos_radix_passes64(keys, values, count, hist, (digits * CHAOS_RADIX64_BITS) - top, digits - prefix, digits, sign, neg);
+        if ((prefix < digits) && (chaos_radix_finish64(keys, values, count, sign, neg) == CHAOS_FALSE))
+        {
+            chaos_radix_passes64(keys, values, count, hist, (digits * CHAOS_RADIX64_BITS) - top, 0U, digits, sign, neg);
+        }
+    }
+}
+
+/*
+ * Sort on digits first to last - 1. Digit d starts at bit d * 11 - base,
+ * digit 0 at bit 0; the bits it shares with digit 1 then decide nothing.
+ */
+static void chaos_radix_passes64(chaos_u8_t *keys, chaos_u32_t *values, chaos_size_t count, chaos_size_t *hist, chaos_u32_t base, chaos_u32_t first, chaos_u32_t last, chaos_u64_t sign, chaos_u64_t neg)
+{
+    chaos_u8_t *src_k = keys;
+    chaos_u8_t *dst_k = (chaos_u8_t *)&hist[CHAOS_RADIX64_DIGITS * CHAOS_RADIX64_BUCKETS];
+    chaos_u32_t *src_v = values;
+    chaos_u32_t *dst_v = (values != CHAOS_NULL) ? (chaos_u32_t *)(void *)(dst_k + (count * 8U)) : CHAOS_NULL;
+    chaos_u8_t *swap_k;
+    chaos_u32_t *swap_v;
+    chaos_u32_t shift[CHAOS_RADIX64_DIGITS];
+    chaos_size_t *h;
+    chaos_size_t i;
+    chaos_size_t pos;
+    chaos_size_t sum;
+    chaos_size_t c;
+    chaos_u32_t pass;
+    chaos_u32_t n = last - first;
+    chaos_u64_t k;
+    chaos_u64_t t;
+
+    for (pass = 0U; pass < n; pass++)
+    {
+        shift[pass] = ((first + pass) == 0U) ? 0U : (((first + pass) * CHAOS_RADIX64_BITS) - base);
+    }
+
+    (void)chaos_memset(hist, 0U, n * CHAOS_RADIX64_BUCKETS * (chaos_size_t)sizeof(chaos_size_t));
+    for (i = 0U; i < count; i++)
+    {
+        k = chaos_u64_loadu(&keys[i * 8U]);
+        t = k ^ sign ^ (neg & (0U - (k >> 63U)));
+        for (pass = 0U; pass < n; pass++)
+        {
+            hist[(pass * CHAOS_RADIX64_BUCKETS) + (chaos_size_t)((t >> shift[pass]) & 0x7FFU)]++;
+        }
+    }
+
+    for (pass = 0U; pass < n; pass++)
+    {
+        h = &hist[pass * CHAOS_RADIX64_BUCKETS];
+        k = chaos_u64_loadu(src_k);
+        t = k ^ sign ^ (neg & (0U - (k >> 63U)));
+
+        if (h[(chaos_size_t)((t >> shift[pass]) & 0x7FFU)] != count)
+        {
+            sum = 0U;
+            for (i = 0U; i < CHAOS_RADIX64_BUCKETS; i++)
+            {
+                c = h[i];
+                h[i] = sum;
+                sum += c;
+            }
+
+            for (i = 0U; i < count; i++)
+            {
+                k = chaos_u64_loadu(&src_k[i * 8U]);
+                t = k ^ sign ^ (neg & (0U - (k >> 63U)));
+                pos = h[(chaos_size_t)((t >> shift[pass]) & 0x7FFU)]++;
+                chaos_u64_storeu(&dst_k[pos * 8U], k);
+                if (src_v != CHAOS_NULL)
+                {
+                    dst_v[pos] = src_v[i];
+                }
+            }
+
+            swap_k = src_k;
+            src_k = dst_k;
+            dst_k = swap_k;
+            swap_v = src_v;
+            src_v = dst_v;
+            dst_v = swap_v;
+        }
+    }
+
+    if (src_k != keys)
+    {
+        (void)chaos_memcpy(keys, src_k, count * 8U);
+        if (values != CHAOS_NULL)
+        {
+            (void)chaos_memcpy(values, src_v, count * (chaos_size_t)sizeof(chaos_u32_t));
+        }
+    }
+}
+
+/*
+ * Stable insertion pass over keys already sorted on a prefix. Gives up,
+ * returning CHAOS_FALSE with the keys still in stable prefix order, once
+ * it has moved count keys.
+ */
+static chaos_bool_t chaos_radix_finish64(chaos_u8_t *keys, chaos_u32_t *values, chaos_size_t count, chaos_u64_t sign, chaos_u64_t neg)
+{
+    chaos_size_t moves = 0U;
+    chaos_size_t i;
+    chaos_size_t j;
+    chaos_u64_t k;
+    chaos_u64_t t;
+    chaos_u64_t p;
+    chaos_u64_t prev;
+    chaos_u32_t v = 0U;
+
+    for (i = 1U; (i < count) && (moves < count); i++)
+    {
+        k = chaos_u64_loadu(&keys[i * 8U]);
+        t = k ^ sign ^ (neg & (0U - (k >> 63U)));
+        prev = chaos_u64_loadu(&keys[(i - 1U) * 8U]);
+        p = prev ^ sign ^ (neg & (0U - (prev >> 63U)));
+        if (p > t)
+        {
+            if (values != CHAOS_NULL)
+            {
+                v = values[i];
+            }
+            j = i;
+            while ((j > 0U) && (p > t))
+            {
+                chaos_u64_storeu(&keys[j * 8U], prev);
+                if (values != CHAOS_NULL)
+                {
+                    values[j] = values[j - 1U];
+                }
+                j--;
+                moves++;
+                if (j > 0U)
+                {
+                    prev = chaos_u64_loadu(&keys[(j - 1U) * 8U]);
+                    p = prev ^ sign ^ (neg & (0U - (prev >> 63U)));
+                }
+            }
+            chaos_u64_storeu(&keys[j * 8U], k);
+            if (values != CHAOS_NULL)
+            {
+                values[j] = v;
+            }
+        }
+    }
+
+    return (moves < count) ? CHAOS_TRUE : CHAOS_FALSE;
+}
+#endif
@@ -0,0 +1,223 @@
+/**
+ * @file chaos_search.c
+ * @brief Implementation of the sorted-array searches.
+ *
+ * The typed searches are instantiations of chaos_search_impl.h; the
+ * callback forms below follow the same loops on elements of run-time size.
+ */
+
+#include "chaos_search.h"
+#include "chaos_memory.h"
+#include "chaos_assert.h"
+#include "chaos_bits.h"
+#include "chaos_compiler.h"
+
+/* ============================================================= */
+/* CONSTANTS                                                     */
+/* ============================================================= */
+
+/* The descendants of slot k four levels down fill slots 16k to 16k + 15 */
+#define CHAOS_EYTZINGER_LEVELS 4U
+
+/* Typed searches prefetch the cache line at byte 64k: those 16 slots for
+ * 4-byte elements, the 8 descendants three levels down for 8-byte ones */
+#define CHAOS_EYTZINGER_AHEAD  ((chaos_uintptr_t)64U)
+
+/* ============================================================= */
+/* FUNCTION PROTOTYPES                                          */
+/* ============================================================= */
+static void chaos_search_check(const void *base, chaos_size_t count, chaos_size_t size, chaos_sort_cmp_t cmp, const void *out, chaos_status_t *status);
+
+/* ============================================================= */
+/* TYPED SEARCHES                                                */
+/* ============================================================= */
+
+#define CHAOS_SEARCH_TYPE  chaos_u32_t
+#define CHAOS_SEARCH_LOWER chaos_lower_bound_u32
+#define CHAOS_SEARCH_EYTZ  chaos_eytzinger_lower_bound_u32
+#include "chaos_search_impl.h"
+
+#define CHAOS_SEARCH_TYPE  chaos_i32_t
+#define CHAOS_SEARCH_LOWER chaos_lower_bound_i32
+#define CHAOS_SEARCH_EYTZ  chaos_eytzinger_lower_bound_i32
+#include "chaos_search_impl.h"
+
+#if defined(CHAOS_ENABLE_INT64) && (CHAOS_ENABLE_INT64 == 1)
+#define CHAOS_SEARCH_TYPE  chaos_u64_t
+#define CHAOS_SEARCH_LOWER chaos_lower_bound_u64
+#define CHAOS_SEARCH_EYTZ  chaos_eytzinger_lower_bound_u64
+#include "chaos_search_impl.h"
+
+#define CHAOS_SEARCH_TYPE  chaos_i64_t
+#define CHAOS_SEARCH_LOWER chaos_lower_bound_i64
+#define CHAOS_SEARCH_EYTZ  chaos_eytzinger_lower_bound_i64
+#include "chaos_search_impl.h"
+#endif
+
+#if defined(CHAOS_ENABLE_FLOAT) && (CHAOS_ENABLE_FLOAT == 1)
+#define CHAOS_SEARCH_TYPE  chaos_f32_t
+#define CHAOS_SEARCH_LOWER chaos_lower_bound_f32
+#define CHAOS_SEARCH_EYTZ  chaos_eytzinger_lower_bound_f32
+#include "chaos_search_impl.h"
+
+#define CHAOS_SEARCH_TYPE  chaos_f64_t
+#define CHAOS_SEARCH_LOWER chaos_lower_bound_f64
+#define CHAOS_SEARCH_EYTZ  chaos_eytzinger_lower_bound_f64
+#include "chaos_search_impl.h"
+#endif
+
+/* ============================================================= */
+/* BINARY SEARCH                                                 */
+/* ============================================================= */
+chaos_status_t chaos_lower_bound(const void *base, chaos_size_t count, chaos_size_t size, const void *key, chaos_sort_cmp_t cmp, void *ctx, chaos_size_t *index)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    const chaos_u8_t *b = (const chaos_u8_t *)base;
+    chaos_size_t lo = 0U;
+    chaos_size_t n = count;
+    chaos_size_t half;
+
+    chaos_search_check(base, count, size, cmp, index, &status);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        *index = 0U;
+        if (count != 0U)
+        {
+            while (n > 1U)
+            {
+                half = n / 2U;
+                lo += half & (0U - (chaos_size_t)(cmp(ctx, &b[(lo + half - 1U) * size], key) < 0));
+                n -= half;
+            }
+            *index = lo + (chaos_size_t)(cmp(ctx, &b[lo * size], key) < 0);
+        }
+    }
+
+    return status;
+}
+
+chaos_status_t chaos_bsearch(const void *base, chaos_size_t count, chaos_size_t size, const void *key, chaos_sort_cmp_t cmp, void *ctx, chaos_size_t *index, chaos_bool_t *found)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    chaos_assert_not_null(found, &status, CHAOS_MODULE_STDLIB);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        *found = CHAOS_FALSE;
+        status = chaos_lower_bound(base, count, size, key, cmp, ctx, index);
+    }
+
+    /* The lower bound is the only candidate: nothing before it is equal */
+    if ((status == CHAOS_STATUS_OK) && (*index < count))
+    {
+        if (cmp(ctx, (const chaos_u8_t *)base + (*index * size), key) == 0)
+        {
+            *found = CHAOS_TRUE;
+        }
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* EYTZINGER LAYOUT                                              */
+/* ============================================================= */
+chaos_status_t chaos_eytzinger_build(const void *sorted, chaos_size_t count, chaos_size_t size, void *tree)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    const chaos_u8_t *src = (const chaos_u8_t *)sorted;
+    chaos_u8_t *dst = (chaos_u8_t *)tree;
+    chaos_size_t k = 1U;
+    chaos_size_t i;
+
+    chaos_assert_not_null(tree, &status, CHAOS_MODULE_STDLIB);
+    if (count != 0U)
+    {
+        chaos_assert_not_null(sorted, &status, CHAOS_MODULE_STDLIB);
+    }
+    if ((status == CHAOS_STATUS_OK) && (size == 0U))
+    {
+        status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STDLIB, CHAOS_ERRCLASS_INVALID_PARAM, CHAOS_STD_SIZE_ZERO);
+    }
+    if ((status == CHAOS_STATUS_OK) && (count > CHAOS_EYTZINGER_MAX))
+    {
+        status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STDLIB, CHAOS_ERRCLASS_OUT_OF_RANGE, CHAOS_STD_OVERFLOW);
+    }
+
+    if ((status == CHAOS_STATUS_OK) && (count != 0U))
+    {
+        /* Walk the implicit tree in order, starting at its leftmost node */
+        while ((2U * k) <= count)
+        {
+            k *= 2U;
+        }
+        for (i = 0U; i < count; i++)
+        {
+            (void)chaos_memcpy(&dst[k * size], &src[i * size], size);
+            if (((2U * k) + 1U) <= count)
+            {
+                k = (2U * k) + 1U;
+                while ((2U * k) <= count)
+                {
+                    k *= 2U;
+                }
+            }
+            else
+            {
+                /* Climb past the right-child links to the next ancestor */
+                k >>= chaos_u32_ctz(~k) + 1U;
+            }
+        }
+    }
+
+    return status;
+}
+
+chaos_status_t chaos_eytzinger_lower_bound(const void *tree, chaos_size_t count, chaos_size_t size, const void *key, chaos_sort_cmp_t cmp, void *ctx, chaos_size_t *slot)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    const chaos_u8_t *t = (const chaos_u8_t *)tree;
+    chaos_size_t k = 1U;
+
+    chaos_search_check(tree, count, size, cmp, slot, &status);
+    if ((status == CHAOS_STATUS_OK) && (count > CHAOS_EYTZINGER_MAX))
+    {
+        status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STDLIB, CHAOS_ERRCLASS_OUT_OF_RANGE, CHAOS_STD_OVERFLOW);
+    }
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        while (k <= count)
+        {
+            CHAOS_PREFETCH((const void *)((chaos_uintptr_t)t + (((chaos_uintptr_t)k << CHAOS_EYTZINGER_LEVELS) * size)));
+            k = (2U * k) + (chaos_size_t)(cmp(ctx, &t[k * size], key) < 0);
+        }
+        *slot = k >> (chaos_u32_ctz(~k) + 1U);
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* INTERNAL HELPERS                                              */
+/* ============================================================= */
+
+/* Argument checks shared by the callback searches */
+static void chaos_search_check(const void *base, chaos_size_t count, chaos_size_t size, chaos_sort_cmp_t cmp, const void *out, chaos_status_t *status)
+{
+    chaos_assert_not_null(out, status, CHAOS_MODULE_STDLIB);
+    if (count != 0U)
+    {
+        chaos_assert_not_null(base, status, CHAOS_MODULE_STDLIB);
+    }
+    if ((*status == CHAOS_STATUS_OK) && (cmp == CHAOS_NULL))
+    {
+        *status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STDLIB, CHAOS_ERRCLASS_NULL_PTR, 0U);
+    }
+    if ((*status == CHAOS_STATUS_OK) && (size == 0U))
+    {
+        *status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STDLIB, CHAOS_ERRCLASS_INVALID_PARAM, CHAOS_STD_SIZE_ZERO);
+    }
+}
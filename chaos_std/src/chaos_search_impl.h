@@ -0,0 +1,87 @@
+/**
+ * @file chaos_search_impl.h
+ * @brief Typed lower-bound searches, instantiated by macro (private).
+ *
+ * Define CHAOS_SEARCH_TYPE, CHAOS_SEARCH_LOWER and CHAOS_SEARCH_EYTZ (the
+ * element type and the two function names declared in chaos_search.h),
+ * then include this file. The parameters are undefined at the end.
+ *
+ * No include guard: this file is meant to be included more than once.
+ */
+
+#if !defined(CHAOS_SEARCH_TYPE) || !defined(CHAOS_SEARCH_LOWER) || !defined(CHAOS_SEARCH_EYTZ)
+#error "Define CHAOS_SEARCH_TYPE, CHAOS_SEARCH_LOWER and CHAOS_SEARCH_EYTZ before including chaos_search_impl.h"
+#endif
+
+chaos_status_t CHAOS_SEARCH_LOWER(const CHAOS_SEARCH_TYPE *base, chaos_size_t count, CHAOS_SEARCH_TYPE key, chaos_size_t *index)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_size_t lo = 0U;
+    chaos_size_t n = count;
+    chaos_size_t half;
+    chaos_size_t next;
+
+    chaos_assert_not_null(index, &status, CHAOS_MODULE_STDLIB);
+    if (count != 0U)
+    {
+        chaos_assert_not_null(base, &status, CHAOS_MODULE_STDLIB);
+    }
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        *index = 0U;
+        if (count != 0U)
+        {
+            /*
+             * The answer lies in [lo, lo + n]; the comparison becomes a mask,
+             * not a branch. Both places the next probe can land are fetched
+             * while this one resolves, as the miss would otherwise stall it.
+             */
+            while (n > 1U)
+            {
+                half = n / 2U;
+                next = ((n - half) / 2U) * (chaos_size_t)sizeof(CHAOS_SEARCH_TYPE);
+                CHAOS_PREFETCH((const void *)(((chaos_uintptr_t)&base[lo] + (chaos_uintptr_t)next) - (chaos_uintptr_t)sizeof(CHAOS_SEARCH_TYPE)));
+                CHAOS_PREFETCH((const void *)(((chaos_uintptr_t)&base[lo + half] + (chaos_uintptr_t)next) - (chaos_uintptr_t)sizeof(CHAOS_SEARCH_TYPE)));
+                lo += half & (0U - (chaos_size_t)(base[lo + half - 1U] < key));
+                n -= half;
+            }
+            *index = lo + (chaos_size_t)(base[lo] < key);
+        }
+    }
+
+    return status;
+}
+
+chaos_status_t CHAOS_SEARCH_EYTZ(const CHAOS_SEARCH_TYPE *tree, chaos_size_t count, CHAOS_SEARCH_TYPE key, chaos_size_t *slot)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_size_t k = 1U;
+
+    chaos_assert_not_null(slot, &status, CHAOS_MODULE_STDLIB);
+    if (count != 0U)
+    {
+        chaos_assert_not_null(tree, &status, CHAOS_MODULE_STDLIB);
+    }
+    if ((status == CHAOS_STATUS_OK) && (count > CHAOS_EYTZINGER_MAX))
+    {
+        status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STDLIB, CHAOS_ERRCLASS_OUT_OF_RANGE, CHAOS_STD_OVERFLOW);
+    }
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        while (k <= count)
+        {
+            CHAOS_PREFETCH((const void *)((chaos_uintptr_t)tree + ((chaos_uintptr_t)k * CHAOS_EYTZINGER_AHEAD)));
+            k = (2U * k) + (chaos_size_t)(tree[k] < key);
+        }
+        /* Undo the right turns taken after the last left turn; that node is the answer */
+        *slot = k >> (chaos_u32_ctz(~k) + 1U);
+    }
+
+    return status;
+}
+
+#undef CHAOS_SEARCH_TYPE
+#undef CHAOS_SEARCH_LOWER
+#undef CHAOS_SEARCH_EYTZ
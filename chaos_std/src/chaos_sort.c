@@ -0,0 +1,300 @@
+/**
+ * @file chaos_sort.c
+ * @brief Implementation of the in-place sorts.
+ *
+ * Every sort is an instantiation of chaos_sort_impl.h: the typed ones with
+ * the comparison inlined, the callback one over elements of run-time size
+ * with the comparator called through its context.
+ */
+
+#include "chaos_sort.h"
+#include "chaos_assert.h"
+#include "chaos_bits.h"
+
+/* ============================================================= */
+/* CONSTANTS                                                     */
+/* ============================================================= */
+
+/**
+ * @brief Comparator and element size of one callback sort.
+ */
+typedef struct
+{
+    chaos_size_t size;        /* Element size in bytes */
+    chaos_sort_cmp_t cmp;     /* Comparator */
+    void *ctx;                /* Comparator context */
+} chaos_sort_ctx_t;
+
+/* ============================================================= */
+/* FUNCTION PROTOTYPES                                          */
+/* ============================================================= */
+static void chaos_sort_swap(chaos_u8_t *a, chaos_u8_t *b, chaos_size_t size);
+
+/* ============================================================= */
+/* INSTANTIATIONS                                                */
+/* ============================================================= */
+
+#define CHAOS_SORT_NAME       chaos_sort_u32_impl
+#define CHAOS_SORT_TYPE       chaos_u32_t
+#define CHAOS_SORT_LESS(a, b) (*(a) < *(b))
+#include "chaos_sort_impl.h"
+
+#define CHAOS_SORT_NAME       chaos_sort_i32_impl
+#define CHAOS_SORT_TYPE       chaos_i32_t
+#define CHAOS_SORT_LESS(a, b) (*(a) < *(b))
+#include "chaos_sort_impl.h"
+
+#define CHAOS_SORT_NAME       chaos_sort_kv32_impl
+#define CHAOS_SORT_TYPE       chaos_sort_kv32_t
+#define CHAOS_SORT_LESS(a, b) ((a)->key < (b)->key)
+#include "chaos_sort_impl.h"
+
+#if defined(CHAOS_ENABLE_INT64) && (CHAOS_ENABLE_INT64 == 1)
+#define CHAOS_SORT_NAME       chaos_sort_u64_impl
+#define CHAOS_SORT_TYPE       chaos_u64_t
+#define CHAOS_SORT_LESS(a, b) (*(a) < *(b))
+#include "chaos_sort_impl.h"
+
+#define CHAOS_SORT_NAME       chaos_sort_i64_impl
+#define CHAOS_SORT_TYPE       chaos_i64_t
+#define CHAOS_SORT_LESS(a, b) (*(a) < *(b))
+#include "chaos_sort_impl.h"
+
+#define CHAOS_SORT_NAME       chaos_sort_kv64_impl
+#define CHAOS_SORT_TYPE       chaos_sort_kv64_t
+#define CHAOS_SORT_LESS(a, b) ((a)->key < (b)->key)
+#include "chaos_sort_impl.h"
+#endif
+
+#if defined(CHAOS_ENABLE_FLOAT) && (CHAOS_ENABLE_FLOAT == 1)
+/* A NaN is greater than any number and equal to another NaN, which keeps the order strict weak */
+#define CHAOS_SORT_NAME       chaos_sort_f32_impl
+#define CHAOS_SORT_TYPE       chaos_f32_t
+#define CHAOS_SORT_LESS(a, b) ((*(a) < *(b)) || ((*(b) != *(b)) && (*(a) == *(a))))
+#include "chaos_sort_impl.h"
+
+#define CHAOS_SORT_NAME       chaos_sort_f64_impl
+#define CHAOS_SORT_TYPE       chaos_f64_t
+#define CHAOS_SORT_LESS(a, b) ((*(a) < *(b)) || ((*(b) != *(b)) && (*(a) == *(a))))
+#include "chaos_sort_impl.h"
+#endif
+
+/* Elements of run-time size, ordered by the caller's comparator */
+#define CHAOS_SORT_NAME       chaos_sort_any_impl
+#define CHAOS_SORT_TYPE       chaos_u8_t
+#define CHAOS_SORT_CTX        const chaos_sort_ctx_t *
+#define CHAOS_SORT_WIDTH(c)   ((c)->size)
+#define CHAOS_SORT_SWAP(a, b) chaos_sort_swap((a), (b), ctx->size)
+#define CHAOS_SORT_LESS(a, b) (ctx->cmp(ctx->ctx, (a), (b)) < 0)
+#include "chaos_sort_impl.h"
+
+/* ============================================================= */
+/* SORT                                                          */
+/* ============================================================= */
+chaos_status_t chaos_sort(void *base, chaos_size_t count, chaos_size_t size, chaos_sort_cmp_t cmp, void *ctx)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_sort_ctx_t s;
+
+    if (count != 0U)
+    {
+        chaos_assert_not_null(base, &status, CHAOS_MODULE_STDLIB);
+    }
+    /* A function pointer does not convert to const void *: assert on the context it fills */
+    chaos_assert_not_null((cmp != CHAOS_NULL) ? (const void *)&s : CHAOS_NULL, &status, CHAOS_MODULE_STDLIB);
+    if ((status == CHAOS_STATUS_OK) && (size == 0U))
+    {
+        status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STDLIB, CHAOS_ERRCLASS_INVALID_PARAM, CHAOS_STD_SIZE_ZERO);
+    }
+
+    /* The comparator is called unconditionally, so it is checked even without assertions */
+    if ((status == CHAOS_STATUS_OK) && (count > 1U) && (cmp != CHAOS_NULL))
+    {
+        s.size = size;
+        s.cmp = cmp;
+        s.ctx = ctx;
+        chaos_sort_any_impl(&s, (chaos_u8_t *)base, count);
+    }
+
+    return status;
+}
+
+chaos_status_t chaos_sort_u32(chaos_u32_t *base, chaos_size_t count)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    if (count != 0U)
+    {
+        chaos_assert_not_null(base, &status, CHAOS_MODULE_STDLIB);
+    }
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        chaos_sort_u32_impl(base, count);
+    }
+
+    return status;
+}
+
+chaos_status_t chaos_sort_i32(chaos_i32_t *base, chaos_size_t count)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    if (count != 0U)
+    {
+        chaos_assert_not_null(base, &status, CHAOS_MODULE_STDLIB);
+    }
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        chaos_sort_i32_impl(base, count);
+    }
+
+    return status;
+}
+
+chaos_status_t chaos_sort_kv32(chaos_sort_kv32_t *base, chaos_size_t count)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    if (count != 0U)
+    {
+        chaos_assert_not_null(base, &status, CHAOS_MODULE_STDLIB);
+    }
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        chaos_sort_kv32_impl(base, count);
+    }
+
+    return status;
+}
+
+#if defined(CHAOS_ENABLE_INT64) && (CHAOS_ENABLE_INT64 == 1)
+chaos_status_t chaos_sort_u64(chaos_u64_t *base, chaos_size_t count)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    if (count != 0U)
+    {
+        chaos_assert_not_null(base, &status, CHAOS_MODULE_STDLIB);
+    }
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        chaos_sort_u64_impl(base, count);
+    }
+
+    return status;
+}
+
+chaos_status_t chaos_sort_i64(chaos_i64_t *base, chaos_size_t count)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    if (count != 0U)
+    {
+        chaos_assert_not_null(base, &status, CHAOS_MODULE_STDLIB);
+    }
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        chaos_sort_i64_impl(base, count);
+    }
+
+    return status;
+}
+
+chaos_status_t chaos_sort_kv64(chaos_sort_kv64_t *base, chaos_size_t count)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    if (count != 0U)
+    {
+        chaos_assert_not_null(base, &status, CHAOS_MODULE_STDLIB);
+    }
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        chaos_sort_kv64_impl(base, count);
+    }
+
+    return status;
+}
+#endif
+
+#if defined(CHAOS_ENABLE_FLOAT) && (CHAOS_ENABLE_FLOAT == 1)
+chaos_status_t chaos_sort_f32(chaos_f32_t *base, chaos_size_t count)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    if (count != 0U)
+    {
+        chaos_assert_not_null(base, &status, CHAOS_MODULE_STDLIB);
+    }
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        chaos_sort_f32_impl(base, count);
+    }
+
+    return status;
+}
+
+chaos_status_t chaos_sort_f64(chaos_f64_t *base, chaos_size_t count)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    if (count != 0U)
+    {
+        chaos_assert_not_null(base, &status, CHAOS_MODULE_STDLIB);
+    }
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        chaos_sort_f64_impl(base, count);
+    }
+
+    return status;
+}
+#endif
+
+/* ============================================================= */
+/* INTERNAL HELPERS                                              */
+/* ============================================================= */
+
+/* Exchange two elements a word at a time, then the 32-bit and byte tail */
+static void chaos_sort_swap(chaos_u8_t *a, chaos_u8_t *b, chaos_size_t size)
+{
+    chaos_word_t w;
+    chaos_u32_t v;
+    chaos_u8_t t;
+
+    while (size >= CHAOS_WORD_SIZE)
+    {
+        w = chaos_word_loadu(a);
+        chaos_word_storeu(a, chaos_word_loadu(b));
+        chaos_word_storeu(b, w);
+        a += CHAOS_WORD_SIZE;
+        b += CHAOS_WORD_SIZE;
+        size -= CHAOS_WORD_SIZE;
+    }
+    if (size >= 4U)
+    {
+        v = chaos_u32_loadu(a);
+        chaos_u32_storeu(a, chaos_u32_loadu(b));
+        chaos_u32_storeu(b, v);
+        a += 4U;
+        b += 4U;
+        size -= 4U;
+    }
+    while (size != 0U)
+    {
+        t = *a;
+        *a = *b;
+        *b = t;
+        a++;
+        b++;
+        size--;
+    }
+}
@@ -0,0 +1,621 @@
+/**
+ * @file chaos_std.c
+ * @brief Implementation of the standard library replacements.
+ */
+
+#include "chaos_std.h"
+#include "chaos_string.h"
+#include "chaos_assert.h"
+#include "chaos_bits.h"
+#include "chaos_std_internal.h"
+
+/* ============================================================= */
+/* CONSTANTS                                                     */
+/* ============================================================= */
+
+/* High bit and low nibble of every byte of a word */
+#define CHAOS_STD_HIGH   (CHAOS_WORD_ONES * (chaos_word_t)0x80U)
+#define CHAOS_STD_NIBBLE (CHAOS_WORD_ONES * (chaos_word_t)0x0FU)
+
+/* Powers of ten that fit the accumulator */
+static const chaos_std_acc_t chaos_std_pow10[] = {
+    1U, 10U, 100U, 1000U, 10000U, 100000U, 1000000U, 10000000U, 100000000U, 1000000000U,
+#if defined(CHAOS_ENABLE_INT64) && (CHAOS_ENABLE_INT64 == 1)
+    10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL, 100000000000000ULL,
+    1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL, 1000000000000000000ULL,
+    10000000000000000000ULL
+#endif
+};
+
+/* "00" to "99": two characters per entry, so one load places a digit pair */
+static const chaos_char_t chaos_std_pairs[200] = {
+    '0', '0', '0', '1', '0', '2', '0', '3', '0', '4', '0', '5', '0', '6', '0', '7', '0', '8', '0', '9',
+    '1', '0', '1', '1', '1', '2', '1', '3', '1', '4', '1', '5', '1', '6', '1', '7', '1', '8', '1', '9',
+    '2', '0', '2', '1', '2', '2', '2', '3', '2', '4', '2', '5', '2', '6', '2', '7', '2', '8', '2', '9',
+    '3', '0', '3', '1', '3', '2', '3', '3', '3', '4', '3', '5', '3', '6', '3', '7', '3', '8', '3', '9',
+    '4', '0', '4', '1', '4', '2', '4', '3', '4', '4', '4', '5', '4', '6', '4', '7', '4', '8', '4', '9',
+    '5', '0', '5', '1', '5', '2', '5', '3', '5', '4', '5', '5', '5', '6', '5', '7', '5', '8', '5', '9',
+    '6', '0', '6', '1', '6', '2', '6', '3', '6', '4', '6', '5', '6', '6', '6', '7', '6', '8', '6', '9',
+    '7', '0', '7', '1', '7', '2', '7', '3', '7', '4', '7', '5', '7', '6', '7', '7', '7', '8', '7', '9',
+    '8', '0', '8', '1', '8', '2', '8', '3', '8', '4', '8', '5', '8', '6', '8', '7', '8', '8', '8', '9',
+    '9', '0', '9', '1', '9', '2', '9', '3', '9', '4', '9', '5', '9', '6', '9', '7', '9', '8', '9', '9'
+};
+
+/* Hexadecimal digit characters */
+static const chaos_char_t chaos_std_hex[16] = {
+    '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'
+};
+
+/* ============================================================= */
+/* FUNCTION PROTOTYPES                                          */
+/* ============================================================= */
+static chaos_size_t chaos_std_parse(const chaos_char_t *str, chaos_size_t len, chaos_bool_t is_signed, chaos_std_acc_t limit, chaos_std_acc_t *mag, chaos_bool_t *neg, chaos_status_t *status);
+static chaos_size_t chaos_std_digits(const chaos_u8_t *p, chaos_size_t len, chaos_std_acc_t *acc, chaos_bool_t *wrapped);
+#if (CHAOS_LITTLE_ENDIAN == 1)
+static chaos_word_t chaos_std_nondigit(chaos_word_t w);
+static chaos_word_t chaos_std_swar(chaos_word_t w);
+#endif
+static chaos_u32_t chaos_std_bits(chaos_std_acc_t v);
+static void chaos_std_format(chaos_std_acc_t v, chaos_bool_t neg, chaos_char_t *buf, chaos_size_t size, chaos_size_t *len, chaos_status_t *status);
+static void chaos_std_format_hex(chaos_std_acc_t v, chaos_char_t *buf, chaos_size_t size, chaos_size_t *len, chaos_status_t *status);
+static void chaos_std_put8(chaos_u32_t v, chaos_char_t *end);
+static void chaos_std_put32(chaos_u32_t v, chaos_char_t *end);
+
+/* ============================================================= */
+/* INTEGER PARSING                                               */
+/* ============================================================= */
+chaos_status_t chaos_strtoi32(const chaos_char_t *str, chaos_size_t len, chaos_i32_t *value, chaos_size_t *consumed)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_std_acc_t mag = 0U;
+    chaos_bool_t neg = CHAOS_FALSE;
+    chaos_size_t used;
+
+    chaos_assert_not_null(value, &status, CHAOS_MODULE_STDLIB);
+    if (len != 0U)
+    {
+        chaos_assert_not_null(str, &status, CHAOS_MODULE_STDLIB);
+    }
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        used = chaos_std_parse(str, len, CHAOS_TRUE, (chaos_std_acc_t)chaos_i32_t_MAX, &mag, &neg, &status);
+        if ((neg == CHAOS_TRUE) && (mag != 0U))
+        {
+            /* The most negative value has no positive counterpart: negate mag - 1 */
+            *value = -(chaos_i32_t)(mag - 1U) - 1;
+        }
+        else
+        {
+            *value = (chaos_i32_t)mag;
+        }
+        if (consumed != CHAOS_NULL)
+        {
+            *consumed = used;
+        }
+    }
+
+    return status;
+}
+
+chaos_status_t chaos_strtou32(const chaos_char_t *str, chaos_size_t len, chaos_u32_t *value, chaos_size_t *consumed)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_std_acc_t mag = 0U;
+    chaos_bool_t neg = CHAOS_FALSE;
+    chaos_size_t used;
+
+    chaos_assert_not_null(value, &status, CHAOS_MODULE_STDLIB);
+    if (len != 0U)
+    {
+        chaos_assert_not_null(str, &status, CHAOS_MODULE_STDLIB);
+    }
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        used = chaos_std_parse(str, len, CHAOS_FALSE, (chaos_std_acc_t)chaos_u32_t_MAX, &mag, &neg, &status);
+        *value = (chaos_u32_t)mag;
+        if (consumed != CHAOS_NULL)
+        {
+            *consumed = used;
+        }
+    }
+
+    return status;
+}
+
+#if defined(CHAOS_ENABLE_INT64) && (CHAOS_ENABLE_INT64 == 1)
+chaos_status_t chaos_strtoi64(const chaos_char_t *str, chaos_size_t len, chaos_i64_t *value, chaos_size_t *consumed)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_std_acc_t mag = 0U;
+    chaos_bool_t neg = CHAOS_FALSE;
+    chaos_size_t used;
+
+    chaos_assert_not_null(value, &status, CHAOS_MODULE_STDLIB);
+    if (len != 0U)
+    {
+        chaos_assert_not_null(str, &status, CHAOS_MODULE_STDLIB);
+    }
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        used = chaos_std_parse(str, len, CHAOS_TRUE, (chaos_std_acc_t)chaos_i64_t_MAX, &mag, &neg, &status);
+        if ((neg == CHAOS_TRUE) && (mag != 0U))
+        {
+            /* The most negative value has no positive counterpart: negate mag - 1 */
+            *value = -(chaos_i64_t)(mag - 1U) - 1;
+        }
+        else
+        {
+            *value = (chaos_i64_t)mag;
+        }
+        if (consumed != CHAOS_NULL)
+        {
+            *consumed = used;
+        }
+    }
+
+    return status;
+}
+
+chaos_status_t chaos_strtou64(const chaos_char_t *str, chaos_size_t len, chaos_u64_t *value, chaos_size_t *consumed)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_std_acc_t mag = 0U;
+    chaos_bool_t neg = CHAOS_FALSE;
+    chaos_size_t used;
+
+    chaos_assert_not_null(value, &status, CHAOS_MODULE_STDLIB);
+    if (len != 0U)
+    {
+        chaos_assert_not_null(str, &status, CHAOS_MODULE_STDLIB);
+    }
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        used = chaos_std_parse(str, len, CHAOS_FALSE, chaos_u64_t_MAX, &mag, &neg, &status);
+        *value = mag;
+        if (consumed != CHAOS_NULL)
+        {
+            *consumed = used;
+        }
+    }
+
+    return status;
+}
+#endif
+
+chaos_status_t chaos_atoi(const chaos_cstr_t str, chaos_i32_t *value)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_size_t len = 0U;
+
+    chaos_assert_not_null(str, &status, CHAOS_MODULE_STDLIB);
+    chaos_assert_not_null(value, &status, CHAOS_MODULE_STDLIB);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        /* Bound the word reads by the terminator */
+        (void)chaos_strlen(str, &len);
+        status = chaos_strtoi32(str, len, value, CHAOS_NULL);
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* INTEGER FORMATTING                                            */
+/* ============================================================= */
+chaos_status_t chaos_u32_to_str(chaos_u32_t value, chaos_char_t *buf, chaos_size_t size, chaos_size_t *len)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    chaos_assert_not_null(buf, &status, CHAOS_MODULE_STDLIB);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        chaos_std_format((chaos_std_acc_t)value, CHAOS_FALSE, buf, size, len, &status);
+    }
+
+    return status;
+}
+
+chaos_status_t chaos_i32_to_str(chaos_i32_t value, chaos_char_t *buf, chaos_size_t size, chaos_size_t *len)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_u32_t mag = (chaos_u32_t)value;
+    chaos_bool_t neg = CHAOS_FALSE;
+
+    chaos_assert_not_null(buf, &status, CHAOS_MODULE_STDLIB);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        if (value < 0)
+        {
+            mag = 0U - mag;
+            neg = CHAOS_TRUE;
+        }
+        chaos_std_format((chaos_std_acc_t)mag, neg, buf, size, len, &status);
+    }
+
+    return status;
+}
+
+chaos_status_t chaos_u32_to_hex(chaos_u32_t value, chaos_char_t *buf, chaos_size_t size, chaos_size_t *len)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    chaos_assert_not_null(buf, &status, CHAOS_MODULE_STDLIB);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        chaos_std_format_hex((chaos_std_acc_t)value, buf, size, len, &status);
+    }
+
+    return status;
+}
+
+#if defined(CHAOS_ENABLE_INT64) && (CHAOS_ENABLE_INT64 == 1)
+chaos_status_t chaos_u64_to_str(chaos_u64_t value, chaos_char_t *buf, chaos_size_t size, chaos_size_t *len)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    chaos_assert_not_null(buf, &status, CHAOS_MODULE_STDLIB);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        chaos_std_format(value, CHAOS_FALSE, buf, size, len, &status);
+    }
+
+    return status;
+}
+
+chaos_status_t chaos_i64_to_str(chaos_i64_t value, chaos_char_t *buf, chaos_size_t size, chaos_size_t *len)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_u64_t mag = (chaos_u64_t)value;
+    chaos_bool_t neg = CHAOS_FALSE;
+
+    chaos_assert_not_null(buf, &status, CHAOS_MODULE_STDLIB);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        if (value < 0)
+        {
+            mag = 0U - mag;
+            neg = CHAOS_TRUE;
+        }
+        chaos_std_format(mag, neg, buf, size, len, &status);
+    }
+
+    return status;
+}
+
+chaos_status_t chaos_u64_to_hex(chaos_u64_t value, chaos_char_t *buf, chaos_size_t size, chaos_size_t *len)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    chaos_assert_not_null(buf, &status, CHAOS_MODULE_STDLIB);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        chaos_std_format_hex(value, buf, size, len, &status);
+    }
+
+    return status;
+}
+#endif
+
+/* ============================================================= */
+/* INTERNAL HELPERS                                              */
+/* ============================================================= */
+
+/*
+ * Whitespace, sign and digits; saturates mag at limit (limit + 1 for a
+ * negative signed value) and returns the characters consumed.
+ */
+static chaos_size_t chaos_std_parse(const chaos_char_t *str, chaos_size_t len, chaos_bool_t is_signed, chaos_std_acc_t limit, chaos_std_acc_t *mag, chaos_bool_t *neg, chaos_status_t *status)
+{
+    chaos_size_t i = 0U;
+    chaos_size_t n = 0U;
+    chaos_bool_t wrapped = CHAOS_FALSE;
+
+    while ((i < len) && ((str[i] == (chaos_char_t)' ') || ((str[i] >= (chaos_char_t)'\t') && (str[i] <= (chaos_char_t)'\r'))))
+    {
+        i++;
+    }
+    if ((i < len) && ((str[i] == (chaos_char_t)'+') || ((str[i] == (chaos_char_t)'-') && (is_signed == CHAOS_TRUE))))
+    {
+        *neg = (str[i] == (chaos_char_t)'-') ? CHAOS_TRUE : CHAOS_FALSE;
+        i++;
+    }
+
+    if (i < len)
+    {
+        n = chaos_std_digits(&str[i], len - i, mag, &wrapped);
+    }
+
+    if (n == 0U)
+    {
+        *mag = 0U;
+        *neg = CHAOS_FALSE;
+        i = 0U;
+        *status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STDLIB, CHAOS_ERRCLASS_INVALID_PARAM, CHAOS_STD_NO_DIGITS);
+    }
+    else
+    {
+        if (*neg == CHAOS_TRUE)
+        {
+            limit += 1U;
+        }
+        if ((wrapped == CHAOS_TRUE) || (*mag > limit))
+        {
+            *mag = limit;
+            *status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STDLIB, CHAOS_ERRCLASS_OVERFLOW, CHAOS_STD_OVERFLOW);
+        }
+        i += n;
+    }
+
+    return i;
+}
+
+/*
+ * Accumulates the leading digits of p and returns how many there are.
+ * Leading zeros are skipped first, then whole words of digits are folded
+ * in while the accumulator is sure not to wrap; a word that ends the number
+ * is converted in the same step, which makes numbers shorter than a word
+ * one load and a few multiplies. Digits past that point go one at a time
+ * with an explicit wrap check.
+ */
+static chaos_size_t chaos_std_digits(const chaos_u8_t *p, chaos_size_t len, chaos_std_acc_t *acc, chaos_bool_t *wrapped)
+{
+    chaos_std_acc_t v = 0U;
+    chaos_std_acc_t d;
+    chaos_size_t i = 0U;
+    chaos_bool_t done = CHAOS_FALSE;
+#if (CHAOS_LITTLE_ENDIAN == 1)
+    chaos_size_t width = 0U;
+    chaos_size_t n;
+    chaos_word_t w;
+    chaos_word_t stop;
+#endif
+
+    while ((i < len) && (p[i] == (chaos_u8_t)'0'))
+    {
+        i++;
+    }
+
+#if (CHAOS_LITTLE_ENDIAN == 1)
+    while ((done == CHAOS_FALSE) && ((len - i) >= CHAOS_WORD_SIZE) && ((width + CHAOS_WORD_SIZE) <= CHAOS_STD_ACC_DIGITS))
+    {
+        w = chaos_word_loadu(&p[i]);
+        stop = chaos_std_nondigit(w);
+        if (stop == 0U)
+        {
+            v = (v * chaos_std_pow10[CHAOS_WORD_SIZE]) + (chaos_std_acc_t)chaos_std_swar(w & CHAOS_STD_NIBBLE);
+            i += CHAOS_WORD_SIZE;
+            width += CHAOS_WORD_SIZE;
+        }
+        else
+        {
+            /* Move the n digits to the top lanes; the zeroed lanes read as leading zeros */
+            n = chaos_word_first_lane(stop);
+            if (n != 0U)
+            {
+                w = (w & CHAOS_STD_NIBBLE) << ((CHAOS_WORD_SIZE - n) * 8U);
+                v = (v * chaos_std_pow10[n]) + (chaos_std_acc_t)chaos_std_swar(w);
+                i += n;
+            }
+            done = CHAOS_TRUE;
+        }
+    }
+#endif
+
+    while ((done == CHAOS_FALSE) && (i < len) && ((chaos_u8_t)(p[i] - (chaos_u8_t)'0') <= 9U))
+    {
+        d = (chaos_std_acc_t)(p[i] - (chaos_u8_t)'0');
+        if (v > ((CHAOS_STD_ACC_MAX - d) / 10U))
+        {
+            *wrapped = CHAOS_TRUE;
+        }
+        else
+        {
+            v = (v * 10U) + d;
+        }
+        i++;
+    }
+
+    *acc = v;
+
+    return i;
+}
+
+#if (CHAOS_LITTLE_ENDIAN == 1)
+/* 0x80 in each lane that is not an ASCII digit (exact per lane, no borrows) */
+static chaos_word_t chaos_std_nondigit(chaos_word_t w)
+{
+    chaos_word_t low = w & CHAOS_WORD_LOW7;
+    chaos_word_t ge_0 = low + (CHAOS_WORD_ONES * (chaos_word_t)(0x80U - 0x30U));
+    chaos_word_t ge_10 = low + (CHAOS_WORD_ONES * (chaos_word_t)(0x80U - 0x3AU));
+
+    return (w | ~ge_0 | ge_10) & CHAOS_STD_HIGH;
+}
+
+/*
+ * Value of a word of digit values (first digit in the lowest byte): each
+ * multiply merges neighbouring lanes, giving 2-, then 4-, then 8-digit
+ * numbers in lanes twice as wide.
+ */
+static chaos_word_t chaos_std_swar(chaos_word_t w)
+{
+#if (CHAOS_PTR_WIDTH == 64)
+    w = (w * (chaos_word_t)((10U << 8U) + 1U)) >> 8U;
+    w = ((w & (chaos_word_t)0x00FF00FF00FF00FFULL) * (chaos_word_t)((100U << 16U) + 1U)) >> 16U;
+    w = ((w & (chaos_word_t)0x0000FFFF0000FFFFULL) * (chaos_word_t)((10000ULL << 32U) + 1U)) >> 32U;
+#else
+    w = (w * (chaos_word_t)((10U << 8U) + 1U)) >> 8U;
+    w = ((w & (chaos_word_t)0x00FF00FFU) * (chaos_word_t)((100U << 16U) + 1U)) >> 16U;
+#endif
+
+    return w;
+}
+#endif
+
+/* Significant bits of v (at least 1, so that 0 prints as one digit) */
+static chaos_u32_t chaos_std_bits(chaos_std_acc_t v)
+{
+    chaos_u32_t bits;
+
+#if defined(CHAOS_ENABLE_INT64) && (CHAOS_ENABLE_INT64 == 1)
+    if ((v >> 32U) != 0U)
+    {
+        bits = 64U - chaos_u32_clz((chaos_u32_t)(v >> 32U));
+    }
+    else
+#endif
+    {
+        bits = 32U - chaos_u32_clz((chaos_u32_t)v | 1U);
+    }
+
+    return bits;
+}
+
+/* The digit count comes first, so the digits are stored straight into place */
+static void chaos_std_format(chaos_std_acc_t v, chaos_bool_t neg, chaos_char_t *buf, chaos_size_t size, chaos_size_t *len, chaos_status_t *status)
+{
+    chaos_size_t n = chaos_std_dec_len(v);
+
+    n += (neg == CHAOS_TRUE) ? 1U : 0U;
+
+    if (n >= size)
+    {
+        if (size != 0U)
+        {
+            buf[0] = 0U;
+        }
+        n = 0U;
+        *status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STDLIB, CHAOS_ERRCLASS_OVERFLOW, CHAOS_STD_TRUNCATED);
+    }
+    else
+    {
+        buf[n] = 0U;
+        chaos_std_put_dec(v, &buf[n]);
+        if (neg == CHAOS_TRUE)
+        {
+            buf[0] = (chaos_char_t)'-';
+        }
+    }
+
+    if (len != CHAOS_NULL)
+    {
+        *len = n;
+    }
+}
+
+/* Lowercase, no prefix; one digit per four significant bits */
+static void chaos_std_format_hex(chaos_std_acc_t v, chaos_char_t *buf, chaos_size_t size, chaos_size_t *len, chaos_status_t *status)
+{
+    chaos_size_t n = (chaos_size_t)((chaos_std_bits(v) + 3U) >> 2U);
+    chaos_size_t i;
+
+    if (n >= size)
+    {
+        if (size != 0U)
+        {
+            buf[0] = 0U;
+        }
+        n = 0U;
+        *status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STDLIB, CHAOS_ERRCLASS_OVERFLOW, CHAOS_STD_TRUNCATED);
+    }
+    else
+    {
+        buf[n] = 0U;
+        for (i = n; i > 0U; i--)
+        {
+            buf[i - 1U] = chaos_std_hex[v & 0x0FU];
+            v >>= 4U;
+        }
+    }
+
+    if (len != CHAOS_NULL)
+    {
+        *len = n;
+    }
+}
+
+/* ============================================================= */
+/* SHARED DIGIT HELPERS                                          */
+/* ============================================================= */
+
+/*
+ * bits * 1233 / 4096 approximates bits * log10(2), which is the count or
+ * one short of it, settled by one table compare (zero, alone, still needs
+ * its digit).
+ */
+chaos_size_t chaos_std_dec_len(chaos_std_acc_t v)
+{
+    chaos_size_t t = (chaos_size_t)((chaos_std_bits(v) * 1233U) >> 12U);
+
+    return t + (((v >= chaos_std_pow10[t]) || (v == 0U)) ? 1U : 0U);
+}
+
+/* From the last digit backwards, eight at a time while more than eight remain */
+void chaos_std_put_dec(chaos_std_acc_t v, chaos_char_t *end)
+{
+    chaos_std_acc_t q;
+
+    while (v >= 100000000U)
+    {
+        q = v / 100000000U;
+        chaos_std_put8((chaos_u32_t)(v - (q * 100000000U)), end);
+        end -= 8;
+        v = q;
+    }
+    chaos_std_put32((chaos_u32_t)v, end);
+}
+
+/* Exactly eight digits (leading zeros kept) ending just before end */
+static void chaos_std_put8(chaos_u32_t v, chaos_char_t *end)
+{
+    chaos_u32_t hi = v / 10000U;
+    chaos_u32_t lo = v - (hi * 10000U);
+    chaos_u32_t a = hi / 100U;
+    chaos_u32_t b = lo / 100U;
+
+    /* Four independent pairs */
+    end[-8] = chaos_std_pairs[a * 2U];
+    end[-7] = chaos_std_pairs[(a * 2U) + 1U];
+    end[-6] = chaos_std_pairs[(hi - (a * 100U)) * 2U];
+    end[-5] = chaos_std_pairs[((hi - (a * 100U)) * 2U) + 1U];
+    end[-4] = chaos_std_pairs[b * 2U];
+    end[-3] = chaos_std_pairs[(b * 2U) + 1U];
+    end[-2] = chaos_std_pairs[(lo - (b * 100U)) * 2U];
+    end[-1] = chaos_std_pairs[((lo - (b * 100U)) * 2U) + 1U];
+}
+
+/* The significant digits of v ending just before end */
+static void chaos_std_put32(chaos_u32_t v, chaos_char_t *end)
+{
+    chaos_u32_t q;
+    chaos_u32_t r;
+
+    while (v >= 100U)
+    {
+        q = v / 100U;
+        r = (v - (q * 100U)) * 2U;
+        end -= 2;
+        end[0] = chaos_std_pairs[r];
+        end[1] = chaos_std_pairs[r + 1U];
+        v = q;
+    }
+    if (v >= 10U)
+    {
+        end[-2] = chaos_std_pairs[v * 2U];
+        end[-1] = chaos_std_pairs[(v * 2U) + 1U];
+    }
+    else
+    {
+        end[-1] = (chaos_char_t)((chaos_u32_t)'0' + v);
+    }
+}
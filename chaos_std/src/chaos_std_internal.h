@@ -0,0 +1,57 @@
+/**
+ * @file chaos_std_internal.h
+ * @brief Internal helpers and tables shared by the chaos_std sources (not
+ *        part of the public API).
+ */
+
+#ifndef CHAOS_STD_INTERNAL_H
+#define CHAOS_STD_INTERNAL_H
+
+#include "chaos_types.h"
+
+/* ============================================================= */
+/* DIGIT HELPERS                                                 */
+/* ============================================================= */
+
+/* Accumulator of the digit loops and the digits it always holds exactly */
+#if defined(CHAOS_ENABLE_INT64) && (CHAOS_ENABLE_INT64 == 1)
+typedef chaos_u64_t chaos_std_acc_t;
+#define CHAOS_STD_ACC_MAX    chaos_u64_t_MAX
+#define CHAOS_STD_ACC_DIGITS 19U
+#else
+typedef chaos_u32_t chaos_std_acc_t;
+#define CHAOS_STD_ACC_MAX    chaos_u32_t_MAX
+#define CHAOS_STD_ACC_DIGITS 9U
+#endif
+
+/**
+ * @brief Number of decimal digits of v (1 for 0).
+ */
+extern chaos_size_t chaos_std_dec_len(chaos_std_acc_t v);
+
+/**
+ * @brief Store the decimal digits of v so that the last one is just before end.
+ * @details Exactly chaos_std_dec_len(v) characters are written; no terminator.
+ */
+extern void chaos_std_put_dec(chaos_std_acc_t v, chaos_char_t *end);
+
+/* ============================================================= */
+/* POWERS OF FIVE                                                */
+/* ============================================================= */
+
+#if defined(CHAOS_ENABLE_INT64) && (CHAOS_ENABLE_INT64 == 1)
+
+/** @brief Smallest and largest power of five in chaos_std_pow5. */
+#define CHAOS_STD_POW5_MIN (-342)
+#define CHAOS_STD_POW5_MAX 324
+
+/**
+ * @brief 5^q for q = CHAOS_STD_POW5_MIN..CHAOS_STD_POW5_MAX as 128-bit
+ *        mantissas { high, low }, scaled so that bit 127 is set and rounded
+ *        down (exact for q = 0..55). Entry q is at index q - CHAOS_STD_POW5_MIN.
+ */
+extern const chaos_u64_t chaos_std_pow5[(CHAOS_STD_POW5_MAX - CHAOS_STD_POW5_MIN) + 1][2];
+
+#endif /* CHAOS_ENABLE_INT64 */
+
+#endif /* CHAOS_STD_INTERNAL_H */
@@ -0,0 +1,110 @@
+/**
+ * @file chaos_strbuf.h
+ * @brief Length-tracked string builder for CHAOSLIB.
+ *
+ * A chaos_strbuf_t remembers its length, so appending costs only the bytes
+ * appended (no rescan for the terminator as with chaos_strcat()). The
+ * content is always null-terminated and can be handed to any function
+ * expecting a chaos_cstr_t.
+ */
+
+#ifndef CHAOS_STRBUF_H
+#define CHAOS_STRBUF_H
+
+#include "chaos_types.h"
+#include "chaos_status.h"
+
+/* ============================================================= */
+/* STRING BUFFER TYPE                                            */
+/* ============================================================= */
+
+/**
+ * @brief String builder over caller storage or chaos_alloc() storage.
+ */
+typedef struct
+{
+    chaos_char_t *data;    /**< Storage, always null-terminated */
+    chaos_size_t len;      /**< Current length (excluding null terminator) */
+    chaos_size_t cap;      /**< Storage size in bytes (including null terminator) */
+    chaos_bool_t growable; /**< Storage comes from chaos_alloc() and may be reallocated */
+} chaos_strbuf_t;
+
+/* ============================================================= */
+/* STRING BUFFER FUNCTIONS                                       */
+/* ============================================================= */
+
+/**
+ * @brief Initialise a fixed-capacity buffer over caller storage.
+ * @param[out] sb Buffer to initialise
+ * @param[in] storage Caller storage
+ * @param[in] cap Size of @p storage in bytes (at least 1)
+ */
+extern chaos_status_t chaos_strbuf_init(chaos_strbuf_t *sb, chaos_char_t *storage, chaos_size_t cap);
+
+/**
+ * @brief Initialise a buffer that grows through chaos_alloc().
+ * @param[out] sb Buffer to initialise
+ * @param[in] cap Initial storage size in bytes (at least 1)
+ * @note Requires CHAOS_ENABLE_ALLOC; release with chaos_strbuf_free().
+ */
+extern chaos_status_t chaos_strbuf_init_dynamic(chaos_strbuf_t *sb, chaos_size_t cap);
+
+/**
+ * @brief Release the storage of a growable buffer (no-op for caller storage).
+ * @param[inout] sb Buffer to release
+ */
+extern chaos_status_t chaos_strbuf_free(chaos_strbuf_t *sb);
+
+/**
+ * @brief Empty the buffer, keeping its storage.
+ * @param[inout] sb Buffer to reset
+ */
+extern chaos_status_t chaos_strbuf_reset(chaos_strbuf_t *sb);
+
+/**
+ * @brief Append a null-terminated string.
+ * @details A fixed buffer keeps what fits and reports CHAOS_STRING_TRUNCATED.
+ * @param[inout] sb Buffer
+ * @param[in] str String to append
+ */
+extern chaos_status_t chaos_strbuf_append(chaos_strbuf_t *sb, const chaos_cstr_t str);
+
+/**
+ * @brief Append len bytes (no null terminator required).
+ * @details @p data may point into the buffer itself, even when it grows.
+ * @param[inout] sb Buffer
+ * @param[in] data Bytes to append
+ * @param[in] len Number of bytes
+ */
+extern chaos_status_t chaos_strbuf_append_n(chaos_strbuf_t *sb, const chaos_char_t *data, chaos_size_t len);
+
+/**
+ * @brief Append one character.
+ * @param[inout] sb Buffer
+ * @param[in] c Character to append
+ */
+extern chaos_status_t chaos_strbuf_append_char(chaos_strbuf_t *sb, chaos_char_t c);
+
+/**
+ * @brief Append an unsigned integer in decimal.
+ * @param[inout] sb Buffer
+ * @param[in] value Value to append
+ */
+extern chaos_status_t chaos_strbuf_append_u32(chaos_strbuf_t *sb, chaos_u32_t value);
+
+/**
+ * @brief Append a signed integer in decimal.
+ * @param[inout] sb Buffer
+ * @param[in] value Value to append
+ */
+extern chaos_status_t chaos_strbuf_append_i32(chaos_strbuf_t *sb, chaos_i32_t value);
+
+/**
+ * @brief Get the content as a null-terminated string and its length.
+ * @param[in] sb Buffer
+ * @param[out] str Content (valid until the next append, reset or free)
+ * @param[out] len Content length (may be NULL)
+ */
+extern chaos_status_t chaos_strbuf_view(const chaos_strbuf_t *sb, chaos_cstr_t *str, chaos_size_t *len);
+
+#endif /* CHAOS_STRBUF_H */
@@ -39,6 +39,24 @@ extern chaos_status_t chaos_strcpy(
     chaos_size_t dst_size
 );
 
+/**
+ * @brief Copy a string and report how much was copied (strlcpy-style).
+ * @details Copy and length are computed in one pass; truncation is reported
+ *          as with chaos_strcpy() and is also visible as written < src_len.
+ * @param[out] dst Destination buffer
+ * @param[in] src Source string
+ * @param[in] dst_size Size of destination buffer in bytes
+ * @param[out] written Characters copied, excluding the null terminator (may be NULL)
+ * @param[out] src_len Full length of @p src (may be NULL)
+ */
+extern chaos_status_t chaos_strcpy_len(
+    chaos_cstr_t dst,
+    const chaos_cstr_t src,
+    chaos_size_t dst_size,
+    chaos_size_t *written,
+    chaos_size_t *src_len
+);
+
 /**
  * @brief Concatenate a string to a destination buffer.
  * @param[out] dst Destination buffer
@@ -51,6 +69,22 @@ extern chaos_status_t chaos_strcat(
     chaos_size_t dst_size
 );
 
+/**
+ * @brief Concatenate a string and report how much was appended (strlcat-style).
+ * @param[out] dst Destination buffer
+ * @param[in] src Source string
+ * @param[in] dst_size Total size of destination buffer
+ * @param[out] written Characters appended, excluding the null terminator (may be NULL)
+ * @param[out] src_len Full length of @p src (may be NULL)
+ */
+extern chaos_status_t chaos_strcat_len(
+    chaos_cstr_t dst,
+    const chaos_cstr_t src,
+    chaos_size_t dst_size,
+    chaos_size_t *written,
+    chaos_size_t *src_len
+);
+
 /**
  * @brief Compare two null-terminated strings.
  * @param[in] str1 First string
@@ -63,6 +97,19 @@ extern chaos_status_t chaos_strcmp(
     chaos_bool_t *equal
 );
 
+/**
+ * @brief Compare two null-terminated strings for ordering.
+ * @param[in] str1 First string
+ * @param[in] str2 Second string
+ * @param[out] order Negative, zero or positive as str1 sorts before, equal to
+ *                   or after str2 (bytes compared as unsigned values)
+ */
+extern chaos_status_t chaos_strcmp_order(
+    const chaos_cstr_t str1,
+    const chaos_cstr_t str2,
+    chaos_i32_t *order
+);
+
 /**
  * @brief Search for a substring in a string.
  * @param[in] str String to search in
@@ -75,4 +122,19 @@ extern chaos_status_t chaos_strstr(
     chaos_bool_t *found
 );
 
+/**
+ * @brief Locate the first occurrence of a substring in a string.
+ * @details Linear time in the length of both strings (Two-Way algorithm).
+ * @param[in] str String to search in
+ * @param[in] substr Substring to search for
+ * @param[out] pos Offset of the first match, or the length of @p str when not found
+ * @param[out] found Output boolean: CHAOS_TRUE if found
+ */
+extern chaos_status_t chaos_strstr_pos(
+    const chaos_cstr_t str,
+    const chaos_cstr_t substr,
+    chaos_size_t *pos,
+    chaos_bool_t *found
+);
+
 #endif /* CHAOS_STRING_H */
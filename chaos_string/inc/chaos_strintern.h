@@ -0,0 +1,145 @@
+/**
+ * @file chaos_strintern.h
+ * @brief String interning for CHAOSLIB.
+ *
+ * Each distinct string is stored once and given a stable 32-bit handle, so
+ * two interned strings are equal exactly when their handles are. Lookup is
+ * an open-addressing (linear probing) hash table; the table, the handle
+ * index and the character pool share one region, supplied by the caller or
+ * taken from chaos_alloc(). Capacity is fixed at initialisation: handles
+ * and the stored characters never move.
+ */
+
+#ifndef CHAOS_STRINTERN_H
+#define CHAOS_STRINTERN_H
+
+#include "chaos_types.h"
+#include "chaos_status.h"
+#include "chaos_strview.h"
+
+/* ============================================================= */
+/* INTERN TABLE TYPES                                            */
+/* ============================================================= */
+
+/** @brief Handle of an interned string (never CHAOS_STRID_NONE). */
+typedef chaos_u32_t chaos_strid_t;
+
+/** @brief Value that no interned string receives. */
+#define CHAOS_STRID_NONE ((chaos_strid_t)0U)
+
+/** @brief Largest supported number of hash slots. */
+#define CHAOS_STRINTERN_SLOTS_MAX ((chaos_size_t)1U << 22U)
+
+/**
+ * @brief One hash table slot (internal layout, exposed for sizing only).
+ */
+typedef struct
+{
+    chaos_u32_t hash;         /**< Full hash of the string, for a cheap reject */
+    chaos_strid_t id;         /**< Handle, or CHAOS_STRID_NONE when empty */
+} chaos_strintern_slot_t;
+
+/**
+ * @brief Where an interned string lives in the pool.
+ */
+typedef struct
+{
+    chaos_u32_t offset;       /**< Offset of the first character in the pool */
+    chaos_u32_t len;          /**< Length (excluding the null terminator) */
+} chaos_strintern_entry_t;
+
+/**
+ * @brief Intern table.
+ */
+typedef struct
+{
+    chaos_strintern_slot_t *slots;     /**< Hash table, slot_count entries */
+    chaos_strintern_entry_t *entries;  /**< Entry of handle n at index n - 1 */
+    chaos_char_t *pool;                /**< Null-terminated copies of the strings */
+    chaos_size_t slot_count;           /**< Number of slots (power of two) */
+    chaos_size_t capacity;             /**< Maximum number of strings (3/4 of the slots) */
+    chaos_size_t count;                /**< Number of strings interned */
+    chaos_size_t pool_size;            /**< Pool size in bytes */
+    chaos_size_t pool_used;            /**< Pool bytes in use */
+    chaos_size_t probe_total;          /**< Sum over strings of the slots probed to insert them */
+    chaos_size_t probe_max;            /**< Longest probe sequence so far */
+    void *region;                      /**< chaos_alloc() block to release, or NULL */
+} chaos_strintern_t;
+
+/**
+ * @brief Load statistics.
+ */
+typedef struct
+{
+    chaos_size_t count;       /**< Strings interned */
+    chaos_size_t capacity;    /**< Maximum number of strings */
+    chaos_size_t slot_count;  /**< Hash table slots */
+    chaos_u32_t load_permille;/**< Occupied slots per thousand */
+    chaos_u32_t probe_avg_x100; /**< Mean probe length times 100 (100 = no collision) */
+    chaos_size_t probe_max;   /**< Longest probe sequence */
+    chaos_size_t pool_used;   /**< Pool bytes in use */
+    chaos_size_t pool_size;   /**< Pool size in bytes */
+} chaos_strintern_stats_t;
+
+/* ============================================================= */
+/* INTERN TABLE FUNCTIONS                                        */
+/* ============================================================= */
+
+/**
+ * @brief Initialise a table over a caller-supplied region.
+ * @details The slots and the handle index are carved from the start of the
+ *          region; whatever remains holds the characters.
+ * @param[out] table Table to initialise
+ * @param[in] region Caller storage (any alignment)
+ * @param[in] region_size Size of @p region in bytes
+ * @param[in] slot_count Number of hash slots (power of two, 4 to CHAOS_STRINTERN_SLOTS_MAX)
+ */
+extern chaos_status_t chaos_strintern_init(chaos_strintern_t *table, void *region, chaos_size_t region_size, chaos_size_t slot_count);
+
+/**
+ * @brief Initialise a table in chaos_alloc() memory.
+ * @param[out] table Table to initialise
+ * @param[in] slot_count Number of hash slots (power of two, 4 to CHAOS_STRINTERN_SLOTS_MAX)
+ * @param[in] pool_size Bytes reserved for the characters (terminators included)
+ * @note Requires CHAOS_ENABLE_ALLOC; release with chaos_strintern_free().
+ */
+extern chaos_status_t chaos_strintern_init_dynamic(chaos_strintern_t *table, chaos_size_t slot_count, chaos_size_t pool_size);
+
+/**
+ * @brief Release the region of a dynamic table (no-op for caller storage).
+ * @param[inout] table Table to release
+ */
+extern chaos_status_t chaos_strintern_free(chaos_strintern_t *table);
+
+/**
+ * @brief Intern a string, returning the handle of its stored copy.
+ * @param[inout] table Table
+ * @param[in] str String to intern
+ * @param[out] id Handle (the same for every call with equal characters)
+ */
+extern chaos_status_t chaos_strintern_add(chaos_strintern_t *table, const chaos_strview_t *str, chaos_strid_t *id);
+
+/**
+ * @brief Look a string up without interning it.
+ * @param[in] table Table
+ * @param[in] str String to look up
+ * @param[out] id Handle, or CHAOS_STRID_NONE if absent
+ */
+extern chaos_status_t chaos_strintern_find(const chaos_strintern_t *table, const chaos_strview_t *str, chaos_strid_t *id);
+
+/**
+ * @brief Get the characters behind a handle.
+ * @param[in] table Table
+ * @param[in] id Handle returned by chaos_strintern_add()
+ * @param[out] str View of the stored copy (null-terminated)
+ */
+extern chaos_status_t chaos_strintern_get(const chaos_strintern_t *table, chaos_strid_t id, chaos_strview_t *str);
+
+/**
+ * @brief Report table load and probe statistics.
+ * @param[in] table Table
+ * @param[out] stats Statistics
+ */
+extern chaos_status_t chaos_strintern_stats(const chaos_strintern_t *table, chaos_strintern_stats_t *stats);
+
+#endif /* CHAOS_STRINTERN_H */
@@ -0,0 +1,111 @@
+/**
+ * @file chaos_strmatch.h
+ * @brief Multi-pattern string search (Aho-Corasick) for CHAOSLIB.
+ *
+ * A pattern set is compiled once into an automaton that finds every
+ * occurrence of every pattern in a single pass over the text, whatever the
+ * number of patterns. The automaton lives entirely in a caller-provided
+ * arena: nothing is allocated, and the patterns themselves need not
+ * outlive the build.
+ *
+ * Transitions are bitmap-compressed: each state keeps a 256-bit set of the
+ * bytes it has children for, and its children sit next to each other in
+ * byte order, so a child is found by counting the set bits below it. The
+ * root row is kept as a dense table since most text bytes start there.
+ */
+
+#ifndef CHAOS_STRMATCH_H
+#define CHAOS_STRMATCH_H
+
+#include "chaos_types.h"
+#include "chaos_status.h"
+#include "chaos_strview.h"
+
+/* ============================================================= */
+/* MATCHER TYPES                                                 */
+/* ============================================================= */
+
+/**
+ * @brief One automaton state (internal layout, exposed for sizing only).
+ */
+typedef struct
+{
+    chaos_u32_t bitmap[8];    /**< Bytes that have a child, one bit per value */
+    chaos_u8_t rank[8];       /**< Children in the bitmap words before each word */
+    chaos_u32_t base;         /**< Index of the first child */
+    chaos_u32_t fail;         /**< Longest proper suffix that is also a state */
+    chaos_u32_t dict;         /**< Nearest suffix state that ends a pattern (0: none) */
+    chaos_u32_t pattern;      /**< Pattern index + 1 ending here (0: none) */
+    chaos_u32_t depth;        /**< Length of the prefix this state spells */
+} chaos_strmatch_node_t;
+
+/**
+ * @brief Compiled pattern set.
+ */
+typedef struct
+{
+    const chaos_strmatch_node_t *nodes; /**< States, in breadth-first order */
+    const chaos_u32_t *root_next;       /**< Dense transitions out of the root */
+    chaos_size_t node_count;            /**< Number of states */
+} chaos_strmatch_t;
+
+/**
+ * @brief One match.
+ */
+typedef struct
+{
+    chaos_size_t pattern;     /**< Index of the pattern in the build set */
+    chaos_size_t offset;      /**< Offset of the first matched character */
+    chaos_size_t len;         /**< Length of the match */
+} chaos_strmatch_hit_t;
+
+/**
+ * @brief Match callback.
+ * @return CHAOS_TRUE to keep scanning, CHAOS_FALSE to stop
+ */
+typedef chaos_bool_t (*chaos_strmatch_cb_t)(void *ctx, const chaos_strmatch_hit_t *hit);
+
+/* ============================================================= */
+/* MATCHER FUNCTIONS                                             */
+/* ============================================================= */
+
+/**
+ * @brief Arena size needed to build a pattern set.
+ * @param[in] patterns Patterns (each non-empty)
+ * @param[in] count Number of patterns
+ * @param[out] size Required arena size in bytes
+ */
+extern chaos_status_t chaos_strmatch_arena_size(const chaos_strview_t *patterns, chaos_size_t count, chaos_size_t *size);
+
+/**
+ * @brief Compile a pattern set into an automaton.
+ * @details Identical patterns are reported once, under the lowest index.
+ *          The arena must stay alive and unmodified while @p matcher is used.
+ * @param[out] matcher Matcher to initialise
+ * @param[in] patterns Patterns (each non-empty)
+ * @param[in] count Number of patterns
+ * @param[in] arena Caller-provided storage
+ * @param[in] arena_size Size of @p arena (see chaos_strmatch_arena_size())
+ */
+extern chaos_status_t chaos_strmatch_build(chaos_strmatch_t *matcher, const chaos_strview_t *patterns, chaos_size_t count, void *arena, chaos_size_t arena_size);
+
+/**
+ * @brief Report every pattern occurrence in a text.
+ * @details Matches are reported in order of their end offset; matches ending
+ *          at the same offset are reported longest first.
+ * @param[in] matcher Compiled matcher
+ * @param[in] text Text to scan
+ * @param[in] cb Called once per match
+ * @param[in] ctx Passed through to @p cb
+ */
+extern chaos_status_t chaos_strmatch_scan(const chaos_strmatch_t *matcher, const chaos_strview_t *text, chaos_strmatch_cb_t cb, void *ctx);
+
+/**
+ * @brief Test whether a text contains any of the patterns.
+ * @param[in] matcher Compiled matcher
+ * @param[in] text Text to scan
+ * @param[out] found CHAOS_TRUE if at least one pattern occurs
+ */
+extern chaos_status_t chaos_strmatch_any(const chaos_strmatch_t *matcher, const chaos_strview_t *text, chaos_bool_t *found);
+
+#endif /* CHAOS_STRMATCH_H */
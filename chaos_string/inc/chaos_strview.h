@@ -0,0 +1,117 @@
+/**
+ * @file chaos_strview.h
+ * @brief Non-owning string views for CHAOSLIB.
+ *
+ * A chaos_strview_t is a pointer and a length into someone else's buffer.
+ * Views are not null-terminated, never allocate, and stay valid only as
+ * long as the underlying buffer does.
+ */
+
+#ifndef CHAOS_STRVIEW_H
+#define CHAOS_STRVIEW_H
+
+#include "chaos_types.h"
+#include "chaos_status.h"
+
+/* ============================================================= */
+/* STRING VIEW TYPES                                             */
+/* ============================================================= */
+
+/**
+ * @brief Read-only window onto a run of characters.
+ */
+typedef struct
+{
+    const chaos_char_t *data; /**< First character (may be NULL when len is 0) */
+    chaos_size_t len;         /**< Number of characters */
+} chaos_strview_t;
+
+/**
+ * @brief Re-entrant split/tokenize iterator; all state lives here.
+ */
+typedef struct
+{
+    chaos_strview_t rest;     /**< Part of the input not consumed yet */
+    chaos_u32_t delims[8];    /**< Delimiter set, one bit per byte value */
+    chaos_bool_t skip_empty;  /**< CHAOS_TRUE: tokenize (drop empty fields) */
+    chaos_bool_t done;        /**< No more fields */
+} chaos_strview_iter_t;
+
+/* ============================================================= */
+/* STRING VIEW FUNCTIONS                                         */
+/* ============================================================= */
+
+/**
+ * @brief View a null-terminated string.
+ * @param[out] view Resulting view
+ * @param[in] str Null-terminated string
+ */
+extern chaos_status_t chaos_strview_from_cstr(chaos_strview_t *view, const chaos_cstr_t str);
+
+/**
+ * @brief Sub-view of len characters starting at start.
+ * @details @p len is clamped to the end of @p view.
+ * @param[in] view Source view
+ * @param[in] start Offset of the first character (at most view->len)
+ * @param[in] len Maximum number of characters
+ * @param[out] out Resulting view
+ */
+extern chaos_status_t chaos_strview_slice(const chaos_strview_t *view, chaos_size_t start, chaos_size_t len, chaos_strview_t *out);
+
+/**
+ * @brief Lexicographic comparison (unsigned bytes; a prefix sorts first).
+ * @param[in] a First view
+ * @param[in] b Second view
+ * @param[out] order Negative, zero or positive as a is below, equal to or above b
+ */
+extern chaos_status_t chaos_strview_compare(const chaos_strview_t *a, const chaos_strview_t *b, chaos_i32_t *order);
+
+/**
+ * @brief Test whether two views hold the same characters.
+ * @param[in] a First view
+ * @param[in] b Second view
+ * @param[out] equal CHAOS_TRUE if equal
+ */
+extern chaos_status_t chaos_strview_equal(const chaos_strview_t *a, const chaos_strview_t *b, chaos_bool_t *equal);
+
+/**
+ * @brief Test whether a view starts with a prefix.
+ * @param[in] view View to test
+ * @param[in] prefix Prefix
+ * @param[out] result CHAOS_TRUE if @p view starts with @p prefix
+ */
+extern chaos_status_t chaos_strview_starts_with(const chaos_strview_t *view, const chaos_strview_t *prefix, chaos_bool_t *result);
+
+/**
+ * @brief Test whether a view ends with a suffix.
+ * @param[in] view View to test
+ * @param[in] suffix Suffix
+ * @param[out] result CHAOS_TRUE if @p view ends with @p suffix
+ */
+extern chaos_status_t chaos_strview_ends_with(const chaos_strview_t *view, const chaos_strview_t *suffix, chaos_bool_t *result);
+
+/**
+ * @brief Drop leading and trailing ASCII whitespace (space, \\t, \\n, \\v, \\f, \\r).
+ * @param[in] view Source view
+ * @param[out] out Trimmed view (may be the same object as @p view)
+ */
+extern chaos_status_t chaos_strview_trim(const chaos_strview_t *view, chaos_strview_t *out);
+
+/**
+ * @brief Start splitting a view on a set of delimiter characters.
+ * @param[out] iter Iterator to initialise
+ * @param[in] view View to split (must outlive the iterator)
+ * @param[in] delims Delimiter characters (each byte is one delimiter)
+ * @param[in] skip_empty CHAOS_TRUE to drop empty fields (tokenize), CHAOS_FALSE to keep them (split)
+ */
+extern chaos_status_t chaos_strview_split_init(chaos_strview_iter_t *iter, const chaos_strview_t *view, const chaos_strview_t *delims, chaos_bool_t skip_empty);
+
+/**
+ * @brief Get the next field.
+ * @param[inout] iter Iterator
+ * @param[out] token Next field, pointing into the original buffer
+ * @param[out] found CHAOS_FALSE once the input is exhausted
+ */
+extern chaos_status_t chaos_strview_split_next(chaos_strview_iter_t *iter, chaos_strview_t *token, chaos_bool_t *found);
+
+#endif /* CHAOS_STRVIEW_H */
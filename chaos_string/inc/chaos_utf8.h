@@ -0,0 +1,43 @@
+/**
+ * @file chaos_utf8.h
+ * @brief UTF-8 validation and code point counting for CHAOSLIB.
+ *
+ * Validation follows RFC 3629: overlong forms, surrogates (U+D800 to
+ * U+DFFF), code points above U+10FFFF and truncated sequences are all
+ * rejected. Runs of ASCII are skipped a word or a vector at a time; with
+ * SSE4.1 or AVX2 the remaining bytes are checked by the vectorised
+ * lookup-table method (Keiser and Lemire), otherwise by a scalar decoder.
+ */
+
+#ifndef CHAOS_UTF8_H
+#define CHAOS_UTF8_H
+
+#include "chaos_types.h"
+#include "chaos_status.h"
+
+/* ============================================================= */
+/* UTF-8 FUNCTIONS                                               */
+/* ============================================================= */
+
+/**
+ * @brief Check that a buffer holds well-formed UTF-8.
+ * @param[in] str Bytes to check (may be NULL when size is 0)
+ * @param[in] size Number of bytes
+ * @param[out] valid CHAOS_TRUE if the whole buffer is well-formed
+ * @param[out] offset Length of the longest well-formed prefix, i.e. where
+ *             the first bad sequence starts (size when valid; may be NULL)
+ */
+extern chaos_status_t chaos_utf8_validate(const chaos_char_t *str, chaos_size_t size, chaos_bool_t *valid, chaos_size_t *offset);
+
+/**
+ * @brief Count the code points of a UTF-8 buffer.
+ * @details Counts every byte that is not a continuation byte, which is the
+ *          code point count for well-formed input. Validate first when the
+ *          input is untrusted.
+ * @param[in] str UTF-8 bytes (may be NULL when size is 0)
+ * @param[in] size Number of bytes
+ * @param[out] count Number of code points
+ */
+extern chaos_status_t chaos_utf8_count(const chaos_char_t *str, chaos_size_t size, chaos_size_t *count);
+
+#endif /* CHAOS_UTF8_H */
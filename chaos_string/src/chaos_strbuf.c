@@ -0,0 +1,303 @@
+/**
+ * @file chaos_strbuf.c
+ * @brief Implementation of the length-tracked string builder.
+ */
+
+#include "chaos_strbuf.h"
+#include "chaos_string.h"
+#include "chaos_memory.h"
+#include "chaos_assert.h"
+#include "chaos_std.h"
+
+#if (CHAOS_ENABLE_ALLOC == 1)
+#include "chaos_alloc.h"
+#endif
+
+/* Largest representable buffer size */
+#define CHAOS_STRBUF_SIZE_MAX ((chaos_size_t)~(chaos_size_t)0U)
+
+/* ============================================================= */
+/* FUNCTION PROTOTYPES                                          */
+/* ============================================================= */
+static chaos_size_t chaos_strbuf_reserve(chaos_strbuf_t *sb, chaos_size_t len);
+
+/* ============================================================= */
+/* INIT                                                          */
+/* ============================================================= */
+chaos_status_t chaos_strbuf_init(chaos_strbuf_t *sb, chaos_char_t *storage, chaos_size_t cap)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    chaos_assert_not_null(sb, &status, CHAOS_MODULE_STRING);
+    chaos_assert_not_null(storage, &status, CHAOS_MODULE_STRING);
+    chaos_assert_param((cap != 0U), &status, CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STRING, CHAOS_STRING_SIZE_ZERO);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        sb->data = storage;
+        sb->len = 0U;
+        sb->cap = cap;
+        sb->growable = CHAOS_FALSE;
+        sb->data[0] = CHAOS_CHAR_NULL;
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* INIT DYNAMIC                                                  */
+/* ============================================================= */
+chaos_status_t chaos_strbuf_init_dynamic(chaos_strbuf_t *sb, chaos_size_t cap)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    chaos_assert_not_null(sb, &status, CHAOS_MODULE_STRING);
+    chaos_assert_param((cap != 0U), &status, CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STRING, CHAOS_STRING_SIZE_ZERO);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+#if (CHAOS_ENABLE_ALLOC == 1)
+        void *storage = CHAOS_NULL;
+
+        status = chaos_alloc(cap, &storage);
+        if (status == CHAOS_STATUS_OK)
+        {
+            sb->data = (chaos_char_t *)storage;
+            sb->len = 0U;
+            sb->cap = cap;
+            sb->growable = CHAOS_TRUE;
+            sb->data[0] = CHAOS_CHAR_NULL;
+        }
+#else
+        status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STRING, CHAOS_ERRCLASS_NOT_SUPPORTED, CHAOS_STRING_UNKNOWN);
+#endif
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* FREE                                                          */
+/* ============================================================= */
+chaos_status_t chaos_strbuf_free(chaos_strbuf_t *sb)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    chaos_assert_not_null(sb, &status, CHAOS_MODULE_STRING);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+#if (CHAOS_ENABLE_ALLOC == 1)
+        if ((sb->growable == CHAOS_TRUE) && (sb->data != CHAOS_NULL))
+        {
+            status = chaos_free(sb->data);
+        }
+#endif
+        sb->data = CHAOS_NULL;
+        sb->len = 0U;
+        sb->cap = 0U;
+        sb->growable = CHAOS_FALSE;
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* RESET                                                         */
+/* ============================================================= */
+chaos_status_t chaos_strbuf_reset(chaos_strbuf_t *sb)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    chaos_assert_not_null(sb, &status, CHAOS_MODULE_STRING);
+    chaos_assert_not_null((sb != CHAOS_NULL) ? sb->data : CHAOS_NULL, &status, CHAOS_MODULE_STRING);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        sb->len = 0U;
+        sb->data[0] = CHAOS_CHAR_NULL;
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* APPEND                                                        */
+/* ============================================================= */
+chaos_status_t chaos_strbuf_append(chaos_strbuf_t *sb, const chaos_cstr_t str)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_size_t len = 0U;
+
+    chaos_assert_not_null(str, &status, CHAOS_MODULE_STRING);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        (void)chaos_strlen(str, &len);
+        status = chaos_strbuf_append_n(sb, str, len);
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* APPEND N                                                      */
+/* ============================================================= */
+chaos_status_t chaos_strbuf_append_n(chaos_strbuf_t *sb, const chaos_char_t *data, chaos_size_t len)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_size_t room = 0U;
+    chaos_uintptr_t offset = 0U;
+    chaos_bool_t inside = CHAOS_FALSE;
+
+    chaos_assert_not_null(sb, &status, CHAOS_MODULE_STRING);
+    chaos_assert_not_null((sb != CHAOS_NULL) ? sb->data : CHAOS_NULL, &status, CHAOS_MODULE_STRING);
+    chaos_assert_not_null(data, &status, CHAOS_MODULE_STRING);
+
+    if ((status == CHAOS_STATUS_OK) && (len != 0U))
+    {
+        /* Growing frees the old block, so data inside it is kept as an offset */
+        offset = (chaos_uintptr_t)data - (chaos_uintptr_t)sb->data;
+        if (((chaos_uintptr_t)data >= (chaos_uintptr_t)sb->data) && (offset < (chaos_uintptr_t)sb->cap))
+        {
+            inside = CHAOS_TRUE;
+        }
+
+        room = chaos_strbuf_reserve(sb, len);
+        if (inside == CHAOS_TRUE)
+        {
+            data = sb->data + offset;
+        }
+        if (room < len)
+        {
+            status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_WARNING, CHAOS_MODULE_STRING, CHAOS_ERRCLASS_OVERFLOW, CHAOS_STRING_TRUNCATED);
+        }
+        else
+        {
+            room = len;
+        }
+
+        if (room != 0U)
+        {
+            (void)chaos_memmove(sb->data + sb->len, data, room);
+            sb->len += room;
+        }
+        sb->data[sb->len] = CHAOS_CHAR_NULL;
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* APPEND CHAR                                                   */
+/* ============================================================= */
+chaos_status_t chaos_strbuf_append_char(chaos_strbuf_t *sb, chaos_char_t c)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    chaos_assert_not_null(sb, &status, CHAOS_MODULE_STRING);
+    chaos_assert_not_null((sb != CHAOS_NULL) ? sb->data : CHAOS_NULL, &status, CHAOS_MODULE_STRING);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        if (chaos_strbuf_reserve(sb, 1U) != 0U)
+        {
+            sb->data[sb->len] = c;
+            sb->len++;
+            sb->data[sb->len] = CHAOS_CHAR_NULL;
+        }
+        else
+        {
+            status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_WARNING, CHAOS_MODULE_STRING, CHAOS_ERRCLASS_OVERFLOW, CHAOS_STRING_TRUNCATED);
+        }
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* APPEND NUMBER                                                 */
+/* ============================================================= */
+chaos_status_t chaos_strbuf_append_u32(chaos_strbuf_t *sb, chaos_u32_t value)
+{
+    chaos_char_t digits[11];
+    chaos_size_t len = 0U;
+
+    (void)chaos_u32_to_str(value, digits, (chaos_size_t)sizeof(digits), &len);
+
+    return chaos_strbuf_append_n(sb, digits, len);
+}
+
+chaos_status_t chaos_strbuf_append_i32(chaos_strbuf_t *sb, chaos_i32_t value)
+{
+    chaos_char_t digits[12];
+    chaos_size_t len = 0U;
+
+    (void)chaos_i32_to_str(value, digits, (chaos_size_t)sizeof(digits), &len);
+
+    return chaos_strbuf_append_n(sb, digits, len);
+}
+
+/* ============================================================= */
+/* VIEW                                                          */
+/* ============================================================= */
+chaos_status_t chaos_strbuf_view(const chaos_strbuf_t *sb, chaos_cstr_t *str, chaos_size_t *len)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    chaos_assert_not_null(sb, &status, CHAOS_MODULE_STRING);
+    chaos_assert_not_null(str, &status, CHAOS_MODULE_STRING);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        *str = sb->data;
+        if (len != CHAOS_NULL)
+        {
+            *len = sb->len;
+        }
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* CAPACITY                                                      */
+/* ============================================================= */
+
+/*
+ * Make room for len more bytes plus the terminator, growing a dynamic
+ * buffer geometrically. Returns how many of those bytes fit.
+ */
+static chaos_size_t chaos_strbuf_reserve(chaos_strbuf_t *sb, chaos_size_t len)
+{
+    chaos_size_t room = sb->cap - sb->len - 1U;
+
+#if (CHAOS_ENABLE_ALLOC == 1)
+    chaos_size_t need;
+    chaos_size_t cap;
+    void *storage = CHAOS_NULL;
+
+    if ((room < len) && (sb->growable == CHAOS_TRUE) && (len <= (CHAOS_STRBUF_SIZE_MAX - sb->len - 1U)))
+    {
+        need = sb->len + len + 1U;
+        cap = (sb->cap <= (CHAOS_STRBUF_SIZE_MAX / 2U)) ? (sb->cap * 2U) : CHAOS_STRBUF_SIZE_MAX;
+        if (cap < need)
+        {
+            cap = need;
+        }
+
+        if (chaos_alloc(cap, &storage) == CHAOS_STATUS_OK)
+        {
+            (void)chaos_memcpy(storage, sb->data, sb->len + 1U);
+            (void)chaos_free(sb->data);
+            sb->data = (chaos_char_t *)storage;
+            sb->cap = cap;
+            room = cap - sb->len - 1U;
+        }
+    }
+#else
+    (void)len;
+#endif
+
+    return room;
+}
@@ -4,7 +4,99 @@
  */
 
 #include "chaos_string.h"
+#include "chaos_memory.h"
 #include "chaos_assert.h"
+#include "chaos_bits.h"
+
+#if (CHAOS_HAS_SSE2 == 1)
+#include <emmintrin.h>
+#endif
+#if (CHAOS_HAS_AVX2 == 1)
+#include <immintrin.h>
+#endif
+
+/* ============================================================= */
+/* FUNCTION PROTOTYPES                                          */
+/* ============================================================= */
+static chaos_size_t chaos_str_len(const chaos_u8_t *s);
+static chaos_i32_t chaos_str_cmp(const chaos_u8_t *a, const chaos_u8_t *b);
+static chaos_bool_t chaos_str_copy(chaos_u8_t *d, const chaos_u8_t *s, chaos_size_t max, chaos_size_t *copied);
+static chaos_size_t chaos_str_maxsuf(const chaos_u8_t *x, chaos_size_t m, chaos_bool_t reverse, chaos_size_t *period);
+static chaos_bool_t chaos_str_find(const chaos_u8_t *y, chaos_size_t n, const chaos_u8_t *x, chaos_size_t m, chaos_size_t *pos);
+
+/* ============================================================= */
+/* LENGTH KERNEL                                                 */
+/* ============================================================= */
+
+/*
+ * Every wide load below is aligned to its own size, so it never spans two
+ * pages: bytes read past the terminator (or before the start of the
+ * string) always share a page with a byte the caller owns.
+ */
+static chaos_size_t chaos_str_len(const chaos_u8_t *s)
+{
+    chaos_size_t len = 0U;
+
+#if (CHAOS_HAS_AVX2 == 1) || (CHAOS_HAS_SSE2 == 1)
+#if (CHAOS_HAS_AVX2 == 1)
+    const chaos_uintptr_t vmask = (chaos_uintptr_t)31U;
+    const __m256i zero = _mm256_setzero_si256();
+    const chaos_u8_t *p = (const chaos_u8_t *)((chaos_uintptr_t)s & ~vmask);
+    chaos_u32_t mask = (chaos_u32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256((const __m256i *)p), zero));
+#else
+    const chaos_uintptr_t vmask = (chaos_uintptr_t)15U;
+    const __m128i zero = _mm_setzero_si128();
+    const chaos_u8_t *p = (const chaos_u8_t *)((chaos_uintptr_t)s & ~vmask);
+    chaos_u32_t mask = (chaos_u32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128((const __m128i *)p), zero));
+#endif
+
+    /* Drop the lanes that precede the string in the first aligned block */
+    mask >>= (chaos_u32_t)((chaos_uintptr_t)s & vmask);
+    if (mask != 0U)
+    {
+        len = (chaos_size_t)chaos_u32_ctz(mask);
+    }
+    else
+    {
+        do
+        {
+            p += vmask + 1U;
+#if (CHAOS_HAS_AVX2 == 1)
+            mask = (chaos_u32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256((const __m256i *)p), zero));
+#else
+            mask = (chaos_u32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128((const __m128i *)p), zero));
+#endif
+        } while (mask == 0U);
+
+        len = (chaos_size_t)((chaos_uintptr_t)(p - s) + chaos_u32_ctz(mask));
+    }
+#else
+    const chaos_u8_t *p = s;
+    chaos_word_t zeros = 0U;
+
+    /* Bytewise up to the first word boundary */
+    while ((((chaos_uintptr_t)p & CHAOS_WORD_MASK) != 0U) && (*p != CHAOS_CHAR_NULL))
+    {
+        p++;
+    }
+
+    if (*p != CHAOS_CHAR_NULL)
+    {
+        /* Aligned words: one zero-lane test per step */
+        zeros = chaos_word_zero_lanes(chaos_word_load(p));
+        while (zeros == 0U)
+        {
+            p += CHAOS_WORD_SIZE;
+            zeros = chaos_word_zero_lanes(chaos_word_load(p));
+        }
+        p += chaos_word_first_lane(zeros);
+    }
+
+    len = (chaos_size_t)(p - s);
+#endif
+
+    return len;
+}
 
 /* ============================================================= */
 /* STRLEN                                                        */
@@ -15,21 +107,136 @@ chaos_status_t chaos_strlen(
 )
 {
     chaos_status_t status = CHAOS_STATUS_OK;
-    chaos_size_t count = 0U;
 
     chaos_assert_not_null(str, &status, CHAOS_MODULE_STRING);
     chaos_assert_not_null(len, &status, CHAOS_MODULE_STRING);
 
     if (status == CHAOS_STATUS_OK)
     {
-        while (str[count] != CHAOS_CHAR_NULL)
+        *len = chaos_str_len(str);
+    }
+    return status;
+}
+
+/* ============================================================= */
+/* COMPARE KERNEL                                                */
+/* ============================================================= */
+
+/*
+ * Compares a block at a time and drops to bytes only inside the block that
+ * holds the first difference or terminator. Blocks are loaded only when
+ * neither read crosses a page; otherwise a single byte step is taken.
+ */
+static chaos_i32_t chaos_str_cmp(const chaos_u8_t *a, const chaos_u8_t *b)
+{
+#if (CHAOS_HAS_SSE2 == 1)
+    const chaos_size_t step = 16U;
+    const __m128i zero = _mm_setzero_si128();
+    __m128i va;
+    chaos_u32_t mask;
+#else
+    const chaos_size_t step = CHAOS_WORD_SIZE;
+    chaos_word_t wa;
+    chaos_word_t wb;
+#endif
+    chaos_bool_t stop = CHAOS_FALSE;
+
+    while (stop == CHAOS_FALSE)
+    {
+        if ((chaos_page_fits(a, step) == CHAOS_TRUE) && (chaos_page_fits(b, step) == CHAOS_TRUE))
+        {
+#if (CHAOS_HAS_SSE2 == 1)
+            va = _mm_loadu_si128((const __m128i *)a);
+            /* Lanes that differ or hold the terminator */
+            mask = (chaos_u32_t)_mm_movemask_epi8(_mm_or_si128(
+                       _mm_xor_si128(_mm_cmpeq_epi8(va, _mm_loadu_si128((const __m128i *)b)), _mm_set1_epi8(-1)),
+                       _mm_cmpeq_epi8(va, zero)));
+            if (mask != 0U)
+            {
+                a += chaos_u32_ctz(mask);
+                b += chaos_u32_ctz(mask);
+                stop = CHAOS_TRUE;
+            }
+#else
+            wa = chaos_word_loadu(a);
+            wb = chaos_word_loadu(b);
+            if (((wa ^ wb) | chaos_word_zero_lanes(wa)) != 0U)
+            {
+                /* The difference or terminator lies in this word */
+                while ((*a == *b) && (*a != CHAOS_CHAR_NULL))
+                {
+                    a++;
+                    b++;
+                }
+                stop = CHAOS_TRUE;
+            }
+#endif
+            if (stop == CHAOS_FALSE)
+            {
+                a += step;
+                b += step;
+            }
+        }
+        else if ((*a != *b) || (*a == CHAOS_CHAR_NULL))
         {
-            count++;
+            stop = CHAOS_TRUE;
         }
+        else
+        {
+            a++;
+            b++;
+        }
+    }
 
-        *len = count;
+    return (chaos_i32_t)*a - (chaos_i32_t)*b;
+}
+
+/* ============================================================= */
+/* COPY KERNEL                                                   */
+/* ============================================================= */
+
+/*
+ * Copies at most max characters of s to d and terminates d. Source words
+ * are loaded aligned (so never across a page) and stored whole until one
+ * holds the terminator or the room runs out; the rest goes bytewise.
+ * Returns CHAOS_TRUE when the whole source fitted.
+ */
+static chaos_bool_t chaos_str_copy(chaos_u8_t *d, const chaos_u8_t *s, chaos_size_t max, chaos_size_t *copied)
+{
+    chaos_size_t n = 0U;
+    chaos_word_t w;
+
+    /* Bytewise up to the first source word boundary */
+    while ((n < max) && ((((chaos_uintptr_t)(s + n)) & CHAOS_WORD_MASK) != 0U) && (s[n] != CHAOS_CHAR_NULL))
+    {
+        d[n] = s[n];
+        n++;
     }
-    return status;
+
+    if ((((chaos_uintptr_t)(s + n)) & CHAOS_WORD_MASK) == 0U)
+    {
+        while ((max - n) >= CHAOS_WORD_SIZE)
+        {
+            w = chaos_word_load(s + n);
+            if (chaos_word_zero_lanes(w) != 0U)
+            {
+                break;
+            }
+            chaos_word_storeu(d + n, w);
+            n += CHAOS_WORD_SIZE;
+        }
+    }
+
+    while ((n < max) && (s[n] != CHAOS_CHAR_NULL))
+    {
+        d[n] = s[n];
+        n++;
+    }
+
+    d[n] = CHAOS_CHAR_NULL;
+    *copied = n;
+
+    return (s[n] == CHAOS_CHAR_NULL) ? CHAOS_TRUE : CHAOS_FALSE;
 }
 
 /* ============================================================= */
@@ -40,9 +247,25 @@ chaos_status_t chaos_strcpy(
     const chaos_cstr_t src,
     chaos_size_t dst_size
 )
+{
+    chaos_size_t written = 0U;
+
+    return chaos_strcpy_len(dst, src, dst_size, &written, CHAOS_NULL);
+}
+
+/* ============================================================= */
+/* STRCPY LEN                                                    */
+/* ============================================================= */
+chaos_status_t chaos_strcpy_len(
+    chaos_cstr_t dst,
+    const chaos_cstr_t src,
+    chaos_size_t dst_size,
+    chaos_size_t *written,
+    chaos_size_t *src_len
+)
 {
     chaos_status_t status = CHAOS_STATUS_OK;
-    chaos_size_t i = 0U;
+    chaos_size_t copied = 0U;
 
     chaos_assert_not_null(dst, &status, CHAOS_MODULE_STRING);
     chaos_assert_not_null(src, &status, CHAOS_MODULE_STRING);
@@ -50,17 +273,7 @@ chaos_status_t chaos_strcpy(
 
     if (status == CHAOS_STATUS_OK)
     {
-        while ((src[i] != CHAOS_CHAR_NULL) && (i < (dst_size - 1U)))
-        {
-            dst[i] = src[i];
-            i++;
-        }
-
-        /* Always null-terminate */
-        dst[i] = CHAOS_CHAR_NULL;
-
-        /* Detect truncation */
-        if (src[i] != CHAOS_CHAR_NULL)
+        if (chaos_str_copy(dst, src, dst_size - 1U, &copied) == CHAOS_FALSE)
         {
             status = CHAOS_STATUS_MAKE(
                 CHAOS_SEVERITY_WARNING,
@@ -69,6 +282,16 @@ chaos_status_t chaos_strcpy(
                 CHAOS_STRING_TRUNCATED
             );
         }
+
+        if (written != CHAOS_NULL)
+        {
+            *written = copied;
+        }
+        if (src_len != CHAOS_NULL)
+        {
+            /* Only the part that did not fit is scanned a second time */
+            *src_len = copied + chaos_str_len(src + copied);
+        }
     }
     return status;
 }
@@ -82,10 +305,27 @@ chaos_status_t chaos_strcat(
     const chaos_cstr_t src,
     chaos_size_t dst_size
 )
+{
+    chaos_size_t written = 0U;
+
+    return chaos_strcat_len(dst, src, dst_size, &written, CHAOS_NULL);
+}
+
+/* ============================================================= */
+/* STRCAT LEN                                                    */
+/* ============================================================= */
+chaos_status_t chaos_strcat_len(
+    chaos_cstr_t dst,
+    const chaos_cstr_t src,
+    chaos_size_t dst_size,
+    chaos_size_t *written,
+    chaos_size_t *src_len
+)
 {
     chaos_status_t status = CHAOS_STATUS_OK;
     chaos_size_t dst_len = 0U;
-    chaos_size_t i = 0U;
+    chaos_size_t copied = 0U;
+    chaos_bool_t terminated = CHAOS_FALSE;
 
     chaos_assert_not_null(dst, &status, CHAOS_MODULE_STRING);
     chaos_assert_not_null(src, &status, CHAOS_MODULE_STRING);
@@ -97,13 +337,10 @@ chaos_status_t chaos_strcat(
     if (status == CHAOS_STATUS_OK)
     {
         /* Find end of dst */
-        while ((dst_len < dst_size) && (dst[dst_len] != CHAOS_CHAR_NULL))
-        {
-            dst_len++;
-        }
+        (void)chaos_memchr(dst, dst_size, CHAOS_CHAR_NULL, &dst_len, &terminated);
 
         /* dst not null-terminated within dst_size */
-        if (dst_len >= dst_size)
+        if (terminated == CHAOS_FALSE)
         {
             status = CHAOS_STATUS_MAKE(
                 CHAOS_SEVERITY_ERROR,
@@ -115,18 +352,7 @@ chaos_status_t chaos_strcat(
         else
         {
             /* Append src */
-            while ((src[i] != CHAOS_CHAR_NULL) &&
-                   ((dst_len + i) < (dst_size - 1U)))
-            {
-                dst[dst_len + i] = src[i];
-                i++;
-            }
-
-            /* Always null-terminate */
-            dst[dst_len + i] = CHAOS_CHAR_NULL;
-
-            /* Detect truncation */
-            if (src[i] != CHAOS_CHAR_NULL)
+            if (chaos_str_copy(dst + dst_len, src, (dst_size - 1U) - dst_len, &copied) == CHAOS_FALSE)
             {
                 status = CHAOS_STATUS_MAKE(
                     CHAOS_SEVERITY_WARNING,
@@ -135,6 +361,15 @@ chaos_status_t chaos_strcat(
                     CHAOS_STRING_TRUNCATED
                 );
             }
+
+            if (written != CHAOS_NULL)
+            {
+                *written = copied;
+            }
+            if (src_len != CHAOS_NULL)
+            {
+                *src_len = copied + chaos_str_len(src + copied);
+            }
         }
     }
 
@@ -152,31 +387,40 @@ chaos_status_t chaos_strcmp(
 )
 {
     chaos_status_t status = CHAOS_STATUS_OK;
-    chaos_size_t i = 0U;
+    chaos_i32_t order = 0;
 
-    chaos_assert_not_null(str1, &status, CHAOS_MODULE_STRING);
-    chaos_assert_not_null(str2, &status, CHAOS_MODULE_STRING);
     chaos_assert_not_null(equal, &status, CHAOS_MODULE_STRING);
 
     if (status == CHAOS_STATUS_OK)
     {
-        *equal = CHAOS_TRUE;
-
-        while ((str1[i] != CHAOS_CHAR_NULL) &&
-               (str2[i] != CHAOS_CHAR_NULL) &&
-               (*equal == CHAOS_TRUE))
+        status = chaos_strcmp_order(str1, str2, &order);
+        if (status == CHAOS_STATUS_OK)
         {
-            if (str1[i] != str2[i])
-            {
-                *equal = CHAOS_FALSE;
-            }
-            i++;
+            *equal = (order == 0) ? CHAOS_TRUE : CHAOS_FALSE;
         }
+    }
 
-        if (str1[i] != str2[i])
-        {
-            *equal = CHAOS_FALSE;
-        }
+    return status;
+}
+
+/* ============================================================= */
+/* STRCMP ORDER                                                  */
+/* ============================================================= */
+chaos_status_t chaos_strcmp_order(
+    const chaos_cstr_t str1,
+    const chaos_cstr_t str2,
+    chaos_i32_t *order
+)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    chaos_assert_not_null(str1, &status, CHAOS_MODULE_STRING);
+    chaos_assert_not_null(str2, &status, CHAOS_MODULE_STRING);
+    chaos_assert_not_null(order, &status, CHAOS_MODULE_STRING);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        *order = chaos_str_cmp(str1, str2);
     }
 
     return status;
@@ -191,46 +435,187 @@ chaos_status_t chaos_strstr(
     const chaos_cstr_t substr,
     chaos_bool_t *found
 )
+{
+    chaos_size_t pos = 0U;
+
+    return chaos_strstr_pos(str, substr, &pos, found);
+}
+
+/* ============================================================= */
+/* STRSTR POS                                                    */
+/* ============================================================= */
+chaos_status_t chaos_strstr_pos(
+    const chaos_cstr_t str,
+    const chaos_cstr_t substr,
+    chaos_size_t *pos,
+    chaos_bool_t *found
+)
 {
     chaos_status_t status = CHAOS_STATUS_OK;
-    chaos_size_t i = 0U;
-    chaos_size_t j = 0U;
+    chaos_size_t n = 0U;
+    chaos_size_t m = 0U;
 
     chaos_assert_not_null(str, &status, CHAOS_MODULE_STRING);
     chaos_assert_not_null(substr, &status, CHAOS_MODULE_STRING);
+    chaos_assert_not_null(pos, &status, CHAOS_MODULE_STRING);
     chaos_assert_not_null(found, &status, CHAOS_MODULE_STRING);
 
     if (status == CHAOS_STATUS_OK)
     {
+        n = chaos_str_len(str);
+        m = chaos_str_len(substr);
+        *pos = n;
         *found = CHAOS_FALSE;
 
         /* Empty substring always matches */
-        if (substr[0] == CHAOS_CHAR_NULL)
+        if (m == 0U)
         {
+            *pos = 0U;
             *found = CHAOS_TRUE;
         }
+        else if (m <= n)
+        {
+            *found = chaos_str_find(str, n, substr, m, pos);
+        }
         else
         {
-            while ((str[i] != CHAOS_CHAR_NULL) && (*found == CHAOS_FALSE))
+            /* Substring longer than string: no match */
+        }
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* TWO-WAY SEARCH                                                */
+/* ============================================================= */
+
+/*
+ * Crochemore-Perrin Two-Way matching: O(n + m) time, O(1) space.
+ * Indices below are stored one past their textbook value (ms, ell and
+ * memory start at -1 in the paper) so that everything stays unsigned.
+ */
+
+/* Start of the maximal suffix of x for the byte order (or its reverse) */
+static chaos_size_t chaos_str_maxsuf(const chaos_u8_t *x, chaos_size_t m, chaos_bool_t reverse, chaos_size_t *period)
+{
+    chaos_size_t ms = 0U;
+    chaos_size_t j = 0U;
+    chaos_size_t k = 1U;
+    chaos_size_t p = 1U;
+    chaos_u8_t a;
+    chaos_u8_t b;
+
+    while ((j + k) < m)
+    {
+        a = x[j + k];
+        b = x[(ms + k) - 1U];
+        if ((reverse == CHAOS_FALSE) ? (a < b) : (a > b))
+        {
+            /* Suffix is smaller: the period extends over everything seen */
+            j += k;
+            k = 1U;
+            p = (j + 1U) - ms;
+        }
+        else if (a == b)
+        {
+            if (k != p)
+            {
+                k++;
+            }
+            else
             {
-                j = 0U;
+                j += p;
+                k = 1U;
+            }
+        }
+        else
+        {
+            /* Suffix is larger: restart from it */
+            ms = j + 1U;
+            j = ms;
+            k = 1U;
+            p = 1U;
+        }
+    }
 
-                while ((substr[j] != CHAOS_CHAR_NULL) &&
-                       (str[i + j] != CHAOS_CHAR_NULL) &&
-                       (str[i + j] == substr[j]))
-                {
-                    j++;
-                }
+    *period = p;
+    return ms;
+}
 
-                if (substr[j] == CHAOS_CHAR_NULL)
-                {
-                    *found = CHAOS_TRUE;
-                }
+static chaos_bool_t chaos_str_find(const chaos_u8_t *y, chaos_size_t n, const chaos_u8_t *x, chaos_size_t m, chaos_size_t *pos)
+{
+    chaos_bool_t found = CHAOS_FALSE;
+    chaos_size_t p = 0U;
+    chaos_size_t q = 0U;
+    chaos_size_t ell = chaos_str_maxsuf(x, m, CHAOS_FALSE, &p);
+    chaos_size_t ell_rev = chaos_str_maxsuf(x, m, CHAOS_TRUE, &q);
+    chaos_size_t per;
+    chaos_size_t mem = 0U;
+    chaos_size_t i;
+    chaos_size_t j = 0U;
+    chaos_bool_t periodic;
+
+    /* Critical factorisation x = x[0, ell) x[ell, m) */
+    if (ell_rev >= ell)
+    {
+        ell = ell_rev;
+        per = q;
+    }
+    else
+    {
+        per = p;
+    }
+
+    periodic = CHAOS_TRUE;
+    for (i = 0U; (i < ell) && (periodic == CHAOS_TRUE); i++)
+    {
+        if (x[i] != x[i + per])
+        {
+            periodic = CHAOS_FALSE;
+        }
+    }
+    if (periodic == CHAOS_FALSE)
+    {
+        /* Left half is not periodic: shift past the longer half on a match */
+        per = ((ell > (m - ell)) ? ell : (m - ell)) + 1U;
+    }
+
+    while (((j + m) <= n) && (found == CHAOS_FALSE))
+    {
+        /* Right half, left to right (skipping a prefix known to match) */
+        i = (mem > ell) ? mem : ell;
+        while ((i < m) && (x[i] == y[i + j]))
+        {
+            i++;
+        }
 
-                i++;
+        if (i < m)
+        {
+            j += (i - ell) + 1U;
+            mem = 0U;
+        }
+        else
+        {
+            /* Left half, right to left */
+            i = ell;
+            while ((i > mem) && (x[i - 1U] == y[(i - 1U) + j]))
+            {
+                i--;
+            }
+
+            if (i <= mem)
+            {
+                *pos = j;
+                found = CHAOS_TRUE;
+            }
+            else
+            {
+                j += per;
+                mem = (periodic == CHAOS_TRUE) ? (m - per) : 0U;
             }
         }
     }
 
-    return status;
+    return found;
 }
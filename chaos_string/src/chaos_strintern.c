@@ -0,0 +1,378 @@
+/**
+ * @file chaos_strintern.c
+ * @brief Implementation of the string intern table.
+ */
+
+#include "chaos_strintern.h"
+#include "chaos_memory.h"
+#include "chaos_assert.h"
+
+#if (CHAOS_ENABLE_ALLOC == 1)
+#include "chaos_alloc.h"
+#endif
+
+/* ============================================================= */
+/* CONSTANTS                                                     */
+/* ============================================================= */
+
+/* Region alignment (the table holds 32-bit fields only) */
+#define CHAOS_STRINTERN_ALIGN ((chaos_uintptr_t)sizeof(chaos_u32_t))
+
+/* FNV-1a parameters */
+#define CHAOS_STRINTERN_FNV_BASIS 0x811C9DC5U
+#define CHAOS_STRINTERN_FNV_PRIME 0x01000193U
+
+/* ============================================================= */
+/* FUNCTION PROTOTYPES                                          */
+/* ============================================================= */
+static chaos_u32_t chaos_strintern_hash(const chaos_char_t *data, chaos_size_t len);
+static chaos_size_t chaos_strintern_probe(const chaos_strintern_t *table, const chaos_strview_t *str, chaos_u32_t hash, chaos_size_t *probes);
+static void chaos_strintern_layout(chaos_strintern_t *table, void *region, chaos_size_t region_size, chaos_size_t slot_count, chaos_status_t *status);
+static void chaos_strintern_check(const chaos_strintern_t *table, const chaos_strview_t *str, chaos_status_t *status);
+
+/* ============================================================= */
+/* INIT                                                          */
+/* ============================================================= */
+chaos_status_t chaos_strintern_init(chaos_strintern_t *table, void *region, chaos_size_t region_size, chaos_size_t slot_count)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    chaos_assert_not_null(table, &status, CHAOS_MODULE_STRING);
+    chaos_assert_not_null(region, &status, CHAOS_MODULE_STRING);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        chaos_strintern_layout(table, region, region_size, slot_count, &status);
+        table->region = CHAOS_NULL;
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* INIT DYNAMIC                                                  */
+/* ============================================================= */
+chaos_status_t chaos_strintern_init_dynamic(chaos_strintern_t *table, chaos_size_t slot_count, chaos_size_t pool_size)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    chaos_assert_not_null(table, &status, CHAOS_MODULE_STRING);
+    chaos_assert_param((pool_size != 0U), &status, CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STRING, CHAOS_STRING_SIZE_ZERO);
+
+    /* Checked before allocating: the size below and the probe mask rely on it */
+    if ((status == CHAOS_STATUS_OK) &&
+        ((slot_count < 4U) || (slot_count > CHAOS_STRINTERN_SLOTS_MAX) || ((slot_count & (slot_count - 1U)) != 0U)))
+    {
+        status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STRING, CHAOS_ERRCLASS_OUT_OF_RANGE, CHAOS_STRING_OUT_OF_RANGE);
+    }
+
+    if (status == CHAOS_STATUS_OK)
+    {
+#if (CHAOS_ENABLE_ALLOC == 1)
+        void *region = CHAOS_NULL;
+        chaos_size_t size = (slot_count * (chaos_size_t)sizeof(chaos_strintern_slot_t))
+                            + ((slot_count - (slot_count / 4U)) * (chaos_size_t)sizeof(chaos_strintern_entry_t));
+
+        if (pool_size > (chaos_u32_t_MAX - size))
+        {
+            status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STRING, CHAOS_ERRCLASS_OVERFLOW, CHAOS_STRING_OUT_OF_RANGE);
+        }
+        else
+        {
+            size += pool_size;
+            status = chaos_alloc(size, &region);
+        }
+
+        if (status == CHAOS_STATUS_OK)
+        {
+            chaos_strintern_layout(table, region, size, slot_count, &status);
+            if (status == CHAOS_STATUS_OK)
+            {
+                table->region = region;
+            }
+            else
+            {
+                (void)chaos_free(region);
+            }
+        }
+#else
+        status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STRING, CHAOS_ERRCLASS_NOT_SUPPORTED, CHAOS_STRING_UNKNOWN);
+#endif
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* FREE                                                          */
+/* ============================================================= */
+chaos_status_t chaos_strintern_free(chaos_strintern_t *table)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    chaos_assert_not_null(table, &status, CHAOS_MODULE_STRING);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+#if (CHAOS_ENABLE_ALLOC == 1)
+        if (table->region != CHAOS_NULL)
+        {
+            status = chaos_free(table->region);
+        }
+#endif
+        table->slots = CHAOS_NULL;
+        table->entries = CHAOS_NULL;
+        table->pool = CHAOS_NULL;
+        table->slot_count = 0U;
+        table->capacity = 0U;
+        table->count = 0U;
+        table->pool_size = 0U;
+        table->pool_used = 0U;
+        table->region = CHAOS_NULL;
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* ADD                                                           */
+/* ============================================================= */
+chaos_status_t chaos_strintern_add(chaos_strintern_t *table, const chaos_strview_t *str, chaos_strid_t *id)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_strintern_entry_t *entry;
+    chaos_u32_t hash = 0U;
+    chaos_size_t slot = 0U;
+    chaos_size_t probes = 0U;
+
+    chaos_strintern_check(table, str, &status);
+    chaos_assert_not_null(id, &status, CHAOS_MODULE_STRING);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        hash = chaos_strintern_hash(str->data, str->len);
+        slot = chaos_strintern_probe(table, str, hash, &probes);
+
+        if (table->slots[slot].id != CHAOS_STRID_NONE)
+        {
+            *id = table->slots[slot].id;
+        }
+        else if ((table->count >= table->capacity) || (str->len >= (table->pool_size - table->pool_used)))
+        {
+            status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STRING, CHAOS_ERRCLASS_OVERFLOW, CHAOS_STRING_TRUNCATED);
+        }
+        else
+        {
+            entry = &table->entries[table->count];
+            entry->offset = (chaos_u32_t)table->pool_used;
+            entry->len = (chaos_u32_t)str->len;
+            if (str->len != 0U)
+            {
+                (void)chaos_memcpy(&table->pool[table->pool_used], str->data, str->len);
+            }
+            table->pool[table->pool_used + str->len] = CHAOS_CHAR_NULL;
+            table->pool_used += str->len + 1U;
+
+            table->count++;
+            table->slots[slot].hash = hash;
+            table->slots[slot].id = (chaos_strid_t)table->count;
+
+            table->probe_total += probes;
+            table->probe_max = (probes > table->probe_max) ? probes : table->probe_max;
+            *id = (chaos_strid_t)table->count;
+        }
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* FIND                                                          */
+/* ============================================================= */
+chaos_status_t chaos_strintern_find(const chaos_strintern_t *table, const chaos_strview_t *str, chaos_strid_t *id)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_size_t probes = 0U;
+
+    chaos_strintern_check(table, str, &status);
+    chaos_assert_not_null(id, &status, CHAOS_MODULE_STRING);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        *id = table->slots[chaos_strintern_probe(table, str, chaos_strintern_hash(str->data, str->len), &probes)].id;
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* GET                                                           */
+/* ============================================================= */
+chaos_status_t chaos_strintern_get(const chaos_strintern_t *table, chaos_strid_t id, chaos_strview_t *str)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    chaos_assert_not_null(table, &status, CHAOS_MODULE_STRING);
+    chaos_assert_not_null(str, &status, CHAOS_MODULE_STRING);
+
+    if ((status == CHAOS_STATUS_OK) && ((id == CHAOS_STRID_NONE) || (id > table->count)))
+    {
+        status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STRING, CHAOS_ERRCLASS_OUT_OF_RANGE, CHAOS_STRING_OUT_OF_RANGE);
+    }
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        str->data = &table->pool[table->entries[id - 1U].offset];
+        str->len = table->entries[id - 1U].len;
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* STATS                                                         */
+/* ============================================================= */
+chaos_status_t chaos_strintern_stats(const chaos_strintern_t *table, chaos_strintern_stats_t *stats)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    chaos_assert_not_null(table, &status, CHAOS_MODULE_STRING);
+    chaos_assert_not_null(stats, &status, CHAOS_MODULE_STRING);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        stats->count = table->count;
+        stats->capacity = table->capacity;
+        stats->slot_count = table->slot_count;
+        stats->load_permille = (table->slot_count != 0U) ? (chaos_u32_t)((table->count * 1000U) / table->slot_count) : 0U;
+        stats->probe_avg_x100 = (table->count != 0U)
+                                ? (chaos_u32_t)(((table->probe_total / table->count) * 100U) + (((table->probe_total % table->count) * 100U) / table->count))
+                                : 0U;
+        stats->probe_max = table->probe_max;
+        stats->pool_used = table->pool_used;
+        stats->pool_size = table->pool_size;
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* INTERNAL HELPERS                                              */
+/* ============================================================= */
+
+static chaos_u32_t chaos_strintern_hash(const chaos_char_t *data, chaos_size_t len)
+{
+    chaos_u32_t hash = CHAOS_STRINTERN_FNV_BASIS;
+    chaos_size_t i;
+
+    for (i = 0U; i < len; i++)
+    {
+        hash ^= (chaos_u32_t)data[i];
+        hash *= CHAOS_STRINTERN_FNV_PRIME;
+    }
+
+    return hash;
+}
+
+/* Slot holding str, or the empty slot where it belongs; probes counts the slots visited */
+static chaos_size_t chaos_strintern_probe(const chaos_strintern_t *table, const chaos_strview_t *str, chaos_u32_t hash, chaos_size_t *probes)
+{
+    const chaos_strintern_slot_t *slot;
+    const chaos_strintern_entry_t *entry;
+    chaos_size_t mask = table->slot_count - 1U;
+    chaos_size_t index = (chaos_size_t)hash & mask;
+    chaos_bool_t equal = CHAOS_FALSE;
+    chaos_bool_t done = CHAOS_FALSE;
+
+    *probes = 0U;
+
+    /* The load limit keeps an empty slot, so the walk always ends */
+    while (done == CHAOS_FALSE)
+    {
+        slot = &table->slots[index];
+        (*probes)++;
+
+        if (slot->id == CHAOS_STRID_NONE)
+        {
+            done = CHAOS_TRUE;
+        }
+        else if (slot->hash == hash)
+        {
+            entry = &table->entries[slot->id - 1U];
+            equal = (entry->len == str->len) ? CHAOS_TRUE : CHAOS_FALSE;
+            if ((equal == CHAOS_TRUE) && (str->len != 0U))
+            {
+                (void)chaos_memcmp(&table->pool[entry->offset], str->data, str->len, &equal);
+            }
+            done = equal;
+        }
+        else
+        {
+            /* Keep probing */
+        }
+
+        if (done == CHAOS_FALSE)
+        {
+            index = (index + 1U) & mask;
+        }
+    }
+
+    return index;
+}
+
+static void chaos_strintern_layout(chaos_strintern_t *table, void *region, chaos_size_t region_size, chaos_size_t slot_count, chaos_status_t *status)
+{
+    chaos_u8_t *base = (chaos_u8_t *)region;
+    chaos_size_t pad = (chaos_size_t)((CHAOS_STRINTERN_ALIGN - ((chaos_uintptr_t)base & (CHAOS_STRINTERN_ALIGN - 1U))) & (CHAOS_STRINTERN_ALIGN - 1U));
+    chaos_size_t capacity = slot_count - (slot_count / 4U);
+    chaos_size_t fixed;
+    chaos_size_t i;
+
+    /* Not an assertion: the probe loop masks with slot_count - 1 */
+    if ((slot_count < 4U) || (slot_count > CHAOS_STRINTERN_SLOTS_MAX) || ((slot_count & (slot_count - 1U)) != 0U))
+    {
+        *status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STRING, CHAOS_ERRCLASS_OUT_OF_RANGE, CHAOS_STRING_OUT_OF_RANGE);
+    }
+
+    fixed = pad + (slot_count * (chaos_size_t)sizeof(chaos_strintern_slot_t)) + (capacity * (chaos_size_t)sizeof(chaos_strintern_entry_t));
+
+    /* Room for at least one empty string */
+    if ((*status == CHAOS_STATUS_OK) && (region_size <= fixed))
+    {
+        *status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STRING, CHAOS_ERRCLASS_OVERFLOW, CHAOS_STRING_TRUNCATED);
+    }
+
+    if (*status == CHAOS_STATUS_OK)
+    {
+        table->slots = (chaos_strintern_slot_t *)(void *)(base + pad);
+        table->entries = (chaos_strintern_entry_t *)(void *)(table->slots + slot_count);
+        table->pool = (chaos_char_t *)(void *)(table->entries + capacity);
+        table->slot_count = slot_count;
+        table->capacity = capacity;
+        table->count = 0U;
+        table->pool_size = region_size - fixed;
+        table->pool_used = 0U;
+        table->probe_total = 0U;
+        table->probe_max = 0U;
+
+        for (i = 0U; i < slot_count; i++)
+        {
+            table->slots[i].hash = 0U;
+            table->slots[i].id = CHAOS_STRID_NONE;
+        }
+    }
+}
+
+static void chaos_strintern_check(const chaos_strintern_t *table, const chaos_strview_t *str, chaos_status_t *status)
+{
+    chaos_assert_not_null(table, status, CHAOS_MODULE_STRING);
+    chaos_assert_not_null(str, status, CHAOS_MODULE_STRING);
+    if ((str != CHAOS_NULL) && (str->len != 0U))
+    {
+        chaos_assert_not_null(str->data, status, CHAOS_MODULE_STRING);
+    }
+    if ((*status == CHAOS_STATUS_OK) && (table->slots == CHAOS_NULL))
+    {
+        *status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STRING, CHAOS_ERRCLASS_NULL_PTR, CHAOS_STRING_NULL_PTR);
+    }
+}
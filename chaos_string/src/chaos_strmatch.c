@@ -0,0 +1,412 @@
+/**
+ * @file chaos_strmatch.c
+ * @brief Implementation of the Aho-Corasick multi-pattern matcher.
+ */
+
+#include "chaos_strmatch.h"
+#include "chaos_assert.h"
+#include "chaos_bits.h"
+
+/* ============================================================= */
+/* CONSTANTS                                                     */
+/* ============================================================= */
+
+/* Arena alignment (the automaton holds 32-bit fields only) */
+#define CHAOS_STRMATCH_ALIGN ((chaos_uintptr_t)sizeof(chaos_u32_t))
+
+/* Size of the dense root row */
+#define CHAOS_STRMATCH_ROOT_SIZE (256U * (chaos_size_t)sizeof(chaos_u32_t))
+
+/* ============================================================= */
+/* FUNCTION PROTOTYPES                                          */
+/* ============================================================= */
+static chaos_bool_t chaos_strmatch_has(const chaos_strmatch_node_t *node, chaos_u8_t c);
+static chaos_u32_t chaos_strmatch_child(const chaos_strmatch_node_t *node, chaos_u8_t c);
+static chaos_u32_t chaos_strmatch_step(const chaos_strmatch_t *matcher, chaos_u32_t state, chaos_u8_t c);
+static void chaos_strmatch_sort(const chaos_strview_t *patterns, chaos_u32_t *idx, chaos_size_t count);
+static void chaos_strmatch_trie(chaos_strmatch_node_t *nodes, const chaos_strview_t *patterns, const chaos_u32_t *idx, chaos_u32_t *lo, chaos_u32_t *hi, chaos_size_t count, chaos_size_t *node_count);
+static void chaos_strmatch_links(chaos_strmatch_node_t *nodes, chaos_u32_t *root_next, chaos_size_t node_count);
+static chaos_bool_t chaos_strmatch_stop(void *ctx, const chaos_strmatch_hit_t *hit);
+static void chaos_strmatch_check(const chaos_strview_t *patterns, chaos_size_t count, chaos_status_t *status, chaos_size_t *states, chaos_size_t *size);
+
+/* ============================================================= */
+/* ARENA SIZE                                                    */
+/* ============================================================= */
+chaos_status_t chaos_strmatch_arena_size(const chaos_strview_t *patterns, chaos_size_t count, chaos_size_t *size)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_size_t states = 0U;
+
+    chaos_assert_not_null(size, &status, CHAOS_MODULE_STRING);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        chaos_strmatch_check(patterns, count, &status, &states, size);
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* BUILD                                                         */
+/* ============================================================= */
+chaos_status_t chaos_strmatch_build(chaos_strmatch_t *matcher, const chaos_strview_t *patterns, chaos_size_t count, void *arena, chaos_size_t arena_size)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_size_t need = 0U;
+    chaos_size_t states = 0U;
+    chaos_size_t node_count = 0U;
+    chaos_u8_t *base;
+    chaos_u32_t *root_next;
+    chaos_strmatch_node_t *nodes;
+    chaos_u32_t *idx;
+    chaos_u32_t *lo;
+    chaos_u32_t *hi;
+
+    chaos_assert_not_null(matcher, &status, CHAOS_MODULE_STRING);
+    chaos_assert_not_null(arena, &status, CHAOS_MODULE_STRING);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        chaos_strmatch_check(patterns, count, &status, &states, &need);
+    }
+
+    if ((status == CHAOS_STATUS_OK) && (arena_size < need))
+    {
+        status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STRING, CHAOS_ERRCLASS_OVERFLOW, CHAOS_STRING_TRUNCATED);
+    }
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        /* root row | states | build scratch: sort order, pattern range per state */
+        base = (chaos_u8_t *)arena;
+        base += (CHAOS_STRMATCH_ALIGN - ((chaos_uintptr_t)base & (CHAOS_STRMATCH_ALIGN - 1U))) & (CHAOS_STRMATCH_ALIGN - 1U);
+        root_next = (chaos_u32_t *)(void *)base;
+        nodes = (chaos_strmatch_node_t *)(void *)(base + CHAOS_STRMATCH_ROOT_SIZE);
+        idx = (chaos_u32_t *)(void *)(nodes + states);
+        lo = idx + count;
+        hi = lo + states;
+
+        chaos_strmatch_sort(patterns, idx, count);
+        chaos_strmatch_trie(nodes, patterns, idx, lo, hi, count, &node_count);
+        chaos_strmatch_links(nodes, root_next, node_count);
+
+        matcher->nodes = nodes;
+        matcher->root_next = root_next;
+        matcher->node_count = node_count;
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* SCAN                                                          */
+/* ============================================================= */
+chaos_status_t chaos_strmatch_scan(const chaos_strmatch_t *matcher, const chaos_strview_t *text, chaos_strmatch_cb_t cb, void *ctx)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    const chaos_strmatch_node_t *nodes;
+    chaos_strmatch_hit_t hit;
+    chaos_bool_t go = CHAOS_TRUE;
+    chaos_u32_t state = 0U;
+    chaos_u32_t out;
+    chaos_size_t i;
+
+    chaos_assert_not_null(matcher, &status, CHAOS_MODULE_STRING);
+    chaos_assert_not_null(text, &status, CHAOS_MODULE_STRING);
+
+    if ((status == CHAOS_STATUS_OK) && (text->len != 0U))
+    {
+        chaos_assert_not_null(text->data, &status, CHAOS_MODULE_STRING);
+    }
+
+    if ((status == CHAOS_STATUS_OK) && (cb == CHAOS_NULL))
+    {
+        status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STRING, CHAOS_ERRCLASS_NULL_PTR, CHAOS_STRING_NULL_PTR);
+    }
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        nodes = matcher->nodes;
+
+        for (i = 0U; (i < text->len) && (go == CHAOS_TRUE); i++)
+        {
+            state = chaos_strmatch_step(matcher, state, text->data[i]);
+
+            /* Walk every pattern that ends here, longest first */
+            out = (nodes[state].pattern != 0U) ? state : nodes[state].dict;
+            while ((out != 0U) && (go == CHAOS_TRUE))
+            {
+                hit.pattern = nodes[out].pattern - 1U;
+                hit.len = nodes[out].depth;
+                hit.offset = (i + 1U) - hit.len;
+                go = cb(ctx, &hit);
+                out = nodes[out].dict;
+            }
+        }
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* ANY                                                           */
+/* ============================================================= */
+chaos_status_t chaos_strmatch_any(const chaos_strmatch_t *matcher, const chaos_strview_t *text, chaos_bool_t *found)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    chaos_assert_not_null(found, &status, CHAOS_MODULE_STRING);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        *found = CHAOS_FALSE;
+        status = chaos_strmatch_scan(matcher, text, chaos_strmatch_stop, found);
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* INTERNAL HELPERS                                              */
+/* ============================================================= */
+
+static chaos_bool_t chaos_strmatch_has(const chaos_strmatch_node_t *node, chaos_u8_t c)
+{
+    return ((node->bitmap[c >> 5U] & ((chaos_u32_t)1U << (c & 31U))) != 0U) ? CHAOS_TRUE : CHAOS_FALSE;
+}
+
+/* Child for byte c of a state that has one: rank of c among the set bits */
+static chaos_u32_t chaos_strmatch_child(const chaos_strmatch_node_t *node, chaos_u8_t c)
+{
+    chaos_u32_t below = node->bitmap[c >> 5U] & (((chaos_u32_t)1U << (c & 31U)) - 1U);
+
+    return node->base + (chaos_u32_t)node->rank[c >> 5U] + chaos_u32_popcount(below);
+}
+
+static chaos_u32_t chaos_strmatch_step(const chaos_strmatch_t *matcher, chaos_u32_t state, chaos_u8_t c)
+{
+    const chaos_strmatch_node_t *node;
+    chaos_u32_t next = chaos_u32_t_MAX;
+
+    while (next == chaos_u32_t_MAX)
+    {
+        node = &matcher->nodes[state];
+
+        if (state == 0U)
+        {
+            next = matcher->root_next[c];
+        }
+        else if (chaos_strmatch_has(node, c) == CHAOS_TRUE)
+        {
+            next = chaos_strmatch_child(node, c);
+        }
+        else
+        {
+            state = node->fail;
+        }
+    }
+
+    return next;
+}
+
+/* Insertion sort of pattern indices into byte order (stable: duplicates keep index order) */
+static void chaos_strmatch_sort(const chaos_strview_t *patterns, chaos_u32_t *idx, chaos_size_t count)
+{
+    chaos_size_t i;
+    chaos_size_t j;
+    chaos_u32_t key;
+    chaos_i32_t order = 0;
+
+    for (i = 0U; i < count; i++)
+    {
+        key = (chaos_u32_t)i;
+        j = i;
+        while (j > 0U)
+        {
+            (void)chaos_strview_compare(&patterns[idx[j - 1U]], &patterns[key], &order);
+            if (order <= 0)
+            {
+                break;
+            }
+            idx[j] = idx[j - 1U];
+            j--;
+        }
+        idx[j] = key;
+    }
+}
+
+/*
+ * Build the trie breadth-first straight into its final layout. Every state
+ * owns the run [lo, hi) of sorted patterns that share its prefix; splitting
+ * that run on the next byte yields its children, which are appended in byte
+ * order and therefore sit next to each other.
+ */
+static void chaos_strmatch_trie(chaos_strmatch_node_t *nodes, const chaos_strview_t *patterns, const chaos_u32_t *idx, chaos_u32_t *lo, chaos_u32_t *hi, chaos_size_t count, chaos_size_t *node_count)
+{
+    chaos_strmatch_node_t *node;
+    chaos_u32_t next = 1U;
+    chaos_u32_t state;
+    chaos_u32_t depth;
+    chaos_u32_t i;
+    chaos_u32_t j;
+    chaos_u32_t w;
+    chaos_u8_t c;
+
+    nodes[0].depth = 0U;
+    lo[0] = 0U;
+    hi[0] = (chaos_u32_t)count;
+
+    for (state = 0U; state < next; state++)
+    {
+        node = &nodes[state];
+        depth = node->depth;
+        node->pattern = 0U;
+        node->base = next;
+        for (w = 0U; w < 8U; w++)
+        {
+            node->bitmap[w] = 0U;
+        }
+
+        /* Patterns spelled exactly by this prefix sort first in the run */
+        i = lo[state];
+        while ((i < hi[state]) && (patterns[idx[i]].len == depth))
+        {
+            if (node->pattern == 0U)
+            {
+                node->pattern = idx[i] + 1U;
+            }
+            i++;
+        }
+
+        while (i < hi[state])
+        {
+            c = patterns[idx[i]].data[depth];
+            j = i + 1U;
+            while ((j < hi[state]) && (patterns[idx[j]].data[depth] == c))
+            {
+                j++;
+            }
+
+            node->bitmap[c >> 5U] |= (chaos_u32_t)1U << (c & 31U);
+            nodes[next].depth = depth + 1U;
+            lo[next] = i;
+            hi[next] = j;
+            next++;
+            i = j;
+        }
+
+        node->rank[0] = 0U;
+        for (w = 1U; w < 8U; w++)
+        {
+            node->rank[w] = (chaos_u8_t)(node->rank[w - 1U] + chaos_u32_popcount(node->bitmap[w - 1U]));
+        }
+    }
+
+    *node_count = next;
+}
+
+/* Failure and dictionary links, in breadth-first order so every suffix state is already done */
+static void chaos_strmatch_links(chaos_strmatch_node_t *nodes, chaos_u32_t *root_next, chaos_size_t node_count)
+{
+    chaos_u32_t state;
+    chaos_u32_t child;
+    chaos_u32_t fail;
+    chaos_u32_t c;
+    chaos_bool_t done;
+
+    nodes[0].fail = 0U;
+    nodes[0].dict = 0U;
+
+    for (c = 0U; c < 256U; c++)
+    {
+        root_next[c] = (chaos_strmatch_has(&nodes[0], (chaos_u8_t)c) == CHAOS_TRUE) ? chaos_strmatch_child(&nodes[0], (chaos_u8_t)c) : 0U;
+    }
+
+    for (state = 0U; state < (chaos_u32_t)node_count; state++)
+    {
+        for (c = 0U; c < 256U; c++)
+        {
+            if (chaos_strmatch_has(&nodes[state], (chaos_u8_t)c) == CHAOS_TRUE)
+            {
+                child = chaos_strmatch_child(&nodes[state], (chaos_u8_t)c);
+                fail = 0U;
+
+                if (state != 0U)
+                {
+                    fail = nodes[state].fail;
+                    done = CHAOS_FALSE;
+                    while (done == CHAOS_FALSE)
+                    {
+                        if (chaos_strmatch_has(&nodes[fail], (chaos_u8_t)c) == CHAOS_TRUE)
+                        {
+                            fail = chaos_strmatch_child(&nodes[fail], (chaos_u8_t)c);
+                            done = CHAOS_TRUE;
+                        }
+                        else if (fail == 0U)
+                        {
+                            done = CHAOS_TRUE;
+                        }
+                        else
+                        {
+                            fail = nodes[fail].fail;
+                        }
+                    }
+                }
+
+                nodes[child].fail = fail;
+                nodes[child].dict = (nodes[fail].pattern != 0U) ? fail : nodes[fail].dict;
+            }
+        }
+    }
+}
+
+static chaos_bool_t chaos_strmatch_stop(void *ctx, const chaos_strmatch_hit_t *hit)
+{
+    (void)hit;
+    *(chaos_bool_t *)ctx = CHAOS_TRUE;
+
+    return CHAOS_FALSE;
+}
+
+/* Validate a pattern set; states is an upper bound (one per pattern byte, plus the root) */
+static void chaos_strmatch_check(const chaos_strview_t *patterns, chaos_size_t count, chaos_status_t *status, chaos_size_t *states, chaos_size_t *size)
+{
+    chaos_size_t total = 1U;
+    chaos_size_t per_state = (chaos_size_t)sizeof(chaos_strmatch_node_t) + (2U * (chaos_size_t)sizeof(chaos_u32_t));
+    chaos_size_t fixed = CHAOS_STRMATCH_ROOT_SIZE + (chaos_size_t)(CHAOS_STRMATCH_ALIGN - 1U);
+    chaos_size_t i;
+
+    chaos_assert_not_null(patterns, status, CHAOS_MODULE_STRING);
+    chaos_assert_param((count != 0U), status, CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STRING, CHAOS_STRING_SIZE_ZERO);
+
+    for (i = 0U; (i < count) && (*status == CHAOS_STATUS_OK); i++)
+    {
+        chaos_assert_not_null(patterns[i].data, status, CHAOS_MODULE_STRING);
+        chaos_assert_param((patterns[i].len != 0U), status, CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STRING, CHAOS_STRING_SIZE_ZERO);
+
+        if (patterns[i].len > (chaos_u32_t_MAX - total))
+        {
+            *status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STRING, CHAOS_ERRCLASS_OVERFLOW, CHAOS_STRING_OUT_OF_RANGE);
+        }
+        else
+        {
+            total += patterns[i].len;
+        }
+    }
+
+    if (*status == CHAOS_STATUS_OK)
+    {
+        /* Alignment slack, root row and sort order, then per-state storage */
+        if ((count > ((chaos_u32_t_MAX - fixed) / (chaos_size_t)sizeof(chaos_u32_t))) ||
+            (total > ((chaos_u32_t_MAX - fixed - (count * (chaos_size_t)sizeof(chaos_u32_t))) / per_state)))
+        {
+            *status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STRING, CHAOS_ERRCLASS_OVERFLOW, CHAOS_STRING_OUT_OF_RANGE);
+        }
+        else
+        {
+            *states = total;
+            *size = fixed + (count * (chaos_size_t)sizeof(chaos_u32_t)) + (total * per_state);
+        }
+    }
+}
@@ -0,0 +1,316 @@
+/**
+ * @file chaos_strview.c
+ * @brief Implementation of non-owning string views.
+ */
+
+#include "chaos_strview.h"
+#include "chaos_string.h"
+#include "chaos_memory.h"
+#include "chaos_assert.h"
+
+/* ============================================================= */
+/* FUNCTION PROTOTYPES                                          */
+/* ============================================================= */
+static chaos_bool_t chaos_strview_is_space(chaos_char_t c);
+static chaos_bool_t chaos_strview_is_delim(const chaos_strview_iter_t *iter, chaos_char_t c);
+static chaos_bool_t chaos_strview_same(const chaos_char_t *a, const chaos_char_t *b, chaos_size_t len);
+static void chaos_strview_check(const chaos_strview_t *view, chaos_status_t *status);
+
+/* ============================================================= */
+/* FROM CSTR                                                     */
+/* ============================================================= */
+chaos_status_t chaos_strview_from_cstr(chaos_strview_t *view, const chaos_cstr_t str)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_size_t len = 0U;
+
+    chaos_assert_not_null(view, &status, CHAOS_MODULE_STRING);
+    chaos_assert_not_null(str, &status, CHAOS_MODULE_STRING);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        (void)chaos_strlen(str, &len);
+        view->data = str;
+        view->len = len;
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* SLICE                                                         */
+/* ============================================================= */
+chaos_status_t chaos_strview_slice(const chaos_strview_t *view, chaos_size_t start, chaos_size_t len, chaos_strview_t *out)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    chaos_strview_check(view, &status);
+    chaos_assert_not_null(out, &status, CHAOS_MODULE_STRING);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        if (start > view->len)
+        {
+            status = CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STRING, CHAOS_ERRCLASS_OUT_OF_RANGE, CHAOS_STRING_OUT_OF_RANGE);
+        }
+        else
+        {
+            out->len = ((view->len - start) < len) ? (view->len - start) : len;
+            out->data = (view->data != CHAOS_NULL) ? (view->data + start) : CHAOS_NULL;
+        }
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* COMPARE                                                       */
+/* ============================================================= */
+chaos_status_t chaos_strview_compare(const chaos_strview_t *a, const chaos_strview_t *b, chaos_i32_t *order)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_size_t n;
+    chaos_size_t i = 0U;
+
+    chaos_strview_check(a, &status);
+    chaos_strview_check(b, &status);
+    chaos_assert_not_null(order, &status, CHAOS_MODULE_STRING);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        n = (a->len < b->len) ? a->len : b->len;
+        while ((i < n) && (a->data[i] == b->data[i]))
+        {
+            i++;
+        }
+
+        if (i < n)
+        {
+            *order = (chaos_i32_t)a->data[i] - (chaos_i32_t)b->data[i];
+        }
+        else
+        {
+            *order = (a->len == b->len) ? 0 : ((a->len < b->len) ? -1 : 1);
+        }
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* EQUAL                                                         */
+/* ============================================================= */
+chaos_status_t chaos_strview_equal(const chaos_strview_t *a, const chaos_strview_t *b, chaos_bool_t *equal)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    chaos_strview_check(a, &status);
+    chaos_strview_check(b, &status);
+    chaos_assert_not_null(equal, &status, CHAOS_MODULE_STRING);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        *equal = CHAOS_FALSE;
+        if (a->len == b->len)
+        {
+            *equal = chaos_strview_same(a->data, b->data, a->len);
+        }
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* STARTS WITH / ENDS WITH                                       */
+/* ============================================================= */
+chaos_status_t chaos_strview_starts_with(const chaos_strview_t *view, const chaos_strview_t *prefix, chaos_bool_t *result)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    chaos_strview_check(view, &status);
+    chaos_strview_check(prefix, &status);
+    chaos_assert_not_null(result, &status, CHAOS_MODULE_STRING);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        *result = CHAOS_FALSE;
+        if (prefix->len <= view->len)
+        {
+            *result = chaos_strview_same(view->data, prefix->data, prefix->len);
+        }
+    }
+
+    return status;
+}
+
+chaos_status_t chaos_strview_ends_with(const chaos_strview_t *view, const chaos_strview_t *suffix, chaos_bool_t *result)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+
+    chaos_strview_check(view, &status);
+    chaos_strview_check(suffix, &status);
+    chaos_assert_not_null(result, &status, CHAOS_MODULE_STRING);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        *result = CHAOS_FALSE;
+        if (suffix->len <= view->len)
+        {
+            *result = (suffix->len == 0U) ? CHAOS_TRUE : chaos_strview_same(view->data + (view->len - suffix->len), suffix->data, suffix->len);
+        }
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* TRIM                                                          */
+/* ============================================================= */
+chaos_status_t chaos_strview_trim(const chaos_strview_t *view, chaos_strview_t *out)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_size_t begin = 0U;
+    chaos_size_t end = 0U;
+
+    chaos_strview_check(view, &status);
+    chaos_assert_not_null(out, &status, CHAOS_MODULE_STRING);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        end = view->len;
+        while ((begin < end) && (chaos_strview_is_space(view->data[begin]) == CHAOS_TRUE))
+        {
+            begin++;
+        }
+        while ((end > begin) && (chaos_strview_is_space(view->data[end - 1U]) == CHAOS_TRUE))
+        {
+            end--;
+        }
+
+        out->data = (view->data != CHAOS_NULL) ? (view->data + begin) : CHAOS_NULL;
+        out->len = end - begin;
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* SPLIT / TOKENIZE                                              */
+/* ============================================================= */
+chaos_status_t chaos_strview_split_init(chaos_strview_iter_t *iter, const chaos_strview_t *view, const chaos_strview_t *delims, chaos_bool_t skip_empty)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_size_t i;
+
+    chaos_assert_not_null(iter, &status, CHAOS_MODULE_STRING);
+    chaos_strview_check(view, &status);
+    chaos_strview_check(delims, &status);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        iter->rest = *view;
+        iter->skip_empty = skip_empty;
+        iter->done = CHAOS_FALSE;
+
+        for (i = 0U; i < 8U; i++)
+        {
+            iter->delims[i] = 0U;
+        }
+        for (i = 0U; i < delims->len; i++)
+        {
+            iter->delims[delims->data[i] >> 5U] |= (chaos_u32_t)1U << (delims->data[i] & 31U);
+        }
+    }
+
+    return status;
+}
+
+chaos_status_t chaos_strview_split_next(chaos_strview_iter_t *iter, chaos_strview_t *token, chaos_bool_t *found)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_size_t i = 0U;
+
+    chaos_assert_not_null(iter, &status, CHAOS_MODULE_STRING);
+    chaos_assert_not_null(token, &status, CHAOS_MODULE_STRING);
+    chaos_assert_not_null(found, &status, CHAOS_MODULE_STRING);
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        *found = CHAOS_FALSE;
+
+        /* Tokenize mode: swallow any run of delimiters first */
+        if (iter->skip_empty == CHAOS_TRUE)
+        {
+            while ((iter->rest.len != 0U) && (chaos_strview_is_delim(iter, iter->rest.data[0]) == CHAOS_TRUE))
+            {
+                iter->rest.data++;
+                iter->rest.len--;
+            }
+            if (iter->rest.len == 0U)
+            {
+                iter->done = CHAOS_TRUE;
+            }
+        }
+
+        if (iter->done == CHAOS_FALSE)
+        {
+            while ((i < iter->rest.len) && (chaos_strview_is_delim(iter, iter->rest.data[i]) == CHAOS_FALSE))
+            {
+                i++;
+            }
+
+            token->data = iter->rest.data;
+            token->len = i;
+            *found = CHAOS_TRUE;
+
+            if (i < iter->rest.len)
+            {
+                /* Step over the delimiter; a trailing one still yields an empty field */
+                iter->rest.data += i + 1U;
+                iter->rest.len -= i + 1U;
+            }
+            else
+            {
+                iter->done = CHAOS_TRUE;
+            }
+        }
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* HELPERS                                                       */
+/* ============================================================= */
+
+/* A view is valid when it is non-NULL and its data is non-NULL or empty */
+static void chaos_strview_check(const chaos_strview_t *view, chaos_status_t *status)
+{
+    chaos_assert_not_null(view, status, CHAOS_MODULE_STRING);
+    if ((view != CHAOS_NULL) && (view->len != 0U))
+    {
+        chaos_assert_not_null(view->data, status, CHAOS_MODULE_STRING);
+    }
+}
+
+static chaos_bool_t chaos_strview_same(const chaos_char_t *a, const chaos_char_t *b, chaos_size_t len)
+{
+    chaos_bool_t equal = CHAOS_TRUE;
+
+    if (len != 0U)
+    {
+        (void)chaos_memcmp(a, b, len, &equal);
+    }
+
+    return equal;
+}
+
+static chaos_bool_t chaos_strview_is_space(chaos_char_t c)
+{
+    return ((c == (chaos_char_t)' ') || ((c >= (chaos_char_t)'\t') && (c <= (chaos_char_t)'\r'))) ? CHAOS_TRUE : CHAOS_FALSE;
+}
+
+static chaos_bool_t chaos_strview_is_delim(const chaos_strview_iter_t *iter, chaos_char_t c)
+{
+    return ((iter->delims[c >> 5U] & ((chaos_u32_t)1U << (c & 31U))) != 0U) ? CHAOS_TRUE : CHAOS_FALSE;
+}
@@ -0,0 +1,454 @@
+/**
+ * @file chaos_utf8.c
+ * @brief Implementation of UTF-8 validation and code point counting.
+ */
+
+#include "chaos_utf8.h"
+#include "chaos_assert.h"
+#include "chaos_bits.h"
+
+#if (CHAOS_HAS_SSE2 == 1)
+#include <emmintrin.h>
+#endif
+#if (CHAOS_HAS_SSE41 == 1) || (CHAOS_HAS_AVX2 == 1)
+#include <immintrin.h>
+#endif
+
+/* ============================================================= */
+/* CONSTANTS                                                     */
+/* ============================================================= */
+
+/* High bit of every byte of a word */
+#define CHAOS_UTF8_HIGH (CHAOS_WORD_ONES * (chaos_word_t)0x80U)
+
+#if (CHAOS_HAS_AVX2 == 1) || (CHAOS_HAS_SSE41 == 1)
+/*
+ * Error classes of the lookup validator. Each table below gives, for one
+ * nibble, the classes that nibble value is compatible with; a byte pair is
+ * in error when all three lookups agree on a class.
+ */
+#define CHAOS_UTF8_TOO_SHORT  (1U << 0U) /* Lead not followed by a continuation */
+#define CHAOS_UTF8_TOO_LONG   (1U << 1U) /* ASCII followed by a continuation */
+#define CHAOS_UTF8_OVERLONG_3 (1U << 2U) /* E0 80..9F */
+#define CHAOS_UTF8_TOO_LARGE  (1U << 3U) /* F4 90..BF, F5..FF */
+#define CHAOS_UTF8_SURROGATE  (1U << 4U) /* ED A0..BF */
+#define CHAOS_UTF8_OVERLONG_2 (1U << 5U) /* C0, C1 */
+#define CHAOS_UTF8_TOO_LARGE_1000 (1U << 6U) /* F5..FF 80..8F */
+#define CHAOS_UTF8_OVERLONG_4 (1U << 6U) /* F0 80..8F */
+#define CHAOS_UTF8_TWO_CONTS  (1U << 7U) /* Continuation following a continuation */
+#define CHAOS_UTF8_CARRY      (CHAOS_UTF8_TOO_SHORT | CHAOS_UTF8_TOO_LONG | CHAOS_UTF8_TWO_CONTS)
+
+/* Byte 1, high nibble */
+static const chaos_u8_t chaos_utf8_t1[16] =
+{
+    CHAOS_UTF8_TOO_LONG, CHAOS_UTF8_TOO_LONG, CHAOS_UTF8_TOO_LONG, CHAOS_UTF8_TOO_LONG,
+    CHAOS_UTF8_TOO_LONG, CHAOS_UTF8_TOO_LONG, CHAOS_UTF8_TOO_LONG, CHAOS_UTF8_TOO_LONG,
+    CHAOS_UTF8_TWO_CONTS, CHAOS_UTF8_TWO_CONTS, CHAOS_UTF8_TWO_CONTS, CHAOS_UTF8_TWO_CONTS,
+    CHAOS_UTF8_TOO_SHORT | CHAOS_UTF8_OVERLONG_2,
+    CHAOS_UTF8_TOO_SHORT,
+    CHAOS_UTF8_TOO_SHORT | CHAOS_UTF8_OVERLONG_3 | CHAOS_UTF8_SURROGATE,
+    CHAOS_UTF8_TOO_SHORT | CHAOS_UTF8_TOO_LARGE | CHAOS_UTF8_TOO_LARGE_1000 | CHAOS_UTF8_OVERLONG_4
+};
+
+/* Byte 1, low nibble */
+static const chaos_u8_t chaos_utf8_t2[16] =
+{
+    CHAOS_UTF8_CARRY | CHAOS_UTF8_OVERLONG_3 | CHAOS_UTF8_OVERLONG_2 | CHAOS_UTF8_OVERLONG_4,
+    CHAOS_UTF8_CARRY | CHAOS_UTF8_OVERLONG_2,
+    CHAOS_UTF8_CARRY,
+    CHAOS_UTF8_CARRY,
+    CHAOS_UTF8_CARRY | CHAOS_UTF8_TOO_LARGE,
+    CHAOS_UTF8_CARRY | CHAOS_UTF8_TOO_LARGE | CHAOS_UTF8_TOO_LARGE_1000,
+    CHAOS_UTF8_CARRY | CHAOS_UTF8_TOO_LARGE | CHAOS_UTF8_TOO_LARGE_1000,
+    CHAOS_UTF8_CARRY | CHAOS_UTF8_TOO_LARGE | CHAOS_UTF8_TOO_LARGE_1000,
+    CHAOS_UTF8_CARRY | CHAOS_UTF8_TOO_LARGE | CHAOS_UTF8_TOO_LARGE_1000,
+    CHAOS_UTF8_CARRY | CHAOS_UTF8_TOO_LARGE | CHAOS_UTF8_TOO_LARGE_1000,
+    CHAOS_UTF8_CARRY | CHAOS_UTF8_TOO_LARGE | CHAOS_UTF8_TOO_LARGE_1000,
+    CHAOS_UTF8_CARRY | CHAOS_UTF8_TOO_LARGE | CHAOS_UTF8_TOO_LARGE_1000,
+    CHAOS_UTF8_CARRY | CHAOS_UTF8_TOO_LARGE | CHAOS_UTF8_TOO_LARGE_1000,
+    CHAOS_UTF8_CARRY | CHAOS_UTF8_TOO_LARGE | CHAOS_UTF8_TOO_LARGE_1000 | CHAOS_UTF8_SURROGATE,
+    CHAOS_UTF8_CARRY | CHAOS_UTF8_TOO_LARGE | CHAOS_UTF8_TOO_LARGE_1000,
+    CHAOS_UTF8_CARRY | CHAOS_UTF8_TOO_LARGE | CHAOS_UTF8_TOO_LARGE_1000
+};
+
+/* Byte 2, high nibble */
+static const chaos_u8_t chaos_utf8_t3[16] =
+{
+    CHAOS_UTF8_TOO_SHORT, CHAOS_UTF8_TOO_SHORT, CHAOS_UTF8_TOO_SHORT, CHAOS_UTF8_TOO_SHORT,
+    CHAOS_UTF8_TOO_SHORT, CHAOS_UTF8_TOO_SHORT, CHAOS_UTF8_TOO_SHORT, CHAOS_UTF8_TOO_SHORT,
+    CHAOS_UTF8_TOO_LONG | CHAOS_UTF8_OVERLONG_2 | CHAOS_UTF8_TWO_CONTS | CHAOS_UTF8_OVERLONG_3 |
+        CHAOS_UTF8_TOO_LARGE_1000 | CHAOS_UTF8_OVERLONG_4,
+    CHAOS_UTF8_TOO_LONG | CHAOS_UTF8_OVERLONG_2 | CHAOS_UTF8_TWO_CONTS | CHAOS_UTF8_OVERLONG_3 |
+        CHAOS_UTF8_TOO_LARGE,
+    CHAOS_UTF8_TOO_LONG | CHAOS_UTF8_OVERLONG_2 | CHAOS_UTF8_TWO_CONTS | CHAOS_UTF8_SURROGATE |
+        CHAOS_UTF8_TOO_LARGE,
+    CHAOS_UTF8_TOO_LONG | CHAOS_UTF8_OVERLONG_2 | CHAOS_UTF8_TWO_CONTS | CHAOS_UTF8_SURROGATE |
+        CHAOS_UTF8_TOO_LARGE,
+    CHAOS_UTF8_TOO_SHORT, CHAOS_UTF8_TOO_SHORT, CHAOS_UTF8_TOO_SHORT, CHAOS_UTF8_TOO_SHORT
+};
+
+/* Largest byte values that may end a block without leaving a sequence open */
+static const chaos_u8_t chaos_utf8_last[32] =
+{
+    0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+    0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xEFU, 0xDFU, 0xBFU
+};
+#endif
+
+/* ============================================================= */
+/* FUNCTION PROTOTYPES                                          */
+/* ============================================================= */
+static chaos_size_t chaos_utf8_scalar(const chaos_u8_t *s, chaos_size_t size);
+#if (CHAOS_HAS_AVX2 == 1) || (CHAOS_HAS_SSE41 == 1)
+static chaos_size_t chaos_utf8_resume(const chaos_u8_t *s, chaos_size_t size, chaos_size_t block);
+#endif
+#if (CHAOS_HAS_AVX2 == 1)
+static chaos_size_t chaos_utf8_avx2(const chaos_u8_t *s, chaos_size_t size);
+#elif (CHAOS_HAS_SSE41 == 1)
+static chaos_size_t chaos_utf8_sse(const chaos_u8_t *s, chaos_size_t size);
+#endif
+
+/* ============================================================= */
+/* VALIDATE                                                      */
+/* ============================================================= */
+chaos_status_t chaos_utf8_validate(const chaos_char_t *str, chaos_size_t size, chaos_bool_t *valid, chaos_size_t *offset)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_size_t good = 0U;
+
+    chaos_assert_not_null(valid, &status, CHAOS_MODULE_STRING);
+    if (size != 0U)
+    {
+        chaos_assert_not_null(str, &status, CHAOS_MODULE_STRING);
+    }
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        if (size != 0U)
+        {
+#if (CHAOS_HAS_AVX2 == 1)
+            good = chaos_utf8_avx2(str, size);
+#elif (CHAOS_HAS_SSE41 == 1)
+            good = chaos_utf8_sse(str, size);
+#else
+            good = chaos_utf8_scalar(str, size);
+#endif
+        }
+
+        *valid = (good == size) ? CHAOS_TRUE : CHAOS_FALSE;
+        if (offset != CHAOS_NULL)
+        {
+            *offset = good;
+        }
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* COUNT                                                         */
+/* ============================================================= */
+chaos_status_t chaos_utf8_count(const chaos_char_t *str, chaos_size_t size, chaos_size_t *count)
+{
+    chaos_status_t status = CHAOS_STATUS_OK;
+    chaos_size_t conts = 0U;
+    chaos_size_t i = 0U;
+    chaos_word_t w;
+
+    chaos_assert_not_null(count, &status, CHAOS_MODULE_STRING);
+    if (size != 0U)
+    {
+        chaos_assert_not_null(str, &status, CHAOS_MODULE_STRING);
+    }
+
+    if (status == CHAOS_STATUS_OK)
+    {
+        /* Continuation bytes are 0x80..0xBF, i.e. below -64 as signed bytes */
+#if (CHAOS_HAS_AVX2 == 1)
+        {
+            const __m256i limit = _mm256_set1_epi8(-64);
+
+            while ((size - i) >= 32U)
+            {
+                __m256i v = _mm256_loadu_si256((const __m256i *)(const void *)(str + i));
+                conts += chaos_u32_popcount((chaos_u32_t)_mm256_movemask_epi8(_mm256_cmpgt_epi8(limit, v)));
+                i += 32U;
+            }
+        }
+#endif
+#if (CHAOS_HAS_SSE2 == 1)
+        {
+            const __m128i limit = _mm_set1_epi8(-64);
+
+            while ((size - i) >= 16U)
+            {
+                __m128i v = _mm_loadu_si128((const __m128i *)(const void *)(str + i));
+                conts += chaos_u32_popcount((chaos_u32_t)_mm_movemask_epi8(_mm_cmplt_epi8(v, limit)));
+                i += 16U;
+            }
+        }
+#endif
+        /* Bit 7 set and bit 6 clear; summing the flags of a word via a multiply */
+        while ((size - i) >= CHAOS_WORD_SIZE)
+        {
+            w = chaos_word_loadu(str + i);
+            w = ((w & ~(w << 1U)) & CHAOS_UTF8_HIGH) >> 7U;
+            conts += (chaos_size_t)((w * CHAOS_WORD_ONES) >> ((CHAOS_WORD_SIZE - 1U) * 8U));
+            i += CHAOS_WORD_SIZE;
+        }
+        while (i < size)
+        {
+            conts += ((str[i] & 0xC0U) == 0x80U) ? 1U : 0U;
+            i++;
+        }
+
+        *count = size - conts;
+    }
+
+    return status;
+}
+
+/* ============================================================= */
+/* INTERNAL HELPERS                                              */
+/* ============================================================= */
+
+/* Length of the longest well-formed prefix (RFC 3629, table 3-7 of Unicode) */
+static chaos_size_t chaos_utf8_scalar(const chaos_u8_t *s, chaos_size_t size)
+{
+    chaos_size_t i = 0U;
+    chaos_size_t n;
+    chaos_size_t k;
+    chaos_u8_t c;
+    chaos_u8_t lo = 0x80U;
+    chaos_u8_t hi = 0xBFU;
+    chaos_bool_t bad = CHAOS_FALSE;
+
+    while ((i < size) && (bad == CHAOS_FALSE))
+    {
+        if (((size - i) >= CHAOS_WORD_SIZE) && ((chaos_word_loadu(s + i) & CHAOS_UTF8_HIGH) == 0U))
+        {
+            /* Word of ASCII */
+            i += CHAOS_WORD_SIZE;
+        }
+        else
+        {
+            c = s[i];
+            lo = 0x80U;
+            hi = 0xBFU;
+
+            if (c < 0x80U)
+            {
+                n = 1U;
+            }
+            else if ((c >= 0xC2U) && (c <= 0xDFU))
+            {
+                n = 2U;
+            }
+            else if ((c >= 0xE0U) && (c <= 0xEFU))
+            {
+                n = 3U;
+                lo = (c == 0xE0U) ? 0xA0U : 0x80U;
+                hi = (c == 0xEDU) ? 0x9FU : 0xBFU;
+            }
+            else if ((c >= 0xF0U) && (c <= 0xF4U))
+            {
+                n = 4U;
+                lo = (c == 0xF0U) ? 0x90U : 0x80U;
+                hi = (c == 0xF4U) ? 0x8FU : 0xBFU;
+            }
+            else
+            {
+                n = 0U;
+            }
+
+            if ((n == 0U) || ((size - i) < n))
+            {
+                bad = CHAOS_TRUE;
+            }
+            else if (n > 1U)
+            {
+                /* Second byte has the narrowed range, the others any continuation */
+                bad = ((s[i + 1U] < lo) || (s[i + 1U] > hi)) ? CHAOS_TRUE : CHAOS_FALSE;
+                for (k = 2U; k < n; k++)
+                {
+                    if ((s[i + k] & 0xC0U) != 0x80U)
+                    {
+                        bad = CHAOS_TRUE;
+                    }
+                }
+            }
+            else
+            {
+                /* ASCII */
+            }
+
+            if (bad == CHAOS_FALSE)
+            {
+                i += n;
+            }
+        }
+    }
+
+    return i;
+}
+
+#if (CHAOS_HAS_AVX2 == 1) || (CHAOS_HAS_SSE41 == 1)
+/*
+ * The vector validator reports the block where it saw an error. Sequences
+ * starting more than three bytes before that block cannot reach into it and
+ * were checked, so the first non-continuation byte of the three before the
+ * block starts a sequence; the scalar decoder resumes there to find the
+ * offset.
+ */
+static chaos_size_t chaos_utf8_resume(const chaos_u8_t *s, chaos_size_t size, chaos_size_t block)
+{
+    chaos_size_t start = (block > 3U) ? (block - 3U) : 0U;
+
+    while ((start < block) && ((s[start] & 0xC0U) == 0x80U))
+    {
+        start++;
+    }
+
+    return start + chaos_utf8_scalar(s + start, size - start);
+}
+#endif
+
+#if (CHAOS_HAS_AVX2 == 1)
+/* 32 bytes per step; prev<N> shifts the previous block's last N bytes in */
+static chaos_size_t chaos_utf8_avx2(const chaos_u8_t *s, chaos_size_t size)
+{
+    const __m256i t1 = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)(const void *)chaos_utf8_t1));
+    const __m256i t2 = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)(const void *)chaos_utf8_t2));
+    const __m256i t3 = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)(const void *)chaos_utf8_t3));
+    const __m256i nib = _mm256_set1_epi8(0x0F);
+    const __m256i last = _mm256_loadu_si256((const __m256i *)(const void *)chaos_utf8_last);
+    __m256i prev = _mm256_setzero_si256();
+    __m256i incomplete = _mm256_setzero_si256();
+    __m256i in;
+    __m256i err;
+    __m256i shifted;
+    __m256i prev1;
+    __m256i must23;
+    chaos_u8_t tail[32];
+    chaos_size_t good = size;
+    chaos_size_t i = 0U;
+    chaos_size_t k;
+    chaos_bool_t done = CHAOS_FALSE;
+
+    while (done == CHAOS_FALSE)
+    {
+        if ((size - i) >= 32U)
+        {
+            in = _mm256_loadu_si256((const __m256i *)(const void *)(s + i));
+        }
+        else
+        {
+            /* Zero padding: a sequence left open at the end fails as too short */
+            for (k = 0U; k < 32U; k++)
+            {
+                tail[k] = ((i + k) < size) ? s[i + k] : 0U;
+            }
+            in = _mm256_loadu_si256((const __m256i *)(const void *)tail);
+            done = CHAOS_TRUE;
+        }
+
+        if (_mm256_movemask_epi8(in) == 0)
+        {
+            err = incomplete;
+            incomplete = _mm256_setzero_si256();
+        }
+        else
+        {
+            shifted = _mm256_permute2x128_si256(prev, in, 0x21);
+            prev1 = _mm256_alignr_epi8(in, shifted, 15);
+            err = _mm256_and_si256(_mm256_and_si256(
+                      _mm256_shuffle_epi8(t1, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nib)),
+                      _mm256_shuffle_epi8(t2, _mm256_and_si256(prev1, nib))),
+                      _mm256_shuffle_epi8(t3, _mm256_and_si256(_mm256_srli_epi16(in, 4), nib)));
+            must23 = _mm256_or_si256(_mm256_subs_epu8(_mm256_alignr_epi8(in, shifted, 14), _mm256_set1_epi8(0x60)),
+                                     _mm256_subs_epu8(_mm256_alignr_epi8(in, shifted, 13), _mm256_set1_epi8(0x70)));
+            err = _mm256_xor_si256(err, _mm256_and_si256(must23, _mm256_set1_epi8((char)0x80)));
+            incomplete = _mm256_subs_epu8(in, last);
+        }
+
+        if (_mm256_testz_si256(err, err) == 0)
+        {
+            good = chaos_utf8_resume(s, size, i);
+            done = CHAOS_TRUE;
+        }
+
+        prev = in;
+        i += 32U;
+    }
+
+    return good;
+}
+#elif (CHAOS_HAS_SSE41 == 1)
+/* 16 bytes per step; prev<N> shifts the previous block's last N bytes in */
+static chaos_size_t chaos_utf8_sse(const chaos_u8_t *s, chaos_size_t size)
+{
+    const __m128i t1 = _mm_loadu_si128((const __m128i *)(const void *)chaos_utf8_t1);
+    const __m128i t2 = _mm_loadu_si128((const __m128i *)(const void *)chaos_utf8_t2);
+    const __m128i t3 = _mm_loadu_si128((const __m128i *)(const void *)chaos_utf8_t3);
+    const __m128i nib = _mm_set1_epi8(0x0F);
+    const __m128i last = _mm_loadu_si128((const __m128i *)(const void *)&chaos_utf8_last[16]);
+    __m128i prev = _mm_setzero_si128();
+    __m128i incomplete = _mm_setzero_si128();
+    __m128i in;
+    __m128i err;
+    __m128i prev1;
+    __m128i must23;
+    chaos_u8_t tail[16];
+    chaos_size_t good = size;
+    chaos_size_t i = 0U;
+    chaos_size_t k;
+    chaos_bool_t done = CHAOS_FALSE;
+
+    while (done == CHAOS_FALSE)
+    {
+        if ((size - i) >= 16U)
+        {
+            in = _mm_loadu_si128((const __m128i *)(const void *)(s + i));
+        }
+        else
+        {
+            /* Zero padding: a sequence left open at the end fails as too short */
+            for (k = 0U; k < 16U; k++)
+            {
+                tail[k] = ((i + k) < size) ? s[i + k] : 0U;
+            }
+            in = _mm_loadu_si128((const __m128i *)(const void *)tail);
+            done = CHAOS_TRUE;
+        }
+
+        if (_mm_movemask_epi8(in) == 0)
+        {
+            err = incomplete;
+            incomplete = _mm_setzero_si128();
+        }
+        else
+        {
+            prev1 = _mm_alignr_epi8(in, prev, 15);
+            err = _mm_and_si128(_mm_and_si128(
+                      _mm_shuffle_epi8(t1, _mm_and_si128(_mm_srli_epi16(prev1, 4), nib)),
+                      _mm_shuffle_epi8(t2, _mm_and_si128(prev1, nib))),
+                      _mm_shuffle_epi8(t3, _mm_and_si128(_mm_srli_epi16(in, 4), nib)));
+            must23 = _mm_or_si128(_mm_subs_epu8(_mm_alignr_epi8(in, prev, 14), _mm_set1_epi8(0x60)),
+                                  _mm_subs_epu8(_mm_alignr_epi8(in, prev, 13), _mm_set1_epi8(0x70)));
+            err = _mm_xor_si128(err, _mm_and_si128(must23, _mm_set1_epi8((char)0x80)));
+            incomplete = _mm_subs_epu8(in, last);
+        }
+
+        if (_mm_testz_si128(err, err) == 0)
+        {
+            good = chaos_utf8_resume(s, size, i);
+            done = CHAOS_TRUE;
+        }
+
+        prev = in;
+        i += 16U;
+    }
+
+    return good;
+}
+#endif
@@ -21,6 +21,13 @@ OPT_RELEASE     := -O2
 OPT_SIZE        := -Os
 OPT_ANALYZE     := -O0 -g
 
+# =============================
+# TARGET ARCHITECTURE
+# =============================
+# Extra target flags (e.g. -msse4.2 -mavx2 -mpclmul, -march=native).
+# SIMD kernels are selected from what these flags enable.
+ARCH_FLAGS      :=
+
 # =============================
 # WARNINGS / MISRA STYLE
 # =============================
@@ -42,6 +49,8 @@ CHAOS_ALLOC_ALIGNMENT  := 8U
 CHAOS_ENABLE_FLOAT 	   := 1
 CHAOS_ENABLE_INT64     := 1
 CHAOS_STRICT_ABI_CHECK := 0
+CHAOS_ENABLE_SIMD      := 1
+CHAOS_ENABLE_THREADS   := 0
 # =============================
 # ANALYSIS TOOLS
 # =============================
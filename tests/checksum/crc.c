@@ -0,0 +1,206 @@
+#include <string.h>
+
+#include "chaos_checksum.h"
+#include "chaos_crc_tables.h"
+#include "chaos_types.h"
+#include "chaos_status.h"
+
+#include "chaos_test.h"
+
+/* -------------------------------------------------------------------------- */
+/* Helpers                                                                     */
+/* -------------------------------------------------------------------------- */
+
+static chaos_u8_t g_src[1100];
+static chaos_u8_t g_dst[1100];
+
+/* Bit-at-a-time reference, zlib convention */
+static chaos_u32_t ref_crc(chaos_u32_t poly, chaos_u32_t crc, const chaos_u8_t *p, chaos_size_t size)
+{
+    chaos_size_t i;
+    chaos_u32_t bit;
+
+    crc = ~crc;
+    for (i = 0U; i < size; i++)
+    {
+        crc ^= p[i];
+        for (bit = 0U; bit < 8U; bit++)
+        {
+            crc = ((crc & 1U) != 0U) ? ((crc >> 1U) ^ poly) : (crc >> 1U);
+        }
+    }
+    return ~crc;
+}
+
+static void fill_random(chaos_u8_t *p, chaos_size_t size)
+{
+    chaos_u32_t x = 0x12345678U;
+    chaos_size_t i;
+
+    for (i = 0U; i < size; i++)
+    {
+        x = (x * 1103515245U) + 12345U;
+        p[i] = (chaos_u8_t)(x >> 24U);
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+/* Tests                                                                       */
+/* -------------------------------------------------------------------------- */
+
+static int test_crc_check_values(void)
+{
+    const chaos_u8_t check[] = "123456789";
+    chaos_u32_t crc = 0U;
+
+    TEST_ASSERT(chaos_crc32(check, 9U, &crc) == CHAOS_STATUS_OK, "crc32 status");
+    TEST_ASSERT(crc == 0xCBF43926U, "crc32 check value");
+
+    crc = 0U;
+    TEST_ASSERT(chaos_crc32c(check, 9U, &crc) == CHAOS_STATUS_OK, "crc32c status");
+    TEST_ASSERT(crc == 0xE3069283U, "crc32c check value");
+
+    TEST_PASS("crc check values");
+}
+
+static int test_crc_sizes_offsets(void)
+{
+    chaos_size_t off;
+    chaos_size_t size;
+    chaos_u32_t crc;
+
+    fill_random(g_src, sizeof(g_src));
+
+    for (off = 0U; off < 16U; off++)
+    {
+        for (size = 1U; size <= 1040U; size += ((size < 300U) ? 1U : 37U))
+        {
+            crc = 0U;
+            TEST_ASSERT(chaos_crc32(g_src + off, size, &crc) == CHAOS_STATUS_OK, "crc32 status");
+            TEST_ASSERT(crc == ref_crc(0xEDB88320U, 0U, g_src + off, size), "crc32 matches reference");
+
+            crc = 0U;
+            TEST_ASSERT(chaos_crc32c(g_src + off, size, &crc) == CHAOS_STATUS_OK, "crc32c status");
+            TEST_ASSERT(crc == ref_crc(0x82F63B78U, 0U, g_src + off, size), "crc32c matches reference");
+        }
+    }
+
+    TEST_PASS("crc every path, size and alignment");
+}
+
+static int test_crc_chaining(void)
+{
+    chaos_u32_t whole = 0U;
+    chaos_u32_t parts = 0U;
+    chaos_size_t split;
+
+    fill_random(g_src, sizeof(g_src));
+    (void)chaos_crc32c(g_src, 1000U, &whole);
+
+    for (split = 1U; split < 1000U; split += 61U)
+    {
+        parts = 0U;
+        (void)chaos_crc32c(g_src, split, &parts);
+        (void)chaos_crc32c(g_src + split, 1000U - split, &parts);
+        TEST_ASSERT(parts == whole, "crc32c chained equals one-shot");
+    }
+
+    TEST_PASS("crc chaining across buffers");
+}
+
+static int test_memcpy_crc(void)
+{
+    chaos_size_t off;
+    chaos_size_t size;
+    chaos_u32_t crc;
+
+    fill_random(g_src, sizeof(g_src));
+
+    for (off = 0U; off < 8U; off++)
+    {
+        for (size = 1U; size <= 1040U; size += ((size < 200U) ? 1U : 53U))
+        {
+            memset(g_dst, 0xA5, sizeof(g_dst));
+            crc = 0U;
+            TEST_ASSERT(chaos_memcpy_crc(g_dst + (7U - off), g_src + off, size, CHAOS_CRC_32, &crc) == CHAOS_STATUS_OK, "memcpy_crc status");
+            TEST_ASSERT(memcmp(g_dst + (7U - off), g_src + off, size) == 0, "memcpy_crc copied data");
+            TEST_ASSERT(g_dst[7U - off + size] == 0xA5U, "memcpy_crc no overrun");
+            TEST_ASSERT(crc == ref_crc(0xEDB88320U, 0U, g_src + off, size), "memcpy_crc crc32");
+
+            crc = 0U;
+            TEST_ASSERT(chaos_memcpy_crc(g_dst, g_src + off, size, CHAOS_CRC_32C, &crc) == CHAOS_STATUS_OK, "memcpy_crc 32c status");
+            TEST_ASSERT(crc == ref_crc(0x82F63B78U, 0U, g_src + off, size), "memcpy_crc crc32c");
+        }
+    }
+
+    TEST_PASS("memcpy_crc copies and checksums");
+}
+
+/* Entry [k][b] is the raw register after byte b and k zero bytes, from 0 */
+static int check_table(const chaos_u32_t table[8][256], chaos_u32_t poly)
+{
+    chaos_u8_t msg[8];
+    chaos_size_t k;
+    chaos_size_t b;
+
+    memset(msg, 0, sizeof(msg));
+    for (k = 0U; k < 8U; k++)
+    {
+        for (b = 0U; b < 256U; b++)
+        {
+            msg[0] = (chaos_u8_t)b;
+            if (table[k][b] != ~ref_crc(poly, 0xFFFFFFFFU, msg, k + 1U))
+            {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+static int test_crc_tables(void)
+{
+    TEST_ASSERT(check_table(chaos_crc32_table, 0xEDB88320U), "crc32 table matches reference");
+    TEST_ASSERT(check_table(chaos_crc32c_table, 0x82F63B78U), "crc32c table matches reference");
+
+    TEST_PASS("crc tables, every entry");
+}
+
+static int test_crc_invalid(void)
+{
+    chaos_u32_t crc = 0x1234U;
+
+    TEST_ASSERT(chaos_crc32(NULL, 4U, &crc) != CHAOS_STATUS_OK, "crc32 NULL buf");
+    TEST_ASSERT(chaos_crc32c(g_src, 4U, NULL) != CHAOS_STATUS_OK, "crc32c NULL crc");
+    TEST_ASSERT(chaos_memcpy_crc(NULL, g_src, 4U, CHAOS_CRC_32, &crc) != CHAOS_STATUS_OK, "memcpy_crc NULL dst");
+    TEST_ASSERT(CHAOS_STATUS_CODE(chaos_memcpy_crc(g_dst, g_src, 4U, (chaos_crc_type_t)7, &crc)) == CHAOS_CHECKSUM_BAD_TYPE, "memcpy_crc bad type");
+    TEST_ASSERT(CHAOS_STATUS_CODE(chaos_crc32(g_src, 0U, &crc)) == CHAOS_CHECKSUM_SIZE_ZERO, "crc32 size zero");
+    TEST_ASSERT(crc == 0x1234U, "crc unchanged on error");
+
+    TEST_PASS("crc invalid parameters");
+}
+
+/* -------------------------------------------------------------------------- */
+/* Runner                                                                      */
+/* -------------------------------------------------------------------------- */
+
+int main(void)
+{
+    int failures = 0;
+
+    failures += test_crc_check_values();
+    failures += test_crc_tables();
+    failures += test_crc_sizes_offsets();
+    failures += test_crc_chaining();
+    failures += test_memcpy_crc();
+    failures += test_crc_invalid();
+
+    if (failures == 0)
+    {
+        printf("\nAll chaos_crc tests passed \n");
+        return 0;
+    }
+
+    printf("\n%d test(s) failed \n", failures);
+    return 1;
+}
@@ -0,0 +1,289 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "chaos_hash.h"
+#include "chaos_test.h"
+
+/* -------------------------------------------------------------------------- */
+/* Helpers                                                                     */
+/* -------------------------------------------------------------------------- */
+
+static chaos_u64_t g_rng = 0x9E3779B97F4A7C15ULL;
+
+static chaos_u64_t rng(void)
+{
+    /* xorshift64* */
+    g_rng ^= g_rng >> 12;
+    g_rng ^= g_rng << 25;
+    g_rng ^= g_rng >> 27;
+    return g_rng * 0x2545F4914F6CDD1DULL;
+}
+
+static chaos_u64_t hash(const void *buf, chaos_size_t size, chaos_u64_t seed)
+{
+    chaos_u64_t h = 0U;
+
+    (void)chaos_hash64(buf, size, seed, &h);
+    return h;
+}
+
+static int popcount64(chaos_u64_t v)
+{
+    int n = 0;
+
+    while (v != 0U)
+    {
+        v &= v - 1U;
+        n++;
+    }
+    return n;
+}
+
+static int cmp_u64(const void *a, const void *b)
+{
+    chaos_u64_t x = *(const chaos_u64_t *)a;
+    chaos_u64_t y = *(const chaos_u64_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+/* Number of equal neighbours after sorting */
+static unsigned collisions(chaos_u64_t *v, size_t n, chaos_u64_t mask)
+{
+    unsigned c = 0U;
+    size_t i;
+
+    for (i = 0U; i < n; i++)
+    {
+        v[i] &= mask;
+    }
+    qsort(v, n, sizeof(v[0]), cmp_u64);
+    for (i = 1U; i < n; i++)
+    {
+        c += (v[i] == v[i - 1U]) ? 1U : 0U;
+    }
+    return c;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Tests                                                                       */
+/* -------------------------------------------------------------------------- */
+
+static int test_hash_api(void)
+{
+    chaos_u64_t h = 0U;
+    chaos_u8_t data[4] = { 1U, 2U, 3U, 4U };
+
+    TEST_ASSERT(chaos_hash64(NULL, 0U, 0U, &h) == CHAOS_STATUS_OK, "empty input with NULL buffer");
+    TEST_ASSERT(chaos_hash64(NULL, 4U, 0U, &h) != CHAOS_STATUS_OK, "NULL buffer");
+    TEST_ASSERT(chaos_hash64(data, 4U, 0U, NULL) != CHAOS_STATUS_OK, "NULL output");
+
+    /* Values are part of the contract (stable across targets and releases) */
+    TEST_ASSERT(hash("", 0U, 0U) == 0x0409638EE2BDE459ULL, "known value: empty");
+    TEST_ASSERT(hash("abc", 3U, 0U) == 0x02A4F1D7CB516C72ULL, "known value: abc");
+    TEST_ASSERT(hash("The quick brown fox jumps over the lazy dog. The quick brown fox.", 64U, 7U) == 0x5CF055E3BC04482FULL, "known value: 64 bytes");
+
+    TEST_PASS("hash64 api and known values");
+}
+
+static int test_hash_streaming(void)
+{
+    static chaos_u8_t data[1024];
+    chaos_hash64_state_t st;
+    chaos_u64_t expect;
+    chaos_u64_t got = 0U;
+    chaos_size_t len;
+    chaos_size_t off;
+    chaos_size_t chunk;
+    unsigned round;
+
+    for (len = 0U; len < sizeof(data); len++)
+    {
+        data[len] = (chaos_u8_t)rng();
+    }
+
+    /* Every length up to 200 fed one byte at a time */
+    for (len = 0U; len <= 200U; len++)
+    {
+        expect = hash(data, len, 42U);
+        (void)chaos_hash64_init(&st, 42U);
+        for (off = 0U; off < len; off++)
+        {
+            (void)chaos_hash64_update(&st, &data[off], 1U);
+        }
+        (void)chaos_hash64_final(&st, &got);
+        TEST_ASSERT(got == expect, "bytewise stream matches one-shot");
+    }
+
+    /* Random lengths split at random points */
+    for (round = 0U; round < 2000U; round++)
+    {
+        len = (chaos_size_t)(rng() % sizeof(data));
+        expect = hash(data, len, round);
+        (void)chaos_hash64_init(&st, round);
+        for (off = 0U; off < len; off += chunk)
+        {
+            chunk = (chaos_size_t)(rng() % 130U);
+            chunk = ((len - off) < chunk) ? (len - off) : chunk;
+            TEST_ASSERT(chaos_hash64_update(&st, &data[off], chunk) == CHAOS_STATUS_OK, "update");
+        }
+        TEST_ASSERT((chaos_hash64_final(&st, &got) == CHAOS_STATUS_OK) && (got == expect), "split stream matches one-shot");
+    }
+
+    TEST_PASS("hash64 streaming equals one-shot");
+}
+
+static int test_hash_avalanche(void)
+{
+    /* 1-byte keys have too few flip pairs for a bias estimate; see the exhaustive test */
+    static const chaos_size_t lens[] = { 2U, 3U, 4U, 8U, 15U, 16U, 17U, 31U, 48U, 49U, 64U, 200U };
+    static unsigned flips[64];
+    chaos_u8_t key[200];
+    chaos_u64_t base;
+    chaos_u64_t diff;
+    unsigned trials;
+    unsigned t;
+    size_t l;
+    chaos_size_t bit;
+    unsigned o;
+    double p;
+    double worst = 0.0;
+
+    /* Each input bit must flip each output bit with probability ~1/2 */
+    for (l = 0U; l < (sizeof(lens) / sizeof(lens[0])); l++)
+    {
+        memset(flips, 0, sizeof(flips));
+        trials = 0U;
+        /* At least 32k flips per length, so sampling noise stays well under 1% */
+        for (t = 0U; t < ((4096U / (unsigned)lens[l]) + 200U); t++)
+        {
+            for (bit = 0U; bit < lens[l]; bit++)
+            {
+                key[bit] = (chaos_u8_t)rng();
+            }
+            base = hash(key, lens[l], 0U);
+            for (bit = 0U; bit < (lens[l] * 8U); bit++)
+            {
+                key[bit >> 3] ^= (chaos_u8_t)(1U << (bit & 7U));
+                diff = base ^ hash(key, lens[l], 0U);
+                key[bit >> 3] ^= (chaos_u8_t)(1U << (bit & 7U));
+                for (o = 0U; o < 64U; o++)
+                {
+                    flips[o] += (unsigned)((diff >> o) & 1U);
+                }
+                trials++;
+            }
+        }
+        for (o = 0U; o < 64U; o++)
+        {
+            p = (double)flips[o] / (double)trials;
+            p = (p > 0.5) ? (p - 0.5) : (0.5 - p);
+            worst = (p > worst) ? p : worst;
+        }
+    }
+    printf("[INFO] worst avalanche bias %.4f\n", worst);
+    TEST_ASSERT(worst < 0.02, "avalanche bias below 2%");
+
+    TEST_PASS("hash64 avalanche");
+}
+
+static int test_hash_sparse(void)
+{
+    static chaos_u64_t h[32896 + 1];
+    chaos_u8_t key[32];
+    size_t n = 0U;
+    unsigned a;
+    unsigned b;
+    unsigned low32;
+
+    /* All 32-byte keys with at most two bits set */
+    memset(key, 0, sizeof(key));
+    h[n++] = hash(key, sizeof(key), 0U);
+    for (a = 0U; a < 256U; a++)
+    {
+        key[a >> 3] ^= (chaos_u8_t)(1U << (a & 7U));
+        h[n++] = hash(key, sizeof(key), 0U);
+        for (b = a + 1U; b < 256U; b++)
+        {
+            key[b >> 3] ^= (chaos_u8_t)(1U << (b & 7U));
+            h[n++] = hash(key, sizeof(key), 0U);
+            key[b >> 3] ^= (chaos_u8_t)(1U << (b & 7U));
+        }
+        key[a >> 3] ^= (chaos_u8_t)(1U << (a & 7U));
+    }
+
+    TEST_ASSERT(collisions(h, n, ~0ULL) == 0U, "no 64-bit collision on sparse keys");
+    /* ~0.13 expected for 32896 keys in 2^32; allow a little luck */
+    low32 = collisions(h, n, 0xFFFFFFFFULL);
+    TEST_ASSERT(low32 <= 3U, "low 32 bits as good as random");
+
+    TEST_PASS("hash64 sparse keys");
+}
+
+static int test_hash_lengths_and_seeds(void)
+{
+    static chaos_u64_t h[65536 + 256];
+    static chaos_u8_t zeros[1024];
+    chaos_u8_t key[2];
+    chaos_size_t len;
+    chaos_u64_t seed;
+    unsigned k;
+    int bits;
+    int worst = 64;
+
+    /* Every 1- and 2-byte key */
+    for (k = 0U; k < 65536U; k++)
+    {
+        key[0] = (chaos_u8_t)k;
+        key[1] = (chaos_u8_t)(k >> 8);
+        h[k] = hash(key, 2U, 0U);
+    }
+    for (k = 0U; k < 256U; k++)
+    {
+        key[0] = (chaos_u8_t)k;
+        h[65536U + k] = hash(key, 1U, 0U);
+    }
+    TEST_ASSERT(collisions(h, 65536U + 256U, ~0ULL) == 0U, "short keys all distinct");
+
+    /* Zero-filled keys differ only by length */
+    for (len = 0U; len <= 1024U; len++)
+    {
+        h[len] = hash(zeros, len, 0U);
+    }
+    TEST_ASSERT(collisions(h, 1025U, ~0ULL) == 0U, "length is hashed");
+
+    /* Neighbouring seeds give unrelated functions */
+    for (seed = 0U; seed < 1000U; seed++)
+    {
+        bits = popcount64(hash("parameter", 9U, seed) ^ hash("parameter", 9U, seed + 1U));
+        worst = (bits < worst) ? bits : worst;
+    }
+    TEST_ASSERT(worst >= 12, "seed changes flip many bits");
+
+    TEST_PASS("hash64 lengths and seeds");
+}
+
+/* -------------------------------------------------------------------------- */
+/* Runner                                                                      */
+/* -------------------------------------------------------------------------- */
+
+int main(void)
+{
+    int failures = 0;
+
+    failures += test_hash_api();
+    failures += test_hash_streaming();
+    failures += test_hash_avalanche();
+    failures += test_hash_sparse();
+    failures += test_hash_lengths_and_seeds();
+
+    if (failures == 0)
+    {
+        printf("\nAll chaos_hash tests passed \n");
+        return 0;
+    }
+
+    printf("\n%d test(s) failed \n", failures);
+    return 1;
+}
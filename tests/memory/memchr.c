@@ -0,0 +1,140 @@
+#include <string.h>
+
+#include "chaos_memory.h"
+#include "chaos_types.h"
+#include "chaos_status.h"
+
+#include "chaos_test.h"
+
+/* -------------------------------------------------------------------------- */
+/* Helpers                                                                     */
+/* -------------------------------------------------------------------------- */
+
+static chaos_u8_t g_buf[520];
+
+static chaos_size_t ref_first(const chaos_u8_t *p, chaos_size_t size, chaos_u8_t v)
+{
+    chaos_size_t i = 0U;
+    while ((i < size) && (p[i] != v))
+    {
+        i++;
+    }
+    return i;
+}
+
+static chaos_size_t ref_last(const chaos_u8_t *p, chaos_size_t size, chaos_u8_t v)
+{
+    chaos_size_t i = size;
+    while ((i > 0U) && (p[i - 1U] != v))
+    {
+        i--;
+    }
+    return (i == 0U) ? size : (i - 1U);
+}
+
+/* -------------------------------------------------------------------------- */
+/* Tests                                                                       */
+/* -------------------------------------------------------------------------- */
+
+static int test_memchr_nominal(void)
+{
+    const chaos_u8_t frame[] = {0x00, 0x11, 0xEB, 0x90, 0x22, 0xEB, 0x90};
+    chaos_size_t offset = 0U;
+    chaos_bool_t found = CHAOS_FALSE;
+
+    TEST_ASSERT(chaos_memchr(frame, sizeof(frame), 0xEBU, &offset, &found) == CHAOS_STATUS_OK, "memchr status");
+    TEST_ASSERT((found == CHAOS_TRUE) && (offset == 2U), "memchr first sync byte");
+
+    TEST_ASSERT(chaos_memrchr(frame, sizeof(frame), 0xEBU, &offset, &found) == CHAOS_STATUS_OK, "memrchr status");
+    TEST_ASSERT((found == CHAOS_TRUE) && (offset == 5U), "memrchr last sync byte");
+
+    TEST_ASSERT(chaos_memchr(frame, sizeof(frame), 0x7FU, &offset, &found) == CHAOS_STATUS_OK, "memchr miss status");
+    TEST_ASSERT((found == CHAOS_FALSE) && (offset == sizeof(frame)), "memchr miss");
+
+    TEST_PASS("memchr nominal");
+}
+
+static int test_memchr_exhaustive(void)
+{
+    chaos_size_t offset = 0U;
+    chaos_bool_t found = CHAOS_FALSE;
+
+    for (chaos_size_t i = 0U; i < sizeof(g_buf); i++)
+    {
+        g_buf[i] = (chaos_u8_t)((i % 200U) + 1U);
+    }
+
+    /* Every start alignment, a range of sizes, needles at every position */
+    for (chaos_size_t start = 0U; start < 9U; start++)
+    {
+        for (chaos_size_t size = 1U; size < 300U; size += 13U)
+        {
+            for (chaos_size_t pos = 0U; pos <= size; pos += 5U)
+            {
+                chaos_u8_t saved = 0U;
+                chaos_u8_t *p = &g_buf[start];
+
+                if (pos < size)
+                {
+                    saved = p[pos];
+                    p[pos] = 0x00U;
+                }
+
+                TEST_ASSERT(chaos_memchr(p, size, 0x00U, &offset, &found) == CHAOS_STATUS_OK, "memchr status");
+                TEST_ASSERT(offset == ref_first(p, size, 0x00U), "memchr offset mismatch");
+                TEST_ASSERT(found == (chaos_bool_t)(pos < size), "memchr found mismatch");
+
+                TEST_ASSERT(chaos_memrchr(p, size, 0x00U, &offset, &found) == CHAOS_STATUS_OK, "memrchr status");
+                TEST_ASSERT(offset == ref_last(p, size, 0x00U), "memrchr offset mismatch");
+
+                /* Needle repeated by the pattern: both ends of the range */
+                TEST_ASSERT(chaos_memchr(p, size, 0x80U, &offset, &found) == CHAOS_STATUS_OK, "memchr high status");
+                TEST_ASSERT(offset == ref_first(p, size, 0x80U), "memchr high-bit offset mismatch");
+                TEST_ASSERT(chaos_memrchr(p, size, 0x80U, &offset, &found) == CHAOS_STATUS_OK, "memrchr high status");
+                TEST_ASSERT(offset == ref_last(p, size, 0x80U), "memrchr high-bit offset mismatch");
+
+                if (pos < size)
+                {
+                    p[pos] = saved;
+                }
+            }
+        }
+    }
+
+    TEST_PASS("memchr exhaustive alignment/size/position");
+}
+
+static int test_memchr_invalid(void)
+{
+    chaos_size_t offset = 0U;
+    chaos_bool_t found = CHAOS_FALSE;
+
+    TEST_ASSERT(chaos_memchr(NULL, 4U, 0U, &offset, &found) != CHAOS_STATUS_OK, "memchr NULL buf");
+    TEST_ASSERT(chaos_memchr(g_buf, 4U, 0U, NULL, &found) != CHAOS_STATUS_OK, "memchr NULL offset");
+    TEST_ASSERT(chaos_memrchr(g_buf, 4U, 0U, &offset, NULL) != CHAOS_STATUS_OK, "memrchr NULL found");
+    TEST_ASSERT(CHAOS_STATUS_CODE(chaos_memchr(g_buf, 0U, 0U, &offset, &found)) == CHAOS_MEM_SIZE_ZERO, "memchr size zero");
+
+    TEST_PASS("memchr invalid parameters");
+}
+
+/* -------------------------------------------------------------------------- */
+/* Runner                                                                      */
+/* -------------------------------------------------------------------------- */
+
+int main(void)
+{
+    int failures = 0;
+
+    failures += test_memchr_nominal();
+    failures += test_memchr_exhaustive();
+    failures += test_memchr_invalid();
+
+    if (failures == 0)
+    {
+        printf("\nAll chaos_memchr tests passed \n");
+        return 0;
+    }
+
+    printf("\n%d test(s) failed \n", failures);
+    return 1;
+}
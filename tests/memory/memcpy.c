@@ -27,6 +27,37 @@ static int test_memcpy_nominal(void)
     TEST_PASS("memcpy nominal");
 }
 
+static int test_memcpy_wide_unaligned(void)
+{
+    static chaos_u8_t src[512];
+    static chaos_u8_t dst[512];
+
+    for (chaos_size_t i = 0U; i < sizeof(src); i++)
+    {
+        src[i] = (chaos_u8_t)(i * 13U + 5U);
+    }
+
+    for (chaos_size_t so = 0U; so < 8U; so++)
+    {
+        for (chaos_size_t doff = 0U; doff < 8U; doff++)
+        {
+            for (chaos_size_t size = 1U; size < 300U; size += 37U)
+            {
+                memset(dst, 0xEE, sizeof(dst));
+
+                chaos_status_t status = chaos_memcpy(&dst[doff], &src[so], size);
+
+                TEST_ASSERT(status == CHAOS_STATUS_OK, "wide copy status");
+                TEST_ASSERT(memcmp(&dst[doff], &src[so], size) == 0, "wide copy content mismatch");
+                TEST_ASSERT((doff == 0U) || (dst[doff - 1U] == 0xEEU), "wide copy wrote before dst");
+                TEST_ASSERT(dst[doff + size] == 0xEEU, "wide copy wrote past end");
+            }
+        }
+    }
+
+    TEST_PASS("memcpy wide unaligned");
+}
+
 static int test_memcpy_dst_null(void)
 {
     chaos_u8_t src[4] = {1,2,3,4};
@@ -81,6 +112,7 @@ int main(void)
     int failures = 0;
 
     failures += test_memcpy_nominal();
+    failures += test_memcpy_wide_unaligned();
     failures += test_memcpy_dst_null();
     failures += test_memcpy_src_null();
     failures += test_memcpy_size_zero();
@@ -0,0 +1,180 @@
+#include <string.h>
+
+#include "chaos_memory_async.h"
+#include "chaos_types.h"
+#include "chaos_status.h"
+
+#include "chaos_test.h"
+
+/* -------------------------------------------------------------------------- */
+/* Helpers                                                                     */
+/* -------------------------------------------------------------------------- */
+
+#define ASYNC_SIZE (1024U * 1024U)
+#define ASYNC_JOBS 4U
+
+static chaos_u8_t g_src[ASYNC_JOBS][ASYNC_SIZE];
+static chaos_u8_t g_dst[ASYNC_JOBS][ASYNC_SIZE];
+
+static void fill_pattern(chaos_u8_t *p, chaos_size_t size, chaos_u32_t seed)
+{
+    chaos_size_t i;
+
+    for (i = 0U; i < size; i++)
+    {
+        seed = (seed * 1664525U) + 1013904223U;
+        p[i] = (chaos_u8_t)(seed >> 24U);
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+/* Tests                                                                       */
+/* -------------------------------------------------------------------------- */
+
+static int test_memcpy_async_overlap_work(void)
+{
+    chaos_mem_async_t handle;
+    chaos_bool_t done = CHAOS_FALSE;
+    chaos_u32_t work = 0U;
+
+    fill_pattern(g_src[0], ASYNC_SIZE, 1U);
+    memset(g_dst[0], 0, ASYNC_SIZE);
+
+    TEST_ASSERT(chaos_memcpy_async(g_dst[0], g_src[0], ASYNC_SIZE, &handle) == CHAOS_STATUS_OK, "memcpy_async status");
+
+    /* Caller keeps computing until the copy reports completion */
+    while (done == CHAOS_FALSE)
+    {
+        work++;
+        TEST_ASSERT(chaos_memcpy_poll(&handle, &done) == CHAOS_STATUS_OK, "memcpy_poll status");
+    }
+
+    TEST_ASSERT(work != 0U, "caller ran while copying");
+    TEST_ASSERT(chaos_memcpy_wait(&handle) == CHAOS_STATUS_OK, "memcpy_wait status");
+    TEST_ASSERT(memcmp(g_dst[0], g_src[0], ASYNC_SIZE) == 0, "memcpy_async data");
+    TEST_ASSERT(chaos_memcpy_wait(&handle) == CHAOS_STATUS_OK, "second wait is harmless");
+
+    TEST_PASS("memcpy_async poll/wait");
+}
+
+static int test_memcpy_async_concurrent(void)
+{
+    chaos_mem_async_t handles[ASYNC_JOBS];
+    chaos_size_t i;
+
+    for (i = 0U; i < ASYNC_JOBS; i++)
+    {
+        fill_pattern(g_src[i], ASYNC_SIZE, (chaos_u32_t)(i + 10U));
+        memset(g_dst[i], 0, ASYNC_SIZE);
+        TEST_ASSERT(chaos_memcpy_async(g_dst[i], g_src[i], ASYNC_SIZE - (chaos_size_t)i, &handles[i]) == CHAOS_STATUS_OK, "concurrent submit");
+    }
+
+    for (i = ASYNC_JOBS; i > 0U; i--)
+    {
+        TEST_ASSERT(chaos_memcpy_wait(&handles[i - 1U]) == CHAOS_STATUS_OK, "concurrent wait");
+        TEST_ASSERT(memcmp(g_dst[i - 1U], g_src[i - 1U], ASYNC_SIZE - (i - 1U)) == 0, "concurrent data");
+        TEST_ASSERT((i == 1U) || (g_dst[i - 1U][ASYNC_SIZE - 1U] == 0U), "concurrent bounds");
+    }
+
+    TEST_PASS("memcpy_async several copies in flight");
+}
+
+static int test_memcpy_async_thread(void)
+{
+#if (CHAOS_ENABLE_THREADS == 1)
+    chaos_mem_async_t handle;
+    chaos_bool_t done = CHAOS_TRUE;
+    chaos_bool_t seen_busy = CHAOS_FALSE;
+    chaos_u32_t attempt;
+
+    fill_pattern(g_src[1], ASYNC_SIZE, 3U);
+
+    /*
+     * The copy runs on its own thread, so a poll straight after submitting
+     * normally finds it in progress. A few attempts keep a badly timed
+     * preemption from failing the test.
+     */
+    for (attempt = 0U; (attempt < 8U) && (seen_busy == CHAOS_FALSE); attempt++)
+    {
+        memset(g_dst[1], 0, ASYNC_SIZE);
+        TEST_ASSERT(chaos_memcpy_async(g_dst[1], g_src[1], ASYNC_SIZE, &handle) == CHAOS_STATUS_OK, "threaded submit");
+        TEST_ASSERT(handle.priv[CHAOS_DMA_PRIVATE_WORDS - 1U] == 1U, "thread recorded for join");
+        TEST_ASSERT(chaos_memcpy_poll(&handle, &done) == CHAOS_STATUS_OK, "threaded poll");
+        seen_busy = (done == CHAOS_FALSE) ? CHAOS_TRUE : CHAOS_FALSE;
+
+        TEST_ASSERT(chaos_memcpy_wait(&handle) == CHAOS_STATUS_OK, "threaded wait");
+        TEST_ASSERT(handle.priv[CHAOS_DMA_PRIVATE_WORDS - 1U] == 0U, "thread joined by wait");
+        TEST_ASSERT((chaos_memcpy_poll(&handle, &done) == CHAOS_STATUS_OK) && (done == CHAOS_TRUE), "done after wait");
+        TEST_ASSERT(memcmp(g_dst[1], g_src[1], ASYNC_SIZE) == 0, "threaded data");
+    }
+
+    TEST_ASSERT(seen_busy == CHAOS_TRUE, "poll saw the copy in progress");
+#endif
+
+    TEST_PASS("memcpy_async background thread");
+}
+
+static int test_memcpy_async_busy(void)
+{
+    chaos_mem_async_t handle;
+    chaos_status_t st;
+
+    fill_pattern(g_src[0], 64U, 7U);
+    TEST_ASSERT(chaos_memcpy_async(g_dst[0], g_src[0], 64U, &handle) == CHAOS_STATUS_OK, "memcpy_async status");
+    TEST_ASSERT(chaos_memcpy_wait(&handle) == CHAOS_STATUS_OK, "memcpy_wait status");
+
+    /* Pretend the engine never finishes: the wait gives up instead of spinning */
+    handle.state = (chaos_u32_t)CHAOS_DMA_BUSY;
+    st = chaos_memcpy_wait(&handle);
+    TEST_ASSERT(CHAOS_STATUS_SEVERITY(st) == CHAOS_SEVERITY_WARNING, "busy wait is a warning");
+    TEST_ASSERT(CHAOS_STATUS_CODE(st) == CHAOS_MEM_BUSY, "busy wait status");
+
+    /* Once the engine completes, waiting again collects the result */
+    handle.state = (chaos_u32_t)CHAOS_DMA_DONE;
+    TEST_ASSERT(chaos_memcpy_wait(&handle) == CHAOS_STATUS_OK, "wait after busy");
+    TEST_ASSERT(memcmp(g_dst[0], g_src[0], 64U) == 0, "busy copy data");
+
+    TEST_PASS("memcpy_async bounded wait");
+}
+
+static int test_memcpy_async_invalid(void)
+{
+    chaos_mem_async_t handle;
+    chaos_bool_t done = CHAOS_FALSE;
+
+    TEST_ASSERT(chaos_memcpy_async(NULL, g_src[0], 16U, &handle) != CHAOS_STATUS_OK, "memcpy_async NULL dst");
+    TEST_ASSERT(chaos_memcpy_async(g_dst[0], g_src[0], 16U, NULL) != CHAOS_STATUS_OK, "memcpy_async NULL handle");
+    TEST_ASSERT(chaos_memcpy_poll(NULL, &done) != CHAOS_STATUS_OK, "memcpy_poll NULL handle");
+    TEST_ASSERT(chaos_memcpy_wait(NULL) != CHAOS_STATUS_OK, "memcpy_wait NULL handle");
+
+    /* A rejected copy is immediately complete and reports its status on wait */
+    TEST_ASSERT(CHAOS_STATUS_CODE(chaos_memcpy_async(g_dst[0], g_src[0], 0U, &handle)) == CHAOS_MEM_SIZE_ZERO, "memcpy_async size zero");
+    TEST_ASSERT((chaos_memcpy_poll(&handle, &done) == CHAOS_STATUS_OK) && (done == CHAOS_TRUE), "rejected copy polls done");
+    TEST_ASSERT(CHAOS_STATUS_CODE(chaos_memcpy_wait(&handle)) == CHAOS_MEM_SIZE_ZERO, "rejected copy wait status");
+
+    TEST_PASS("memcpy_async invalid parameters");
+}
+
+/* -------------------------------------------------------------------------- */
+/* Runner                                                                      */
+/* -------------------------------------------------------------------------- */
+
+int main(void)
+{
+    int failures = 0;
+
+    failures += test_memcpy_async_overlap_work();
+    failures += test_memcpy_async_concurrent();
+    failures += test_memcpy_async_thread();
+    failures += test_memcpy_async_busy();
+    failures += test_memcpy_async_invalid();
+
+    if (failures == 0)
+    {
+        printf("\nAll chaos_memcpy_async tests passed \n");
+        return 0;
+    }
+
+    printf("\n%d test(s) failed \n", failures);
+    return 1;
+}
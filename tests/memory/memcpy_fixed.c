@@ -0,0 +1,141 @@
+#include <string.h>
+
+#include "chaos_memory_fixed.h"
+#include "chaos_types.h"
+#include "chaos_status.h"
+
+#include "chaos_test.h"
+
+/* -------------------------------------------------------------------------- */
+/* Helpers                                                                     */
+/* -------------------------------------------------------------------------- */
+
+static chaos_u8_t g_src[80];
+static chaos_u8_t g_dst[80];
+
+static void reset_buffers(void)
+{
+    for (chaos_size_t i = 0U; i < sizeof(g_src); i++)
+    {
+        g_src[i] = (chaos_u8_t)(i + 1U);
+        g_dst[i] = 0xEEU;
+    }
+}
+
+/* Each expansion uses a literal size so the inline path is exercised */
+#define CHECK_COPY(n)                                                          \
+    do                                                                         \
+    {                                                                          \
+        reset_buffers();                                                       \
+        TEST_ASSERT(chaos_memcpy_fixed(&g_dst[1], &g_src[3], (n)) == CHAOS_STATUS_OK, "fixed copy status"); \
+        TEST_ASSERT(memcmp(&g_dst[1], &g_src[3], (n)) == 0, "fixed copy content"); \
+        TEST_ASSERT((g_dst[0] == 0xEEU) && (g_dst[(n) + 1U] == 0xEEU), "fixed copy bounds"); \
+    } while (0)
+
+#define CHECK_FILL(n)                                                          \
+    do                                                                         \
+    {                                                                          \
+        reset_buffers();                                                       \
+        TEST_ASSERT(chaos_memset_fixed(&g_dst[1], 0x5AU, (n)) == CHAOS_STATUS_OK, "fixed fill status"); \
+        for (chaos_size_t k = 1U; k <= (n); k++)                               \
+        {                                                                      \
+            TEST_ASSERT(g_dst[k] == 0x5AU, "fixed fill content");              \
+        }                                                                      \
+        TEST_ASSERT((g_dst[0] == 0xEEU) && (g_dst[(n) + 1U] == 0xEEU), "fixed fill bounds"); \
+    } while (0)
+
+/* -------------------------------------------------------------------------- */
+/* Tests                                                                       */
+/* -------------------------------------------------------------------------- */
+
+static int test_memcpy_fixed_sizes(void)
+{
+    CHECK_COPY(1U);
+    CHECK_COPY(2U);
+    CHECK_COPY(3U);
+    CHECK_COPY(4U);
+    CHECK_COPY(7U);
+    CHECK_COPY(8U);
+    CHECK_COPY(12U);
+    CHECK_COPY(16U);
+    CHECK_COPY(24U);
+    CHECK_COPY(31U);
+    CHECK_COPY(32U);
+    CHECK_COPY(48U);
+    CHECK_COPY(63U);
+    CHECK_COPY(64U);
+    CHECK_COPY(65U);
+
+    TEST_PASS("memcpy_fixed constant sizes");
+}
+
+static int test_memset_fixed_sizes(void)
+{
+    CHECK_FILL(1U);
+    CHECK_FILL(2U);
+    CHECK_FILL(5U);
+    CHECK_FILL(8U);
+    CHECK_FILL(15U);
+    CHECK_FILL(16U);
+    CHECK_FILL(40U);
+    CHECK_FILL(64U);
+    CHECK_FILL(70U);
+
+    TEST_PASS("memset_fixed constant sizes");
+}
+
+static int test_memcpy_fixed_runtime_size(void)
+{
+    volatile chaos_size_t size = 37U;
+
+    reset_buffers();
+    TEST_ASSERT(chaos_memcpy_fixed(g_dst, g_src, size) == CHAOS_STATUS_OK, "runtime size status");
+    TEST_ASSERT(memcmp(g_dst, g_src, 37U) == 0, "runtime size content");
+
+    TEST_PASS("memcpy_fixed runtime size");
+}
+
+static int test_memcpy_fixed_validation(void)
+{
+    chaos_status_t status;
+
+    status = chaos_memcpy_fixed(NULL, g_src, 8U);
+    TEST_ASSERT(status != CHAOS_STATUS_OK, "NULL dst should fail");
+
+    status = chaos_memcpy_fixed(g_dst, NULL, 8U);
+    TEST_ASSERT(status != CHAOS_STATUS_OK, "NULL src should fail");
+
+    status = chaos_memcpy_fixed(g_dst, g_src, 0U);
+    TEST_ASSERT(CHAOS_STATUS_CODE(status) == CHAOS_MEM_SIZE_ZERO, "size zero warning");
+
+    status = chaos_memcpy_fixed(g_dst, g_dst, 8U);
+    TEST_ASSERT(CHAOS_STATUS_CODE(status) == CHAOS_MEM_SRC_EQ_DST, "dst == src warning");
+
+    status = chaos_memset_fixed(NULL, 0U, 8U);
+    TEST_ASSERT(status != CHAOS_STATUS_OK, "memset NULL dst should fail");
+
+    TEST_PASS("memcpy_fixed validation");
+}
+
+/* -------------------------------------------------------------------------- */
+/* Runner                                                                      */
+/* -------------------------------------------------------------------------- */
+
+int main(void)
+{
+    int failures = 0;
+
+    failures += test_memcpy_fixed_sizes();
+    failures += test_memset_fixed_sizes();
+    failures += test_memcpy_fixed_runtime_size();
+    failures += test_memcpy_fixed_validation();
+
+    if (failures == 0)
+    {
+        printf("\nAll chaos_memcpy_fixed tests passed \n");
+        return 0;
+    }
+
+    printf("\n%d test(s) failed \n", failures);
+    return 1;
+}
@@ -0,0 +1,146 @@
+#include <string.h>
+
+#include "chaos_memory.h"
+#include "chaos_types.h"
+#include "chaos_status.h"
+
+#include "chaos_test.h"
+
+/* -------------------------------------------------------------------------- */
+/* Tests                                                                       */
+/* -------------------------------------------------------------------------- */
+
+static int test_gather_nominal(void)
+{
+    chaos_u8_t header[4]   = {0xA0, 0xA1, 0xA2, 0xA3};
+    chaos_u8_t payload[70] = {0};
+    chaos_u8_t trailer[2]  = {0xF0, 0xF1};
+    chaos_u8_t packet[96];
+    chaos_size_t total = 0U;
+
+    for (chaos_size_t i = 0U; i < sizeof(payload); i++)
+    {
+        payload[i] = (chaos_u8_t)i;
+    }
+
+    chaos_iovec_t iov[4] = {
+        {header, sizeof(header)},
+        {payload, sizeof(payload)},
+        {NULL, 0U},
+        {trailer, sizeof(trailer)},
+    };
+
+    memset(packet, 0xEE, sizeof(packet));
+
+    chaos_status_t status = chaos_memcpy_gather(packet, sizeof(packet), iov, 4U, &total);
+
+    TEST_ASSERT(status == CHAOS_STATUS_OK, "gather status should be OK");
+    TEST_ASSERT(total == 76U, "gather total length");
+    TEST_ASSERT(memcmp(&packet[0], header, 4U) == 0, "gather header");
+    TEST_ASSERT(memcmp(&packet[4], payload, 70U) == 0, "gather payload");
+    TEST_ASSERT(memcmp(&packet[74], trailer, 2U) == 0, "gather trailer");
+    TEST_ASSERT(packet[76] == 0xEEU, "gather wrote past total");
+
+    TEST_PASS("gather nominal");
+}
+
+static int test_gather_overflow(void)
+{
+    chaos_u8_t a[8] = {0};
+    chaos_u8_t b[8] = {0};
+    chaos_u8_t packet[12];
+    chaos_size_t total = 0U;
+    chaos_iovec_t iov[2] = {{a, sizeof(a)}, {b, sizeof(b)}};
+
+    memset(packet, 0xEE, sizeof(packet));
+
+    chaos_status_t status = chaos_memcpy_gather(packet, sizeof(packet), iov, 2U, &total);
+
+    TEST_ASSERT(CHAOS_STATUS_CODE(status) == CHAOS_MEM_OVERFLOW, "gather overflow detected");
+    TEST_ASSERT(packet[0] == 0xEEU, "gather must not write on overflow");
+
+    TEST_PASS("gather overflow");
+}
+
+static int test_gather_null_fragment(void)
+{
+    chaos_u8_t packet[16];
+    chaos_size_t total = 0U;
+    chaos_iovec_t iov[1] = {{NULL, 4U}};
+
+    chaos_status_t status = chaos_memcpy_gather(packet, sizeof(packet), iov, 1U, &total);
+    TEST_ASSERT(CHAOS_STATUS_CLASS(status) == CHAOS_ERRCLASS_NULL_PTR, "NULL fragment rejected");
+
+    status = chaos_memcpy_gather(NULL, sizeof(packet), iov, 1U, &total);
+    TEST_ASSERT(status != CHAOS_STATUS_OK, "NULL dst rejected");
+
+    status = chaos_memcpy_gather(packet, sizeof(packet), iov, 0U, &total);
+    TEST_ASSERT(CHAOS_STATUS_CODE(status) == CHAOS_MEM_SIZE_ZERO, "empty list warning");
+
+    TEST_PASS("gather NULL fragment");
+}
+
+static int test_scatter_nominal(void)
+{
+    chaos_u8_t src[20];
+    chaos_u8_t a[3]  = {0};
+    chaos_u8_t b[10] = {0};
+    chaos_u8_t c[16];
+    chaos_iovec_t iov[3] = {{a, sizeof(a)}, {b, sizeof(b)}, {c, sizeof(c)}};
+
+    for (chaos_size_t i = 0U; i < sizeof(src); i++)
+    {
+        src[i] = (chaos_u8_t)(i + 100U);
+    }
+    memset(c, 0xEE, sizeof(c));
+
+    chaos_status_t status = chaos_memcpy_scatter(iov, 3U, src, sizeof(src));
+
+    TEST_ASSERT(status == CHAOS_STATUS_OK, "scatter status should be OK");
+    TEST_ASSERT(memcmp(a, &src[0], 3U) == 0, "scatter first fragment");
+    TEST_ASSERT(memcmp(b, &src[3], 10U) == 0, "scatter second fragment");
+    TEST_ASSERT(memcmp(c, &src[13], 7U) == 0, "scatter third fragment");
+    TEST_ASSERT(c[7] == 0xEEU, "scatter wrote past size");
+
+    TEST_PASS("scatter nominal");
+}
+
+static int test_scatter_overflow(void)
+{
+    chaos_u8_t src[20] = {0};
+    chaos_u8_t a[4];
+    chaos_iovec_t iov[1] = {{a, sizeof(a)}};
+
+    memset(a, 0xEE, sizeof(a));
+
+    chaos_status_t status = chaos_memcpy_scatter(iov, 1U, src, sizeof(src));
+
+    TEST_ASSERT(CHAOS_STATUS_CODE(status) == CHAOS_MEM_OVERFLOW, "scatter overflow detected");
+    TEST_ASSERT(a[0] == 0xEEU, "scatter must not write on overflow");
+
+    TEST_PASS("scatter overflow");
+}
+
+/* -------------------------------------------------------------------------- */
+/* Runner                                                                      */
+/* -------------------------------------------------------------------------- */
+
+int main(void)
+{
+    int failures = 0;
+
+    failures += test_gather_nominal();
+    failures += test_gather_overflow();
+    failures += test_gather_null_fragment();
+    failures += test_scatter_nominal();
+    failures += test_scatter_overflow();
+
+    if (failures == 0)
+    {
+        printf("\nAll chaos_memcpy_gather/scatter tests passed \n");
+        return 0;
+    }
+
+    printf("\n%d test(s) failed \n", failures);
+    return 1;
+}
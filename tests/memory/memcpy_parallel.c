@@ -0,0 +1,180 @@
+#include <string.h>
+
+#include "chaos_memory.h"
+#include "chaos_parallel.h"
+#include "chaos_types.h"
+#include "chaos_status.h"
+
+#if (CHAOS_ENABLE_THREADS == 1)
+#include <pthread.h>
+#endif
+
+#include "chaos_test.h"
+
+/* -------------------------------------------------------------------------- */
+/* Helpers                                                                     */
+/* -------------------------------------------------------------------------- */
+
+#define BIG_SIZE ((3U * CHAOS_MEM_PARALLEL_THRESHOLD) + 77U)
+
+static chaos_u8_t g_src[BIG_SIZE + 64U];
+static chaos_u8_t g_dst[BIG_SIZE + 64U];
+
+static void fill_random(chaos_u8_t *p, chaos_size_t size)
+{
+    chaos_u32_t x = 0xC0FFEEU;
+    chaos_size_t i;
+
+    for (i = 0U; i < size; i++)
+    {
+        x = (x * 1664525U) + 1013904223U;
+        p[i] = (chaos_u8_t)(x >> 24U);
+    }
+}
+
+static int all_equal(const chaos_u8_t *p, chaos_size_t size, chaos_u8_t value)
+{
+    chaos_size_t i;
+
+    for (i = 0U; i < size; i++)
+    {
+        if (p[i] != value)
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+#if (CHAOS_ENABLE_THREADS == 1)
+#define POOL_TASKS 6U
+
+static pthread_t g_ran_on[POOL_TASKS];
+static chaos_u32_t g_hits[POOL_TASKS];
+
+static void record_task(void *ctx, chaos_size_t index)
+{
+    (void)ctx;
+    g_ran_on[index] = pthread_self();
+    g_hits[index]++;
+}
+
+/* Runs a whole parallel call from inside a task */
+static void nested_task(void *ctx, chaos_size_t index)
+{
+    (void)index;
+    (void)chaos_parallel_run(record_task, CHAOS_NULL, POOL_TASKS);
+    *(chaos_u32_t *)ctx += 1U;
+}
+#endif
+
+/* -------------------------------------------------------------------------- */
+/* Tests                                                                       */
+/* -------------------------------------------------------------------------- */
+
+static int test_memcpy_parallel_threads(void)
+{
+    const chaos_size_t threads[] = {0U, 1U, 2U, 3U, 7U, 64U};
+    chaos_size_t t;
+
+    fill_random(g_src, sizeof(g_src));
+
+    for (t = 0U; t < (sizeof(threads) / sizeof(threads[0])); t++)
+    {
+        memset(g_dst, 0, sizeof(g_dst));
+        TEST_ASSERT(chaos_memcpy_parallel(g_dst + 5U, g_src + 3U, BIG_SIZE, threads[t]) == CHAOS_STATUS_OK, "memcpy_parallel status");
+        TEST_ASSERT(memcmp(g_dst + 5U, g_src + 3U, BIG_SIZE) == 0, "memcpy_parallel data");
+        TEST_ASSERT(all_equal(g_dst, 5U, 0U) && (g_dst[BIG_SIZE + 5U] == 0U), "memcpy_parallel bounds");
+    }
+
+    TEST_PASS("memcpy_parallel any thread count");
+}
+
+static int test_memcpy_parallel_small(void)
+{
+    fill_random(g_src, 4096U);
+    memset(g_dst, 0, 4096U);
+
+    TEST_ASSERT(chaos_memcpy_parallel(g_dst, g_src, 4000U, 8U) == CHAOS_STATUS_OK, "small memcpy_parallel status");
+    TEST_ASSERT(memcmp(g_dst, g_src, 4000U) == 0, "small memcpy_parallel data");
+    TEST_ASSERT(g_dst[4000U] == 0U, "small memcpy_parallel bounds");
+
+    TEST_PASS("memcpy_parallel below threshold");
+}
+
+static int test_memset_parallel(void)
+{
+    memset(g_dst, 0, sizeof(g_dst));
+
+    TEST_ASSERT(chaos_memset_parallel(g_dst + 1U, 0x5AU, BIG_SIZE, 5U) == CHAOS_STATUS_OK, "memset_parallel status");
+    TEST_ASSERT(all_equal(g_dst + 1U, BIG_SIZE, 0x5AU), "memset_parallel data");
+    TEST_ASSERT((g_dst[0] == 0U) && (g_dst[BIG_SIZE + 1U] == 0U), "memset_parallel bounds");
+
+    TEST_PASS("memset_parallel");
+}
+
+static int test_parallel_invalid(void)
+{
+    TEST_ASSERT(chaos_memcpy_parallel(NULL, g_src, 16U, 4U) != CHAOS_STATUS_OK, "memcpy_parallel NULL dst");
+    TEST_ASSERT(chaos_memset_parallel(NULL, 0U, 16U, 4U) != CHAOS_STATUS_OK, "memset_parallel NULL dst");
+    TEST_ASSERT(CHAOS_STATUS_CODE(chaos_memcpy_parallel(g_dst, g_src, 0U, 4U)) == CHAOS_MEM_SIZE_ZERO, "memcpy_parallel size zero");
+    TEST_ASSERT(CHAOS_STATUS_CODE(chaos_memcpy_parallel(g_dst, g_dst, 16U, 4U)) == CHAOS_MEM_SRC_EQ_DST, "memcpy_parallel src == dst");
+
+    TEST_PASS("parallel invalid parameters");
+}
+
+static int test_parallel_pool(void)
+{
+#if (CHAOS_ENABLE_THREADS == 1)
+    chaos_u32_t nested = 0U;
+    chaos_size_t round;
+    chaos_size_t i;
+
+    /* Every call reuses the pool and waits for all of its tasks */
+    memset(g_hits, 0, sizeof(g_hits));
+    for (round = 0U; round < 1000U; round++)
+    {
+        TEST_ASSERT(chaos_parallel_run(record_task, CHAOS_NULL, POOL_TASKS) == CHAOS_STATUS_OK, "parallel_run status");
+    }
+    for (i = 0U; i < POOL_TASKS; i++)
+    {
+        TEST_ASSERT(g_hits[i] == 1000U, "each task once per call");
+    }
+
+    /* Task 0 belongs to the caller, task 1 to the first worker */
+    TEST_ASSERT(pthread_equal(g_ran_on[0], pthread_self()) != 0, "caller runs task 0");
+    TEST_ASSERT(pthread_equal(g_ran_on[1], pthread_self()) == 0, "worker runs task 1");
+
+    /* A call from inside a task finds the pool in use and runs inline */
+    TEST_ASSERT(chaos_parallel_run(nested_task, &nested, 1U) == CHAOS_STATUS_OK, "single task status");
+    TEST_ASSERT(chaos_parallel_run(nested_task, &nested, 2U) == CHAOS_STATUS_OK, "nested parallel_run status");
+    TEST_ASSERT(nested == 3U, "nested calls complete");
+    TEST_ASSERT(g_hits[POOL_TASKS - 1U] == 1003U, "nested tasks ran");
+#endif
+
+    TEST_PASS("parallel_run worker pool");
+}
+
+/* -------------------------------------------------------------------------- */
+/* Runner                                                                      */
+/* -------------------------------------------------------------------------- */
+
+int main(void)
+{
+    int failures = 0;
+
+    failures += test_memcpy_parallel_threads();
+    failures += test_memcpy_parallel_small();
+    failures += test_memset_parallel();
+    failures += test_parallel_invalid();
+    failures += test_parallel_pool();
+
+    if (failures == 0)
+    {
+        printf("\nAll chaos_memcpy_parallel tests passed \n");
+        return 0;
+    }
+
+    printf("\n%d test(s) failed \n", failures);
+    return 1;
+}
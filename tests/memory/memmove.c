@@ -65,6 +65,59 @@ static int test_memmove_overlap_backward(void)
     TEST_PASS("memmove overlap backward");
 }
 
+static int test_memmove_wide_overlap(void)
+{
+    static chaos_u8_t buf[600];
+    static chaos_u8_t ref[600];
+    static const chaos_size_t shifts[] = {1U, 3U, 8U, 15U, 16U, 17U, 31U, 64U, 129U};
+    static const chaos_size_t sizes[] = {7U, 32U, 63U, 64U, 200U, 257U, 400U};
+
+    for (chaos_size_t k = 0U; k < (sizeof(shifts) / sizeof(shifts[0])); k++)
+    {
+        for (chaos_size_t m = 0U; m < (sizeof(sizes) / sizeof(sizes[0])); m++)
+        {
+            for (chaos_size_t base = 0U; base < 4U; base++)
+            {
+                for (chaos_size_t i = 0U; i < sizeof(buf); i++)
+                {
+                    buf[i] = (chaos_u8_t)(i * 7U + 1U);
+                }
+
+                /* dst above src */
+                memcpy(ref, buf, sizeof(buf));
+                memmove(&ref[base + shifts[k]], &ref[base], sizes[m]);
+                TEST_ASSERT(chaos_memmove(&buf[base + shifts[k]], &buf[base], sizes[m]) == CHAOS_STATUS_OK, "wide backward status");
+                TEST_ASSERT(memcmp(buf, ref, sizeof(buf)) == 0, "wide backward overlap mismatch");
+
+                /* dst below src */
+                memmove(&ref[base], &ref[base + shifts[k]], sizes[m]);
+                TEST_ASSERT(chaos_memmove(&buf[base], &buf[base + shifts[k]], sizes[m]) == CHAOS_STATUS_OK, "wide forward status");
+                TEST_ASSERT(memcmp(buf, ref, sizeof(buf)) == 0, "wide forward overlap mismatch");
+            }
+        }
+    }
+
+    TEST_PASS("memmove wide overlap");
+}
+
+static int test_memmove_disjoint_above(void)
+{
+    static chaos_u8_t buf[1024];
+
+    for (chaos_size_t i = 0U; i < 300U; i++)
+    {
+        buf[i + 1U] = (chaos_u8_t)(i ^ 0x5AU);
+    }
+
+    /* dst above src but not overlapping: must take the forward path and still be exact */
+    chaos_status_t status = chaos_memmove(&buf[601], &buf[1], 300U);
+
+    TEST_ASSERT(status == CHAOS_STATUS_OK, "disjoint move failed");
+    TEST_ASSERT(memcmp(&buf[601], &buf[1], 300U) == 0, "disjoint move mismatch");
+
+    TEST_PASS("memmove disjoint dst above src");
+}
+
 static int test_memmove_dst_null(void)
 {
     chaos_u8_t src[4] = {1,2,3,4};
@@ -98,6 +151,8 @@ int main(void)
     failures += test_memmove_nominal();
     failures += test_memmove_overlap_forward();
     failures += test_memmove_overlap_backward();
+    failures += test_memmove_wide_overlap();
+    failures += test_memmove_disjoint_above();
     failures += test_memmove_dst_null();
     failures += test_memmove_src_null();
 
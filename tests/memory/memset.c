@@ -25,6 +25,29 @@ static int test_memset_nominal(void)
     TEST_PASS("memset nominal");
 }
 
+static int test_memset_wide_unaligned(void)
+{
+    static chaos_u8_t buf[400];
+
+    for (chaos_size_t start = 1U; start < 40U; start += 3U)
+    {
+        for (chaos_size_t size = 1U; size < 350U; size += 29U)
+        {
+            memset(buf, 0xEE, sizeof(buf));
+
+            TEST_ASSERT(chaos_memset(&buf[start], 0x3CU, size) == CHAOS_STATUS_OK, "wide memset status");
+
+            for (chaos_size_t i = 0U; i < size; i++)
+            {
+                TEST_ASSERT(buf[start + i] == 0x3CU, "wide memset content");
+            }
+            TEST_ASSERT((buf[start - 1U] == 0xEEU) && (buf[start + size] == 0xEEU), "wide memset bounds");
+        }
+    }
+
+    TEST_PASS("memset wide unaligned");
+}
+
 static int test_memset_size_zero(void)
 {
     chaos_u8_t buf[4] = {1,2,3,4};
@@ -54,6 +77,7 @@ int main(void)
     int failures = 0;
 
     failures += test_memset_nominal();
+    failures += test_memset_wide_unaligned();
     failures += test_memset_size_zero();
     failures += test_memset_dst_null();
 
@@ -0,0 +1,121 @@
+#include <string.h>
+
+#include "chaos_memory.h"
+#include "chaos_types.h"
+#include "chaos_status.h"
+
+#include "chaos_test.h"
+
+/* -------------------------------------------------------------------------- */
+/* Helpers                                                                     */
+/* -------------------------------------------------------------------------- */
+
+static chaos_u8_t g_buf[700];
+
+/* Checks that [start, start + count * esize) repeats 'pattern' and that the
+ * guard bytes on either side are untouched. */
+static int check_pattern(chaos_size_t start, const void *pattern, chaos_size_t esize, chaos_size_t count)
+{
+    const chaos_u8_t *pat = (const chaos_u8_t *)pattern;
+
+    for (chaos_size_t i = 0U; i < (count * esize); i++)
+    {
+        if (g_buf[start + i] != pat[i % esize])
+        {
+            return 0;
+        }
+    }
+
+    return (g_buf[start - 1U] == 0xEEU) && (g_buf[start + (count * esize)] == 0xEEU);
+}
+
+/* -------------------------------------------------------------------------- */
+/* Tests                                                                       */
+/* -------------------------------------------------------------------------- */
+
+static int test_memset16(void)
+{
+    const chaos_u16_t value = 0xF81FU;
+
+    for (chaos_size_t start = 1U; start < 10U; start++)
+    {
+        for (chaos_size_t count = 1U; count < 300U; count += 7U)
+        {
+            memset(g_buf, 0xEE, sizeof(g_buf));
+            TEST_ASSERT(chaos_memset16(&g_buf[start], value, count) == CHAOS_STATUS_OK, "memset16 status");
+            TEST_ASSERT(check_pattern(start, &value, 2U, count), "memset16 content mismatch");
+        }
+    }
+
+    TEST_PASS("memset16 all alignments");
+}
+
+static int test_memset32(void)
+{
+    const chaos_u32_t value = 0xDEADBEEFU;
+
+    for (chaos_size_t start = 1U; start < 10U; start++)
+    {
+        for (chaos_size_t count = 1U; count < 160U; count += 5U)
+        {
+            memset(g_buf, 0xEE, sizeof(g_buf));
+            TEST_ASSERT(chaos_memset32(&g_buf[start], value, count) == CHAOS_STATUS_OK, "memset32 status");
+            TEST_ASSERT(check_pattern(start, &value, 4U, count), "memset32 content mismatch");
+        }
+    }
+
+    TEST_PASS("memset32 all alignments");
+}
+
+#if (CHAOS_ENABLE_INT64 == 1)
+static int test_memset64(void)
+{
+    const chaos_u64_t value = 0x7FF8000000000001ULL; /* NaN poison */
+
+    for (chaos_size_t start = 1U; start < 10U; start++)
+    {
+        for (chaos_size_t count = 1U; count < 80U; count += 3U)
+        {
+            memset(g_buf, 0xEE, sizeof(g_buf));
+            TEST_ASSERT(chaos_memset64(&g_buf[start], value, count) == CHAOS_STATUS_OK, "memset64 status");
+            TEST_ASSERT(check_pattern(start, &value, 8U, count), "memset64 content mismatch");
+        }
+    }
+
+    TEST_PASS("memset64 all alignments");
+}
+#endif
+
+static int test_memset_pattern_invalid(void)
+{
+    TEST_ASSERT(chaos_memset32(NULL, 0U, 4U) != CHAOS_STATUS_OK, "NULL dst should fail");
+    TEST_ASSERT(CHAOS_STATUS_CODE(chaos_memset16(g_buf, 0U, 0U)) == CHAOS_MEM_SIZE_ZERO, "count zero warning");
+    TEST_ASSERT(CHAOS_STATUS_CODE(chaos_memset32(g_buf, 0U, 0x40000000U)) == CHAOS_MEM_OVERFLOW, "byte size overflow");
+
+    TEST_PASS("memset pattern invalid parameters");
+}
+
+/* -------------------------------------------------------------------------- */
+/* Runner                                                                      */
+/* -------------------------------------------------------------------------- */
+
+int main(void)
+{
+    int failures = 0;
+
+    failures += test_memset16();
+    failures += test_memset32();
+#if (CHAOS_ENABLE_INT64 == 1)
+    failures += test_memset64();
+#endif
+    failures += test_memset_pattern_invalid();
+
+    if (failures == 0)
+    {
+        printf("\nAll chaos_memset16/32/64 tests passed \n");
+        return 0;
+    }
+
+    printf("\n%d test(s) failed \n", failures);
+    return 1;
+}
@@ -0,0 +1,435 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "chaos_std.h"
+#include "chaos_test.h"
+
+#if (CHAOS_ENABLE_FLOAT == 1) && (CHAOS_ENABLE_INT64 == 1)
+
+/* -------------------------------------------------------------------------- */
+/* Helpers                                                                     */
+/* -------------------------------------------------------------------------- */
+
+static unsigned long long g_state = 0x9E3779B97F4A7C15ULL;
+
+static unsigned long long next_u64(void)
+{
+    g_state ^= g_state << 13U;
+    g_state ^= g_state >> 7U;
+    g_state ^= g_state << 17U;
+    return g_state;
+}
+
+static double from_bits64(unsigned long long u)
+{
+    double d;
+
+    memcpy(&d, &u, sizeof(d));
+    return d;
+}
+
+static unsigned long long bits64(double d)
+{
+    unsigned long long u;
+
+    memcpy(&u, &d, sizeof(u));
+    return u;
+}
+
+static float from_bits32(unsigned u)
+{
+    float f;
+
+    memcpy(&f, &u, sizeof(f));
+    return f;
+}
+
+static unsigned bits32(float f)
+{
+    unsigned u;
+
+    memcpy(&u, &f, sizeof(u));
+    return u;
+}
+
+/* Significant digits of a formatted number (leading and trailing zeros excluded) */
+static int sig_digits(const char *s)
+{
+    int n = 0;
+    int zeros = 0;
+
+    for (; (*s != '\0') && (*s != 'e'); s++)
+    {
+        if ((*s >= '1') && (*s <= '9'))
+        {
+            n += zeros + 1;
+            zeros = 0;
+        }
+        else if ((*s == '0') && (n > 0))
+        {
+            zeros++;
+        }
+    }
+    return (n == 0) ? 1 : n;
+}
+
+/* Fewest digits of %e output that read back to d */
+static int shortest64(double d)
+{
+    char want[40];
+    int p;
+
+    for (p = 1; p < 17; p++)
+    {
+        snprintf(want, sizeof(want), "%.*e", p - 1, d);
+        if (strtod(want, NULL) == d)
+        {
+            break;
+        }
+    }
+    return p;
+}
+
+static int shortest32(float f)
+{
+    char want[40];
+    int p;
+
+    for (p = 1; p < 9; p++)
+    {
+        snprintf(want, sizeof(want), "%.*e", p - 1, (double)f);
+        if (strtof(want, NULL) == f)
+        {
+            break;
+        }
+    }
+    return p;
+}
+
+static int parse_matches(const char *s)
+{
+    chaos_f64_t d = 1.0;
+    chaos_f32_t f = 1.0f;
+    chaos_size_t n64 = 0U;
+    chaos_size_t n32 = 0U;
+    char *end = NULL;
+    double want = strtod(s, &end);
+    float wantf = strtof(s, NULL);
+
+    (void)chaos_strtof64((const chaos_char_t *)s, (chaos_size_t)strlen(s), &d, &n64);
+    (void)chaos_strtof32((const chaos_char_t *)s, (chaos_size_t)strlen(s), &f, &n32);
+
+    return (bits64(d) == bits64(want)) && (bits32(f) == bits32(wantf)) && (n64 == (chaos_size_t)(end - s)) && (n32 == n64);
+}
+
+/* -------------------------------------------------------------------------- */
+/* Tests                                                                       */
+/* -------------------------------------------------------------------------- */
+
+static int test_float_format_edges(void)
+{
+    static const struct
+    {
+        double value;
+        const char *text;
+    } cases64[] = {
+        { 0.0, "0" }, { 1.0, "1" }, { -1.5, "-1.5" }, { 0.1, "0.1" }, { 0.3, "0.3" }, { 100.0, "100" },
+        { 123456.789, "123456.789" }, { 1e20, "100000000000000000000" }, { 1e21, "1e+21" },
+        { 1e-6, "0.000001" }, { 1.5e-7, "1.5e-7" }, { 5e-324, "5e-324" }, { 9007199254740992.0, "9007199254740992" },
+        { 1.7976931348623157e308, "1.7976931348623157e+308" }, { 2.2250738585072014e-308, "2.2250738585072014e-308" },
+        { 0.1 + 0.2, "0.30000000000000004" }, { -123456789012345678.0, "-123456789012345680" }, { 1e23, "1e+23" }
+    };
+    static const struct
+    {
+        float value;
+        const char *text;
+    } cases32[] = {
+        { 0.1f, "0.1" }, { 16777216.0f, "16777216" }, { 3.4028235e38f, "3.4028235e+38" }, { 1e-45f, "1e-45" },
+        { 1.17549435e-38f, "1.1754944e-38" }, { -2.5f, "-2.5" }, { 123456.79f, "123456.79" }
+    };
+    chaos_char_t buf[32];
+    chaos_size_t len = 0U;
+    size_t i;
+    int ok = 1;
+
+    for (i = 0U; i < sizeof(cases64) / sizeof(cases64[0]); i++)
+    {
+        ok &= (chaos_f64_to_str(cases64[i].value, buf, sizeof(buf), &len) == CHAOS_STATUS_OK);
+        ok &= (strcmp((const char *)buf, cases64[i].text) == 0) && (len == (chaos_size_t)strlen(cases64[i].text));
+    }
+    TEST_ASSERT(ok, "double formats");
+
+    for (i = 0U; i < sizeof(cases32) / sizeof(cases32[0]); i++)
+    {
+        ok &= (chaos_f32_to_str(cases32[i].value, buf, sizeof(buf), &len) == CHAOS_STATUS_OK);
+        ok &= (strcmp((const char *)buf, cases32[i].text) == 0) && (len == (chaos_size_t)strlen(cases32[i].text));
+    }
+    TEST_ASSERT(ok, "float formats");
+
+    (void)chaos_f64_to_str(-0.0, buf, sizeof(buf), &len);
+    TEST_ASSERT(strcmp((const char *)buf, "-0") == 0, "negative zero");
+    (void)chaos_f64_to_str(from_bits64(0x7FF0000000000000ULL), buf, sizeof(buf), &len);
+    TEST_ASSERT(strcmp((const char *)buf, "inf") == 0, "infinity");
+    (void)chaos_f64_to_str(from_bits64(0xFFF0000000000000ULL), buf, sizeof(buf), &len);
+    TEST_ASSERT(strcmp((const char *)buf, "-inf") == 0, "negative infinity");
+    (void)chaos_f64_to_str(from_bits64(0xFFF8000000000001ULL), buf, sizeof(buf), &len);
+    TEST_ASSERT(strcmp((const char *)buf, "nan") == 0, "nan");
+    (void)chaos_f32_to_str(from_bits32(0x7FC00000U), buf, sizeof(buf), &len);
+    TEST_ASSERT(strcmp((const char *)buf, "nan") == 0, "float nan");
+
+    TEST_PASS("float format edges");
+}
+
+static int test_float_roundtrip64(void)
+{
+    chaos_char_t buf[32];
+    chaos_size_t len = 0U;
+    chaos_size_t used = 0U;
+    chaos_f64_t back;
+    unsigned long long u;
+    double d;
+    int i;
+    int ok = 1;
+    int shortest = 1;
+    int longest = 0;
+
+    for (i = 0; i < 1000000; i++)
+    {
+        u = next_u64();
+        if ((i & 3) == 0)
+        {
+            /* Small exponents as well: integers, fractions, subnormals */
+            u &= 0x80FFFFFFFFFFFFFFULL;
+            u |= (unsigned long long)(0x3C0U + (unsigned)(i % 0x80)) << 52U;
+            u = ((i & 7) == 4) ? (u & 0x800FFFFFFFFFFFFFULL) : u;
+        }
+        if (((u >> 52U) & 0x7FFU) == 0x7FFU)
+        {
+            continue;
+        }
+        d = from_bits64(u);
+        ok &= (chaos_f64_to_str(d, buf, sizeof(buf), &len) == CHAOS_STATUS_OK);
+        ok &= (chaos_strtof64(buf, len, &back, &used) == CHAOS_STATUS_OK) && (used == len);
+        ok &= (bits64(back) == u) && (bits64(strtod((const char *)buf, NULL)) == u);
+        longest = ((int)len > longest) ? (int)len : longest;
+        if ((i % 50) == 0)
+        {
+            shortest &= (sig_digits((const char *)buf) == shortest64(d));
+        }
+    }
+    TEST_ASSERT(ok, "random doubles read back exactly (both parsers)");
+    TEST_ASSERT(shortest, "no shorter %e text reads back");
+    TEST_ASSERT(longest <= 25, "26 bytes suffice");
+
+    TEST_PASS("double round trip");
+}
+
+static int test_float_roundtrip32(void)
+{
+    chaos_char_t buf[32];
+    chaos_size_t len = 0U;
+    chaos_size_t used = 0U;
+    chaos_f32_t back;
+    unsigned u;
+    float f;
+    long i;
+    int ok = 1;
+    int shortest = 1;
+    int longest = 0;
+
+    for (i = 0; i < 1000000; i++)
+    {
+        u = (unsigned)(next_u64() >> 32U);
+        if (((u >> 23U) & 0xFFU) == 0xFFU)
+        {
+            continue;
+        }
+        f = from_bits32(u);
+        ok &= (chaos_f32_to_str(f, buf, sizeof(buf), &len) == CHAOS_STATUS_OK);
+        ok &= (chaos_strtof32(buf, len, &back, &used) == CHAOS_STATUS_OK) && (used == len);
+        ok &= (bits32(back) == u) && (bits32(strtof((const char *)buf, NULL)) == u);
+        longest = ((int)len > longest) ? (int)len : longest;
+        if ((i % 50) == 0)
+        {
+            shortest &= (sig_digits((const char *)buf) == shortest32(f));
+        }
+    }
+    TEST_ASSERT(ok, "random floats read back exactly (both parsers)");
+    TEST_ASSERT(shortest, "no shorter %e text reads back");
+    TEST_ASSERT(longest <= 22, "23 bytes suffice");
+
+    TEST_PASS("float round trip");
+}
+
+static int test_float_parse_random(void)
+{
+    char s[96];
+    int i;
+    int j;
+    int n;
+    int dot;
+    int p;
+    int ok = 1;
+
+    for (i = 0; i < 300000; i++)
+    {
+        /* 1 to 40 digits, a point somewhere (or none), exponent within +-360 */
+        n = 1 + (int)(next_u64() % 40U);
+        dot = (int)(next_u64() % (unsigned long long)(n + 2));
+        p = 0;
+        for (j = 0; j < n; j++)
+        {
+            if (j == dot)
+            {
+                s[p++] = '.';
+            }
+            s[p++] = (char)('0' + (next_u64() % 10U));
+        }
+        if ((next_u64() & 1U) != 0U)
+        {
+            p += sprintf(&s[p], "e%d", (int)(next_u64() % 721U) - 360);
+        }
+        s[p] = '\0';
+        ok &= parse_matches(s);
+    }
+    TEST_ASSERT(ok, "random decimals match strtod/strtof");
+
+    TEST_PASS("float parse random");
+}
+
+static int test_float_parse_halfway(void)
+{
+    char s[1200];
+    unsigned long long u;
+    long double mid;
+    double m32;
+    unsigned v;
+    int i;
+    int ok = 1;
+
+    for (i = 0; i < 20000; i++)
+    {
+        /* Exact decimal of the midpoint between neighbours, then nudged by truncation */
+        u = next_u64() & 0x7FFFFFFFFFFFFFFFULL;
+        u = ((i & 1) != 0) ? (u & 0x000FFFFFFFFFFFFFULL) | ((unsigned long long)(i % 80) << 52U) : u;
+        if (((u >> 52U) & 0x7FFU) >= 0x7FEU)
+        {
+            continue;
+        }
+        mid = ((long double)from_bits64(u) + (long double)from_bits64(u + 1U)) / 2.0L;
+        snprintf(s, sizeof(s), "%.780Le", mid);
+        ok &= parse_matches(s);
+        snprintf(s, sizeof(s), "%.25Le", mid);
+        ok &= parse_matches(s);
+
+        v = (unsigned)(u >> 32U) & 0x7FFFFFFFU;
+        if (v < 0x7F7FFFFFU)
+        {
+            m32 = ((double)from_bits32(v) + (double)from_bits32(v + 1U)) / 2.0;
+            snprintf(s, sizeof(s), "%.160e", m32);
+            ok &= parse_matches(s);
+        }
+    }
+    TEST_ASSERT(ok, "halfway points round to even");
+
+    TEST_ASSERT(parse_matches("2.4703282292062327208828439643411068618252990130716238221279284125033775363510437593264991818081799618989828234772285886546332835517796989819938739800539093906315035659515570226392290858392449105184435931802849936536152500319370457678249219365623669863658480757001585769269903706311928279558551332927834338409351978015531246597263579574622766465272827220056374006485499977096599470454020828166226237857393450736339007967761930577506740176324673600968951340535537458516661134223766678604162159680461914467291840300530057530849048765391711386591646239524912623653881879636239373280423891018672348497668235089863388587925628302755995657524455507255189313690836254779186948667994968324049705821028513185451396213837722826145437693412532098591327667236328124e-324"), "just below half the smallest subnormal");
+    TEST_ASSERT(parse_matches("2.4703282292062327208828439643411068618252990130716238221279284125033775363510437593264991818081799618989828234772285886546332835517796989819938739800539093906315035659515570226392290858392449105184435931802849936536152500319370457678249219365623669863658480757001585769269903706311928279558551332927834338409351978015531246597263579574622766465272827220056374006485499977096599470454020828166226237857393450736339007967761930577506740176324673600968951340535537458516661134223766678604162159680461914467291840300530057530849048765391711386591646239524912623653881879636239373280423891018672348497668235089863388587925628302755995657524455507255189313690836254779186948667994968324049705821028513185451396213837722826145437693412532098591327667236328125000000000000000000001e-324"), "just above it");
+    TEST_ASSERT(parse_matches("9007199254740993"), "2^53 + 1 ties to even");
+    TEST_ASSERT(parse_matches("9007199254740993.0000000000000000000000000001"), "just above 2^53 + 1");
+    TEST_ASSERT(parse_matches("1.7976931348623158e308") && parse_matches("1.7976931348623159e308"), "largest double and overflow");
+    TEST_ASSERT(parse_matches("3.4028235677973366e38") && parse_matches("3.4028235677973367e38"), "largest float and overflow");
+
+    TEST_PASS("float parse halfway");
+}
+
+static int test_float_parse_syntax(void)
+{
+    static const char *const cases[] = {
+        "0", "-0", "+1", "  \t\n12.5", "1.", ".5", "-.5e1", "1e", "1e+", "1E-2x", "1.5.3", "00000001.2500000",
+        "1e400", "-1e400", "1e-400", "0e999999999999", "0.0000000000000000000000000000000000000001e40",
+        "inf", "-Infinity", "INFINITE", "nan", "NaN(", "123456789012345678901234567890e-30"
+    };
+    chaos_f64_t d = 1.0;
+    chaos_size_t used = 99U;
+    chaos_status_t st;
+    size_t i;
+    int ok = 1;
+
+    for (i = 0U; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        if (strstr(cases[i], "nan") != NULL || strstr(cases[i], "NaN") != NULL)
+        {
+            st = chaos_strtof64((const chaos_char_t *)cases[i], (chaos_size_t)strlen(cases[i]), &d, &used);
+            ok &= (st == CHAOS_STATUS_OK) && (d != d) && (used == 3U);
+        }
+        else
+        {
+            ok &= parse_matches(cases[i]);
+        }
+    }
+    TEST_ASSERT(ok, "syntax and consumed length match strtod");
+
+    st = chaos_strtof64((const chaos_char_t *)"1e400", 5U, &d, &used);
+    TEST_ASSERT((CHAOS_STATUS_CLASS(st) == CHAOS_ERRCLASS_OVERFLOW) && (CHAOS_STATUS_CODE(st) == CHAOS_STD_OVERFLOW), "overflow reported");
+    TEST_ASSERT(chaos_strtof64((const chaos_char_t *)"1e-400", 6U, &d, &used) == CHAOS_STATUS_OK, "underflow is not an error");
+    st = chaos_strtof64((const chaos_char_t *)" -.e5", 5U, &d, &used);
+    TEST_ASSERT((CHAOS_STATUS_CODE(st) == CHAOS_STD_NO_DIGITS) && (used == 0U) && (bits64(d) == 0U), "no digits");
+    st = chaos_strtof64((const chaos_char_t *)"in", 2U, &d, &used);
+    TEST_ASSERT((CHAOS_STATUS_CODE(st) == CHAOS_STD_NO_DIGITS) && (bits64(d) == 0U), "partial word");
+    TEST_ASSERT(chaos_strtof64((const chaos_char_t *)"12345", 3U, &d, &used) == CHAOS_STATUS_OK && (d == 123.0) && (used == 3U), "length bound");
+    TEST_ASSERT(chaos_strtof64(CHAOS_NULL, 0U, &d, CHAOS_NULL) != CHAOS_STATUS_OK, "empty input");
+    TEST_ASSERT(chaos_strtof64((const chaos_char_t *)"1", 1U, CHAOS_NULL, &used) != CHAOS_STATUS_OK, "NULL value");
+
+    TEST_PASS("float parse syntax");
+}
+
+static int test_float_bounds(void)
+{
+    chaos_char_t buf[32];
+    chaos_size_t len = 99U;
+    chaos_status_t st;
+
+    memset(buf, 'x', sizeof(buf));
+    TEST_ASSERT(chaos_f64_to_str(-1.25, buf, 6U, &len) == CHAOS_STATUS_OK, "exact fit");
+    TEST_ASSERT((len == 5U) && (memcmp(buf, "-1.25", 6U) == 0) && (buf[6] == 'x'), "writes text and terminator only");
+
+    st = chaos_f64_to_str(-1.25, buf, 5U, &len);
+    TEST_ASSERT((CHAOS_STATUS_CLASS(st) == CHAOS_ERRCLASS_OVERFLOW) && (CHAOS_STATUS_CODE(st) == CHAOS_STD_TRUNCATED), "no room for terminator");
+    TEST_ASSERT((len == 0U) && (buf[0] == 0U), "truncation leaves an empty string");
+    TEST_ASSERT(CHAOS_STATUS_CODE(chaos_f32_to_str(1.0f, buf, 0U, CHAOS_NULL)) == CHAOS_STD_TRUNCATED, "zero size");
+    TEST_ASSERT(chaos_f64_to_str(-2.2250738585072014e-308, buf, 26U, CHAOS_NULL) == CHAOS_STATUS_OK, "len may be NULL");
+    TEST_ASSERT(chaos_f64_to_str(1.0, CHAOS_NULL, 8U, &len) != CHAOS_STATUS_OK, "NULL buffer");
+
+    TEST_PASS("float buffer bounds");
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+/* Runner                                                                      */
+/* -------------------------------------------------------------------------- */
+
+int main(void)
+{
+    int failures = 0;
+
+#if (CHAOS_ENABLE_FLOAT == 1) && (CHAOS_ENABLE_INT64 == 1)
+    failures += test_float_format_edges();
+    failures += test_float_roundtrip64();
+    failures += test_float_roundtrip32();
+    failures += test_float_parse_random();
+    failures += test_float_parse_halfway();
+    failures += test_float_parse_syntax();
+    failures += test_float_bounds();
+#endif
+
+    if (failures == 0)
+    {
+        printf("\nAll chaos_std float tests passed \n");
+        return 0;
+    }
+
+    printf("\n%d test(s) failed \n", failures);
+    return 1;
+}
@@ -0,0 +1,183 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "chaos_std.h"
+#include "chaos_test.h"
+
+/* -------------------------------------------------------------------------- */
+/* Helpers                                                                     */
+/* -------------------------------------------------------------------------- */
+
+static unsigned long long g_state = 0x9E3779B97F4A7C15ULL;
+
+/* Random value with a uniformly chosen bit length */
+static unsigned long long next_value(void)
+{
+    unsigned bits;
+
+    g_state ^= g_state << 13U;
+    g_state ^= g_state >> 7U;
+    g_state ^= g_state << 17U;
+    bits = (unsigned)(g_state >> 58U) + 1U;
+    return (bits == 64U) ? g_state : (g_state & ((1ULL << bits) - 1ULL));
+}
+
+static int check_u32(chaos_u32_t v)
+{
+    char want[32];
+    chaos_char_t got[32];
+    chaos_size_t len = 0U;
+    int n = snprintf(want, sizeof(want), "%u", (unsigned)v);
+
+    return (chaos_u32_to_str(v, got, sizeof(got), &len) == CHAOS_STATUS_OK) && (len == (chaos_size_t)n) && (strcmp((const char *)got, want) == 0);
+}
+
+static int check_i32(chaos_i32_t v)
+{
+    char want[32];
+    chaos_char_t got[32];
+    chaos_size_t len = 0U;
+    int n = snprintf(want, sizeof(want), "%d", (int)v);
+
+    return (chaos_i32_to_str(v, got, sizeof(got), &len) == CHAOS_STATUS_OK) && (len == (chaos_size_t)n) && (strcmp((const char *)got, want) == 0);
+}
+
+static int check_hex32(chaos_u32_t v)
+{
+    char want[32];
+    chaos_char_t got[32];
+    chaos_size_t len = 0U;
+    int n = snprintf(want, sizeof(want), "%x", (unsigned)v);
+
+    return (chaos_u32_to_hex(v, got, sizeof(got), &len) == CHAOS_STATUS_OK) && (len == (chaos_size_t)n) && (strcmp((const char *)got, want) == 0);
+}
+
+#if (CHAOS_ENABLE_INT64 == 1)
+static int check_u64(chaos_u64_t v)
+{
+    char want[32];
+    chaos_char_t got[32];
+    chaos_size_t len = 0U;
+    int n = snprintf(want, sizeof(want), "%llu", (unsigned long long)v);
+
+    return (chaos_u64_to_str(v, got, sizeof(got), &len) == CHAOS_STATUS_OK) && (len == (chaos_size_t)n) && (strcmp((const char *)got, want) == 0);
+}
+
+static int check_i64(chaos_i64_t v)
+{
+    char want[32];
+    chaos_char_t got[32];
+    chaos_size_t len = 0U;
+    int n = snprintf(want, sizeof(want), "%lld", (long long)v);
+
+    return (chaos_i64_to_str(v, got, sizeof(got), &len) == CHAOS_STATUS_OK) && (len == (chaos_size_t)n) && (strcmp((const char *)got, want) == 0);
+}
+
+static int check_hex64(chaos_u64_t v)
+{
+    char want[32];
+    chaos_char_t got[32];
+    chaos_size_t len = 0U;
+    int n = snprintf(want, sizeof(want), "%llx", (unsigned long long)v);
+
+    return (chaos_u64_to_hex(v, got, sizeof(got), &len) == CHAOS_STATUS_OK) && (len == (chaos_size_t)n) && (strcmp((const char *)got, want) == 0);
+}
+#endif
+
+/* -------------------------------------------------------------------------- */
+/* Tests                                                                       */
+/* -------------------------------------------------------------------------- */
+
+/* Each power of ten and its neighbours, and the type limits */
+static int test_format_edges(void)
+{
+    unsigned long long p = 1ULL;
+    unsigned k;
+
+    for (k = 0U; k < 20U; k++)
+    {
+        if (p <= 4294967295ULL)
+        {
+            TEST_ASSERT(check_u32((chaos_u32_t)p) && check_u32((chaos_u32_t)(p - 1ULL)), "u32 around a power of ten");
+            TEST_ASSERT(check_i32(-(chaos_i32_t)(p / 10ULL)) && check_hex32((chaos_u32_t)(p - 1ULL)), "i32/hex around a power of ten");
+        }
+#if (CHAOS_ENABLE_INT64 == 1)
+        TEST_ASSERT(check_u64(p) && check_u64(p - 1ULL) && check_u64(p + 1ULL), "u64 around a power of ten");
+        TEST_ASSERT(check_i64(-(chaos_i64_t)p) && check_i64((chaos_i64_t)(p - 1ULL)), "i64 around a power of ten");
+#endif
+        p *= 10ULL;
+    }
+
+    TEST_ASSERT(check_u32(0U) && check_u32(chaos_u32_t_MAX), "u32 limits");
+    TEST_ASSERT(check_i32(0) && check_i32(chaos_i32_t_MIN) && check_i32(chaos_i32_t_MAX), "i32 limits");
+    TEST_ASSERT(check_hex32(0U) && check_hex32(chaos_u32_t_MAX), "hex32 limits");
+#if (CHAOS_ENABLE_INT64 == 1)
+    TEST_ASSERT(check_u64(0U) && check_u64(chaos_u64_t_MAX), "u64 limits");
+    TEST_ASSERT(check_i64(chaos_i64_t_MIN) && check_i64(chaos_i64_t_MAX), "i64 limits");
+    TEST_ASSERT(check_hex64(0U) && check_hex64(chaos_u64_t_MAX), "hex64 limits");
+#endif
+
+    TEST_PASS("format powers of ten and limits vs snprintf");
+}
+
+static int test_format_random(void)
+{
+    unsigned long long v;
+    unsigned long iter;
+
+    for (iter = 0UL; iter < 300000UL; iter++)
+    {
+        v = next_value();
+        TEST_ASSERT(check_u32((chaos_u32_t)v) && check_i32((chaos_i32_t)(chaos_u32_t)v) && check_hex32((chaos_u32_t)v), "random 32-bit");
+#if (CHAOS_ENABLE_INT64 == 1)
+        TEST_ASSERT(check_u64(v) && check_i64((chaos_i64_t)v) && check_hex64(v), "random 64-bit");
+#endif
+    }
+
+    TEST_PASS("format random values vs snprintf");
+}
+
+static int test_format_bounds(void)
+{
+    chaos_char_t buf[16];
+    chaos_size_t len = 99U;
+    chaos_status_t st;
+
+    memset(buf, 'x', sizeof(buf));
+    TEST_ASSERT(chaos_i32_to_str(-12345, buf, 7U, &len) == CHAOS_STATUS_OK, "exact fit");
+    TEST_ASSERT((len == 6U) && (memcmp(buf, "-12345", 7U) == 0) && (buf[7] == 'x'), "writes text and terminator only");
+
+    st = chaos_i32_to_str(-12345, buf, 6U, &len);
+    TEST_ASSERT((CHAOS_STATUS_CLASS(st) == CHAOS_ERRCLASS_OVERFLOW) && (CHAOS_STATUS_CODE(st) == CHAOS_STD_TRUNCATED), "no room for terminator");
+    TEST_ASSERT((len == 0U) && (buf[0] == 0U), "truncation leaves an empty string");
+    st = chaos_u32_to_hex(0xABCU, buf, 3U, &len);
+    TEST_ASSERT(CHAOS_STATUS_CODE(st) == CHAOS_STD_TRUNCATED, "hex truncation");
+    TEST_ASSERT(CHAOS_STATUS_CODE(chaos_u32_to_str(5U, buf, 0U, CHAOS_NULL)) == CHAOS_STD_TRUNCATED, "zero size");
+    TEST_ASSERT(chaos_u32_to_str(5U, buf, 2U, CHAOS_NULL) == CHAOS_STATUS_OK, "len may be NULL");
+    TEST_ASSERT(chaos_u32_to_str(5U, CHAOS_NULL, 2U, &len) != CHAOS_STATUS_OK, "NULL buffer");
+
+    TEST_PASS("format buffer bounds");
+}
+
+/* -------------------------------------------------------------------------- */
+/* Runner                                                                      */
+/* -------------------------------------------------------------------------- */
+
+int main(void)
+{
+    int failures = 0;
+
+    failures += test_format_edges();
+    failures += test_format_random();
+    failures += test_format_bounds();
+
+    if (failures == 0)
+    {
+        printf("\nAll chaos_std format tests passed \n");
+        return 0;
+    }
+
+    printf("\n%d test(s) failed \n", failures);
+    return 1;
+}
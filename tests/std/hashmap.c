@@ -0,0 +1,367 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "chaos_hashmap.h"
+#include "chaos_alloc.h"
+#include "chaos_test.h"
+
+/* -------------------------------------------------------------------------- */
+/* Helpers                                                                     */
+/* -------------------------------------------------------------------------- */
+
+#define UNIVERSE 3000U
+#define OPS      200000U
+
+static unsigned long long g_state = 0x9E3779B97F4A7C15ULL;
+static unsigned char g_region[256U * 1024U];
+
+/* Reference model: which keys are present and the value each one holds */
+static unsigned char g_present[UNIVERSE];
+static unsigned g_value[UNIVERSE];
+
+static unsigned long long next_u64(void)
+{
+    g_state ^= g_state << 13U;
+    g_state ^= g_state >> 7U;
+    g_state ^= g_state << 17U;
+    return g_state;
+}
+
+/* Key bytes of model index k for a key size of 4, 8 or 12 */
+static void make_key(unsigned char *key, size_t key_size, unsigned k)
+{
+    unsigned long long wide = ((unsigned long long)k * 0x100000001ULL) ^ 0xA5A5000000000000ULL;
+
+    memset(key, 0, key_size);
+    if (key_size == 4U)
+    {
+        memcpy(key, &k, 4U);
+    }
+    else
+    {
+        memcpy(key, &wide, 8U);
+        if (key_size > 8U)
+        {
+            memcpy(&key[8], &k, 4U);
+        }
+    }
+}
+
+/* Every key of the universe is found exactly when the model holds it, with its value */
+static int model_matches(const chaos_hashmap_t *map, size_t key_size)
+{
+    unsigned char key[12];
+    void *value = NULL;
+    chaos_bool_t found = CHAOS_FALSE;
+    unsigned v;
+    unsigned k;
+    size_t count = 0U;
+
+    for (k = 0U; k < UNIVERSE; k++)
+    {
+        make_key(key, key_size, k);
+        if (chaos_hashmap_find(map, key, &value, &found) != CHAOS_STATUS_OK)
+        {
+            return 0;
+        }
+        if ((found == CHAOS_TRUE) != (g_present[k] != 0U))
+        {
+            return 0;
+        }
+        if (found == CHAOS_TRUE)
+        {
+            memcpy(&v, value, sizeof(v));
+            if (v != g_value[k])
+            {
+                return 0;
+            }
+            count++;
+        }
+    }
+
+    return (count == map->count) ? 1 : 0;
+}
+
+/* Random puts and erases against the model */
+static int run_model(chaos_hashmap_t *map, size_t key_size)
+{
+    unsigned char key[12];
+    chaos_bool_t found = CHAOS_FALSE;
+    unsigned op;
+    unsigned k;
+    unsigned v;
+
+    memset(g_present, 0, sizeof(g_present));
+    for (op = 0U; op < OPS; op++)
+    {
+        k = (unsigned)(next_u64() % UNIVERSE);
+        make_key(key, key_size, k);
+        if ((next_u64() % 3U) != 0U)
+        {
+            v = (unsigned)next_u64();
+            if (chaos_hashmap_put(map, key, &v) != CHAOS_STATUS_OK)
+            {
+                return 0;
+            }
+            g_present[k] = 1U;
+            g_value[k] = v;
+        }
+        else
+        {
+            if (chaos_hashmap_erase(map, key, &found) != CHAOS_STATUS_OK)
+            {
+                return 0;
+            }
+            if ((found == CHAOS_TRUE) != (g_present[k] != 0U))
+            {
+                return 0;
+            }
+            g_present[k] = 0U;
+        }
+        if (((op % 20000U) == 0U) && (model_matches(map, key_size) == 0))
+        {
+            return 0;
+        }
+    }
+
+    return model_matches(map, key_size);
+}
+
+/* -------------------------------------------------------------------------- */
+/* Tests                                                                       */
+/* -------------------------------------------------------------------------- */
+
+static int test_hashmap_basic(void)
+{
+    chaos_hashmap_t map;
+    chaos_size_t need = 0U;
+    void *value = NULL;
+    chaos_bool_t found = CHAOS_TRUE;
+    unsigned key;
+    unsigned v;
+
+    TEST_ASSERT(chaos_hashmap_region_size(4U, 4U, 16U, &need) == CHAOS_STATUS_OK, "region size");
+    TEST_ASSERT(chaos_hashmap_init(&map, 4U, 4U, 16U, &g_region[1], need) == CHAOS_STATUS_OK, "init on unaligned region");
+    TEST_ASSERT(((size_t)map.entries % 4U) == 0U, "values aligned");
+    TEST_ASSERT(map.capacity == 14U, "capacity is 7/8 of the slots");
+
+    key = 7U;
+    TEST_ASSERT(chaos_hashmap_find(&map, &key, &value, &found) == CHAOS_STATUS_OK, "find in empty map");
+    TEST_ASSERT((found == CHAOS_FALSE) && (value == NULL), "empty map has no key");
+
+    v = 70U;
+    TEST_ASSERT(chaos_hashmap_put(&map, &key, &v) == CHAOS_STATUS_OK, "put");
+    v = 71U;
+    TEST_ASSERT(chaos_hashmap_put(&map, &key, &v) == CHAOS_STATUS_OK, "put again");
+    TEST_ASSERT(map.count == 1U, "same key stored once");
+    TEST_ASSERT(chaos_hashmap_find(&map, &key, &value, &found) == CHAOS_STATUS_OK, "find");
+    TEST_ASSERT((found == CHAOS_TRUE) && (*(unsigned *)value == 71U), "value replaced");
+
+    *(unsigned *)value = 72U;
+    TEST_ASSERT(chaos_hashmap_find(&map, &key, NULL, &found) == CHAOS_STATUS_OK, "find without value");
+    TEST_ASSERT(found == CHAOS_TRUE, "membership");
+
+    for (key = 100U; key < 113U; key++)
+    {
+        TEST_ASSERT(chaos_hashmap_put(&map, &key, &key) == CHAOS_STATUS_OK, "fill");
+    }
+    TEST_ASSERT(map.count == 14U, "map full");
+    TEST_ASSERT(chaos_hashmap_put(&map, &key, &key) != CHAOS_STATUS_OK, "fixed map does not grow");
+    TEST_ASSERT(map.count == 14U, "failed put leaves the map unchanged");
+    key = 7U;
+    v = 73U;
+    TEST_ASSERT(chaos_hashmap_put(&map, &key, &v) == CHAOS_STATUS_OK, "replace in full map");
+
+    TEST_ASSERT(chaos_hashmap_erase(&map, &key, &found) == CHAOS_STATUS_OK, "erase");
+    TEST_ASSERT(found == CHAOS_TRUE, "erased key was present");
+    TEST_ASSERT(chaos_hashmap_erase(&map, &key, &found) == CHAOS_STATUS_OK, "erase again");
+    TEST_ASSERT(found == CHAOS_FALSE, "erased key is gone");
+    TEST_ASSERT(chaos_hashmap_erase(&map, &key, NULL) == CHAOS_STATUS_OK, "erase without found flag");
+    TEST_ASSERT(map.count == 13U, "count after erase");
+    for (key = 100U; key < 113U; key++)
+    {
+        TEST_ASSERT(chaos_hashmap_find(&map, &key, &value, &found) == CHAOS_STATUS_OK, "find after erase");
+        TEST_ASSERT((found == CHAOS_TRUE) && (*(unsigned *)value == key), "other keys kept");
+    }
+
+    TEST_ASSERT(chaos_hashmap_clear(&map) == CHAOS_STATUS_OK, "clear");
+    key = 100U;
+    TEST_ASSERT(chaos_hashmap_find(&map, &key, &value, &found) == CHAOS_STATUS_OK, "find after clear");
+    TEST_ASSERT((map.count == 0U) && (found == CHAOS_FALSE), "clear empties the map");
+
+    TEST_PASS("chaos_hashmap put/find/erase on a fixed region");
+}
+
+static int test_hashmap_model(void)
+{
+    static const size_t key_sizes[] = { 4U, 8U, 12U };
+    chaos_hashmap_t map;
+    chaos_size_t need = 0U;
+    size_t i;
+
+    for (i = 0U; i < (sizeof(key_sizes) / sizeof(key_sizes[0])); i++)
+    {
+        TEST_ASSERT(chaos_hashmap_region_size((chaos_size_t)key_sizes[i], 4U, 4096U, &need) == CHAOS_STATUS_OK, "region size");
+        TEST_ASSERT(need <= sizeof(g_region), "region large enough");
+        TEST_ASSERT(chaos_hashmap_init(&map, (chaos_size_t)key_sizes[i], 4U, 4096U, g_region, need) == CHAOS_STATUS_OK, "init");
+        TEST_ASSERT(run_model(&map, key_sizes[i]) == 1, "random puts and erases match the model");
+    }
+
+    /* Small table: runs wrap around the end and many keys share fingerprints */
+    TEST_ASSERT(chaos_hashmap_region_size(8U, 4U, 16U, &need) == CHAOS_STATUS_OK, "small region size");
+    TEST_ASSERT(chaos_hashmap_init(&map, 8U, 4U, 16U, g_region, need) == CHAOS_STATUS_OK, "small init");
+    {
+        unsigned char key[8];
+        chaos_bool_t found = CHAOS_FALSE;
+        unsigned round;
+        unsigned k;
+
+        memset(g_present, 0, sizeof(g_present));
+        for (round = 0U; round < 2000U; round++)
+        {
+            for (k = 0U; k < 14U; k++)
+            {
+                g_value[k] = round ^ k;
+                make_key(key, 8U, k + (round * 14U));
+                TEST_ASSERT(chaos_hashmap_put(&map, key, &g_value[k]) == CHAOS_STATUS_OK, "small fill");
+            }
+            for (k = 0U; k < 14U; k++)
+            {
+                make_key(key, 8U, k + (round * 14U));
+                TEST_ASSERT(chaos_hashmap_erase(&map, key, &found) == CHAOS_STATUS_OK, "small erase");
+                TEST_ASSERT(found == CHAOS_TRUE, "small key present until erased");
+            }
+            TEST_ASSERT(map.count == 0U, "small map empty again");
+        }
+    }
+
+    TEST_PASS("chaos_hashmap matches a reference model");
+}
+
+static int test_hashmap_iterate(void)
+{
+    chaos_hashmap_t map;
+    chaos_size_t need = 0U;
+    chaos_size_t cursor = 0U;
+    const void *key = NULL;
+    void *value = NULL;
+    chaos_bool_t found = CHAOS_FALSE;
+    unsigned seen[64];
+    unsigned k;
+    unsigned n = 0U;
+
+    TEST_ASSERT(chaos_hashmap_region_size(4U, 0U, 64U, &need) == CHAOS_STATUS_OK, "set region size");
+    TEST_ASSERT(chaos_hashmap_init(&map, 4U, 0U, 64U, g_region, need) == CHAOS_STATUS_OK, "set init");
+    for (k = 0U; k < 40U; k++)
+    {
+        TEST_ASSERT(chaos_hashmap_put(&map, &k, NULL) == CHAOS_STATUS_OK, "set put");
+    }
+
+    memset(seen, 0, sizeof(seen));
+    TEST_ASSERT(chaos_hashmap_next(&map, &cursor, &key, &value, &found) == CHAOS_STATUS_OK, "next");
+    while (found == CHAOS_TRUE)
+    {
+        memcpy(&k, key, sizeof(k));
+        TEST_ASSERT(k < 40U, "iterated key was inserted");
+        seen[k]++;
+        n++;
+        TEST_ASSERT(chaos_hashmap_next(&map, &cursor, &key, NULL, &found) == CHAOS_STATUS_OK, "next");
+    }
+    TEST_ASSERT(n == 40U, "every entry returned");
+    for (k = 0U; k < 40U; k++)
+    {
+        TEST_ASSERT(seen[k] == 1U, "each entry returned once");
+    }
+
+    TEST_PASS("chaos_hashmap_next");
+}
+
+static int test_hashmap_dynamic(void)
+{
+#if (CHAOS_ENABLE_ALLOC == 1)
+    static unsigned char heap[1024U * 1024U];
+    chaos_alloc_config_t cfg = { heap, sizeof(heap) };
+    chaos_hashmap_t map;
+    chaos_size_t before = 0U;
+    chaos_size_t after = 0U;
+    void *value = NULL;
+    chaos_bool_t found = CHAOS_FALSE;
+    chaos_u64_t k;
+    chaos_u64_t v;
+
+    TEST_ASSERT(chaos_alloc_init(&cfg) == CHAOS_STATUS_OK, "alloc init");
+    TEST_ASSERT(chaos_alloc_get_free(&before) == CHAOS_STATUS_OK, "free before");
+    TEST_ASSERT(chaos_hashmap_init_dynamic(&map, 8U, 8U, 16U) == CHAOS_STATUS_OK, "dynamic init");
+    for (k = 0U; k < 10000U; k++)
+    {
+        v = k * 3U;
+        TEST_ASSERT(chaos_hashmap_put(&map, &k, &v) == CHAOS_STATUS_OK, "dynamic put");
+    }
+    TEST_ASSERT((map.count == 10000U) && (map.slot_count == 16384U), "map grew to fit");
+    for (k = 0U; k < 10000U; k++)
+    {
+        TEST_ASSERT(chaos_hashmap_find(&map, &k, &value, &found) == CHAOS_STATUS_OK, "dynamic find");
+        TEST_ASSERT((found == CHAOS_TRUE) && (*(chaos_u64_t *)value == (k * 3U)), "entries kept across growth");
+    }
+    k = 10000U;
+    TEST_ASSERT(chaos_hashmap_find(&map, &k, &value, &found) == CHAOS_STATUS_OK, "dynamic miss");
+    TEST_ASSERT(found == CHAOS_FALSE, "absent key not found");
+    TEST_ASSERT(chaos_hashmap_free(&map) == CHAOS_STATUS_OK, "free");
+    TEST_ASSERT(chaos_alloc_get_free(&after) == CHAOS_STATUS_OK, "free after");
+    TEST_ASSERT(before == after, "regions released");
+    TEST_ASSERT(chaos_hashmap_put(&map, &k, &v) != CHAOS_STATUS_OK, "freed map rejected");
+
+    TEST_PASS("chaos_hashmap dynamic growth");
+#else
+    chaos_hashmap_t map;
+
+    TEST_ASSERT(chaos_hashmap_init_dynamic(&map, 8U, 8U, 16U) != CHAOS_STATUS_OK, "dynamic map needs the allocator");
+    TEST_PASS("chaos_hashmap dynamic growth (allocator disabled)");
+#endif
+}
+
+static int test_hashmap_params(void)
+{
+    chaos_hashmap_t map;
+    chaos_size_t need = 0U;
+    unsigned key = 1U;
+
+    TEST_ASSERT(chaos_hashmap_region_size(0U, 4U, 16U, &need) != CHAOS_STATUS_OK, "zero key size rejected");
+    TEST_ASSERT(chaos_hashmap_region_size(4U, 4U, 8U, &need) != CHAOS_STATUS_OK, "too few slots rejected");
+    TEST_ASSERT(chaos_hashmap_region_size(4U, 4U, 48U, &need) != CHAOS_STATUS_OK, "non power of two rejected");
+    TEST_ASSERT(chaos_hashmap_region_size(4U, 4U, CHAOS_HASHMAP_SLOTS_MAX * 2U, &need) != CHAOS_STATUS_OK, "too many slots rejected");
+    TEST_ASSERT(chaos_hashmap_region_size(4096U, 4096U, CHAOS_HASHMAP_SLOTS_MAX, &need) != CHAOS_STATUS_OK, "size overflow rejected");
+    TEST_ASSERT(chaos_hashmap_region_size(4U, 4U, 16U, &need) == CHAOS_STATUS_OK, "region size");
+    TEST_ASSERT(chaos_hashmap_init(&map, 4U, 4U, 16U, g_region, need - 1U) != CHAOS_STATUS_OK, "small region rejected");
+    TEST_ASSERT(chaos_hashmap_init(&map, 4U, 4U, 16U, g_region, need) == CHAOS_STATUS_OK, "init");
+    TEST_ASSERT(chaos_hashmap_put(&map, &key, NULL) != CHAOS_STATUS_OK, "NULL value rejected");
+    TEST_ASSERT(chaos_hashmap_put(&map, NULL, &key) != CHAOS_STATUS_OK, "NULL key rejected");
+    TEST_ASSERT(chaos_hashmap_find(&map, &key, NULL, NULL) != CHAOS_STATUS_OK, "NULL found rejected");
+
+    TEST_PASS("chaos_hashmap parameter checks");
+}
+
+/* -------------------------------------------------------------------------- */
+/* Main                                                                        */
+/* -------------------------------------------------------------------------- */
+
+int main(void)
+{
+    int failures = 0;
+
+    failures += test_hashmap_basic();
+    failures += test_hashmap_model();
+    failures += test_hashmap_iterate();
+    failures += test_hashmap_dynamic();
+    failures += test_hashmap_params();
+
+    if (failures == 0)
+    {
+        printf("\nAll chaos_std hashmap tests passed \n");
+        return 0;
+    }
+
+    printf("\n%d test(s) failed \n", failures);
+    return 1;
+}
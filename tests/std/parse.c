@@ -0,0 +1,311 @@
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "chaos_std.h"
+#include "chaos_test.h"
+
+/* -------------------------------------------------------------------------- */
+/* Helpers                                                                     */
+/* -------------------------------------------------------------------------- */
+
+/* Reference: strtoll/strtoull on a terminated copy, with chaos semantics for '-' */
+static int ref_i64(const char *s, size_t len, long long *value, size_t *used, int *overflow)
+{
+    char buf[128];
+    char *end;
+
+    memcpy(buf, s, len);
+    buf[len] = '\0';
+    errno = 0;
+    *value = strtoll(buf, &end, 10);
+    *used = (size_t)(end - buf);
+    *overflow = (errno == ERANGE);
+    return *used != 0U;
+}
+
+static int ref_u64(const char *s, size_t len, unsigned long long *value, size_t *used, int *overflow)
+{
+    char buf[128];
+    char *end;
+    size_t i = 0U;
+
+    memcpy(buf, s, len);
+    buf[len] = '\0';
+    /* strtoull negates after a '-'; the chaos parsers reject it */
+    while ((buf[i] == ' ') || ((buf[i] >= '\t') && (buf[i] <= '\r')))
+    {
+        i++;
+    }
+    if (buf[i] == '-')
+    {
+        *value = 0U;
+        *used = 0U;
+        *overflow = 0;
+        return 0;
+    }
+    errno = 0;
+    *value = strtoull(buf, &end, 10);
+    *used = (size_t)(end - buf);
+    *overflow = (errno == ERANGE);
+    return *used != 0U;
+}
+
+static int check_i32(const char *s, size_t len)
+{
+    long long ref;
+    size_t used;
+    int over;
+    int ok = ref_i64(s, len, &ref, &used, &over);
+    chaos_i32_t v = 7;
+    chaos_size_t n = 99U;
+    chaos_status_t st = chaos_strtoi32((const chaos_char_t *)s, (chaos_size_t)len, &v, &n);
+
+    if (ok == 0)
+    {
+        return (CHAOS_STATUS_CODE(st) == CHAOS_STD_NO_DIGITS) && (v == 0) && (n == 0U);
+    }
+    if (ref > 2147483647LL)
+    {
+        over = 1;
+        ref = 2147483647LL;
+    }
+    if (ref < -2147483647LL - 1LL)
+    {
+        over = 1;
+        ref = -2147483647LL - 1LL;
+    }
+    if (over != 0)
+    {
+        return (CHAOS_STATUS_CODE(st) == CHAOS_STD_OVERFLOW) && (CHAOS_STATUS_CLASS(st) == CHAOS_ERRCLASS_OVERFLOW) && ((long long)v == ref) && (n == used);
+    }
+    return (st == CHAOS_STATUS_OK) && ((long long)v == ref) && (n == used);
+}
+
+static int check_u32(const char *s, size_t len)
+{
+    unsigned long long ref;
+    size_t used;
+    int over;
+    int ok = ref_u64(s, len, &ref, &used, &over);
+    chaos_u32_t v = 7U;
+    chaos_size_t n = 99U;
+    chaos_status_t st = chaos_strtou32((const chaos_char_t *)s, (chaos_size_t)len, &v, &n);
+
+    if (ok == 0)
+    {
+        return (CHAOS_STATUS_CODE(st) == CHAOS_STD_NO_DIGITS) && (v == 0U) && (n == 0U);
+    }
+    if (ref > 4294967295ULL)
+    {
+        over = 1;
+        ref = 4294967295ULL;
+    }
+    if (over != 0)
+    {
+        return (CHAOS_STATUS_CODE(st) == CHAOS_STD_OVERFLOW) && (v == ref) && (n == used);
+    }
+    return (st == CHAOS_STATUS_OK) && (v == ref) && (n == used);
+}
+
+#if (CHAOS_ENABLE_INT64 == 1)
+static int check_i64(const char *s, size_t len)
+{
+    long long ref;
+    size_t used;
+    int over;
+    int ok = ref_i64(s, len, &ref, &used, &over);
+    chaos_i64_t v = 7;
+    chaos_size_t n = 99U;
+    chaos_status_t st = chaos_strtoi64((const chaos_char_t *)s, (chaos_size_t)len, &v, &n);
+
+    if (ok == 0)
+    {
+        return (CHAOS_STATUS_CODE(st) == CHAOS_STD_NO_DIGITS) && (v == 0) && (n == 0U);
+    }
+    if (over != 0)
+    {
+        return (CHAOS_STATUS_CODE(st) == CHAOS_STD_OVERFLOW) && (v == ref) && (n == used);
+    }
+    return (st == CHAOS_STATUS_OK) && (v == ref) && (n == used);
+}
+
+static int check_u64(const char *s, size_t len)
+{
+    unsigned long long ref;
+    size_t used;
+    int over;
+    int ok = ref_u64(s, len, &ref, &used, &over);
+    chaos_u64_t v = 7U;
+    chaos_size_t n = 99U;
+    chaos_status_t st = chaos_strtou64((const chaos_char_t *)s, (chaos_size_t)len, &v, &n);
+
+    if (ok == 0)
+    {
+        return (CHAOS_STATUS_CODE(st) == CHAOS_STD_NO_DIGITS) && (v == 0U) && (n == 0U);
+    }
+    if (over != 0)
+    {
+        return (CHAOS_STATUS_CODE(st) == CHAOS_STD_OVERFLOW) && (v == ref) && (n == used);
+    }
+    return (st == CHAOS_STATUS_OK) && (v == ref) && (n == used);
+}
+#endif
+
+static int check_all(const char *s, size_t len)
+{
+    int ok = check_i32(s, len) && check_u32(s, len);
+#if (CHAOS_ENABLE_INT64 == 1)
+    ok = ok && check_i64(s, len) && check_u64(s, len);
+#endif
+    return ok;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Tests                                                                       */
+/* -------------------------------------------------------------------------- */
+
+static int test_parse_basic(void)
+{
+    chaos_i32_t v = 0;
+    chaos_u32_t u = 0U;
+    chaos_size_t n = 0U;
+
+    TEST_ASSERT(chaos_strtoi32((const chaos_char_t *)"12345,", 6U, &v, &n) == CHAOS_STATUS_OK, "status");
+    TEST_ASSERT((v == 12345) && (n == 5U), "stops at the delimiter");
+    TEST_ASSERT(chaos_strtoi32((const chaos_char_t *)"  \t-42x", 7U, &v, &n) == CHAOS_STATUS_OK, "status");
+    TEST_ASSERT((v == -42) && (n == 6U), "whitespace and sign are consumed");
+    TEST_ASSERT(chaos_strtoi32((const chaos_char_t *)"+0007", 5U, &v, &n) == CHAOS_STATUS_OK, "status");
+    TEST_ASSERT((v == 7) && (n == 5U), "plus sign and leading zeros");
+    TEST_ASSERT(chaos_strtoi32((const chaos_char_t *)"-2147483648", 11U, &v, &n) == CHAOS_STATUS_OK, "status");
+    TEST_ASSERT((v == chaos_i32_t_MIN) && (n == 11U), "most negative value");
+    TEST_ASSERT(chaos_strtoi32((const chaos_char_t *)"123456789", 4U, &v, &n) == CHAOS_STATUS_OK, "status");
+    TEST_ASSERT((v == 1234) && (n == 4U), "digits past len are not read");
+    TEST_ASSERT(chaos_strtou32((const chaos_char_t *)"4294967295", 10U, &u, &n) == CHAOS_STATUS_OK, "status");
+    TEST_ASSERT((u == chaos_u32_t_MAX) && (n == 10U), "largest unsigned value");
+    TEST_ASSERT(chaos_atoi((chaos_cstr_t)"  -1234567890 rest", &v) == CHAOS_STATUS_OK, "atoi status");
+    TEST_ASSERT(v == -1234567890, "atoi value");
+
+    TEST_PASS("parse basic values");
+}
+
+static int test_parse_errors(void)
+{
+    chaos_status_t st;
+    chaos_i32_t v = 5;
+    chaos_u32_t u = 5U;
+    chaos_size_t n = 5U;
+
+    st = chaos_strtoi32((const chaos_char_t *)"abc", 3U, &v, &n);
+    TEST_ASSERT((CHAOS_STATUS_MODULE(st) == CHAOS_MODULE_STDLIB) && (CHAOS_STATUS_CODE(st) == CHAOS_STD_NO_DIGITS), "no digits");
+    TEST_ASSERT((v == 0) && (n == 0U), "no digits leaves nothing consumed");
+    st = chaos_strtoi32((const chaos_char_t *)" - 1", 4U, &v, &n);
+    TEST_ASSERT(CHAOS_STATUS_CODE(st) == CHAOS_STD_NO_DIGITS, "sign without digits");
+    st = chaos_strtoi32(CHAOS_NULL, 0U, &v, &n);
+    TEST_ASSERT(CHAOS_STATUS_CODE(st) == CHAOS_STD_NO_DIGITS, "empty input");
+    st = chaos_strtou32((const chaos_char_t *)"-1", 2U, &u, &n);
+    TEST_ASSERT(CHAOS_STATUS_CODE(st) == CHAOS_STD_NO_DIGITS, "unsigned rejects minus");
+
+    st = chaos_strtoi32((const chaos_char_t *)"2147483648", 10U, &v, &n);
+    TEST_ASSERT((CHAOS_STATUS_CLASS(st) == CHAOS_ERRCLASS_OVERFLOW) && (CHAOS_STATUS_CODE(st) == CHAOS_STD_OVERFLOW), "i32 overflow");
+    TEST_ASSERT((v == chaos_i32_t_MAX) && (n == 10U), "i32 overflow saturates and consumes");
+    st = chaos_strtoi32((const chaos_char_t *)"-99999999999999999999999999", 27U, &v, &n);
+    TEST_ASSERT(CHAOS_STATUS_CODE(st) == CHAOS_STD_OVERFLOW, "long negative overflow");
+    TEST_ASSERT((v == chaos_i32_t_MIN) && (n == 27U), "negative overflow saturates");
+    st = chaos_strtou32((const chaos_char_t *)"4294967296", 10U, &u, &n);
+    TEST_ASSERT((CHAOS_STATUS_CODE(st) == CHAOS_STD_OVERFLOW) && (u == chaos_u32_t_MAX), "u32 overflow");
+    st = chaos_atoi((chaos_cstr_t)"3000000000", &v);
+    TEST_ASSERT((CHAOS_STATUS_CODE(st) == CHAOS_STD_OVERFLOW) && (v == chaos_i32_t_MAX), "atoi overflow");
+
+    TEST_ASSERT(chaos_strtoi32((const chaos_char_t *)"1", 1U, CHAOS_NULL, &n) != CHAOS_STATUS_OK, "NULL value");
+    TEST_ASSERT(chaos_strtou32(CHAOS_NULL, 1U, &u, &n) != CHAOS_STATUS_OK, "NULL input");
+    TEST_ASSERT(chaos_atoi(CHAOS_NULL, &v) != CHAOS_STATUS_OK, "atoi NULL input");
+
+    TEST_PASS("parse errors and overflow");
+}
+
+/* Every digit count around each word boundary and each type limit */
+static int test_parse_lengths(void)
+{
+    static const char *const edges[] = {
+        "2147483647", "2147483648", "-2147483648", "-2147483649",
+        "4294967295", "4294967296", "9223372036854775807", "9223372036854775808",
+        "-9223372036854775808", "-9223372036854775809", "18446744073709551615", "18446744073709551616",
+        "99999999999999999999", "00000000000000000000000000001", "-0", "+0", "0", "000",
+    };
+    char buf[64];
+    size_t digits;
+    size_t lead;
+    size_t i;
+
+    for (i = 0U; i < (sizeof(edges) / sizeof(edges[0])); i++)
+    {
+        TEST_ASSERT(check_all(edges[i], strlen(edges[i])), "type limit");
+    }
+
+    for (lead = 0U; lead < 9U; lead++)
+    {
+        for (digits = 0U; digits <= 24U; digits++)
+        {
+            memset(buf, ' ', lead);
+            for (i = 0U; i < digits; i++)
+            {
+                buf[lead + i] = (char)('1' + ((i * 7U) % 9U));
+            }
+            buf[lead + digits] = ';';
+            TEST_ASSERT(check_all(buf, lead + digits), "digits ending the input");
+            TEST_ASSERT(check_all(buf, lead + digits + 1U), "digits before a delimiter");
+            buf[lead] = '-';
+            TEST_ASSERT(check_all(buf, lead + digits + 1U), "negative digits");
+        }
+    }
+
+    TEST_PASS("parse every length vs strtoll/strtoull");
+}
+
+/* Random fields, including bytes next to the digit range */
+static int test_parse_random(void)
+{
+    static const char alphabet[] = "0123456789012345678901234567890123456789 +-/:\t,.\xB0\xB9";
+    char buf[40];
+    size_t len;
+    size_t i;
+    size_t iter;
+
+    srand(44);
+    for (iter = 0U; iter < 200000U; iter++)
+    {
+        len = (size_t)rand() % 30U;
+        for (i = 0U; i < len; i++)
+        {
+            buf[i] = alphabet[(size_t)rand() % (sizeof(alphabet) - 1U)];
+        }
+        TEST_ASSERT(check_all(buf, len), "random field vs strtoll/strtoull");
+    }
+
+    TEST_PASS("parse random fields vs strtoll/strtoull");
+}
+
+/* -------------------------------------------------------------------------- */
+/* Runner                                                                      */
+/* -------------------------------------------------------------------------- */
+
+int main(void)
+{
+    int failures = 0;
+
+    failures += test_parse_basic();
+    failures += test_parse_errors();
+    failures += test_parse_lengths();
+    failures += test_parse_random();
+
+    if (failures == 0)
+    {
+        printf("\nAll chaos_std parse tests passed \n");
+        return 0;
+    }
+
+    printf("\n%d test(s) failed \n", failures);
+    return 1;
+}
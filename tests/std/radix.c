@@ -0,0 +1,321 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "chaos_sort.h"
+#include "chaos_alloc.h"
+#include "chaos_test.h"
+
+/* -------------------------------------------------------------------------- */
+/* Helpers                                                                     */
+/* -------------------------------------------------------------------------- */
+
+#define MAX_N 20000U
+#define PATTERNS 7
+
+static const size_t g_sizes[] = { 0U, 1U, 2U, 3U, 17U, 255U, 256U, 257U, 1000U, MAX_N };
+
+static unsigned long long g_state = 0x9E3779B97F4A7C15ULL;
+static unsigned long long g_src[MAX_N];
+static unsigned g_val[MAX_N];
+static unsigned char g_scratch[(MAX_N * 13U) + 65536U + 16U];
+
+static unsigned long long next_u64(void)
+{
+    g_state ^= g_state << 13U;
+    g_state ^= g_state >> 7U;
+    g_state ^= g_state << 17U;
+    return g_state;
+}
+
+/*
+ * Random, sorted, reversed, few distinct, all equal, timestamps that share
+ * their high bytes, and small keys under one outlier that spans every bit
+ */
+static void fill(size_t n, int pattern)
+{
+    size_t i;
+
+    for (i = 0U; i < n; i++)
+    {
+        switch (pattern)
+        {
+        case 0: g_src[i] = next_u64(); break;
+        case 1: g_src[i] = i * 0x0101010101ULL; break;
+        case 2: g_src[i] = (n - i) << 40U; break;
+        case 3: g_src[i] = (next_u64() % 4U) * 0x8000000080000000ULL; break;
+        case 4: g_src[i] = 0xFFFFFFFF00000000ULL; break;
+        case 5: g_src[i] = 1700000000000000ULL + (next_u64() % 100000U); break;
+        default: g_src[i] = (i == (n / 2U)) ? ~0ULL : (next_u64() & 0xFFFFFU); break;
+        }
+        g_val[i] = (unsigned)i;
+    }
+}
+
+static int cmp_u32(const void *a, const void *b)
+{
+    unsigned x = *(const unsigned *)a;
+    unsigned y = *(const unsigned *)b;
+    return (x > y) - (x < y);
+}
+
+static int cmp_i32(const void *a, const void *b)
+{
+    int x = *(const int *)a;
+    int y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+static int cmp_u64(const void *a, const void *b)
+{
+    unsigned long long x = *(const unsigned long long *)a;
+    unsigned long long y = *(const unsigned long long *)b;
+    return (x > y) - (x < y);
+}
+
+static int cmp_i64(const void *a, const void *b)
+{
+    long long x = *(const long long *)a;
+    long long y = *(const long long *)b;
+    return (x > y) - (x < y);
+}
+
+#if (CHAOS_ENABLE_FLOAT == 1)
+/* IEEE total order as an unsigned key */
+static unsigned total32(float f)
+{
+    unsigned u;
+
+    memcpy(&u, &f, sizeof(u));
+    return ((u >> 31U) != 0U) ? ~u : (u | 0x80000000U);
+}
+
+#if (CHAOS_ENABLE_INT64 == 1)
+static unsigned long long total64(double d)
+{
+    unsigned long long u;
+
+    memcpy(&u, &d, sizeof(u));
+    return ((u >> 63U) != 0U) ? ~u : (u | 0x8000000000000000ULL);
+}
+#endif
+#endif
+
+/* -------------------------------------------------------------------------- */
+/* Tests                                                                       */
+/* -------------------------------------------------------------------------- */
+
+static int test_radix_32(void)
+{
+    static unsigned a[MAX_N];
+    static unsigned want[MAX_N];
+    static int b[MAX_N];
+    static int wantb[MAX_N];
+    static unsigned v[MAX_N];
+    size_t s;
+    size_t i;
+    int p;
+
+    for (p = 0; p < PATTERNS; p++)
+    {
+        for (s = 0U; s < (sizeof(g_sizes) / sizeof(g_sizes[0])); s++)
+        {
+            fill(g_sizes[s], p);
+            for (i = 0U; i < g_sizes[s]; i++)
+            {
+                a[i] = (unsigned)(g_src[i] >> ((p == 5) ? 8U : 0U));
+                b[i] = (int)(unsigned)(g_src[i] >> 32U);
+                v[i] = g_val[i];
+            }
+            memcpy(want, a, g_sizes[s] * sizeof(a[0]));
+            memcpy(wantb, b, g_sizes[s] * sizeof(b[0]));
+            qsort(want, g_sizes[s], sizeof(want[0]), cmp_u32);
+            qsort(wantb, g_sizes[s], sizeof(wantb[0]), cmp_i32);
+
+            TEST_ASSERT(chaos_radix_sort_u32(a, v, g_sizes[s], g_scratch, sizeof(g_scratch)) == CHAOS_STATUS_OK, "u32 status");
+            TEST_ASSERT(memcmp(a, want, g_sizes[s] * sizeof(a[0])) == 0, "u32 matches qsort");
+            for (i = 0U; i < g_sizes[s]; i++)
+            {
+                TEST_ASSERT(a[i] == (unsigned)(g_src[v[i]] >> ((p == 5) ? 8U : 0U)), "u32 payload follows key");
+                TEST_ASSERT((i == 0U) || (a[i - 1U] != a[i]) || (v[i - 1U] < v[i]), "u32 sort is stable");
+            }
+
+            TEST_ASSERT(chaos_radix_sort_i32(b, NULL, g_sizes[s], g_scratch, sizeof(g_scratch)) == CHAOS_STATUS_OK, "i32 status");
+            TEST_ASSERT(memcmp(b, wantb, g_sizes[s] * sizeof(b[0])) == 0, "i32 matches qsort");
+        }
+    }
+
+    TEST_PASS("chaos_radix_sort_u32 / i32");
+}
+
+static int test_radix_64(void)
+{
+#if (CHAOS_ENABLE_INT64 == 1)
+    static unsigned long long a[MAX_N];
+    static long long b[MAX_N];
+    static long long wantb[MAX_N];
+    static unsigned v[MAX_N];
+    size_t s;
+    size_t i;
+    int p;
+
+    for (p = 0; p < PATTERNS; p++)
+    {
+        for (s = 0U; s < (sizeof(g_sizes) / sizeof(g_sizes[0])); s++)
+        {
+            fill(g_sizes[s], p);
+            memcpy(a, g_src, g_sizes[s] * sizeof(a[0]));
+            memcpy(b, g_src, g_sizes[s] * sizeof(b[0]));
+            memcpy(v, g_val, g_sizes[s] * sizeof(v[0]));
+            memcpy(wantb, b, g_sizes[s] * sizeof(b[0]));
+            qsort(wantb, g_sizes[s], sizeof(wantb[0]), cmp_i64);
+
+            TEST_ASSERT(chaos_radix_sort_u64(a, v, g_sizes[s], g_scratch, sizeof(g_scratch)) == CHAOS_STATUS_OK, "u64 status");
+            for (i = 0U; i < g_sizes[s]; i++)
+            {
+                TEST_ASSERT(a[i] == g_src[v[i]], "u64 payload follows key");
+                TEST_ASSERT((i == 0U) || (a[i - 1U] < a[i]) || ((a[i - 1U] == a[i]) && (v[i - 1U] < v[i])), "u64 ascending and stable");
+            }
+
+            TEST_ASSERT(chaos_radix_sort_i64(b, NULL, g_sizes[s], g_scratch, sizeof(g_scratch)) == CHAOS_STATUS_OK, "i64 status");
+            TEST_ASSERT(memcmp(b, wantb, g_sizes[s] * sizeof(b[0])) == 0, "i64 matches qsort");
+
+            qsort(g_src, g_sizes[s], sizeof(g_src[0]), cmp_u64);
+            TEST_ASSERT(memcmp(a, g_src, g_sizes[s] * sizeof(a[0])) == 0, "u64 matches qsort");
+        }
+    }
+#endif
+
+    TEST_PASS("chaos_radix_sort_u64 / i64");
+}
+
+static int test_radix_float(void)
+{
+#if (CHAOS_ENABLE_FLOAT == 1)
+    static float f[MAX_N];
+    static unsigned v[MAX_N];
+#if (CHAOS_ENABLE_INT64 == 1)
+    static double d[MAX_N];
+#endif
+    const size_t n = MAX_N;
+    unsigned long long r;
+    size_t i;
+
+    for (i = 0U; i < n; i++)
+    {
+        r = next_u64();
+        switch (r % 8U)
+        {
+        case 0: f[i] = -0.0f; break;
+        case 1: f[i] = 0.0f; break;
+        case 2: f[i] = -1.0f / 0.0f; break;
+        default: f[i] = (float)((long long)(r >> 20) % 20000) / 3.0f; break;
+        }
+#if (CHAOS_ENABLE_INT64 == 1)
+        d[i] = (double)f[i] * 1e-300;
+#endif
+        v[i] = (unsigned)i;
+    }
+    f[0] = 0.0f / 0.0f;
+    if (total32(f[0]) < 0x80000000U)
+    {
+        f[0] = -f[0];
+    }
+#if (CHAOS_ENABLE_INT64 == 1)
+    d[0] = (double)f[0];
+    d[1] = -d[0];
+#endif
+
+    TEST_ASSERT(chaos_radix_sort_f32(f, v, n, g_scratch, sizeof(g_scratch)) == CHAOS_STATUS_OK, "f32 status");
+    for (i = 1U; i < n; i++)
+    {
+        TEST_ASSERT(total32(f[i - 1U]) <= total32(f[i]), "f32 in total order");
+    }
+    TEST_ASSERT((f[n - 1U] != f[n - 1U]) && (v[n - 1U] == 0U), "positive NaN and its payload go last");
+    TEST_ASSERT(f[0] == -1.0f / 0.0f, "-inf goes first");
+
+#if (CHAOS_ENABLE_INT64 == 1)
+    TEST_ASSERT(chaos_radix_sort_f64(d, NULL, n, g_scratch, sizeof(g_scratch)) == CHAOS_STATUS_OK, "f64 status");
+    for (i = 1U; i < n; i++)
+    {
+        TEST_ASSERT(total64(d[i - 1U]) <= total64(d[i]), "f64 in total order");
+    }
+    TEST_ASSERT((d[0] != d[0]) && (d[n - 1U] != d[n - 1U]), "NaNs go to the end of their sign");
+#endif
+#endif
+
+    TEST_PASS("chaos_radix_sort_f32 / f64 total order");
+}
+
+static int test_radix_scratch(void)
+{
+    unsigned a[4] = { 3U, 1U, 2U, 0U };
+    chaos_size_t need = chaos_radix_sort_scratch(4U, 4U, CHAOS_FALSE);
+
+    TEST_ASSERT(need >= (4U * sizeof(unsigned)), "scratch holds the keys");
+    TEST_ASSERT(chaos_radix_sort_scratch(4U, 4U, CHAOS_TRUE) == (need + (4U * sizeof(unsigned))), "payload adds its copy");
+    TEST_ASSERT(chaos_radix_sort_scratch(~(chaos_size_t)0U, 8U, CHAOS_TRUE) == ~(chaos_size_t)0U, "overflow saturates");
+    TEST_ASSERT(chaos_radix_sort_u32(a, NULL, 4U, g_scratch, need - 1U) ==
+                CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STDLIB, CHAOS_ERRCLASS_INVALID_PARAM, CHAOS_STD_SCRATCH_SMALL),
+                "short scratch rejected");
+    TEST_ASSERT(a[0] == 3U, "keys untouched on error");
+    /* Any alignment will do */
+    TEST_ASSERT(chaos_radix_sort_u32(a, NULL, 4U, &g_scratch[3], need) == CHAOS_STATUS_OK, "unaligned scratch");
+    TEST_ASSERT((a[0] == 0U) && (a[1] == 1U) && (a[2] == 2U) && (a[3] == 3U), "sorted with unaligned scratch");
+    TEST_ASSERT(chaos_radix_sort_u32(NULL, NULL, 0U, NULL, 0U) == CHAOS_STATUS_OK, "empty NULL accepted");
+    TEST_ASSERT(chaos_radix_sort_u32(NULL, NULL, 2U, g_scratch, sizeof(g_scratch)) != CHAOS_STATUS_OK, "NULL keys rejected");
+
+#if (CHAOS_ENABLE_ALLOC == 1)
+    {
+        static unsigned char heap[64U * 1024U];
+        chaos_alloc_config_t cfg = { heap, sizeof(heap) };
+        chaos_size_t before = 0U;
+        chaos_size_t after = 0U;
+        unsigned k[1000];
+        size_t i;
+
+        for (i = 0U; i < 1000U; i++)
+        {
+            k[i] = (unsigned)next_u64();
+        }
+        TEST_ASSERT(chaos_alloc_init(&cfg) == CHAOS_STATUS_OK, "alloc init");
+        TEST_ASSERT(chaos_alloc_get_free(&before) == CHAOS_STATUS_OK, "free before");
+        TEST_ASSERT(chaos_radix_sort_u32(k, NULL, 1000U, NULL, 0U) == CHAOS_STATUS_OK, "sort with allocated scratch");
+        TEST_ASSERT(chaos_alloc_get_free(&after) == CHAOS_STATUS_OK, "free after");
+        TEST_ASSERT(before == after, "allocated scratch released");
+        for (i = 1U; i < 1000U; i++)
+        {
+            TEST_ASSERT(k[i - 1U] <= k[i], "allocated scratch sorts");
+        }
+    }
+#else
+    TEST_ASSERT(chaos_radix_sort_u32(a, NULL, 4U, NULL, 0U) ==
+                CHAOS_STATUS_MAKE(CHAOS_SEVERITY_FATAL, CHAOS_MODULE_ALLOC, CHAOS_ERRCLASS_NOT_SUPPORTED, CHAOS_ALLOC_DISABLED),
+                "no allocator without a scratch buffer");
+#endif
+
+    TEST_PASS("chaos_radix_sort scratch handling");
+}
+
+/* -------------------------------------------------------------------------- */
+/* Main                                                                        */
+/* -------------------------------------------------------------------------- */
+
+int main(void)
+{
+    int failures = 0;
+
+    failures += test_radix_32();
+    failures += test_radix_64();
+    failures += test_radix_float();
+    failures += test_radix_scratch();
+
+    if (failures == 0)
+    {
+        printf("\nAll chaos_std radix tests passed \n");
+        return 0;
+    }
+
+    printf("\n%d test(s) failed \n", failures);
+    return 1;
+}
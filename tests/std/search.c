@@ -0,0 +1,273 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "chaos_search.h"
+#include "chaos_test.h"
+
+/* -------------------------------------------------------------------------- */
+/* Helpers                                                                     */
+/* -------------------------------------------------------------------------- */
+
+#define MAX_N 5000U
+
+static unsigned long long g_state = 0x9E3779B97F4A7C15ULL;
+
+static unsigned long long next_u64(void)
+{
+    g_state ^= g_state << 13U;
+    g_state ^= g_state >> 7U;
+    g_state ^= g_state << 17U;
+    return g_state;
+}
+
+static int cmp_u32(const void *a, const void *b)
+{
+    unsigned x = *(const unsigned *)a;
+    unsigned y = *(const unsigned *)b;
+    return (x > y) - (x < y);
+}
+
+/* Sorted values with runs of duplicates, spaced so that keys fall between them */
+static void fill_sorted(unsigned *a, size_t n)
+{
+    size_t i;
+
+    for (i = 0U; i < n; i++)
+    {
+        a[i] = 2U * (unsigned)(next_u64() % (n + 1U));
+    }
+    qsort(a, n, sizeof(a[0]), cmp_u32);
+}
+
+static size_t ref_lower_bound(const unsigned *a, size_t n, unsigned key)
+{
+    size_t i = 0U;
+
+    while ((i < n) && (a[i] < key))
+    {
+        i++;
+    }
+    return i;
+}
+
+typedef struct
+{
+    float x;
+    float y;
+} point_t;
+
+static chaos_i32_t cmp_point_x(void *ctx, const void *elem, const void *key)
+{
+    float x = ((const point_t *)elem)->x;
+    float k = *(const float *)key;
+    (*(unsigned *)ctx)++;
+    return (x > k) - (x < k);
+}
+
+static chaos_i32_t cmp_u32_cb(void *ctx, const void *elem, const void *key)
+{
+    (void)ctx;
+    return cmp_u32(elem, key);
+}
+
+/* -------------------------------------------------------------------------- */
+/* Tests                                                                       */
+/* -------------------------------------------------------------------------- */
+
+static int test_lower_bound_typed(void)
+{
+    static unsigned a[MAX_N];
+    static int b[MAX_N];
+    chaos_size_t index = 0U;
+    size_t n;
+    size_t i;
+    unsigned key;
+
+    for (n = 0U; n < MAX_N; n = (n < 300U) ? (n + 1U) : (n * 3U))
+    {
+        fill_sorted(a, n);
+        for (i = 0U; i < n; i++)
+        {
+            b[i] = (int)a[i] - (int)n;
+        }
+        for (key = 0U; key <= ((2U * (unsigned)n) + 2U); key += (n < 300U) ? 1U : 7U)
+        {
+            TEST_ASSERT(chaos_lower_bound_u32(a, n, key, &index) == CHAOS_STATUS_OK, "u32 status");
+            TEST_ASSERT(index == ref_lower_bound(a, n, key), "u32 matches linear scan");
+            TEST_ASSERT(chaos_lower_bound_i32(b, n, (int)key - (int)n, &index) == CHAOS_STATUS_OK, "i32 status");
+            TEST_ASSERT(index == ref_lower_bound(a, n, key), "i32 matches linear scan");
+        }
+    }
+
+#if (CHAOS_ENABLE_INT64 == 1)
+    {
+        static const unsigned long long u[] = { 0ULL, 5ULL, 5ULL, 1ULL << 40U, 0xFFFFFFFFFFFFFFFFULL };
+        static const long long s[] = { -(1LL << 50), -1LL, 0LL, 3LL };
+
+        TEST_ASSERT((chaos_lower_bound_u64(u, 5U, 5ULL, &index) == CHAOS_STATUS_OK) && (index == 1U), "u64 first of equal run");
+        TEST_ASSERT((chaos_lower_bound_u64(u, 5U, 6ULL, &index) == CHAOS_STATUS_OK) && (index == 3U), "u64 between");
+        TEST_ASSERT((chaos_lower_bound_u64(u, 5U, 0xFFFFFFFFFFFFFFFFULL, &index) == CHAOS_STATUS_OK) && (index == 4U), "u64 max");
+        TEST_ASSERT((chaos_lower_bound_i64(s, 4U, -2LL, &index) == CHAOS_STATUS_OK) && (index == 1U), "i64 negative");
+        TEST_ASSERT((chaos_lower_bound_i64(s, 4U, 4LL, &index) == CHAOS_STATUS_OK) && (index == 4U), "i64 past the end");
+    }
+#endif
+#if (CHAOS_ENABLE_FLOAT == 1)
+    {
+        static const float f[] = { -2.5f, -0.0f, 0.5f, 0.5f, 1e30f };
+        static const double d[] = { -1e300, 1e-300, 2.0 };
+
+        TEST_ASSERT((chaos_lower_bound_f32(f, 5U, 0.0f, &index) == CHAOS_STATUS_OK) && (index == 1U), "f32 zero");
+        TEST_ASSERT((chaos_lower_bound_f32(f, 5U, 0.25f, &index) == CHAOS_STATUS_OK) && (index == 2U), "f32 between");
+        TEST_ASSERT((chaos_lower_bound_f32(f, 5U, -3.0f, &index) == CHAOS_STATUS_OK) && (index == 0U), "f32 before all");
+        TEST_ASSERT((chaos_lower_bound_f64(d, 3U, 0.0, &index) == CHAOS_STATUS_OK) && (index == 1U), "f64 between");
+    }
+#endif
+
+    TEST_PASS("chaos_lower_bound typed forms");
+}
+
+static int test_lower_bound_generic(void)
+{
+    static point_t table[MAX_N];
+    chaos_size_t index = 0U;
+    chaos_bool_t found = CHAOS_FALSE;
+    unsigned calls = 0U;
+    size_t n;
+    size_t i;
+    float key;
+
+    for (n = 0U; n < MAX_N; n = (n < 64U) ? (n + 1U) : (n * 2U))
+    {
+        for (i = 0U; i < n; i++)
+        {
+            table[i].x = (float)(i / 2U);
+            table[i].y = (float)i * 0.5f;
+        }
+        for (key = -1.0f; key < ((float)n / 2.0f) + 1.0f; key += 0.5f)
+        {
+            calls = 0U;
+            TEST_ASSERT(chaos_lower_bound(table, n, sizeof(table[0]), &key, cmp_point_x, &calls, &index) == CHAOS_STATUS_OK, "generic status");
+            TEST_ASSERT((index == n) || (table[index].x >= key), "generic bound not below key");
+            TEST_ASSERT((index == 0U) || (table[index - 1U].x < key), "generic bound is the first");
+            TEST_ASSERT((n == 0U) || (calls <= 14U), "log2(n) + 1 comparisons");
+
+            TEST_ASSERT(chaos_bsearch(table, n, sizeof(table[0]), &key, cmp_point_x, &calls, &index, &found) == CHAOS_STATUS_OK, "bsearch status");
+            TEST_ASSERT(found == ((key >= 0.0f) && (key < (float)((n + 1U) / 2U)) && ((float)(int)key == key)), "bsearch found");
+            TEST_ASSERT((found == CHAOS_FALSE) || ((table[index].x == key) && ((index == 0U) || (table[index - 1U].x < key))), "bsearch reports the first match");
+        }
+    }
+
+    TEST_PASS("chaos_lower_bound / chaos_bsearch with a comparator");
+}
+
+static int test_eytzinger(void)
+{
+    static unsigned sorted[MAX_N];
+    static unsigned idx[MAX_N];
+    static unsigned tree[MAX_N + 1U];
+    static unsigned slot_idx[MAX_N + 1U];
+    chaos_size_t slot = 0U;
+    chaos_size_t slot2 = 0U;
+    size_t want;
+    size_t n;
+    size_t i;
+    unsigned key;
+
+    for (n = 0U; n < MAX_N; n = (n < 300U) ? (n + 1U) : ((n * 3U) + 1U))
+    {
+        fill_sorted(sorted, n);
+        for (i = 0U; i < n; i++)
+        {
+            idx[i] = (unsigned)i;
+        }
+        tree[0] = 0xDEADBEEFU;
+        TEST_ASSERT(chaos_eytzinger_build(sorted, n, sizeof(sorted[0]), tree) == CHAOS_STATUS_OK, "build status");
+        TEST_ASSERT(chaos_eytzinger_build(idx, n, sizeof(idx[0]), slot_idx) == CHAOS_STATUS_OK, "build payload");
+        TEST_ASSERT(tree[0] == 0xDEADBEEFU, "slot 0 untouched");
+        for (i = 1U; i <= n; i++)
+        {
+            TEST_ASSERT(tree[i] == sorted[slot_idx[i]], "tree holds every element");
+            TEST_ASSERT(((2U * i) > n) || (tree[2U * i] <= tree[i]), "left child not greater");
+            TEST_ASSERT((((2U * i) + 1U) > n) || (tree[(2U * i) + 1U] >= tree[i]), "right child not smaller");
+        }
+
+        for (key = 0U; key <= ((2U * (unsigned)n) + 2U); key += (n < 300U) ? 1U : 5U)
+        {
+            want = ref_lower_bound(sorted, n, key);
+            TEST_ASSERT(chaos_eytzinger_lower_bound_u32(tree, n, key, &slot) == CHAOS_STATUS_OK, "search status");
+            TEST_ASSERT((slot == 0U) ? (want == n) : (slot_idx[slot] == want), "slot maps to the lower bound");
+            TEST_ASSERT(chaos_eytzinger_lower_bound(tree, n, sizeof(tree[0]), &key, cmp_u32_cb, NULL, &slot2) == CHAOS_STATUS_OK, "generic search status");
+            TEST_ASSERT(slot2 == slot, "generic search agrees");
+        }
+    }
+
+#if (CHAOS_ENABLE_FLOAT == 1)
+    {
+        static const float f[] = { -1.0f, 0.5f, 2.0f, 8.0f, 9.0f, 100.0f };
+        float ft[7];
+
+        TEST_ASSERT(chaos_eytzinger_build(f, 6U, sizeof(f[0]), ft) == CHAOS_STATUS_OK, "f32 build");
+        TEST_ASSERT((chaos_eytzinger_lower_bound_f32(ft, 6U, 3.0f, &slot) == CHAOS_STATUS_OK) && (ft[slot] == 8.0f), "f32 search");
+        TEST_ASSERT((chaos_eytzinger_lower_bound_f32(ft, 6U, 101.0f, &slot) == CHAOS_STATUS_OK) && (slot == 0U), "f32 past the end");
+    }
+#endif
+#if (CHAOS_ENABLE_INT64 == 1)
+    {
+        static const long long s[] = { -7LL, -3LL, 0LL, 4LL, 1LL << 40U };
+        long long st[6];
+
+        TEST_ASSERT(chaos_eytzinger_build(s, 5U, sizeof(s[0]), st) == CHAOS_STATUS_OK, "i64 build");
+        TEST_ASSERT((chaos_eytzinger_lower_bound_i64(st, 5U, -5LL, &slot) == CHAOS_STATUS_OK) && (st[slot] == -3LL), "i64 search");
+    }
+#endif
+
+    TEST_PASS("chaos_eytzinger build and search");
+}
+
+static int test_search_errors(void)
+{
+    unsigned a[2] = { 1U, 2U };
+    unsigned key = 1U;
+    chaos_size_t index = 7U;
+    chaos_bool_t found = CHAOS_TRUE;
+
+    TEST_ASSERT((chaos_lower_bound_u32(NULL, 0U, 5U, &index) == CHAOS_STATUS_OK) && (index == 0U), "empty NULL accepted");
+    TEST_ASSERT((chaos_bsearch(NULL, 0U, 4U, &key, cmp_u32_cb, NULL, &index, &found) == CHAOS_STATUS_OK) && (found == CHAOS_FALSE), "empty bsearch");
+    TEST_ASSERT((chaos_eytzinger_lower_bound_u32(NULL, 0U, 5U, &index) == CHAOS_STATUS_OK) && (index == 0U), "empty tree");
+    TEST_ASSERT(chaos_lower_bound_u32(NULL, 2U, 5U, &index) != CHAOS_STATUS_OK, "NULL base rejected");
+    TEST_ASSERT(chaos_lower_bound_u32(a, 2U, 5U, NULL) != CHAOS_STATUS_OK, "NULL index rejected");
+    TEST_ASSERT(chaos_lower_bound(a, 2U, 4U, &key, NULL, NULL, &index) != CHAOS_STATUS_OK, "NULL comparator rejected");
+    TEST_ASSERT(chaos_bsearch(a, 2U, 4U, &key, cmp_u32_cb, NULL, &index, NULL) != CHAOS_STATUS_OK, "NULL found rejected");
+    TEST_ASSERT(chaos_lower_bound(a, 2U, 0U, &key, cmp_u32_cb, NULL, &index) ==
+                CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STDLIB, CHAOS_ERRCLASS_INVALID_PARAM, CHAOS_STD_SIZE_ZERO),
+                "zero size rejected");
+    TEST_ASSERT(chaos_eytzinger_build(a, 2U, 4U, NULL) != CHAOS_STATUS_OK, "NULL tree rejected");
+    TEST_ASSERT(chaos_eytzinger_build(a, CHAOS_EYTZINGER_MAX + 1U, 4U, a) != CHAOS_STATUS_OK, "oversized tree rejected");
+    TEST_ASSERT(chaos_eytzinger_lower_bound_u32(a, CHAOS_EYTZINGER_MAX + 1U, 5U, &index) != CHAOS_STATUS_OK, "oversized search rejected");
+
+    TEST_PASS("chaos_search parameter errors");
+}
+
+/* -------------------------------------------------------------------------- */
+/* Main                                                                        */
+/* -------------------------------------------------------------------------- */
+
+int main(void)
+{
+    int failures = 0;
+
+    failures += test_lower_bound_typed();
+    failures += test_lower_bound_generic();
+    failures += test_eytzinger();
+    failures += test_search_errors();
+
+    if (failures == 0)
+    {
+        printf("\nAll chaos_std search tests passed \n");
+        return 0;
+    }
+
+    printf("\n%d test(s) failed \n", failures);
+    return 1;
+}
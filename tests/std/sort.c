@@ -0,0 +1,478 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "chaos_sort.h"
+#include "chaos_test.h"
+
+/* -------------------------------------------------------------------------- */
+/* Helpers                                                                     */
+/* -------------------------------------------------------------------------- */
+
+#define MAX_N 20000U
+#define PATTERNS 9
+
+static const size_t g_sizes[] = { 0U, 1U, 2U, 3U, 5U, 10U, 23U, 24U, 25U, 64U, 100U, 127U, 128U, 129U, 200U, 1000U, 5000U, MAX_N };
+
+static unsigned long long g_state = 0x9E3779B97F4A7C15ULL;
+
+static unsigned long long next_u64(void)
+{
+    g_state ^= g_state << 13U;
+    g_state ^= g_state >> 7U;
+    g_state ^= g_state << 17U;
+    return g_state;
+}
+
+/* Fill with one of the input shapes quicksorts tend to get wrong */
+static void fill(unsigned long long *a, size_t n, int pattern)
+{
+    size_t i;
+
+    for (i = 0U; i < n; i++)
+    {
+        switch (pattern)
+        {
+        case 0: a[i] = next_u64(); break;
+        case 1: a[i] = i; break;
+        case 2: a[i] = n - i; break;
+        case 3: a[i] = next_u64() % 4U; break;
+        case 4: a[i] = (i < (n / 2U)) ? i : (n - i); break;
+        case 5: a[i] = 7U; break;
+        case 6: a[i] = i % 64U; break;
+        case 7: a[i] = ((i + 10U) < n) ? i : next_u64(); break;
+        default: a[i] = (i == 0U) ? n : i; break;
+        }
+    }
+}
+
+static int cmp_u32(const void *a, const void *b)
+{
+    unsigned x = *(const unsigned *)a;
+    unsigned y = *(const unsigned *)b;
+    return (x > y) - (x < y);
+}
+
+static int cmp_i32(const void *a, const void *b)
+{
+    int x = *(const int *)a;
+    int y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+static int cmp_u64(const void *a, const void *b)
+{
+    unsigned long long x = *(const unsigned long long *)a;
+    unsigned long long y = *(const unsigned long long *)b;
+    return (x > y) - (x < y);
+}
+
+static int cmp_i64(const void *a, const void *b)
+{
+    long long x = *(const long long *)a;
+    long long y = *(const long long *)b;
+    return (x > y) - (x < y);
+}
+
+static int cmp_pair32(const void *a, const void *b)
+{
+    const chaos_sort_kv32_t *x = (const chaos_sort_kv32_t *)a;
+    const chaos_sort_kv32_t *y = (const chaos_sort_kv32_t *)b;
+    int r = (x->key > y->key) - (x->key < y->key);
+    return (r != 0) ? r : ((x->value > y->value) - (x->value < y->value));
+}
+
+typedef struct
+{
+    unsigned key;
+    unsigned tag;
+    unsigned pad;
+} rec_t;
+
+static int cmp_rec_full(const void *a, const void *b)
+{
+    const rec_t *x = (const rec_t *)a;
+    const rec_t *y = (const rec_t *)b;
+    int r = (x->key > y->key) - (x->key < y->key);
+    return (r != 0) ? r : ((x->tag > y->tag) - (x->tag < y->tag));
+}
+
+static chaos_i32_t cmp_rec_key(void *ctx, const void *a, const void *b)
+{
+    const rec_t *x = (const rec_t *)a;
+    const rec_t *y = (const rec_t *)b;
+    (*(unsigned long *)ctx)++;
+    return (x->key > y->key) - (x->key < y->key);
+}
+
+static chaos_i32_t cmp_byte3(void *ctx, const void *a, const void *b)
+{
+    (void)ctx;
+    return memcmp(a, b, 3U);
+}
+
+static int cmp_byte3_q(const void *a, const void *b)
+{
+    return memcmp(a, b, 3U);
+}
+
+/* McIlroy's adversary: decides element values lazily so that every pivot is a bad one */
+static int *g_val;
+static int g_gas;
+static int g_solid;
+static int g_candidate;
+static unsigned long g_ncmp;
+
+static chaos_i32_t cmp_adversary(void *ctx, const void *a, const void *b)
+{
+    int x = *(const int *)a;
+    int y = *(const int *)b;
+
+    (void)ctx;
+    g_ncmp++;
+    if ((g_val[x] == g_gas) && (g_val[y] == g_gas))
+    {
+        g_val[(x == g_candidate) ? x : y] = g_solid++;
+    }
+    if (g_val[x] == g_gas)
+    {
+        g_candidate = x;
+    }
+    else if (g_val[y] == g_gas)
+    {
+        g_candidate = y;
+    }
+    return (g_val[x] > g_val[y]) - (g_val[x] < g_val[y]);
+}
+
+static unsigned long long g_src[MAX_N];
+
+/* -------------------------------------------------------------------------- */
+/* Tests                                                                       */
+/* -------------------------------------------------------------------------- */
+
+static int test_sort_u32_patterns(void)
+{
+    static unsigned a[MAX_N];
+    static unsigned want[MAX_N];
+    size_t s;
+    size_t i;
+    int p;
+
+    for (p = 0; p < PATTERNS; p++)
+    {
+        for (s = 0U; s < (sizeof(g_sizes) / sizeof(g_sizes[0])); s++)
+        {
+            fill(g_src, g_sizes[s], p);
+            for (i = 0U; i < g_sizes[s]; i++)
+            {
+                a[i] = (unsigned)g_src[i];
+                want[i] = a[i];
+            }
+            qsort(want, g_sizes[s], sizeof(want[0]), cmp_u32);
+            TEST_ASSERT(chaos_sort_u32(a, g_sizes[s]) == CHAOS_STATUS_OK, "u32 status");
+            TEST_ASSERT(memcmp(a, want, g_sizes[s] * sizeof(a[0])) == 0, "u32 matches qsort");
+        }
+    }
+
+    TEST_PASS("chaos_sort_u32 patterns");
+}
+
+static int test_sort_signed(void)
+{
+    static int a[MAX_N];
+    static int want[MAX_N];
+    static long long b[MAX_N];
+    static long long wantb[MAX_N];
+    size_t s;
+    size_t i;
+    int p;
+
+    for (p = 0; p < PATTERNS; p++)
+    {
+        for (s = 0U; s < (sizeof(g_sizes) / sizeof(g_sizes[0])); s++)
+        {
+            fill(g_src, g_sizes[s], p);
+            for (i = 0U; i < g_sizes[s]; i++)
+            {
+                a[i] = (int)(unsigned)g_src[i];
+                b[i] = (long long)g_src[i];
+                if ((p == 1) && (i & 1U))
+                {
+                    a[i] = -a[i];
+                    b[i] = -b[i];
+                }
+            }
+            memcpy(want, a, g_sizes[s] * sizeof(a[0]));
+            memcpy(wantb, b, g_sizes[s] * sizeof(b[0]));
+            qsort(want, g_sizes[s], sizeof(want[0]), cmp_i32);
+            qsort(wantb, g_sizes[s], sizeof(wantb[0]), cmp_i64);
+            TEST_ASSERT(chaos_sort_i32(a, g_sizes[s]) == CHAOS_STATUS_OK, "i32 status");
+            TEST_ASSERT(memcmp(a, want, g_sizes[s] * sizeof(a[0])) == 0, "i32 matches qsort");
+#if (CHAOS_ENABLE_INT64 == 1)
+            TEST_ASSERT(chaos_sort_i64(b, g_sizes[s]) == CHAOS_STATUS_OK, "i64 status");
+            TEST_ASSERT(memcmp(b, wantb, g_sizes[s] * sizeof(b[0])) == 0, "i64 matches qsort");
+#endif
+        }
+    }
+
+    TEST_PASS("chaos_sort_i32 / chaos_sort_i64 patterns");
+}
+
+static int test_sort_u64(void)
+{
+#if (CHAOS_ENABLE_INT64 == 1)
+    static unsigned long long a[MAX_N];
+    size_t s;
+    int p;
+
+    for (p = 0; p < PATTERNS; p++)
+    {
+        for (s = 0U; s < (sizeof(g_sizes) / sizeof(g_sizes[0])); s++)
+        {
+            fill(g_src, g_sizes[s], p);
+            memcpy(a, g_src, g_sizes[s] * sizeof(a[0]));
+            qsort(g_src, g_sizes[s], sizeof(g_src[0]), cmp_u64);
+            TEST_ASSERT(chaos_sort_u64(a, g_sizes[s]) == CHAOS_STATUS_OK, "u64 status");
+            TEST_ASSERT(memcmp(a, g_src, g_sizes[s] * sizeof(a[0])) == 0, "u64 matches qsort");
+        }
+    }
+#endif
+
+    TEST_PASS("chaos_sort_u64 patterns");
+}
+
+static int test_sort_float(void)
+{
+#if (CHAOS_ENABLE_FLOAT == 1)
+    static float f[MAX_N];
+    static double d[MAX_N];
+    size_t n;
+    size_t i;
+    size_t nans32;
+    size_t nans64;
+    int round;
+    unsigned long long r;
+
+    for (round = 0; round < 40; round++)
+    {
+        n = (size_t)(next_u64() % MAX_N);
+        nans32 = 0U;
+        nans64 = 0U;
+        for (i = 0U; i < n; i++)
+        {
+            r = next_u64();
+            switch (r % 16U)
+            {
+            case 0: f[i] = 0.0f / 0.0f; d[i] = 0.0 / 0.0; nans32++; nans64++; break;
+            case 1: f[i] = -0.0f; d[i] = -0.0; break;
+            case 2: f[i] = 0.0f; d[i] = 0.0; break;
+            case 3: f[i] = 1.0f / 0.0f; d[i] = -1.0 / 0.0; break;
+            default:
+                f[i] = (float)((long long)(r >> 20) % 2000) / 7.0f;
+                d[i] = (double)((long long)(r >> 8)) * 1e-9;
+                break;
+            }
+        }
+        TEST_ASSERT(chaos_sort_f32(f, n) == CHAOS_STATUS_OK, "f32 status");
+        TEST_ASSERT(chaos_sort_f64(d, n) == CHAOS_STATUS_OK, "f64 status");
+        for (i = 0U; i < n; i++)
+        {
+            if (i < (n - nans32))
+            {
+                TEST_ASSERT(f[i] == f[i], "f32 numbers come first");
+                TEST_ASSERT((i == 0U) || (f[i - 1U] <= f[i]), "f32 ascending");
+            }
+            else
+            {
+                TEST_ASSERT(f[i] != f[i], "f32 NaNs go last");
+            }
+            if (i < (n - nans64))
+            {
+                TEST_ASSERT(d[i] == d[i], "f64 numbers come first");
+                TEST_ASSERT((i == 0U) || (d[i - 1U] <= d[i]), "f64 ascending");
+            }
+            else
+            {
+                TEST_ASSERT(d[i] != d[i], "f64 NaNs go last");
+            }
+        }
+    }
+#endif
+
+    TEST_PASS("chaos_sort_f32 / chaos_sort_f64 with NaN and signed zero");
+}
+
+static int test_sort_kv(void)
+{
+    static chaos_sort_kv32_t a[MAX_N];
+    static chaos_sort_kv32_t want[MAX_N];
+#if (CHAOS_ENABLE_INT64 == 1)
+    static chaos_sort_kv64_t b[MAX_N];
+#endif
+    size_t s;
+    size_t i;
+    int p;
+
+    for (p = 0; p < PATTERNS; p++)
+    {
+        for (s = 0U; s < (sizeof(g_sizes) / sizeof(g_sizes[0])); s++)
+        {
+            fill(g_src, g_sizes[s], p);
+            for (i = 0U; i < g_sizes[s]; i++)
+            {
+                a[i].key = (chaos_u32_t)g_src[i];
+                a[i].value = (chaos_u32_t)i;
+#if (CHAOS_ENABLE_INT64 == 1)
+                b[i].key = g_src[i];
+                b[i].value = ~g_src[i];
+#endif
+            }
+            memcpy(want, a, g_sizes[s] * sizeof(a[0]));
+            qsort(want, g_sizes[s], sizeof(want[0]), cmp_pair32);
+
+            TEST_ASSERT(chaos_sort_kv32(a, g_sizes[s]) == CHAOS_STATUS_OK, "kv32 status");
+            for (i = 1U; i < g_sizes[s]; i++)
+            {
+                TEST_ASSERT(a[i - 1U].key <= a[i].key, "kv32 keys ascending");
+            }
+            /* Equal keys may come out in any order; the pairs themselves must survive */
+            qsort(a, g_sizes[s], sizeof(a[0]), cmp_pair32);
+            TEST_ASSERT(memcmp(a, want, g_sizes[s] * sizeof(a[0])) == 0, "kv32 keeps every pair");
+
+#if (CHAOS_ENABLE_INT64 == 1)
+            TEST_ASSERT(chaos_sort_kv64(b, g_sizes[s]) == CHAOS_STATUS_OK, "kv64 status");
+            for (i = 0U; i < g_sizes[s]; i++)
+            {
+                TEST_ASSERT((i == 0U) || (b[i - 1U].key <= b[i].key), "kv64 keys ascending");
+                TEST_ASSERT(b[i].value == ~b[i].key, "kv64 payload follows key");
+            }
+#endif
+        }
+    }
+
+    TEST_PASS("chaos_sort_kv32 / chaos_sort_kv64");
+}
+
+static int test_sort_generic(void)
+{
+    static rec_t a[MAX_N];
+    static rec_t want[MAX_N];
+    static unsigned char c[MAX_N * 3U];
+    static unsigned char wantc[MAX_N * 3U];
+    unsigned long ncmp = 0U;
+    size_t s;
+    size_t i;
+    int p;
+
+    for (p = 0; p < PATTERNS; p++)
+    {
+        for (s = 0U; s < (sizeof(g_sizes) / sizeof(g_sizes[0])); s++)
+        {
+            fill(g_src, g_sizes[s], p);
+            for (i = 0U; i < g_sizes[s]; i++)
+            {
+                a[i].key = (unsigned)g_src[i];
+                a[i].tag = (unsigned)i;
+                a[i].pad = 0xA5A5A5A5U;
+                c[3U * i] = (unsigned char)(g_src[i] >> 16U);
+                c[(3U * i) + 1U] = (unsigned char)(g_src[i] >> 8U);
+                c[(3U * i) + 2U] = (unsigned char)g_src[i];
+            }
+            memcpy(want, a, g_sizes[s] * sizeof(a[0]));
+            memcpy(wantc, c, g_sizes[s] * 3U);
+            qsort(want, g_sizes[s], sizeof(want[0]), cmp_rec_full);
+            qsort(wantc, g_sizes[s], 3U, cmp_byte3_q);
+
+            TEST_ASSERT(chaos_sort(a, g_sizes[s], sizeof(a[0]), cmp_rec_key, &ncmp) == CHAOS_STATUS_OK, "generic status");
+            for (i = 1U; i < g_sizes[s]; i++)
+            {
+                TEST_ASSERT(a[i - 1U].key <= a[i].key, "generic keys ascending");
+            }
+            qsort(a, g_sizes[s], sizeof(a[0]), cmp_rec_full);
+            TEST_ASSERT(memcmp(a, want, g_sizes[s] * sizeof(a[0])) == 0, "generic keeps every record");
+
+            TEST_ASSERT(chaos_sort(c, g_sizes[s], 3U, cmp_byte3, NULL) == CHAOS_STATUS_OK, "3-byte status");
+            TEST_ASSERT(memcmp(c, wantc, g_sizes[s] * 3U) == 0, "3-byte elements match qsort");
+        }
+    }
+    TEST_ASSERT(ncmp > 0U, "context reaches the comparator");
+
+    TEST_PASS("chaos_sort with a comparator");
+}
+
+static int test_sort_adversary(void)
+{
+    static int idx[MAX_N];
+    static int val[MAX_N];
+    const size_t n = MAX_N;
+    size_t i;
+
+    g_val = val;
+    g_gas = (int)n;
+    g_solid = 0;
+    g_candidate = 0;
+    g_ncmp = 0U;
+    for (i = 0U; i < n; i++)
+    {
+        idx[i] = (int)i;
+        val[i] = g_gas;
+    }
+
+    TEST_ASSERT(chaos_sort(idx, n, sizeof(idx[0]), cmp_adversary, NULL) == CHAOS_STATUS_OK, "adversary status");
+    for (i = 1U; i < n; i++)
+    {
+        TEST_ASSERT(val[idx[i - 1U]] <= val[idx[i]], "adversary input sorted");
+    }
+    /* A quicksort without the heapsort fallback needs about n * n / 2 comparisons here */
+    TEST_ASSERT(g_ncmp < (4UL * n * 15UL), "adversary stays O(n log n)");
+
+    TEST_PASS("chaos_sort against a quicksort adversary");
+}
+
+static int test_sort_errors(void)
+{
+    unsigned v = 1U;
+
+    TEST_ASSERT(chaos_sort_u32(NULL, 0U) == CHAOS_STATUS_OK, "empty NULL accepted");
+    TEST_ASSERT(chaos_sort(NULL, 0U, 4U, cmp_byte3, NULL) == CHAOS_STATUS_OK, "empty generic NULL accepted");
+    TEST_ASSERT(chaos_sort_u32(NULL, 3U) != CHAOS_STATUS_OK, "NULL base rejected");
+    TEST_ASSERT(chaos_sort_kv32(NULL, 3U) != CHAOS_STATUS_OK, "NULL kv base rejected");
+    TEST_ASSERT(chaos_sort(NULL, 3U, 4U, cmp_byte3, NULL) != CHAOS_STATUS_OK, "NULL generic base rejected");
+    TEST_ASSERT(chaos_sort(&v, 1U, 4U, NULL, NULL) ==
+                CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STDLIB, CHAOS_ERRCLASS_NULL_PTR, 0U),
+                "NULL comparator rejected");
+    TEST_ASSERT(chaos_sort(&v, 1U, 0U, cmp_byte3, NULL) ==
+                CHAOS_STATUS_MAKE(CHAOS_SEVERITY_ERROR, CHAOS_MODULE_STDLIB, CHAOS_ERRCLASS_INVALID_PARAM, CHAOS_STD_SIZE_ZERO),
+                "zero size rejected");
+    TEST_ASSERT(v == 1U, "input untouched on error");
+
+    TEST_PASS("chaos_sort parameter errors");
+}
+
+/* -------------------------------------------------------------------------- */
+/* Main                                                                        */
+/* -------------------------------------------------------------------------- */
+
+int main(void)
+{
+    int failures = 0;
+
+    failures += test_sort_u32_patterns();
+    failures += test_sort_signed();
+    failures += test_sort_u64();
+    failures += test_sort_float();
+    failures += test_sort_kv();
+    failures += test_sort_generic();
+    failures += test_sort_adversary();
+    failures += test_sort_errors();
+
+    if (failures == 0)
+    {
+        printf("\nAll chaos_std sort tests passed \n");
+        return 0;
+    }
+
+    printf("\n%d test(s) failed \n", failures);
+    return 1;
+}
@@ -0,0 +1,192 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "chaos_std_internal.h"
+#include "chaos_test.h"
+
+/* -------------------------------------------------------------------------- */
+/* Helpers                                                                     */
+/* -------------------------------------------------------------------------- */
+
+#if defined(CHAOS_ENABLE_INT64) && (CHAOS_ENABLE_INT64 == 1)
+
+/* Little-endian 32-bit limbs: 5^342 * 2^128 < 2^923 */
+#define LIMBS 30U
+
+typedef struct
+{
+    unsigned w[LIMBS];
+} big_t;
+
+static void big_mul_small(big_t *a, unsigned m)
+{
+    unsigned long long carry = 0U;
+    unsigned i;
+
+    for (i = 0U; i < LIMBS; i++)
+    {
+        carry += (unsigned long long)a->w[i] * m;
+        a->w[i] = (unsigned)carry;
+        carry >>= 32U;
+    }
+}
+
+static void big_mul(big_t *r, const big_t *a, const big_t *b)
+{
+    unsigned long long t;
+    unsigned i;
+    unsigned j;
+
+    memset(r, 0, sizeof(*r));
+    for (i = 0U; i < LIMBS; i++)
+    {
+        t = 0U;
+        for (j = 0U; (i + j) < LIMBS; j++)
+        {
+            t += ((unsigned long long)a->w[i] * b->w[j]) + r->w[i + j];
+            r->w[i + j] = (unsigned)t;
+            t >>= 32U;
+        }
+    }
+}
+
+static void big_add(big_t *r, const big_t *a)
+{
+    unsigned long long carry = 0U;
+    unsigned i;
+
+    for (i = 0U; i < LIMBS; i++)
+    {
+        carry += (unsigned long long)r->w[i] + a->w[i];
+        r->w[i] = (unsigned)carry;
+        carry >>= 32U;
+    }
+}
+
+static unsigned big_bit(const big_t *a, unsigned n)
+{
+    return (a->w[n / 32U] >> (n % 32U)) & 1U;
+}
+
+static unsigned big_bitlen(const big_t *a)
+{
+    unsigned n = LIMBS * 32U;
+
+    while ((n != 0U) && (big_bit(a, n - 1U) == 0U))
+    {
+        n--;
+    }
+    return n;
+}
+
+/* 128 bits of a starting at bit lo (bits below 0 read as zero) */
+static void big_top128(const big_t *a, int lo, chaos_u64_t *hi, chaos_u64_t *low)
+{
+    int i;
+
+    *hi = 0U;
+    *low = 0U;
+    for (i = 127; i >= 0; i--)
+    {
+        unsigned bit = ((lo + i) >= 0) ? big_bit(a, (unsigned)(lo + i)) : 0U;
+
+        *hi = (*hi << 1U) | (*low >> 63U);
+        *low = (*low << 1U) | bit;
+    }
+}
+
+static void big_from_entry(big_t *a, const chaos_u64_t entry[2])
+{
+    memset(a, 0, sizeof(*a));
+    a->w[0] = (unsigned)entry[1];
+    a->w[1] = (unsigned)(entry[1] >> 32U);
+    a->w[2] = (unsigned)entry[0];
+    a->w[3] = (unsigned)(entry[0] >> 32U);
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+/* Tests                                                                       */
+/* -------------------------------------------------------------------------- */
+
+static int test_pow5_nonnegative(void)
+{
+#if defined(CHAOS_ENABLE_INT64) && (CHAOS_ENABLE_INT64 == 1)
+    big_t p;
+    chaos_u64_t hi;
+    chaos_u64_t lo;
+    int q;
+
+    /* Entry q >= 0 is the top 128 bits of 5^q, padded with zeros */
+    memset(&p, 0, sizeof(p));
+    p.w[0] = 1U;
+    for (q = 0; q <= CHAOS_STD_POW5_MAX; q++)
+    {
+        const chaos_u64_t *e = chaos_std_pow5[q - CHAOS_STD_POW5_MIN];
+
+        big_top128(&p, (int)big_bitlen(&p) - 128, &hi, &lo);
+        TEST_ASSERT((e[0] == hi) && (e[1] == lo), "5^q for q >= 0");
+        big_mul_small(&p, 5U);
+    }
+
+    TEST_PASS("pow5 table, q = 0..324 recomputed");
+#else
+    TEST_PASS("pow5 table (64-bit integers disabled)");
+#endif
+}
+
+static int test_pow5_negative(void)
+{
+#if defined(CHAOS_ENABLE_INT64) && (CHAOS_ENABLE_INT64 == 1)
+    big_t d;
+    big_t t;
+    big_t p;
+    unsigned s;
+    int k;
+
+    /*
+     * Entry -k must be T = floor(2^s / 5^k) with T of 128 bits, that is
+     * T * 5^k < 2^s < (T + 1) * 5^k (5^k is odd, so 2^s is never a
+     * multiple): T * 5^k and (T + 1) * 5^k differ in bit length.
+     */
+    memset(&d, 0, sizeof(d));
+    d.w[0] = 1U;
+    for (k = 1; k <= -CHAOS_STD_POW5_MIN; k++)
+    {
+        big_mul_small(&d, 5U);
+        big_from_entry(&t, chaos_std_pow5[-k - CHAOS_STD_POW5_MIN]);
+        TEST_ASSERT(big_bitlen(&t) == 128U, "5^-k has 128 bits");
+
+        big_mul(&p, &t, &d);
+        s = big_bitlen(&p);
+        big_add(&p, &d);
+        TEST_ASSERT(big_bitlen(&p) == (s + 1U), "5^-k rounded down");
+    }
+
+    TEST_PASS("pow5 table, q = -342..-1 recomputed");
+#else
+    TEST_PASS("pow5 table (64-bit integers disabled)");
+#endif
+}
+
+/* -------------------------------------------------------------------------- */
+/* Main                                                                        */
+/* -------------------------------------------------------------------------- */
+
+int main(void)
+{
+    int failures = 0;
+
+    failures += test_pow5_nonnegative();
+    failures += test_pow5_negative();
+
+    if (failures == 0)
+    {
+        printf("\nAll chaos_std table tests passed \n");
+        return 0;
+    }
+
+    printf("\n%d test(s) failed \n", failures);
+    return 1;
+}
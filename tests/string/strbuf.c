@@ -0,0 +1,163 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "chaos_strbuf.h"
+#include "chaos_alloc.h"
+#include "chaos_test.h"
+
+/* -------------------------------------------------------------------------- */
+/* Tests                                                                       */
+/* -------------------------------------------------------------------------- */
+
+static int test_strbuf_fixed(void)
+{
+    chaos_char_t storage[64];
+    chaos_strbuf_t sb;
+    chaos_cstr_t str = NULL;
+    chaos_size_t len = 0U;
+
+    TEST_ASSERT(chaos_strbuf_init(&sb, storage, sizeof(storage)) == CHAOS_STATUS_OK, "strbuf init");
+    TEST_ASSERT(chaos_strbuf_append(&sb, (chaos_cstr_t)"T+") == CHAOS_STATUS_OK, "strbuf append");
+    TEST_ASSERT(chaos_strbuf_append_u32(&sb, 4294967295U) == CHAOS_STATUS_OK, "strbuf append u32");
+    TEST_ASSERT(chaos_strbuf_append_char(&sb, (chaos_char_t)' ') == CHAOS_STATUS_OK, "strbuf append char");
+    TEST_ASSERT(chaos_strbuf_append_i32(&sb, -2147483647 - 1) == CHAOS_STATUS_OK, "strbuf append i32 min");
+    TEST_ASSERT(chaos_strbuf_append_char(&sb, (chaos_char_t)' ') == CHAOS_STATUS_OK, "strbuf append char");
+    TEST_ASSERT(chaos_strbuf_append_i32(&sb, 0) == CHAOS_STATUS_OK, "strbuf append zero");
+    TEST_ASSERT(chaos_strbuf_append_n(&sb, (const chaos_char_t *)"|xyz", 2U) == CHAOS_STATUS_OK, "strbuf append_n");
+
+    TEST_ASSERT(chaos_strbuf_view(&sb, &str, &len) == CHAOS_STATUS_OK, "strbuf view");
+    TEST_ASSERT(strcmp((const char *)str, "T+4294967295 -2147483648 0|x") == 0, "strbuf content");
+    TEST_ASSERT(len == strlen((const char *)str), "strbuf length tracked");
+
+    TEST_ASSERT(chaos_strbuf_reset(&sb) == CHAOS_STATUS_OK, "strbuf reset");
+    TEST_ASSERT((chaos_strbuf_view(&sb, &str, &len) == CHAOS_STATUS_OK) && (len == 0U) && (str[0] == 0U), "strbuf empty after reset");
+
+    TEST_PASS("strbuf fixed storage");
+}
+
+static int test_strbuf_truncation(void)
+{
+    chaos_char_t storage[8];
+    chaos_strbuf_t sb;
+    chaos_cstr_t str = NULL;
+    chaos_size_t len = 0U;
+
+    (void)chaos_strbuf_init(&sb, storage, sizeof(storage));
+    TEST_ASSERT(chaos_strbuf_append(&sb, (chaos_cstr_t)"abcd") == CHAOS_STATUS_OK, "fits");
+    TEST_ASSERT(CHAOS_STATUS_CODE(chaos_strbuf_append(&sb, (chaos_cstr_t)"efghij")) == CHAOS_STRING_TRUNCATED, "append truncates");
+    TEST_ASSERT(CHAOS_STATUS_CODE(chaos_strbuf_append_char(&sb, (chaos_char_t)'z')) == CHAOS_STRING_TRUNCATED, "full buffer");
+
+    (void)chaos_strbuf_view(&sb, &str, &len);
+    TEST_ASSERT((len == 7U) && (strcmp((const char *)str, "abcdefg") == 0), "keeps what fits, terminated");
+
+    TEST_PASS("strbuf truncation");
+}
+
+static int test_strbuf_dynamic(void)
+{
+#if (CHAOS_ENABLE_ALLOC == 1)
+    static chaos_u8_t heap[4096];
+    chaos_alloc_config_t cfg = { heap, sizeof(heap) };
+    chaos_strbuf_t sb;
+    chaos_cstr_t str = NULL;
+    chaos_size_t len = 0U;
+    chaos_u32_t i;
+
+    TEST_ASSERT(chaos_alloc_init(&cfg) == CHAOS_STATUS_OK, "alloc init");
+    TEST_ASSERT(chaos_strbuf_init_dynamic(&sb, 4U) == CHAOS_STATUS_OK, "strbuf init dynamic");
+
+    for (i = 0U; i < 100U; i++)
+    {
+        TEST_ASSERT(chaos_strbuf_append_u32(&sb, i % 10U) == CHAOS_STATUS_OK, "dynamic append grows");
+    }
+
+    (void)chaos_strbuf_view(&sb, &str, &len);
+    TEST_ASSERT(len == 100U, "dynamic length");
+    TEST_ASSERT((str[0] == '0') && (str[57] == '7') && (str[100] == 0U), "dynamic content");
+    TEST_ASSERT(sb.cap >= 101U, "dynamic capacity");
+
+    TEST_ASSERT(chaos_strbuf_free(&sb) == CHAOS_STATUS_OK, "strbuf free");
+    TEST_ASSERT(sb.data == NULL, "strbuf released");
+
+    /* Appending its own content past capacity moves the block mid-append */
+    TEST_ASSERT(chaos_strbuf_init_dynamic(&sb, 4U) == CHAOS_STATUS_OK, "strbuf init dynamic");
+    (void)chaos_strbuf_append(&sb, (chaos_cstr_t)"xyz");
+    for (i = 0U; i < 6U; i++)
+    {
+        TEST_ASSERT(chaos_strbuf_append_n(&sb, sb.data, sb.len) == CHAOS_STATUS_OK, "self-append grows");
+    }
+
+    (void)chaos_strbuf_view(&sb, &str, &len);
+    TEST_ASSERT((len == 192U) && (str[192] == 0U), "self-append length");
+    for (i = 0U; i < 192U; i++)
+    {
+        TEST_ASSERT(str[i] == (chaos_char_t)"xyz"[i % 3U], "self-append content");
+    }
+    TEST_ASSERT(chaos_strbuf_free(&sb) == CHAOS_STATUS_OK, "strbuf free");
+
+    TEST_PASS("strbuf growth through chaos_alloc");
+#else
+    chaos_strbuf_t sb;
+
+    TEST_ASSERT(chaos_strbuf_init_dynamic(&sb, 4U) != CHAOS_STATUS_OK, "dynamic strbuf needs the allocator");
+    TEST_PASS("strbuf growth through chaos_alloc (allocator disabled)");
+#endif
+}
+
+static int test_strbuf_self_append(void)
+{
+    chaos_char_t storage[16];
+    chaos_strbuf_t sb;
+    chaos_cstr_t str = NULL;
+    chaos_size_t len = 0U;
+
+    (void)chaos_strbuf_init(&sb, storage, sizeof(storage));
+    (void)chaos_strbuf_append(&sb, (chaos_cstr_t)"abcdef");
+    TEST_ASSERT(chaos_strbuf_append_n(&sb, sb.data, sb.len) == CHAOS_STATUS_OK, "fixed self-append");
+    TEST_ASSERT(CHAOS_STATUS_CODE(chaos_strbuf_append_n(&sb, sb.data + 1U, sb.len - 1U)) == CHAOS_STRING_TRUNCATED, "fixed self-append truncates");
+    (void)chaos_strbuf_view(&sb, &str, &len);
+    TEST_ASSERT((len == 15U) && (strcmp((const char *)str, "abcdefabcdefbcd") == 0), "fixed self-append content");
+
+    TEST_PASS("strbuf append of its own content");
+}
+
+static int test_strbuf_invalid(void)
+{
+    chaos_char_t storage[4];
+    chaos_strbuf_t sb;
+    chaos_cstr_t str = NULL;
+
+    TEST_ASSERT(chaos_strbuf_init(NULL, storage, 4U) != CHAOS_STATUS_OK, "init NULL sb");
+    TEST_ASSERT(CHAOS_STATUS_CODE(chaos_strbuf_init(&sb, storage, 0U)) == CHAOS_STRING_SIZE_ZERO, "init zero capacity");
+    (void)chaos_strbuf_init(&sb, storage, 4U);
+    TEST_ASSERT(chaos_strbuf_append(&sb, NULL) != CHAOS_STATUS_OK, "append NULL");
+    TEST_ASSERT(chaos_strbuf_append_n(NULL, storage, 1U) != CHAOS_STATUS_OK, "append_n NULL sb");
+    TEST_ASSERT(chaos_strbuf_view(&sb, NULL, NULL) != CHAOS_STATUS_OK, "view NULL str");
+    TEST_ASSERT(chaos_strbuf_view(&sb, &str, NULL) == CHAOS_STATUS_OK, "view without length");
+
+    TEST_PASS("strbuf invalid parameters");
+}
+
+/* -------------------------------------------------------------------------- */
+/* Runner                                                                      */
+/* -------------------------------------------------------------------------- */
+
+int main(void)
+{
+    int failures = 0;
+
+    failures += test_strbuf_fixed();
+    failures += test_strbuf_truncation();
+    failures += test_strbuf_dynamic();
+    failures += test_strbuf_self_append();
+    failures += test_strbuf_invalid();
+
+    if (failures == 0)
+    {
+        printf("\nAll chaos_strbuf tests passed \n");
+        return 0;
+    }
+
+    printf("\n%d test(s) failed \n", failures);
+    return 1;
+}
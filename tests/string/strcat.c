@@ -1,8 +1,13 @@
 #include <stdio.h>
+#include <string.h>
 #include "chaos_string.h"
 #include "chaos_test.h"
 
-int main(void)
+/* -------------------------------------------------------------------------- */
+/* Tests                                                                       */
+/* -------------------------------------------------------------------------- */
+
+static int test_strcat_nominal(void)
 {
     char dst[12] = "hello";
     chaos_status_t status;
@@ -22,3 +27,94 @@ int main(void)
 
     TEST_PASS("strcat");
 }
+
+static int test_strcat_len(void)
+{
+    char dst[12] = "hello";
+    char full[4] = { 'a', 'b', 'c', 'd' };
+    chaos_size_t written = 99U;
+    chaos_size_t src_len = 99U;
+    chaos_status_t status;
+
+    status = chaos_strcat_len((chaos_cstr_t)dst, (chaos_cstr_t)" you", sizeof(dst), &written, &src_len);
+    TEST_ASSERT(status == CHAOS_STATUS_OK, "strcat_len status");
+    TEST_ASSERT((written == 4U) && (src_len == 4U), "strcat_len lengths");
+    TEST_ASSERT(strcmp(dst, "hello you") == 0, "strcat_len content");
+
+    status = chaos_strcat_len((chaos_cstr_t)dst, (chaos_cstr_t)" and me", sizeof(dst), &written, &src_len);
+    TEST_ASSERT(CHAOS_STATUS_CODE(status) == CHAOS_STRING_TRUNCATED, "strcat_len truncated");
+    TEST_ASSERT((written == 2U) && (src_len == 7U), "strcat_len truncated lengths");
+    TEST_ASSERT(strcmp(dst, "hello you a") == 0, "strcat_len truncated content");
+
+    status = chaos_strcat_len((chaos_cstr_t)dst, (chaos_cstr_t)"", sizeof(dst), &written, CHAOS_NULL);
+    TEST_ASSERT((status == CHAOS_STATUS_OK) && (written == 0U), "strcat_len empty src on full dst");
+
+    status = chaos_strcat_len((chaos_cstr_t)full, (chaos_cstr_t)"x", sizeof(full), &written, &src_len);
+    TEST_ASSERT(status != CHAOS_STATUS_OK, "strcat_len unterminated dst");
+    TEST_ASSERT(full[3] == 'd', "strcat_len unterminated dst untouched");
+
+    TEST_PASS("strcat_len");
+}
+
+static int test_strcat_len_sweep(void)
+{
+    static char src[64];
+    static char dst[96];
+    chaos_size_t so;
+    chaos_size_t head;
+    chaos_size_t n;
+    chaos_size_t written;
+    chaos_size_t src_len;
+    chaos_size_t expect;
+    chaos_status_t status;
+
+    /* Existing prefix lengths shift the append point through every alignment */
+    for (so = 0U; so < 8U; so++)
+    {
+        for (head = 0U; head < 16U; head++)
+        {
+            for (n = 0U; n < 40U; n++)
+            {
+                memset(src, 'x', sizeof(src));
+                memset(dst, '#', sizeof(dst));
+                memset(src + so, 'b', n);
+                src[so + n] = '\0';
+                memset(dst, 'a', head);
+                dst[head] = '\0';
+
+                status = chaos_strcat_len((chaos_cstr_t)dst, (chaos_cstr_t)(src + so), 40U, &written, &src_len);
+                expect = ((head + n) < 40U) ? n : (39U - head);
+
+                TEST_ASSERT((status == CHAOS_STATUS_OK) == ((head + n) < 40U), "sweep status");
+                TEST_ASSERT((written == expect) && (src_len == n), "sweep lengths");
+                TEST_ASSERT(memcmp(dst + head, src + so, expect) == 0, "sweep content");
+                TEST_ASSERT(dst[head + expect] == '\0', "sweep terminator");
+                TEST_ASSERT(dst[head + expect + 1U] == '#', "sweep wrote past terminator");
+            }
+        }
+    }
+
+    TEST_PASS("strcat_len alignment sweep");
+}
+
+/* -------------------------------------------------------------------------- */
+/* Runner                                                                      */
+/* -------------------------------------------------------------------------- */
+
+int main(void)
+{
+    int failures = 0;
+
+    failures += test_strcat_nominal();
+    failures += test_strcat_len();
+    failures += test_strcat_len_sweep();
+
+    if (failures == 0)
+    {
+        printf("\nAll chaos_strcat tests passed \n");
+        return 0;
+    }
+
+    printf("\n%d test(s) failed \n", failures);
+    return 1;
+}
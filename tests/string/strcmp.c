@@ -1,8 +1,27 @@
+#define _DEFAULT_SOURCE
+
 #include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
 #include "chaos_string.h"
 #include "chaos_test.h"
 
-int main(void)
+/* -------------------------------------------------------------------------- */
+/* Helpers                                                                     */
+/* -------------------------------------------------------------------------- */
+
+static int sign(int v)
+{
+    return (v > 0) - (v < 0);
+}
+
+/* -------------------------------------------------------------------------- */
+/* Tests                                                                       */
+/* -------------------------------------------------------------------------- */
+
+static int test_strcmp_nominal(void)
 {
     chaos_bool_t equal = CHAOS_FALSE;
     chaos_status_t status;
@@ -28,3 +47,109 @@ int main(void)
 
     TEST_PASS("strcmp");
 }
+
+static int test_strcmp_order(void)
+{
+    chaos_i32_t order = 0;
+
+    TEST_ASSERT((chaos_strcmp_order((chaos_cstr_t)"abc", (chaos_cstr_t)"abd", &order) == CHAOS_STATUS_OK) && (order < 0), "order less");
+    TEST_ASSERT((chaos_strcmp_order((chaos_cstr_t)"abd", (chaos_cstr_t)"abc", &order) == CHAOS_STATUS_OK) && (order > 0), "order greater");
+    TEST_ASSERT((chaos_strcmp_order((chaos_cstr_t)"ab", (chaos_cstr_t)"abc", &order) == CHAOS_STATUS_OK) && (order < 0), "prefix sorts first");
+    TEST_ASSERT((chaos_strcmp_order((chaos_cstr_t)"", (chaos_cstr_t)"", &order) == CHAOS_STATUS_OK) && (order == 0), "empty strings");
+    TEST_ASSERT((chaos_strcmp_order((chaos_cstr_t)"\x80", (chaos_cstr_t)"\x7f", &order) == CHAOS_STATUS_OK) && (order > 0), "bytes are unsigned");
+    TEST_ASSERT(chaos_strcmp_order((chaos_cstr_t)"a", (chaos_cstr_t)"a", NULL) != CHAOS_STATUS_OK, "order NULL out");
+
+    TEST_PASS("strcmp_order");
+}
+
+static int test_strcmp_order_sweep(void)
+{
+    static char s1[160];
+    static char s2[160];
+    chaos_size_t o1;
+    chaos_size_t o2;
+    chaos_size_t n;
+    chaos_size_t i;
+    chaos_i32_t order = 0;
+
+    /* Long shared prefixes at every relative alignment, differing or ending at n */
+    for (o1 = 0U; o1 < 16U; o1++)
+    {
+        for (o2 = 0U; o2 < 16U; o2++)
+        {
+            for (n = 0U; n < 100U; n++)
+            {
+                for (i = 0U; i < n; i++)
+                {
+                    s1[o1 + i] = (char)('A' + (i % 23U));
+                    s2[o2 + i] = (char)('A' + (i % 23U));
+                }
+                s1[o1 + n] = (char)((n % 3U) == 0U ? 0 : 'x');
+                s2[o2 + n] = (char)((n % 5U) == 0U ? 0 : 'y');
+                s1[o1 + n + 1U] = '\0';
+                s2[o2 + n + 1U] = '\0';
+
+                (void)chaos_strcmp_order((chaos_cstr_t)(s1 + o1), (chaos_cstr_t)(s2 + o2), &order);
+                TEST_ASSERT(sign(order) == sign(strcmp(s1 + o1, s2 + o2)), "order matches strcmp");
+            }
+        }
+    }
+
+    TEST_PASS("strcmp_order alignment/prefix sweep");
+}
+
+static int test_strcmp_page_end(void)
+{
+    long page = sysconf(_SC_PAGESIZE);
+    char *map;
+    char *end;
+    chaos_size_t n;
+    chaos_i32_t order = 0;
+    static char other[64];
+
+    /* Both strings can end right before an unreadable page */
+    map = (char *)mmap(NULL, (size_t)page * 2U, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    TEST_ASSERT(map != (char *)MAP_FAILED, "mmap");
+    TEST_ASSERT(mprotect(map + page, (size_t)page, PROT_NONE) == 0, "mprotect guard page");
+
+    end = map + page;
+    memset(map, 'q', (size_t)page);
+    memset(other, 'q', sizeof(other) - 1U);
+    for (n = 0U; n < 40U; n++)
+    {
+        end[-1] = '\0';
+        other[n] = '\0';
+        (void)chaos_strcmp_order((chaos_cstr_t)(end - 1 - n), (chaos_cstr_t)other, &order);
+        TEST_ASSERT(order == 0, "equal strings at page end");
+        (void)chaos_strcmp_order((chaos_cstr_t)other, (chaos_cstr_t)(end - 1 - n), &order);
+        TEST_ASSERT(order == 0, "equal strings at page end (swapped)");
+        other[n] = 'q';
+    }
+
+    (void)munmap(map, (size_t)page * 2U);
+
+    TEST_PASS("strcmp_order never reads past the page");
+}
+
+/* -------------------------------------------------------------------------- */
+/* Runner                                                                      */
+/* -------------------------------------------------------------------------- */
+
+int main(void)
+{
+    int failures = 0;
+
+    failures += test_strcmp_nominal();
+    failures += test_strcmp_order();
+    failures += test_strcmp_order_sweep();
+    failures += test_strcmp_page_end();
+
+    if (failures == 0)
+    {
+        printf("\nAll chaos_strcmp tests passed \n");
+        return 0;
+    }
+
+    printf("\n%d test(s) failed \n", failures);
+    return 1;
+}
@@ -1,8 +1,13 @@
 #include <stdio.h>
+#include <string.h>
 #include "chaos_string.h"
 #include "chaos_test.h"
 
-int main(void)
+/* -------------------------------------------------------------------------- */
+/* Tests                                                                       */
+/* -------------------------------------------------------------------------- */
+
+static int test_strcpy_nominal(void)
 {
     char dst[10];
     chaos_status_t status;
@@ -23,3 +28,100 @@ int main(void)
 
     TEST_PASS("strcpy");
 }
+
+static int test_strcpy_len(void)
+{
+    char dst[10];
+    chaos_size_t written = 99U;
+    chaos_size_t src_len = 99U;
+    chaos_status_t status;
+
+    status = chaos_strcpy_len((chaos_cstr_t)dst, (chaos_cstr_t)"abc", sizeof(dst), &written, &src_len);
+    TEST_ASSERT(status == CHAOS_STATUS_OK, "strcpy_len status");
+    TEST_ASSERT((written == 3U) && (src_len == 3U), "strcpy_len lengths");
+    TEST_ASSERT(strcmp(dst, "abc") == 0, "strcpy_len content");
+
+    status = chaos_strcpy_len((chaos_cstr_t)dst, (chaos_cstr_t)"123456789ABCDEFGHIJ", sizeof(dst), &written, &src_len);
+    TEST_ASSERT(CHAOS_STATUS_CODE(status) == CHAOS_STRING_TRUNCATED, "strcpy_len truncated");
+    TEST_ASSERT((written == 9U) && (src_len == 19U), "strcpy_len truncated lengths");
+    TEST_ASSERT(strcmp(dst, "123456789") == 0, "strcpy_len truncated content");
+
+    status = chaos_strcpy_len((chaos_cstr_t)dst, (chaos_cstr_t)"123456789", sizeof(dst), &written, CHAOS_NULL);
+    TEST_ASSERT((status == CHAOS_STATUS_OK) && (written == 9U), "strcpy_len exact fit");
+
+    status = chaos_strcpy_len((chaos_cstr_t)dst, (chaos_cstr_t)"", sizeof(dst), CHAOS_NULL, &src_len);
+    TEST_ASSERT((status == CHAOS_STATUS_OK) && (src_len == 0U) && (dst[0] == '\0'), "strcpy_len empty");
+
+    status = chaos_strcpy_len((chaos_cstr_t)dst, (chaos_cstr_t)"abc", 1U, &written, &src_len);
+    TEST_ASSERT((status != CHAOS_STATUS_OK) && (written == 0U) && (src_len == 3U) && (dst[0] == '\0'), "strcpy_len room for null only");
+
+    status = chaos_strcpy_len((chaos_cstr_t)dst, (chaos_cstr_t)"abc", 0U, &written, &src_len);
+    TEST_ASSERT(status != CHAOS_STATUS_OK, "strcpy_len zero size");
+
+    TEST_PASS("strcpy_len");
+}
+
+static int test_strcpy_len_sweep(void)
+{
+    static char src[96];
+    static char dst[96];
+    chaos_size_t so;
+    chaos_size_t doff;
+    chaos_size_t n;
+    chaos_size_t room;
+    chaos_size_t written;
+    chaos_size_t src_len;
+    chaos_size_t expect;
+    chaos_status_t status;
+
+    /* Every source/destination alignment, length and buffer size around a word */
+    for (so = 0U; so < 8U; so++)
+    {
+        for (doff = 0U; doff < 8U; doff++)
+        {
+            for (n = 0U; n < 40U; n++)
+            {
+                for (room = 1U; room < 48U; room++)
+                {
+                    memset(src, 'x', sizeof(src));
+                    memset(dst, '#', sizeof(dst));
+                    memset(src + so, 'a', n);
+                    src[so + n] = '\0';
+
+                    status = chaos_strcpy_len((chaos_cstr_t)(dst + doff), (chaos_cstr_t)(src + so), room, &written, &src_len);
+                    expect = (n < room) ? n : (room - 1U);
+
+                    TEST_ASSERT((status == CHAOS_STATUS_OK) == (n < room), "sweep status");
+                    TEST_ASSERT((written == expect) && (src_len == n), "sweep lengths");
+                    TEST_ASSERT(memcmp(dst + doff, src + so, expect) == 0, "sweep content");
+                    TEST_ASSERT(dst[doff + expect] == '\0', "sweep terminator");
+                    TEST_ASSERT(dst[doff + expect + 1U] == '#', "sweep wrote past terminator");
+                }
+            }
+        }
+    }
+
+    TEST_PASS("strcpy_len alignment sweep");
+}
+
+/* -------------------------------------------------------------------------- */
+/* Runner                                                                      */
+/* -------------------------------------------------------------------------- */
+
+int main(void)
+{
+    int failures = 0;
+
+    failures += test_strcpy_nominal();
+    failures += test_strcpy_len();
+    failures += test_strcpy_len_sweep();
+
+    if (failures == 0)
+    {
+        printf("\nAll chaos_strcpy tests passed \n");
+        return 0;
+    }
+
+    printf("\n%d test(s) failed \n", failures);
+    return 1;
+}
@@ -0,0 +1,194 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "chaos_strintern.h"
+#include "chaos_alloc.h"
+#include "chaos_test.h"
+
+/* -------------------------------------------------------------------------- */
+/* Helpers                                                                     */
+/* -------------------------------------------------------------------------- */
+
+static chaos_strview_t view(const char *s)
+{
+    chaos_strview_t v;
+
+    v.data = (const chaos_char_t *)s;
+    v.len = (chaos_size_t)strlen(s);
+
+    return v;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Tests                                                                       */
+/* -------------------------------------------------------------------------- */
+
+static int test_strintern_basic(void)
+{
+    static chaos_u8_t region[1024];
+    chaos_strintern_t t;
+    chaos_strview_t v;
+    chaos_strview_t s;
+    chaos_strid_t a = CHAOS_STRID_NONE;
+    chaos_strid_t b = CHAOS_STRID_NONE;
+    chaos_strid_t c = CHAOS_STRID_NONE;
+    char copy[16];
+
+    TEST_ASSERT(chaos_strintern_init(&t, region + 1, sizeof(region) - 1U, 16U) == CHAOS_STATUS_OK, "init (unaligned region)");
+
+    v = view("sensor.temp");
+    TEST_ASSERT((chaos_strintern_add(&t, &v, &a) == CHAOS_STATUS_OK) && (a != CHAOS_STRID_NONE), "add first");
+    v = view("sensor.volt");
+    TEST_ASSERT((chaos_strintern_add(&t, &v, &b) == CHAOS_STATUS_OK) && (b != a), "add second");
+
+    /* Same characters from a different buffer map to the same handle */
+    strcpy(copy, "sensor.temp");
+    v = view(copy);
+    TEST_ASSERT((chaos_strintern_add(&t, &v, &c) == CHAOS_STATUS_OK) && (c == a), "re-add returns handle");
+    TEST_ASSERT(t.count == 2U, "stored once");
+
+    TEST_ASSERT((chaos_strintern_find(&t, &v, &c) == CHAOS_STATUS_OK) && (c == a), "find present");
+    v = view("sensor.tem");
+    TEST_ASSERT((chaos_strintern_find(&t, &v, &c) == CHAOS_STATUS_OK) && (c == CHAOS_STRID_NONE), "find absent prefix");
+    TEST_ASSERT(t.count == 2U, "find does not insert");
+
+    TEST_ASSERT(chaos_strintern_get(&t, b, &s) == CHAOS_STATUS_OK, "get");
+    TEST_ASSERT((s.len == 11U) && (strcmp((const char *)s.data, "sensor.volt") == 0), "get content null-terminated");
+    TEST_ASSERT(chaos_strintern_get(&t, CHAOS_STRID_NONE, &s) != CHAOS_STATUS_OK, "get NONE");
+    TEST_ASSERT(chaos_strintern_get(&t, 3U, &s) != CHAOS_STATUS_OK, "get unknown handle");
+
+    v.len = 0U;
+    TEST_ASSERT((chaos_strintern_add(&t, &v, &c) == CHAOS_STATUS_OK) && (c != CHAOS_STRID_NONE) && (c != a) && (c != b), "empty string interns");
+
+    TEST_PASS("strintern basic");
+}
+
+static int test_strintern_full(void)
+{
+    static chaos_u8_t region[256];
+    chaos_strintern_t t;
+    chaos_strintern_stats_t st;
+    chaos_strview_t v;
+    chaos_strid_t id = CHAOS_STRID_NONE;
+    chaos_status_t status = CHAOS_STATUS_OK;
+    char name[8];
+    chaos_size_t i;
+
+    TEST_ASSERT(chaos_strintern_init(&t, region, sizeof(region), 8U) == CHAOS_STATUS_OK, "init");
+    TEST_ASSERT(t.capacity == 6U, "capacity is 3/4 of the slots");
+
+    for (i = 0U; i < 6U; i++)
+    {
+        (void)snprintf(name, sizeof(name), "p%u", (unsigned)i);
+        v = view(name);
+        TEST_ASSERT(chaos_strintern_add(&t, &v, &id) == CHAOS_STATUS_OK, "fill");
+    }
+
+    v = view("p9");
+    status = chaos_strintern_add(&t, &v, &id);
+    TEST_ASSERT(CHAOS_STATUS_CODE(status) == CHAOS_STRING_TRUNCATED, "full table rejects new string");
+    v = view("p3");
+    TEST_ASSERT((chaos_strintern_add(&t, &v, &id) == CHAOS_STATUS_OK) && (id == 4U), "full table still finds old string");
+
+    TEST_ASSERT(chaos_strintern_stats(&t, &st) == CHAOS_STATUS_OK, "stats");
+    TEST_ASSERT((st.count == 6U) && (st.slot_count == 8U) && (st.load_permille == 750U), "stats load");
+    TEST_ASSERT((st.pool_used == 18U) && (st.probe_avg_x100 >= 100U) && (st.probe_max >= 1U), "stats pool and probes");
+
+    TEST_ASSERT(chaos_strintern_init(&t, region, 64U, 8U) != CHAOS_STATUS_OK, "region too small");
+    TEST_ASSERT(chaos_strintern_init(&t, region, sizeof(region), 12U) != CHAOS_STATUS_OK, "slot count not a power of two");
+
+    TEST_PASS("strintern capacity and stats");
+}
+
+static int test_strintern_many(void)
+{
+    static chaos_u8_t region[128U * 1024U];
+    static chaos_strid_t ids[2000];
+    chaos_strintern_t t;
+    chaos_strintern_stats_t st;
+    chaos_strview_t v;
+    chaos_strview_t s;
+    chaos_strid_t id = CHAOS_STRID_NONE;
+    char name[32];
+    chaos_size_t i;
+
+    TEST_ASSERT(chaos_strintern_init(&t, region, sizeof(region), 4096U) == CHAOS_STATUS_OK, "init");
+
+    for (i = 0U; i < 2000U; i++)
+    {
+        (void)snprintf(name, sizeof(name), "param.group%u.item%u", (unsigned)(i % 37U), (unsigned)i);
+        v = view(name);
+        TEST_ASSERT(chaos_strintern_add(&t, &v, &ids[i]) == CHAOS_STATUS_OK, "add many");
+    }
+    for (i = 0U; i < 2000U; i++)
+    {
+        (void)snprintf(name, sizeof(name), "param.group%u.item%u", (unsigned)(i % 37U), (unsigned)i);
+        v = view(name);
+        TEST_ASSERT((chaos_strintern_find(&t, &v, &id) == CHAOS_STATUS_OK) && (id == ids[i]), "find many");
+        TEST_ASSERT((chaos_strintern_get(&t, id, &s) == CHAOS_STATUS_OK) && (s.len == v.len) && (memcmp(s.data, name, v.len) == 0), "handle stable");
+    }
+
+    TEST_ASSERT((chaos_strintern_stats(&t, &st) == CHAOS_STATUS_OK) && (st.count == 2000U), "stats count");
+    TEST_ASSERT(st.probe_avg_x100 < 300U, "short probes at half load");
+
+    TEST_PASS("strintern 2000 names");
+}
+
+static int test_strintern_dynamic(void)
+{
+#if (CHAOS_ENABLE_ALLOC == 1)
+    static chaos_u8_t heap[8192];
+    chaos_alloc_config_t cfg = { heap, sizeof(heap) };
+    chaos_strintern_t t;
+    chaos_strview_t v = view("mode");
+    chaos_strid_t a = CHAOS_STRID_NONE;
+    chaos_strid_t b = CHAOS_STRID_NONE;
+    chaos_size_t free_before = 0U;
+    chaos_size_t free_after = 0U;
+
+    TEST_ASSERT(chaos_alloc_init(&cfg) == CHAOS_STATUS_OK, "alloc init");
+
+    /* A slot count that is not a power of two fails before allocating */
+    (void)chaos_alloc_get_free(&free_before);
+    TEST_ASSERT(CHAOS_STATUS_CODE(chaos_strintern_init_dynamic(&t, 48U, 512U)) == CHAOS_STRING_OUT_OF_RANGE, "init dynamic non power of two");
+    (void)chaos_alloc_get_free(&free_after);
+    TEST_ASSERT(free_after == free_before, "nothing allocated on error");
+
+    TEST_ASSERT(chaos_strintern_init_dynamic(&t, 64U, 512U) == CHAOS_STATUS_OK, "init dynamic");
+    TEST_ASSERT(t.pool_size >= 512U, "pool size");
+    TEST_ASSERT(chaos_strintern_add(&t, &v, &a) == CHAOS_STATUS_OK, "add");
+    TEST_ASSERT((chaos_strintern_find(&t, &v, &b) == CHAOS_STATUS_OK) && (a == b), "find");
+    TEST_ASSERT(chaos_strintern_free(&t) == CHAOS_STATUS_OK, "free");
+    TEST_ASSERT(chaos_strintern_find(&t, &v, &b) != CHAOS_STATUS_OK, "freed table rejected");
+
+    TEST_PASS("strintern in chaos_alloc memory");
+#else
+    chaos_strintern_t t;
+
+    TEST_ASSERT(chaos_strintern_init_dynamic(&t, 64U, 512U) != CHAOS_STATUS_OK, "dynamic table needs the allocator");
+    TEST_PASS("strintern in chaos_alloc memory (allocator disabled)");
+#endif
+}
+
+/* -------------------------------------------------------------------------- */
+/* Runner                                                                      */
+/* -------------------------------------------------------------------------- */
+
+int main(void)
+{
+    int failures = 0;
+
+    failures += test_strintern_basic();
+    failures += test_strintern_full();
+    failures += test_strintern_many();
+    failures += test_strintern_dynamic();
+
+    if (failures == 0)
+    {
+        printf("\nAll chaos_strintern tests passed \n");
+        return 0;
+    }
+
+    printf("\n%d test(s) failed \n", failures);
+    return 1;
+}
@@ -1,8 +1,18 @@
+#define _DEFAULT_SOURCE
+
 #include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
 #include "chaos_string.h"
 #include "chaos_test.h"
 
-int main(void)
+/* -------------------------------------------------------------------------- */
+/* Tests                                                                       */
+/* -------------------------------------------------------------------------- */
+
+static int test_strlen_nominal(void)
 {
     chaos_size_t len = 0U;
     chaos_status_t status;
@@ -23,3 +33,76 @@ int main(void)
 
     TEST_PASS("strlen");
 }
+
+static int test_strlen_alignment(void)
+{
+    static chaos_char_t buf[320];
+    chaos_size_t off;
+    chaos_size_t n;
+    chaos_size_t len = 0U;
+
+    /* High-bit bytes must not be mistaken for terminators */
+    memset(buf, 0x80, sizeof(buf));
+
+    for (off = 0U; off < 64U; off++)
+    {
+        for (n = 0U; n < 200U; n++)
+        {
+            buf[off + n] = CHAOS_CHAR_NULL;
+            TEST_ASSERT(chaos_strlen(buf + off, &len) == CHAOS_STATUS_OK, "strlen status");
+            TEST_ASSERT(len == n, "strlen every alignment and length");
+            buf[off + n] = (chaos_char_t)(0x80U | (n & 0x7FU));
+        }
+    }
+
+    TEST_PASS("strlen alignment/length sweep");
+}
+
+static int test_strlen_page_end(void)
+{
+    long page = sysconf(_SC_PAGESIZE);
+    chaos_char_t *map;
+    chaos_char_t *end;
+    chaos_size_t n;
+    chaos_size_t len = 0U;
+
+    /* One readable page followed by a guard page: any over-read faults */
+    map = (chaos_char_t *)mmap(NULL, (size_t)page * 2U, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    TEST_ASSERT(map != (chaos_char_t *)MAP_FAILED, "mmap");
+    TEST_ASSERT(mprotect(map + page, (size_t)page, PROT_NONE) == 0, "mprotect guard page");
+
+    end = map + page;
+    memset(map, 'x', (size_t)page);
+    for (n = 0U; n < 100U; n++)
+    {
+        end[-1] = CHAOS_CHAR_NULL;
+        TEST_ASSERT(chaos_strlen(end - 1 - n, &len) == CHAOS_STATUS_OK, "strlen at page end status");
+        TEST_ASSERT(len == n, "strlen at page end");
+    }
+
+    (void)munmap(map, (size_t)page * 2U);
+
+    TEST_PASS("strlen never reads past the page");
+}
+
+/* -------------------------------------------------------------------------- */
+/* Runner                                                                      */
+/* -------------------------------------------------------------------------- */
+
+int main(void)
+{
+    int failures = 0;
+
+    failures += test_strlen_nominal();
+    failures += test_strlen_alignment();
+    failures += test_strlen_page_end();
+
+    if (failures == 0)
+    {
+        printf("\nAll chaos_strlen tests passed \n");
+        return 0;
+    }
+
+    printf("\n%d test(s) failed \n", failures);
+    return 1;
+}
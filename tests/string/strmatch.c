@@ -0,0 +1,265 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "chaos_strmatch.h"
+#include "chaos_test.h"
+
+/* -------------------------------------------------------------------------- */
+/* Helpers                                                                     */
+/* -------------------------------------------------------------------------- */
+
+#define MAX_HITS 4096U
+
+typedef struct
+{
+    chaos_strmatch_hit_t hits[MAX_HITS];
+    chaos_size_t count;
+    chaos_size_t stop_after;
+} hits_t;
+
+static chaos_bool_t collect(void *ctx, const chaos_strmatch_hit_t *hit)
+{
+    hits_t *h = (hits_t *)ctx;
+
+    if (h->count < MAX_HITS)
+    {
+        h->hits[h->count] = *hit;
+    }
+    h->count++;
+
+    return (h->count != h->stop_after) ? CHAOS_TRUE : CHAOS_FALSE;
+}
+
+static chaos_strview_t view(const char *s)
+{
+    chaos_strview_t v;
+
+    v.data = (const chaos_char_t *)s;
+    v.len = (chaos_size_t)strlen(s);
+
+    return v;
+}
+
+static int build(chaos_strmatch_t *m, const chaos_strview_t *pats, chaos_size_t count, void **arena)
+{
+    chaos_size_t size = 0U;
+
+    if (chaos_strmatch_arena_size(pats, count, &size) != CHAOS_STATUS_OK)
+    {
+        return 1;
+    }
+    *arena = malloc(size);
+
+    return (chaos_strmatch_build(m, pats, count, *arena, size) == CHAOS_STATUS_OK) ? 0 : 1;
+}
+
+/* Lowest index holding the same bytes as pattern p */
+static chaos_size_t canonical(const chaos_strview_t *pats, chaos_size_t p)
+{
+    chaos_size_t i;
+
+    for (i = 0U; i < p; i++)
+    {
+        if ((pats[i].len == pats[p].len) && (memcmp(pats[i].data, pats[p].data, pats[p].len) == 0))
+        {
+            break;
+        }
+    }
+
+    return i;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Tests                                                                       */
+/* -------------------------------------------------------------------------- */
+
+static int test_strmatch_classic(void)
+{
+    static hits_t h;
+    chaos_strview_t pats[4];
+    chaos_strview_t text = view("ushers");
+    chaos_strmatch_t m;
+    void *arena = NULL;
+
+    pats[0] = view("he");
+    pats[1] = view("she");
+    pats[2] = view("his");
+    pats[3] = view("hers");
+
+    TEST_ASSERT(build(&m, pats, 4U, &arena) == 0, "build");
+
+    h.count = 0U;
+    h.stop_after = 0U;
+    TEST_ASSERT(chaos_strmatch_scan(&m, &text, collect, &h) == CHAOS_STATUS_OK, "scan status");
+    TEST_ASSERT(h.count == 3U, "three matches in ushers");
+    TEST_ASSERT((h.hits[0].pattern == 1U) && (h.hits[0].offset == 1U) && (h.hits[0].len == 3U), "she first (longest at end 4)");
+    TEST_ASSERT((h.hits[1].pattern == 0U) && (h.hits[1].offset == 2U) && (h.hits[1].len == 2U), "he via dictionary link");
+    TEST_ASSERT((h.hits[2].pattern == 3U) && (h.hits[2].offset == 2U) && (h.hits[2].len == 4U), "hers last");
+
+    h.count = 0U;
+    h.stop_after = 1U;
+    TEST_ASSERT((chaos_strmatch_scan(&m, &text, collect, &h) == CHAOS_STATUS_OK) && (h.count == 1U), "callback stops scan");
+
+    free(arena);
+    TEST_PASS("strmatch classic set");
+}
+
+static int test_strmatch_any(void)
+{
+    chaos_strview_t pats[3];
+    chaos_strview_t text;
+    chaos_strmatch_t m;
+    chaos_bool_t found = CHAOS_FALSE;
+    void *arena = NULL;
+
+    pats[0] = view("ERROR");
+    pats[1] = view("timeout");
+    pats[2] = view("\xff\x00\x01");
+    pats[2].len = 3U;
+
+    TEST_ASSERT(build(&m, pats, 3U, &arena) == 0, "build");
+
+    text = view("[12.004] link up");
+    TEST_ASSERT((chaos_strmatch_any(&m, &text, &found) == CHAOS_STATUS_OK) && (found == CHAOS_FALSE), "no keyword");
+
+    text = view("[12.005] ERRO ERROR: sensor timeout");
+    TEST_ASSERT((chaos_strmatch_any(&m, &text, &found) == CHAOS_STATUS_OK) && (found == CHAOS_TRUE), "keyword found");
+
+    text.data = (const chaos_char_t *)"ab\xff\x00\x01";
+    text.len = 5U;
+    TEST_ASSERT((chaos_strmatch_any(&m, &text, &found) == CHAOS_STATUS_OK) && (found == CHAOS_TRUE), "binary pattern");
+
+    text.len = 0U;
+    TEST_ASSERT((chaos_strmatch_any(&m, &text, &found) == CHAOS_STATUS_OK) && (found == CHAOS_FALSE), "empty text");
+
+    free(arena);
+    TEST_PASS("strmatch any");
+}
+
+static int test_strmatch_errors(void)
+{
+    static chaos_u8_t arena[2048];
+    chaos_strview_t pats[2];
+    chaos_strview_t text = view("abc");
+    chaos_strmatch_t m;
+    chaos_size_t size = 0U;
+
+    pats[0] = view("abc");
+    pats[1] = view("");
+
+    TEST_ASSERT(chaos_strmatch_arena_size(pats, 2U, &size) != CHAOS_STATUS_OK, "empty pattern rejected");
+    TEST_ASSERT(chaos_strmatch_arena_size(pats, 0U, &size) != CHAOS_STATUS_OK, "empty set rejected");
+    TEST_ASSERT(chaos_strmatch_arena_size(NULL, 1U, &size) != CHAOS_STATUS_OK, "NULL patterns");
+
+    TEST_ASSERT(chaos_strmatch_arena_size(pats, 1U, &size) == CHAOS_STATUS_OK, "arena size");
+    TEST_ASSERT(chaos_strmatch_build(&m, pats, 1U, arena, size - 1U) != CHAOS_STATUS_OK, "arena too small");
+    TEST_ASSERT(chaos_strmatch_build(&m, pats, 1U, arena + 1, size) == CHAOS_STATUS_OK, "unaligned arena");
+    TEST_ASSERT(m.node_count == 4U, "one state per prefix");
+    TEST_ASSERT(chaos_strmatch_scan(&m, &text, NULL, NULL) != CHAOS_STATUS_OK, "NULL callback");
+
+    TEST_PASS("strmatch errors");
+}
+
+static int test_strmatch_random(void)
+{
+    static hits_t h;
+    static char store[64][8];
+    static char text[2048];
+    chaos_strview_t pats[64];
+    chaos_strview_t tv;
+    chaos_strmatch_t m;
+    chaos_size_t round;
+    chaos_size_t count;
+    chaos_size_t expect;
+    chaos_size_t p;
+    chaos_size_t e;
+    chaos_size_t k;
+    chaos_size_t prev_end;
+    chaos_size_t prev_len;
+    void *arena = NULL;
+
+    srand(7);
+
+    /* Small alphabet so patterns overlap, nest and repeat */
+    for (round = 0U; round < 200U; round++)
+    {
+        count = 1U + ((chaos_size_t)rand() % 64U);
+        for (p = 0U; p < count; p++)
+        {
+            pats[p].len = 1U + ((chaos_size_t)rand() % 7U);
+            for (k = 0U; k < pats[p].len; k++)
+            {
+                store[p][k] = (char)('a' + (rand() % 3));
+            }
+            pats[p].data = (const chaos_char_t *)store[p];
+        }
+        tv.len = (chaos_size_t)rand() % 256U;
+        for (k = 0U; k < tv.len; k++)
+        {
+            text[k] = (char)('a' + (rand() % 3));
+        }
+        tv.data = (const chaos_char_t *)text;
+
+        TEST_ASSERT(build(&m, pats, count, &arena) == 0, "random build");
+
+        h.count = 0U;
+        h.stop_after = 0U;
+        TEST_ASSERT(chaos_strmatch_scan(&m, &tv, collect, &h) == CHAOS_STATUS_OK, "random scan");
+
+        /* Reference count: every occurrence of every distinct pattern */
+        expect = 0U;
+        for (p = 0U; p < count; p++)
+        {
+            if (canonical(pats, p) == p)
+            {
+                for (e = pats[p].len; e <= tv.len; e++)
+                {
+                    expect += (memcmp(text + e - pats[p].len, pats[p].data, pats[p].len) == 0) ? 1U : 0U;
+                }
+            }
+        }
+        TEST_ASSERT((h.count == expect) && (h.count <= MAX_HITS), "random match count");
+
+        prev_end = 0U;
+        prev_len = 0U;
+        for (k = 0U; k < h.count; k++)
+        {
+            p = h.hits[k].pattern;
+            e = h.hits[k].offset + h.hits[k].len;
+            TEST_ASSERT((p < count) && (canonical(pats, p) == p), "hit reports lowest index");
+            TEST_ASSERT((h.hits[k].len == pats[p].len) && (e <= tv.len), "hit length");
+            TEST_ASSERT(memcmp(text + h.hits[k].offset, pats[p].data, pats[p].len) == 0, "hit content");
+            TEST_ASSERT((e > prev_end) || ((e == prev_end) && (h.hits[k].len < prev_len)), "hit order");
+            prev_end = e;
+            prev_len = h.hits[k].len;
+        }
+
+        free(arena);
+    }
+
+    TEST_PASS("strmatch random sets vs naive search");
+}
+
+/* -------------------------------------------------------------------------- */
+/* Runner                                                                      */
+/* -------------------------------------------------------------------------- */
+
+int main(void)
+{
+    int failures = 0;
+
+    failures += test_strmatch_classic();
+    failures += test_strmatch_any();
+    failures += test_strmatch_errors();
+    failures += test_strmatch_random();
+
+    if (failures == 0)
+    {
+        printf("\nAll chaos_strmatch tests passed \n");
+        return 0;
+    }
+
+    printf("\n%d test(s) failed \n", failures);
+    return 1;
+}
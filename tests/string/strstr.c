@@ -1,8 +1,25 @@
 #include <stdio.h>
+#include <string.h>
+
 #include "chaos_string.h"
 #include "chaos_test.h"
 
-int main(void)
+/* -------------------------------------------------------------------------- */
+/* Helpers                                                                     */
+/* -------------------------------------------------------------------------- */
+
+/* Naive reference: offset of the first match, or strlen(hay) */
+static chaos_size_t ref_find(const char *hay, const char *needle)
+{
+    const char *hit = strstr(hay, needle);
+    return (hit != NULL) ? (chaos_size_t)(hit - hay) : (chaos_size_t)strlen(hay);
+}
+
+/* -------------------------------------------------------------------------- */
+/* Tests                                                                       */
+/* -------------------------------------------------------------------------- */
+
+static int test_strstr_nominal(void)
 {
     chaos_bool_t found = CHAOS_FALSE;
     chaos_status_t status;
@@ -28,3 +45,90 @@ int main(void)
 
     TEST_PASS("strstr");
 }
+
+static int test_strstr_pos_nominal(void)
+{
+    chaos_bool_t found = CHAOS_FALSE;
+    chaos_size_t pos = 0U;
+
+    TEST_ASSERT(chaos_strstr_pos((chaos_cstr_t)"TM:ACK TM:NAK", (chaos_cstr_t)"TM:NAK", &pos, &found) == CHAOS_STATUS_OK, "strstr_pos status");
+    TEST_ASSERT((found == CHAOS_TRUE) && (pos == 7U), "strstr_pos offset");
+
+    TEST_ASSERT(chaos_strstr_pos((chaos_cstr_t)"abcabc", (chaos_cstr_t)"cab", &pos, &found) == CHAOS_STATUS_OK, "strstr_pos status");
+    TEST_ASSERT((found == CHAOS_TRUE) && (pos == 2U), "strstr_pos first match");
+
+    TEST_ASSERT(chaos_strstr_pos((chaos_cstr_t)"abc", (chaos_cstr_t)"abcd", &pos, &found) == CHAOS_STATUS_OK, "strstr_pos long substr");
+    TEST_ASSERT((found == CHAOS_FALSE) && (pos == 3U), "strstr_pos miss reports length");
+
+    TEST_ASSERT(chaos_strstr_pos((chaos_cstr_t)"abc", (chaos_cstr_t)"", &pos, &found) == CHAOS_STATUS_OK, "strstr_pos empty substr");
+    TEST_ASSERT((found == CHAOS_TRUE) && (pos == 0U), "strstr_pos empty substr at 0");
+
+    TEST_ASSERT(chaos_strstr_pos((chaos_cstr_t)"abc", (chaos_cstr_t)"a", NULL, &found) != CHAOS_STATUS_OK, "strstr_pos NULL pos");
+
+    TEST_PASS("strstr_pos");
+}
+
+static int test_strstr_pos_random(void)
+{
+    static char hay[200];
+    static char needle[16];
+    chaos_u32_t x = 12345U;
+    chaos_u32_t round;
+    chaos_size_t n;
+    chaos_size_t m;
+    chaos_size_t i;
+    chaos_size_t pos = 0U;
+    chaos_bool_t found = CHAOS_FALSE;
+
+    /* Small alphabets give plenty of periodic needles and partial matches */
+    for (round = 0U; round < 20000U; round++)
+    {
+        chaos_u32_t alpha = 2U + (round % 3U);
+
+        x = (x * 1103515245U) + 12345U;
+        n = (chaos_size_t)((x >> 16U) % 190U);
+        x = (x * 1103515245U) + 12345U;
+        m = 1U + (chaos_size_t)((x >> 16U) % 15U);
+
+        for (i = 0U; i < n; i++)
+        {
+            x = (x * 1103515245U) + 12345U;
+            hay[i] = (char)('a' + ((x >> 16U) % alpha));
+        }
+        hay[n] = '\0';
+        for (i = 0U; i < m; i++)
+        {
+            x = (x * 1103515245U) + 12345U;
+            needle[i] = (char)('a' + ((x >> 16U) % alpha));
+        }
+        needle[m] = '\0';
+
+        TEST_ASSERT(chaos_strstr_pos((chaos_cstr_t)hay, (chaos_cstr_t)needle, &pos, &found) == CHAOS_STATUS_OK, "random status");
+        TEST_ASSERT(pos == ref_find(hay, needle), "random offset matches reference");
+        TEST_ASSERT((found == CHAOS_TRUE) == (strstr(hay, needle) != NULL), "random found flag");
+    }
+
+    TEST_PASS("strstr_pos random periodic inputs");
+}
+
+/* -------------------------------------------------------------------------- */
+/* Runner                                                                      */
+/* -------------------------------------------------------------------------- */
+
+int main(void)
+{
+    int failures = 0;
+
+    failures += test_strstr_nominal();
+    failures += test_strstr_pos_nominal();
+    failures += test_strstr_pos_random();
+
+    if (failures == 0)
+    {
+        printf("\nAll chaos_strstr tests passed \n");
+        return 0;
+    }
+
+    printf("\n%d test(s) failed \n", failures);
+    return 1;
+}
@@ -0,0 +1,159 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "chaos_strview.h"
+#include "chaos_test.h"
+
+/* -------------------------------------------------------------------------- */
+/* Helpers                                                                     */
+/* -------------------------------------------------------------------------- */
+
+static chaos_strview_t sv(const char *s)
+{
+    chaos_strview_t v;
+    (void)chaos_strview_from_cstr(&v, (chaos_cstr_t)s);
+    return v;
+}
+
+static int view_is(const chaos_strview_t *v, const char *s)
+{
+    return (v->len == strlen(s)) && (memcmp(v->data, s, v->len) == 0);
+}
+
+/* -------------------------------------------------------------------------- */
+/* Tests                                                                       */
+/* -------------------------------------------------------------------------- */
+
+static int test_strview_basics(void)
+{
+    chaos_strview_t cmd = sv("  SET PWR 12  \r\n");
+    chaos_strview_t out;
+    chaos_strview_t a;
+    chaos_strview_t b;
+    chaos_bool_t flag = CHAOS_FALSE;
+    chaos_i32_t order = 0;
+
+    TEST_ASSERT(chaos_strview_trim(&cmd, &out) == CHAOS_STATUS_OK, "trim status");
+    TEST_ASSERT(view_is(&out, "SET PWR 12"), "trim both ends");
+    TEST_ASSERT(out.data == cmd.data + 2, "trim is zero-copy");
+
+    TEST_ASSERT(chaos_strview_slice(&out, 4U, 3U, &a) == CHAOS_STATUS_OK, "slice status");
+    TEST_ASSERT(view_is(&a, "PWR"), "slice content");
+    TEST_ASSERT((chaos_strview_slice(&out, 8U, 100U, &a) == CHAOS_STATUS_OK) && view_is(&a, "12"), "slice clamps length");
+    TEST_ASSERT((chaos_strview_slice(&out, 10U, 1U, &a) == CHAOS_STATUS_OK) && (a.len == 0U), "slice at end is empty");
+    TEST_ASSERT(CHAOS_STATUS_CODE(chaos_strview_slice(&out, 11U, 1U, &a)) == CHAOS_STRING_OUT_OF_RANGE, "slice out of range");
+
+    a = sv("SET");
+    TEST_ASSERT((chaos_strview_starts_with(&out, &a, &flag) == CHAOS_STATUS_OK) && (flag == CHAOS_TRUE), "starts_with");
+    b = sv("12");
+    TEST_ASSERT((chaos_strview_ends_with(&out, &b, &flag) == CHAOS_STATUS_OK) && (flag == CHAOS_TRUE), "ends_with");
+    TEST_ASSERT((chaos_strview_ends_with(&b, &out, &flag) == CHAOS_STATUS_OK) && (flag == CHAOS_FALSE), "ends_with longer suffix");
+
+    a = sv("abc");
+    b = sv("abd");
+    TEST_ASSERT((chaos_strview_compare(&a, &b, &order) == CHAOS_STATUS_OK) && (order < 0), "compare less");
+    TEST_ASSERT((chaos_strview_compare(&b, &a, &order) == CHAOS_STATUS_OK) && (order > 0), "compare greater");
+    b = sv("ab");
+    TEST_ASSERT((chaos_strview_compare(&b, &a, &order) == CHAOS_STATUS_OK) && (order < 0), "prefix sorts first");
+    b = sv("abc");
+    TEST_ASSERT((chaos_strview_compare(&a, &b, &order) == CHAOS_STATUS_OK) && (order == 0), "compare equal");
+    TEST_ASSERT((chaos_strview_equal(&a, &b, &flag) == CHAOS_STATUS_OK) && (flag == CHAOS_TRUE), "equal");
+
+    TEST_PASS("strview slice/compare/prefix/suffix/trim");
+}
+
+static int test_strview_tokenize(void)
+{
+    const char *expect[] = {"SET", "PWR", "12"};
+    chaos_strview_t line = sv("  SET  PWR,12 ,");
+    chaos_strview_t delims = sv(" ,");
+    chaos_strview_iter_t it;
+    chaos_strview_t tok;
+    chaos_bool_t found = CHAOS_FALSE;
+    chaos_size_t n = 0U;
+
+    TEST_ASSERT(chaos_strview_split_init(&it, &line, &delims, CHAOS_TRUE) == CHAOS_STATUS_OK, "tokenize init");
+    while ((chaos_strview_split_next(&it, &tok, &found) == CHAOS_STATUS_OK) && (found == CHAOS_TRUE))
+    {
+        TEST_ASSERT(n < 3U, "tokenize count");
+        TEST_ASSERT(view_is(&tok, expect[n]), "tokenize field");
+        TEST_ASSERT((tok.data >= line.data) && (tok.data < (line.data + line.len)), "token points into input");
+        n++;
+    }
+    TEST_ASSERT(n == 3U, "tokenize all fields");
+
+    TEST_PASS("strview tokenize");
+}
+
+static int test_strview_split(void)
+{
+    const char *expect[] = {"a", "", "b", ""};
+    chaos_strview_t line = sv("a,,b,");
+    chaos_strview_t delims = sv(",");
+    chaos_strview_iter_t outer;
+    chaos_strview_iter_t inner;
+    chaos_strview_t tok;
+    chaos_bool_t found = CHAOS_FALSE;
+    chaos_size_t n = 0U;
+
+    TEST_ASSERT(chaos_strview_split_init(&outer, &line, &delims, CHAOS_FALSE) == CHAOS_STATUS_OK, "split init");
+    while ((chaos_strview_split_next(&outer, &tok, &found) == CHAOS_STATUS_OK) && (found == CHAOS_TRUE))
+    {
+        TEST_ASSERT(n < 4U, "split count");
+        TEST_ASSERT(view_is(&tok, expect[n]), "split keeps empty fields");
+        n++;
+    }
+    TEST_ASSERT(n == 4U, "split all fields");
+
+    /* Two iterators over the same buffer do not interfere */
+    (void)chaos_strview_split_init(&outer, &line, &delims, CHAOS_TRUE);
+    (void)chaos_strview_split_init(&inner, &line, &delims, CHAOS_TRUE);
+    (void)chaos_strview_split_next(&outer, &tok, &found);
+    (void)chaos_strview_split_next(&inner, &tok, &found);
+    (void)chaos_strview_split_next(&inner, &tok, &found);
+    TEST_ASSERT(view_is(&tok, "b"), "inner iterator independent");
+    (void)chaos_strview_split_next(&outer, &tok, &found);
+    TEST_ASSERT(view_is(&tok, "b"), "outer iterator independent");
+
+    line = sv("");
+    (void)chaos_strview_split_init(&outer, &line, &delims, CHAOS_TRUE);
+    TEST_ASSERT((chaos_strview_split_next(&outer, &tok, &found) == CHAOS_STATUS_OK) && (found == CHAOS_FALSE), "tokenize empty input");
+
+    TEST_PASS("strview split (re-entrant)");
+}
+
+static int test_strview_invalid(void)
+{
+    chaos_strview_t v = sv("abc");
+    chaos_strview_t bad = {NULL, 3U};
+    chaos_bool_t flag = CHAOS_FALSE;
+
+    TEST_ASSERT(chaos_strview_from_cstr(&v, NULL) != CHAOS_STATUS_OK, "from_cstr NULL");
+    TEST_ASSERT(chaos_strview_equal(&v, &bad, &flag) != CHAOS_STATUS_OK, "NULL data with length");
+    TEST_ASSERT(chaos_strview_trim(&v, NULL) != CHAOS_STATUS_OK, "trim NULL out");
+
+    TEST_PASS("strview invalid parameters");
+}
+
+/* -------------------------------------------------------------------------- */
+/* Runner                                                                      */
+/* -------------------------------------------------------------------------- */
+
+int main(void)
+{
+    int failures = 0;
+
+    failures += test_strview_basics();
+    failures += test_strview_tokenize();
+    failures += test_strview_split();
+    failures += test_strview_invalid();
+
+    if (failures == 0)
+    {
+        printf("\nAll chaos_strview tests passed \n");
+        return 0;
+    }
+
+    printf("\n%d test(s) failed \n", failures);
+    return 1;
+}
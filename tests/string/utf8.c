@@ -0,0 +1,308 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "chaos_utf8.h"
+#include "chaos_test.h"
+
+/* -------------------------------------------------------------------------- */
+/* Helpers                                                                     */
+/* -------------------------------------------------------------------------- */
+
+/* Reference: decode code points and check ranges (independent of the library) */
+static chaos_size_t ref_valid_prefix(const unsigned char *s, chaos_size_t size)
+{
+    chaos_size_t i = 0U;
+    chaos_size_t n;
+    chaos_size_t k;
+    unsigned long cp;
+    unsigned long min;
+
+    while (i < size)
+    {
+        if (s[i] < 0x80U)
+        {
+            i++;
+            continue;
+        }
+        if ((s[i] & 0xE0U) == 0xC0U)
+        {
+            n = 2U;
+            cp = s[i] & 0x1FU;
+            min = 0x80UL;
+        }
+        else if ((s[i] & 0xF0U) == 0xE0U)
+        {
+            n = 3U;
+            cp = s[i] & 0x0FU;
+            min = 0x800UL;
+        }
+        else if ((s[i] & 0xF8U) == 0xF0U)
+        {
+            n = 4U;
+            cp = s[i] & 0x07U;
+            min = 0x10000UL;
+        }
+        else
+        {
+            return i;
+        }
+        if ((size - i) < n)
+        {
+            return i;
+        }
+        for (k = 1U; k < n; k++)
+        {
+            if ((s[i + k] & 0xC0U) != 0x80U)
+            {
+                return i;
+            }
+            cp = (cp << 6U) | (s[i + k] & 0x3FU);
+        }
+        if ((cp < min) || (cp > 0x10FFFFUL) || ((cp >= 0xD800UL) && (cp <= 0xDFFFUL)))
+        {
+            return i;
+        }
+        i += n;
+    }
+    return i;
+}
+
+static int check(const unsigned char *s, chaos_size_t size)
+{
+    chaos_bool_t valid = CHAOS_FALSE;
+    chaos_size_t offset = 0xFFFFFFFFU;
+    chaos_size_t ref = ref_valid_prefix(s, size);
+
+    if (chaos_utf8_validate(s, size, &valid, &offset) != CHAOS_STATUS_OK)
+    {
+        return 0;
+    }
+    return (offset == ref) && (valid == ((ref == size) ? CHAOS_TRUE : CHAOS_FALSE));
+}
+
+/* -------------------------------------------------------------------------- */
+/* Tests                                                                       */
+/* -------------------------------------------------------------------------- */
+
+static int test_utf8_valid(void)
+{
+    static const char *const texts[] = {
+        "",
+        "plain ascii text that spans more than one vector block of input....",
+        "caf\xC3\xA9 na\xC3\xAFve r\xC3\xA9sum\xC3\xA9",
+        "\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82 \xD0\xBC\xD0\xB8\xD1\x80",
+        "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E\xE3\x81\xAE\xE3\x83\x86\xE3\x82\xAD\xE3\x82\xB9\xE3\x83\x88",
+        "emoji \xF0\x9F\x98\x80\xF0\x9F\x8E\x89 and \xF4\x8F\xBF\xBF max",
+        "\xC2\x80\xDF\xBF\xE0\xA0\x80\xED\x9F\xBF\xEE\x80\x80\xEF\xBF\xBF\xF0\x90\x80\x80",
+    };
+    chaos_bool_t valid = CHAOS_FALSE;
+    chaos_size_t offset = 0U;
+    chaos_size_t i;
+    chaos_size_t len;
+
+    for (i = 0U; i < (sizeof(texts) / sizeof(texts[0])); i++)
+    {
+        len = (chaos_size_t)strlen(texts[i]);
+        TEST_ASSERT(chaos_utf8_validate((const chaos_char_t *)texts[i], len, &valid, &offset) == CHAOS_STATUS_OK, "validate status");
+        TEST_ASSERT((valid == CHAOS_TRUE) && (offset == len), "well-formed text accepted");
+    }
+
+    TEST_ASSERT(chaos_utf8_validate(CHAOS_NULL, 0U, &valid, CHAOS_NULL) == CHAOS_STATUS_OK, "empty NULL buffer");
+    TEST_ASSERT(valid == CHAOS_TRUE, "empty buffer is valid");
+
+    TEST_PASS("utf8 well-formed input");
+}
+
+static int test_utf8_invalid(void)
+{
+    static const struct
+    {
+        const char *text;
+        chaos_size_t offset;
+    } cases[] = {
+        { "ab\x80", 2U },                        /* stray continuation */
+        { "ab\xC0\xAF", 2U },                    /* overlong 2 */
+        { "ab\xC1\xBF", 2U },                    /* overlong 2 */
+        { "\xE0\x9F\xBF", 0U },                  /* overlong 3 */
+        { "x\xF0\x8F\xBF\xBF", 1U },             /* overlong 4 */
+        { "\xED\xA0\x80", 0U },                  /* surrogate */
+        { "ok\xED\xBF\xBF", 2U },                /* surrogate */
+        { "\xF4\x90\x80\x80", 0U },              /* above U+10FFFF */
+        { "\xF5\x80\x80\x80", 0U },              /* bad lead */
+        { "\xFF", 0U },                          /* bad lead */
+        { "abc\xC3", 3U },                       /* truncated at end */
+        { "abc\xE2\x82", 3U },                   /* truncated at end */
+        { "abc\xF0\x9F\x98", 3U },               /* truncated at end */
+        { "\xC3(", 0U },                         /* missing continuation */
+        { "\xE2\x82(", 0U },                     /* missing continuation */
+        { "\xC3\xA9\xA9", 2U },                  /* too many continuations */
+        { "\xF0\x9F\x98\x80\x80", 4U },          /* too many continuations */
+    };
+    chaos_bool_t valid = CHAOS_TRUE;
+    chaos_size_t offset = 0U;
+    chaos_size_t i;
+
+    for (i = 0U; i < (sizeof(cases) / sizeof(cases[0])); i++)
+    {
+        TEST_ASSERT(chaos_utf8_validate((const chaos_char_t *)cases[i].text, (chaos_size_t)strlen(cases[i].text), &valid, &offset) == CHAOS_STATUS_OK, "validate status");
+        TEST_ASSERT(valid == CHAOS_FALSE, "malformed text rejected");
+        TEST_ASSERT(offset == cases[i].offset, "offset of first bad sequence");
+    }
+
+    TEST_PASS("utf8 malformed input");
+}
+
+/* Every 1 and 2 byte input, and sequences straddling a vector boundary */
+static int test_utf8_exhaustive(void)
+{
+    unsigned char buf[80];
+    chaos_size_t a;
+    chaos_size_t b;
+    chaos_size_t pos;
+    chaos_size_t i;
+
+    for (a = 0U; a < 256U; a++)
+    {
+        buf[0] = (unsigned char)a;
+        TEST_ASSERT(check(buf, 1U), "single byte");
+        for (b = 0U; b < 256U; b++)
+        {
+            buf[1] = (unsigned char)b;
+            TEST_ASSERT(check(buf, 2U), "byte pair");
+        }
+    }
+
+    /* Every lead with every second byte and two fixed continuations, placed across the 16 and 32 byte edges */
+    memset(buf, 'a', sizeof(buf));
+    for (pos = 10U; pos < 36U; pos++)
+    {
+        for (a = 0x80U; a < 256U; a++)
+        {
+            for (b = 0U; b < 256U; b += 1U)
+            {
+                memset(buf, 'a', sizeof(buf));
+                buf[pos] = (unsigned char)a;
+                buf[pos + 1U] = (unsigned char)b;
+                buf[pos + 2U] = 0x80U;
+                buf[pos + 3U] = 0xBFU;
+                TEST_ASSERT(check(buf, 64U), "sequence at boundary");
+                TEST_ASSERT(check(buf, (chaos_size_t)(pos + 2U)), "sequence truncated by the end");
+            }
+        }
+    }
+
+    /* ASCII prefix of every length before a multi-byte run */
+    for (i = 0U; i < 70U; i++)
+    {
+        memset(buf, 'a', sizeof(buf));
+        memcpy(&buf[i], "\xE2\x82\xAC", 3U);
+        TEST_ASSERT(check(buf, (chaos_size_t)(i + 3U)), "ascii run then euro sign");
+        TEST_ASSERT(check(buf, (chaos_size_t)(i + 2U)), "ascii run then truncated euro sign");
+    }
+
+    TEST_PASS("utf8 exhaustive pairs and block boundaries");
+}
+
+/* Random mixes of valid code points with occasional corruption */
+static int test_utf8_random(void)
+{
+    static const unsigned char pieces[][4] = {
+        { 'a' }, { 0xC3U, 0xA9U }, { 0xE2U, 0x82U, 0xACU }, { 0xF0U, 0x9FU, 0x98U, 0x80U }, { 0x7FU },
+    };
+    static const chaos_size_t piece_len[] = { 1U, 2U, 3U, 4U, 1U };
+    unsigned char buf[300];
+    chaos_size_t len;
+    chaos_size_t p;
+    chaos_size_t iter;
+
+    srand(43);
+    for (iter = 0U; iter < 20000U; iter++)
+    {
+        len = 0U;
+        while (len < 280U)
+        {
+            p = (chaos_size_t)rand() % 5U;
+            if ((rand() % 4) == 0)
+            {
+                p = 0U;
+            }
+            memcpy(&buf[len], pieces[p], piece_len[p]);
+            len += piece_len[p];
+        }
+        len = (chaos_size_t)rand() % len;
+        if ((iter % 2U) == 0U && (len != 0U))
+        {
+            buf[(chaos_size_t)rand() % len] = (unsigned char)rand();
+        }
+        TEST_ASSERT(check(buf, len), "random text vs reference");
+    }
+
+    TEST_PASS("utf8 random text vs reference decoder");
+}
+
+static int test_utf8_count(void)
+{
+    static const char text[] = "caf\xC3\xA9 \xE6\x97\xA5\xE6\x9C\xAC \xF0\x9F\x98\x80!";
+    unsigned char buf[200];
+    chaos_size_t count = 0U;
+    chaos_size_t i;
+    chaos_size_t n;
+
+    TEST_ASSERT(chaos_utf8_count((const chaos_char_t *)text, (chaos_size_t)(sizeof(text) - 1U), &count) == CHAOS_STATUS_OK, "count status");
+    TEST_ASSERT(count == 10U, "code points of mixed text");
+
+    TEST_ASSERT(chaos_utf8_count(CHAOS_NULL, 0U, &count) == CHAOS_STATUS_OK, "empty count");
+    TEST_ASSERT(count == 0U, "empty count is zero");
+
+    /* Every length, so each of the vector, word and byte loops ends the count */
+    for (i = 0U; i < 50U; i++)
+    {
+        memcpy(&buf[i * 4U], "\xF0\x9F\x98\x80", 4U);
+    }
+    for (n = 0U; n <= 200U; n++)
+    {
+        TEST_ASSERT(chaos_utf8_count(buf, n, &count) == CHAOS_STATUS_OK, "count status");
+        TEST_ASSERT(count == ((n + 3U) / 4U), "count of emoji prefix");
+    }
+
+    TEST_PASS("utf8 code point count");
+}
+
+static int test_utf8_errors(void)
+{
+    chaos_bool_t valid;
+    chaos_size_t count;
+
+    TEST_ASSERT(chaos_utf8_validate((const chaos_char_t *)"a", 1U, CHAOS_NULL, CHAOS_NULL) != CHAOS_STATUS_OK, "NULL valid");
+    TEST_ASSERT(chaos_utf8_validate(CHAOS_NULL, 1U, &valid, CHAOS_NULL) != CHAOS_STATUS_OK, "NULL buffer");
+    TEST_ASSERT(chaos_utf8_count((const chaos_char_t *)"a", 1U, CHAOS_NULL) != CHAOS_STATUS_OK, "NULL count");
+    TEST_ASSERT(chaos_utf8_count(CHAOS_NULL, 1U, &count) != CHAOS_STATUS_OK, "NULL count buffer");
+
+    TEST_PASS("utf8 argument errors");
+}
+
+/* -------------------------------------------------------------------------- */
+/* Runner                                                                      */
+/* -------------------------------------------------------------------------- */
+
+int main(void)
+{
+    int failures = 0;
+
+    failures += test_utf8_valid();
+    failures += test_utf8_invalid();
+    failures += test_utf8_exhaustive();
+    failures += test_utf8_random();
+    failures += test_utf8_count();
+    failures += test_utf8_errors();
+
+    if (failures == 0)
+    {
+        printf("\nAll chaos_utf8 tests passed \n");
+        return 0;
+    }
+
+    printf("\n%d test(s) failed \n", failures);
+    return 1;
+}
@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+"""Generate chaos_checksum/src/chaos_crc_tables.c.
+
+Table 0 holds the bit-at-a-time CRC of each byte value for the reflected
+polynomial; table k holds the contribution of a byte followed by k zero
+bytes, T[k][b] = (T[k-1][b] >> 8) ^ T[0][T[k-1][b] & 0xFF].
+
+Usage: python3 tools/gen_crc_tables.py [output]   (default: stdout)
+"""
+
+import sys
+
+CRCS = [
+    ("chaos_crc32_table", "CRC-32 (IEEE 802.3)", 0xEDB88320),
+    ("chaos_crc32c_table", "CRC-32C (Castagnoli)", 0x82F63B78),
+]
+
+SLICES = 8
+PER_LINE = 6
+
+HEADER = """\
+/**
+ * @file chaos_crc_tables.c
+ * @brief Constant lookup tables for the table-driven CRC kernels.
+ *
+ * Table k maps a byte to its CRC contribution when it is followed by
+ * k zero bytes, which lets the kernel fold 8 input bytes per step.
+ * Generated by tools/gen_crc_tables.py; do not edit by hand.
+ */
+
+#include "chaos_crc_tables.h"
+"""
+
+
+def slicing_tables(poly):
+    """The SLICES tables of 256 entries for one reflected polynomial."""
+    base = []
+    for b in range(256):
+        crc = b
+        for _ in range(8):
+            crc = (crc >> 1) ^ poly if crc & 1 else crc >> 1
+        base.append(crc)
+    tables = [base]
+    for _ in range(1, SLICES):
+        prev = tables[-1]
+        tables.append([(v >> 8) ^ base[v & 0xFF] for v in prev])
+    return tables
+
+
+def main():
+    lines = [HEADER]
+    for name, title, poly in CRCS:
+        lines.append("\n/**\n * @brief Slicing-by-8 tables for %s (reflected polynomial 0x%08XU).\n */\n"
+                     % (title, poly))
+        lines.append("const chaos_u32_t %s[8][256] =\n{\n" % name)
+        tables = slicing_tables(poly)
+        for k, table in enumerate(tables):
+            lines.append("    {\n")
+            rows = [table[i:i + PER_LINE] for i in range(0, 256, PER_LINE)]
+            for r, row in enumerate(rows):
+                sep = "," if r != len(rows) - 1 else ""
+                lines.append("        " + ", ".join("0x%08XU" % v for v in row) + sep + "\n")
+            lines.append("    }%s\n" % ("," if k != SLICES - 1 else ""))
+        lines.append("};\n")
+    text = "".join(lines).replace("\n", "\r\n")
+
+    if len(sys.argv) > 1:
+        with open(sys.argv[1], "w", newline="") as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+"""Generate chaos_std/src/chaos_std_tables.c.
+
+Each entry is floor(5^q * 2^s), with s chosen so that the result has exactly
+128 bits, for q = POW5_MIN..POW5_MAX (CHAOS_STD_POW5_MIN/MAX in
+chaos_std_internal.h). Python integers are arbitrary precision, so every
+entry is exact.
+
+Usage: python3 tools/gen_std_tables.py [output]   (default: stdout)
+"""
+
+import sys
+
+POW5_MIN = -342
+POW5_MAX = 324
+
+HEADER = """\
+/**
+ * @file chaos_std_tables.c
+ * @brief Constant tables for the floating-point conversions.
+ *
+ * Each entry is floor(5^q * 2^s), with s chosen so that the result has
+ * exactly 128 bits. Both directions of the conversion scale by these
+ * mantissas and take the power of two from floor(q * log2(10)).
+ * Generated by tools/gen_std_tables.py; do not edit by hand.
+ */
+
+#include "chaos_std_internal.h"
+
+#if defined(CHAOS_ENABLE_INT64) && (CHAOS_ENABLE_INT64 == 1)
+
+/**
+ * @brief Normalised 128-bit powers of five, 5^%d to 5^%d.
+ */
+const chaos_u64_t chaos_std_pow5[(CHAOS_STD_POW5_MAX - CHAOS_STD_POW5_MIN) + 1][2] =
+{
+"""
+
+FOOTER = """\
+};
+
+#endif /* CHAOS_ENABLE_INT64 */
+"""
+
+
+def pow5_mantissa(q):
+    """floor(5^q * 2^s) with the result in [2^127, 2^128)."""
+    if q >= 0:
+        p = 5 ** q
+        s = 128 - p.bit_length()
+        m = (p << s) if s >= 0 else (p >> -s)
+    else:
+        d = 5 ** -q
+        # 2^(bit_length - 1) <= d < 2^bit_length puts 2^s / d in [2^127, 2^128)
+        s = 127 + d.bit_length()
+        m = (1 << s) // d
+    assert m.bit_length() == 128
+    return m
+
+
+def main():
+    lines = [HEADER % (POW5_MIN, POW5_MAX)]
+    for q in range(POW5_MIN, POW5_MAX + 1):
+        m = pow5_mantissa(q)
+        sep = "," if q != POW5_MAX else " "
+        lines.append("    { 0x%016XULL, 0x%016XULL }%s /* 5^%d */\n"
+                     % (m >> 64, m & ((1 << 64) - 1), sep, q))
+    lines.append(FOOTER)
+    text = "".join(lines).replace("\n", "\r\n")
+
+    if len(sys.argv) > 1:
+        with open(sys.argv[1], "w", newline="") as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+
+
+if __name__ == "__main__":
+    main()